@@ -36,6 +36,8 @@
 
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
+#include <Collections/SumFacKernels.h>
+#include <Collections/SumFacSIMD.h>
 
 using namespace std;
 
@@ -409,6 +411,13 @@ class BwdTrans_SumFac_Quad : public Operator
         {
             boost::ignore_unused(output1, output2);
 
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(), nullptr,
+                         input.get(), output.get());
+                return;
+            }
+
             int i = 0;
             if(m_colldir0 && m_colldir1)
             {
@@ -476,6 +485,7 @@ class BwdTrans_SumFac_Quad : public Operator
         const bool                      m_colldir1;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
+        SumFacBwdTransKernel            m_kernel;
 
     private:
         BwdTrans_SumFac_Quad(
@@ -489,7 +499,8 @@ class BwdTrans_SumFac_Quad : public Operator
               m_colldir0(m_stdExp->GetBasis(0)->Collocation()),
               m_colldir1(m_stdExp->GetBasis(1)->Collocation()),
               m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
-              m_base1   (m_stdExp->GetBasis(1)->GetBdata())
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_kernel  (GetSumFacBwdTransKernel(m_stdExp))
         {
             m_wspSize = m_nquad0*m_nmodes1*m_numElmt;
         }
@@ -629,7 +640,12 @@ class BwdTrans_SumFac_Hex : public Operator
         {
             boost::ignore_unused(output1, output2);
 
-            if(m_colldir0 && m_colldir1 && m_colldir2)
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         m_base2.get(), input.get(), output.get());
+            }
+            else if(m_colldir0 && m_colldir1 && m_colldir2)
             {
                 Vmath::Vcopy(m_numElmt * m_nmodes0 * m_nmodes1 * m_nmodes2,
                              input.get(),  1,
@@ -692,6 +708,7 @@ class BwdTrans_SumFac_Hex : public Operator
         const bool                      m_colldir0;
         const bool                      m_colldir1;
         const bool                      m_colldir2;
+        SumFacBwdTransKernel            m_kernel;
 
     private:
         BwdTrans_SumFac_Hex(
@@ -709,7 +726,8 @@ class BwdTrans_SumFac_Hex : public Operator
               m_base2   (pCollExp[0]->GetBasis(2)->GetBdata()),
               m_colldir0(pCollExp[0]->GetBasis(0)->Collocation()),
               m_colldir1(pCollExp[0]->GetBasis(1)->Collocation()),
-              m_colldir2(pCollExp[0]->GetBasis(2)->Collocation())
+              m_colldir2(pCollExp[0]->GetBasis(2)->Collocation()),
+              m_kernel  (GetSumFacBwdTransKernel(m_stdExp))
         {
             m_wspSize =  m_numElmt*m_nmodes0*(m_nmodes1*m_nquad2 +
                                               m_nquad1*m_nquad2);
@@ -1209,6 +1227,122 @@ OperatorKey BwdTrans_SumFac_Pyr::m_type = GetOperatorFactory().
         OperatorKey(ePyramid, eBwdTrans, eSumFac,false),
         BwdTrans_SumFac_Pyr::create, "BwdTrans_SumFac_Pyr");
 
+/**
+ * @brief Backward transform operator using sum-factorisation on blocks of
+ * #SIMD_WIDTH interleaved elements (Seg, Quad and Hex).
+ *
+ * Coefficients of each block are interleaved once on entry, all tensor
+ * directions are then applied with every basis entry reused across the
+ * lanes of the block, and the result is deinterleaved into the output.
+ */
+class BwdTrans_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(BwdTrans_SumFacSIMD)
+
+        virtual ~BwdTrans_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            ASSERTL1(wsp.size() == m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nblocks = SIMDNumBlocks(m_numElmt);
+            NekDouble *buf[2] = { wsp.get(), wsp.get() + m_bufSize };
+
+            for (int b = 0; b < nblocks; ++b)
+            {
+                const int nelmt = min(SIMD_WIDTH,
+                                      int(m_numElmt) - b*SIMD_WIDTH);
+                const int el0   = b*SIMD_WIDTH;
+
+                SIMDInterleave(m_ncoeffs, nelmt,
+                               input.get() + el0*m_ncoeffs, buf[0]);
+
+                // Transform one direction at a time, ping-ponging between
+                // the two block buffers.
+                int nbefore = 1;
+                int nafter  = m_ncoeffs;
+                int cur     = 0;
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    nafter /= m_nmodes[d];
+                    SIMDTensorContract(false, m_nmodes[d], m_nquad[d],
+                                       nbefore, nafter, m_base[d].get(),
+                                       buf[cur], buf[1-cur]);
+                    nbefore *= m_nquad[d];
+                    cur      = 1 - cur;
+                }
+
+                SIMDDeinterleave(m_nqtot, nelmt, buf[cur],
+                                 output.get() + el0*m_nqtot);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            ASSERTL0(false, "Not valid for this operator.");
+        }
+
+    protected:
+        const int                                m_dim;
+        const int                                m_ncoeffs;
+        const int                                m_nqtot;
+        int                                      m_bufSize;
+        vector<int>                              m_nmodes;
+        vector<int>                              m_nquad;
+        vector<Array<OneD, const NekDouble> >    m_base;
+
+    private:
+        BwdTrans_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_dim     (m_stdExp->GetShapeDimension()),
+              m_ncoeffs (m_stdExp->GetNcoeffs()),
+              m_nqtot   (m_stdExp->GetTotPoints())
+        {
+            int maxsize = 1;
+            for (int d = 0; d < m_dim; ++d)
+            {
+                m_nmodes.push_back(m_stdExp->GetBasisNumModes(d));
+                m_nquad .push_back(m_stdExp->GetNumPoints(d));
+                m_base  .push_back(m_stdExp->GetBasis(d)->GetBdata());
+                maxsize *= max(m_nmodes[d], m_nquad[d]);
+            }
+
+            m_bufSize = maxsize*SIMD_WIDTH;
+            m_wspSize = 2*m_bufSize;
+        }
+};
+
+/// Factory initialisation for the BwdTrans_SumFacSIMD operators
+OperatorKey BwdTrans_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eBwdTrans, eSumFacSIMD,false),
+        BwdTrans_SumFacSIMD::create, "BwdTrans_SumFacSIMD_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eBwdTrans, eSumFacSIMD,false),
+        BwdTrans_SumFacSIMD::create, "BwdTrans_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eBwdTrans, eSumFacSIMD,false),
+        BwdTrans_SumFacSIMD::create, "BwdTrans_SumFacSIMD_Hex")
+};
+
 }
 
 }
@@ -50,6 +50,29 @@ CoalescedGeomData::~CoalescedGeomData(void)
 {
 }
 
+/**
+ * @brief Return whether any element of the collection is deformed.
+ *
+ * If not, the Jacobian and derivative factors are constant within each
+ * element and GetJac and GetDerivFactors store a single value per element.
+ */
+bool CoalescedGeomData::IsDeformed(
+        vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
+{
+    for (int i = 0; i < pCollExp.size(); ++i)
+    {
+        const LocalRegions::Expansion *lep =
+            dynamic_cast<const LocalRegions::Expansion*>(pCollExp[i].get());
+
+        if (lep->GetMetricInfo()->GetGtype() == SpatialDomains::eDeformed)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 const Array<OneD, const NekDouble> &CoalescedGeomData::GetJac(
         vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
 {
@@ -60,11 +83,15 @@ const Array<OneD, const NekDouble> &CoalescedGeomData::GetJac(
         LibUtilities::PointsKeyVector ptsKeys = pCollExp[0]->GetPointsKeys();
         int nElmts = pCollExp.size();
 
-        // set up Cached Jacobians to be continuous
+        // set up Cached Jacobians to be continuous, with a single value per
+        // element if none is deformed
         int npts = 1;
-        for (int i = 0; i < ptsKeys.size(); ++i)
+        if (IsDeformed(pCollExp))
         {
-            npts   *= ptsKeys[i].GetNumPoints();
+            for (int i = 0; i < ptsKeys.size(); ++i)
+            {
+                npts   *= ptsKeys[i].GetNumPoints();
+            }
         }
 
 
@@ -158,11 +185,15 @@ const Array<TwoD, const NekDouble> &CoalescedGeomData::GetDerivFactors(
         const int coordim = pCollExp[0]->GetCoordim();
         int dim = ptsKeys.size();
 
-        // set up Cached Jacobians to be continuous
+        // set up Cached Jacobians to be continuous, with a single value per
+        // element if none is deformed
         int npts = 1;
-        for (int i = 0; i < dim; ++i)
+        if (IsDeformed(pCollExp))
         {
-            npts   *= ptsKeys[i].GetNumPoints();
+            for (int i = 0; i < dim; ++i)
+            {
+                npts   *= ptsKeys[i].GetNumPoints();
+            }
         }
 
 
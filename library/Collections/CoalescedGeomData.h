@@ -57,6 +57,9 @@ class CoalescedGeomData
 
         virtual ~CoalescedGeomData(void);
 
+        bool IsDeformed(
+                std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
+
         const Array<OneD, const NekDouble> &GetJac(
                 std::vector<StdRegions::StdExpansionSharedPtr> &pColLExp);
 
@@ -73,6 +76,64 @@ class CoalescedGeomData
 
 typedef std::shared_ptr<CoalescedGeomData>   CoalescedGeomDataSharedPtr;
 
+/**
+ * @brief Multiply \a in by the geometric factor \a fac of a collection of
+ * \a nElmt elements and \a n points in total, storing the result in
+ * \a out.
+ *
+ * If the collection is not deformed the factor holds one value per element,
+ * as returned by CoalescedGeomData::GetJac and
+ * CoalescedGeomData::GetDerivFactors, and one value per point otherwise.
+ */
+template<typename TFac>
+inline void GeomVmul(
+        const int                           n,
+        const int                           nElmt,
+        const bool                          deformed,
+        const TFac                         &fac,
+        const Array<OneD, const NekDouble> &in,
+              Array<OneD,       NekDouble> &out)
+{
+    if (deformed)
+    {
+        Vmath::Vmul(n, &fac[0], 1, &in[0], 1, &out[0], 1);
+        return;
+    }
+
+    const int nq = n/nElmt;
+    for (int e = 0; e < nElmt; ++e)
+    {
+        Vmath::Smul(nq, fac[e], &in[e*nq], 1, &out[e*nq], 1);
+    }
+}
+
+/**
+ * @brief Add the product of \a in and the geometric factor \a fac to
+ * \a out, with \a fac stored as in GeomVmul.
+ */
+template<typename TFac>
+inline void GeomVvtvp(
+        const int                           n,
+        const int                           nElmt,
+        const bool                          deformed,
+        const TFac                         &fac,
+        const Array<OneD, const NekDouble> &in,
+              Array<OneD,       NekDouble> &out)
+{
+    if (deformed)
+    {
+        Vmath::Vvtvp(n, &fac[0], 1, &in[0], 1, &out[0], 1, &out[0], 1);
+        return;
+    }
+
+    const int nq = n/nElmt;
+    for (int e = 0; e < nElmt; ++e)
+    {
+        Vmath::Svtvp(nq, fac[e], &in[e*nq], 1, &out[e*nq], 1,
+                     &out[e*nq], 1);
+    }
+}
+
 static CoalescedGeomDataSharedPtr GeomDataNull;
 
 }
@@ -41,11 +41,15 @@ namespace Nektar {
 namespace Collections {
 
 /**
- *
+ * Resolves the operator key of every operator type in \a impTypes. The
+ * operators themselves are only constructed by #Initialise when first
+ * used, so that operators which are never applied, such as the Helmholtz
+ * operator of an explicit solver, take no memory.
  */
 Collection::Collection(
         vector<StdRegions::StdExpansionSharedPtr>    pCollExp,
         OperatorImpMap                              &impTypes)
+    : m_collExp(pCollExp)
 {
     // Initialise geometry data.
     m_geomData = MemoryManager<CoalescedGeomData>::AllocateSharedPtr();
@@ -63,17 +67,46 @@ Collection::Collection(
             OperatorKey opKey(pCollExp[0]->DetShapeType(), opType, impType,
                               pCollExp[0]->IsNodalNonTensorialExp());
 
+            // The interleaved kernels only cover a subset of operators and
+            // shapes, so fall back to the standard sum-factorisation.
+            if (impType == eSumFacSIMD &&
+                !GetOperatorFactory().ModuleExists(opKey))
+            {
+                opKey = OperatorKey(pCollExp[0]->DetShapeType(), opType,
+                                    eSumFac,
+                                    pCollExp[0]->IsNodalNonTensorialExp());
+            }
+
             stringstream ss;
             ss << opKey;
             ASSERTL0(GetOperatorFactory().ModuleExists(opKey),
                  "Requested unknown operator "+ss.str());
 
-            m_ops[opType] = GetOperatorFactory().CreateInstance(
-                                                opKey, pCollExp, m_geomData);
+            m_opKeys.insert(std::make_pair(opType, opKey));
         }
     }
 }
 
+/**
+ * Constructs the operator \a opType if it has not been constructed yet.
+ * Collection::ApplyOperator calls this on first use. Callers evaluating
+ * collections concurrently should call it beforehand, since operator
+ * construction is not thread-safe.
+ */
+void Collection::Initialise(const OperatorType opType)
+{
+    if (m_ops.find(opType) != m_ops.end())
+    {
+        return;
+    }
+
+    auto it = m_opKeys.find(opType);
+    ASSERTL0(it != m_opKeys.end(), "Operator not defined for collection.");
+
+    m_ops[opType] = GetOperatorFactory().CreateInstance(
+                                        it->second, m_collExp, m_geomData);
+}
+
 }
 }
 
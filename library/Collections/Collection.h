@@ -84,9 +84,26 @@ class Collection
 
         inline bool HasOperator(const OperatorType &op);
 
+        inline int GetNumElmt() const
+        {
+            return m_collExp.size();
+        }
+
+        COLLECTIONS_EXPORT void Initialise(const OperatorType opType);
+
+        inline void UpdateFactors(
+                const OperatorType                           &op,
+                const StdRegions::ConstFactorMap             &factors);
+
+        inline void UpdateVarCoeffs(
+                const OperatorType                           &op,
+                const StdRegions::VarCoeffMap                &varcoeffs);
+
     protected:
         StdRegions::StdExpansionSharedPtr                             m_stdExp;
+        std::vector<StdRegions::StdExpansionSharedPtr>                m_collExp;
         std::vector<SpatialDomains::GeometrySharedPtr>                m_geom;
+        std::unordered_map<OperatorType, OperatorKey, EnumHash>       m_opKeys;
         std::unordered_map<OperatorType, OperatorSharedPtr, EnumHash> m_ops;
         CoalescedGeomDataSharedPtr                                    m_geomData;
 
@@ -104,6 +121,7 @@ inline void Collection::ApplyOperator(
         const Array<OneD, const NekDouble> &inarray,
               Array<OneD,       NekDouble> &output)
 {
+    Initialise(op);
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output, NullNekDouble1DArray,
                  NullNekDouble1DArray, wsp);
@@ -119,6 +137,7 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output0,
               Array<OneD,       NekDouble> &output1)
 {
+    Initialise(op);
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output0, output1, NullNekDouble1DArray, wsp);
 }
@@ -134,6 +153,7 @@ inline void Collection::ApplyOperator(
               Array<OneD,       NekDouble> &output1,
               Array<OneD,       NekDouble> &output2)
 {
+    Initialise(op);
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(inarray, output0, output1, output2, wsp);
 }
@@ -147,13 +167,36 @@ inline void Collection::ApplyOperator(
         const Array<OneD, const NekDouble> &inarray,
               Array<OneD,       NekDouble> &output)
 {
+    Initialise(op);
     Array<OneD, NekDouble> wsp(m_ops[op]->GetWspSize());
     (*m_ops[op])(dir, inarray, output, wsp);
 }
 
 inline bool Collection::HasOperator(const OperatorType &op)
 {
-    return (m_ops.find(op) != m_ops.end());
+    return (m_opKeys.find(op) != m_opKeys.end());
+}
+
+/**
+ *
+ */
+inline void Collection::UpdateFactors(
+        const OperatorType                 &op,
+        const StdRegions::ConstFactorMap   &factors)
+{
+    Initialise(op);
+    m_ops[op]->UpdateFactors(factors);
+}
+
+/**
+ *
+ */
+inline void Collection::UpdateVarCoeffs(
+        const OperatorType                 &op,
+        const StdRegions::VarCoeffMap      &varcoeffs)
+{
+    Initialise(op);
+    m_ops[op]->UpdateVarCoeffs(varcoeffs);
 }
 
 }
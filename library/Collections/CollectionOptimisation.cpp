@@ -32,13 +32,22 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <boost/core/ignore_unused.hpp>
+#include <fstream>
+#include <functional>
+#include <set>
+
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
 
 #include <Collections/CollectionOptimisation.h>
+#include <LibUtilities/BasicConst/GitRevision.h>
 #include <LibUtilities/BasicUtils/ParseUtils.h>
 #include <LibUtilities/BasicUtils/Timer.h>
 
+#ifndef NEKTAR_VERSION
+#define NEKTAR_VERSION "Unknown"
+#endif
+
 using namespace std;
 
 namespace Nektar
@@ -46,8 +55,46 @@ namespace Nektar
 namespace Collections
 {
 
-// static manager for Operator ImplementationMap
-map<OpImpTimingKey,OperatorImpMap> CollectionOptimisation::m_opImpMap;
+// autotuning cache shared by all instances
+map<string, OperatorImpMap> CollectionOptimisation::m_cacheMap;
+string CollectionOptimisation::m_cacheFile;
+bool CollectionOptimisation::m_cacheLoaded = false;
+
+/**
+ * @brief Return a description of the processor, used to invalidate the
+ * autotuning cache when moving to a different machine.
+ */
+static string GetCpuModel()
+{
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line))
+    {
+        if (boost::starts_with(line, "model name"))
+        {
+            size_t pos = line.find(':');
+            if (pos != string::npos)
+            {
+                line = line.substr(pos + 1);
+                boost::trim(line);
+                return line;
+            }
+        }
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Return a description of this build, used to invalidate the
+ * autotuning cache when the operator implementations change.
+ */
+static string GetBuildId()
+{
+    LibUtilities::GitConsts git;
+    string sha1 = git.GetSha1();
+    return string(NEKTAR_VERSION) + " " +
+        (sha1.empty() ? string(__DATE__ " " __TIME__) : sha1);
+}
 
 CollectionOptimisation::CollectionOptimisation(
         LibUtilities::SessionReaderSharedPtr pSession,
@@ -62,6 +109,7 @@ CollectionOptimisation::CollectionOptimisation(
     m_setByXml    = false;
     m_autotune    = false;
     m_maxCollSize = 0;
+    m_numThreads  = 1;
     m_defaultType = defaultType == eNoImpType ? eIterPerExp : defaultType;
 
     map<string, LibUtilities::ShapeType> elTypes;
@@ -137,6 +185,13 @@ CollectionOptimisation::CollectionOptimisation(
             const char *maxSize = xmlCol->Attribute("MAXSIZE");
             m_maxCollSize = (maxSize ? atoi(maxSize) : 0);
 
+            // Set the number of threads used to evaluate collections
+            const char *numThreads = xmlCol->Attribute("NUMTHREADS");
+            int nThreads = (numThreads ? atoi(numThreads) : 1);
+            ASSERTL0(nThreads > 0,
+                     "NUMTHREADS in COLLECTIONS tag must be positive.");
+            m_numThreads = nThreads;
+
             const char *defaultImpl = xmlCol->Attribute("DEFAULT");
             m_defaultType = defaultType;
 
@@ -176,6 +231,13 @@ CollectionOptimisation::CollectionOptimisation(
                 }
             }
 
+            // Read previous autotuning results if a cache file is given
+            const char *cacheFile = xmlCol->Attribute("CACHE");
+            if (m_autotune && cacheFile && !m_cacheLoaded)
+            {
+                LoadTimingCache(pSession->GetComm(), string(cacheFile));
+            }
+
             // Now process operator-specific implementation selections
             TiXmlElement *elmt = xmlCol->FirstChildElement();
             while (elmt)
@@ -317,43 +379,190 @@ OperatorImpMap  CollectionOptimisation::GetOperatorImpMap(
     return ret;
 }
 
-OperatorImpMap CollectionOptimisation::SetWithTimings(
-        vector<StdRegions::StdExpansionSharedPtr> pCollExp,
-        OperatorImpMap &impTypes,
-        bool verbose )
+/**
+ * @brief Read the autotuning cache file.
+ *
+ * The cache is only used if its header matches the processor and build of
+ * every process and all processes read identical entries, which is agreed
+ * with a single reduction, so that all processes select the same
+ * implementations. Otherwise the file is restarted by the root process.
+ * Newly timed collections are appended by the root process in
+ * #SetWithTimings.
+ */
+void CollectionOptimisation::LoadTimingCache(
+        LibUtilities::CommSharedPtr comm,
+        const string &filename)
 {
-    boost::ignore_unused(impTypes);
+    const string cpuModel = GetCpuModel();
+    const string buildId  = GetBuildId();
 
-    OperatorImpMap ret;
+    m_cacheLoaded = true;
+    m_cacheMap.clear();
+
+    map<string, OperatorType> opTypes;
+    for (int i = 0; i < SIZE_OperatorType; ++i)
+    {
+        opTypes[OperatorTypeMap[i]] = (OperatorType)i;
+    }
+
+    map<string, ImplementationType> impTypes;
+    for (int i = 0; i < SIZE_ImplementationType; ++i)
+    {
+        impTypes[ImplementationTypeMap[i]] = (ImplementationType)i;
+    }
+
+    // Each entry is a key followed by Operator=Implementation pairs.
+    ifstream in(filename.c_str());
+    string line, content;
+    bool valid = false;
+    if (getline(in, line) && line == "cpu " + cpuModel &&
+        getline(in, line) && line == "build " + buildId)
+    {
+        valid = true;
+        while (getline(in, line))
+        {
+            stringstream ss(line);
+            string key, entry;
+            OperatorImpMap impMap;
+
+            ss >> key;
+            while (ss >> entry)
+            {
+                size_t pos = entry.find('=');
+                auto opIt  = opTypes.find(entry.substr(0, pos));
+                auto impIt = pos == string::npos ? impTypes.end() :
+                    impTypes.find(entry.substr(pos + 1));
+                if (opIt == opTypes.end() || impIt == impTypes.end())
+                {
+                    valid = false;
+                    break;
+                }
+                impMap[opIt->second] = impIt->second;
+            }
 
+            if (!valid || key.empty())
+            {
+                break;
+            }
+
+            m_cacheMap[key] = impMap;
+            content += line + "\n";
+        }
+    }
+
+    // Agree on the cache across processes: every process must have a valid
+    // cache with the same entries.
+    int checksum = valid ? int(std::hash<string>()(content) & 0x3fffffff)
+                         : -1;
+    vector<int> check = {valid ? 1 : 0, checksum, -checksum};
+    comm->AllReduce(check, LibUtilities::ReduceMin);
+    valid = check[0] == 1 && check[1] == -check[2];
+
+    if (!valid)
+    {
+        m_cacheMap.clear();
+    }
+
+    if (comm->GetRank() == 0)
+    {
+        m_cacheFile = filename;
+
+        if (!valid)
+        {
+            ofstream out(filename.c_str());
+            ASSERTL0(out.good(), "Unable to write collection autotuning "
+                     "cache " + filename);
+            out << "cpu " << cpuModel << endl << "build " << buildId << endl;
+        }
+    }
+}
+
+/**
+ * @brief Return the key of a collection in the autotuning cache.
+ *
+ * The key consists of the shape and bases of the collection and, for fewer
+ * than 100 elements, the number of elements.
+ */
+string CollectionOptimisation::GetTimingCacheKey(
+        vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
+{
     StdRegions::StdExpansionSharedPtr pExp = pCollExp[0];
 
-    // check to see if already defined for this expansion
-    OpImpTimingKey OpKey(pExp,pCollExp.size(),pExp->GetNumBases());
-    if(m_opImpMap.count(OpKey) != 0)
+    stringstream key;
+    key << LibUtilities::ShapeTypeMap[pExp->DetShapeType()];
+    for (int i = 0; i < pExp->GetNumBases(); ++i)
     {
-        ret = m_opImpMap[OpKey];
-        return ret;
+        const LibUtilities::BasisKey &bkey =
+            pExp->GetBasis(i)->GetBasisKey();
+        key << "_" << LibUtilities::BasisTypeMap[bkey.GetBasisType()]
+            << ":" << bkey.GetNumModes()
+            << ":" << LibUtilities::kPointsTypeStr[bkey.GetPointsType()]
+            << ":" << bkey.GetNumPoints();
     }
 
-    int maxsize = pCollExp.size()*max(pExp->GetNcoeffs(),pExp->GetTotPoints());
+    if (pCollExp.size() < 100)
+    {
+        key << "_n" << pCollExp.size();
+    }
+    else
+    {
+        key << "_n100+";
+    }
+
+    string ret = key.str();
+    replace(ret.begin(), ret.end(), ' ', '-');
+    return ret;
+}
+
+/**
+ * @brief Time every operator of every implementation on the collection
+ * @p pCollExp.
+ *
+ * Returns the time per application of implementation @a imp of operator
+ * @a op at index <tt>op*(SIZE_ImplementationType-1) + imp-1</tt>, or 1000
+ * if the implementation does not exist.
+ */
+vector<NekDouble> CollectionOptimisation::TimeOperators(
+        vector<StdRegions::StdExpansionSharedPtr> &pCollExp)
+{
+    const int nImp = SIZE_ImplementationType - 1;
+
+    StdRegions::StdExpansionSharedPtr pExp = pCollExp[0];
+
+    int maxsize = pCollExp.size()*max(pExp->GetNcoeffs(),
+                                      pExp->GetTotPoints());
     Array<OneD, NekDouble> inarray(maxsize,1.0);
     Array<OneD, NekDouble> outarray1(maxsize);
     Array<OneD, NekDouble> outarray2(maxsize);
     Array<OneD, NekDouble> outarray3(maxsize);
 
-    LibUtilities::Timer t;
+    // The scaled interpolation operators map to or from the quadrature
+    // points scaled by the default factor of 1.5 in each direction.
+    int scaledsize = pCollExp.size();
+    for (int i = 0; i < pExp->GetNumBases(); ++i)
+    {
+        scaledsize *= (int) (pExp->GetNumPoints(i)*1.5);
+    }
+    scaledsize = max(scaledsize, maxsize);
+    Array<OneD, NekDouble> scaledin (scaledsize,1.0);
+    Array<OneD, NekDouble> scaledout(scaledsize);
 
-    if(verbose)
+    auto apply = [&](Collection &c, OperatorType opType)
     {
-        cout << "Collection Implemenation for "
-             << LibUtilities::ShapeTypeMap[pExp->DetShapeType()] << " ( ";
-        for(int i = 0; i < pExp->GetNumBases(); ++i)
+        if (opType == ePhysInterp1DScaled ||
+            opType == ePhysGalerkinProjection1DScaled)
         {
-            cout << pExp->GetBasis(i)->GetNumModes() <<" ";
+            c.ApplyOperator(opType, scaledin, scaledout);
         }
-        cout << ")" <<  " for ngeoms = " << pCollExp.size() << endl;
-    }
+        else
+        {
+            c.ApplyOperator(opType, inarray, outarray1, outarray2,
+                            outarray3);
+        }
+    };
+
+    LibUtilities::Timer t;
+
     // set  up an array of collections
     CollectionVector coll;
     for(int imp = 1; imp < SIZE_ImplementationType; ++imp)
@@ -380,6 +589,19 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
         coll.push_back(collloc);
     }
 
+    // Construct the operators up front so that only their application is
+    // timed.
+    for (auto &c : coll)
+    {
+        for (int i = 0; i < SIZE_OperatorType; ++i)
+        {
+            if (c.HasOperator((OperatorType)i))
+            {
+                c.Initialise((OperatorType)i);
+            }
+        }
+    }
+
     // Determine the number of tests to do in one second
     Array<OneD, int> Ntest(SIZE_OperatorType);
     for(int i = 0; i < SIZE_OperatorType; ++i)
@@ -387,11 +609,7 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
         OperatorType OpType = (OperatorType)i;
 
         t.Start();
-        coll[0].ApplyOperator(OpType,
-                           inarray,
-                           outarray1,
-                           outarray2,
-                           outarray3);
+        apply(coll[0], OpType);
         t.Stop();
 
         NekDouble oneTest = t.TimePerTest(1);
@@ -399,13 +617,11 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
         Ntest[i] = max((int)(0.25/oneTest),1);
     }
 
-    Array<OneD, NekDouble> timing(SIZE_ImplementationType);
-    // loop over all operators and determine fastest implementation
+    vector<NekDouble> timing(SIZE_OperatorType*nImp);
     for(int i = 0; i < SIZE_OperatorType; ++i)
     {
         OperatorType OpType = (OperatorType)i;
 
-        // call collection implementation in thorugh ExpList.
         for (int imp = 0; imp < coll.size(); ++imp)
         {
             if (coll[imp].HasOperator(OpType))
@@ -413,53 +629,179 @@ OperatorImpMap CollectionOptimisation::SetWithTimings(
                 t.Start();
                 for(int n = 0; n < Ntest[i]; ++n)
                 {
-                    coll[imp].ApplyOperator(OpType,
-                                      inarray,
-                                      outarray1,
-                                      outarray2,
-                                      outarray3);
+                    apply(coll[imp], OpType);
                 }
                 t.Stop();
-                timing[imp] = t.TimePerTest(Ntest[i]);
+                timing[i*nImp + imp] = t.TimePerTest(Ntest[i]);
             }
             else
             {
-                timing[imp] = 1000.0;
+                timing[i*nImp + imp] = 1000.0;
             }
         }
-        // determine optimal implementation. Note +1 to
-        // remove NoImplementationType flag
-        int minImp = Vmath::Imin(coll.size(),timing,1)+1;
+    }
+
+    return timing;
+}
 
-        if(verbose)
+/**
+ * @brief Select the fastest implementation of every operator for each of
+ * the collections @p pCollExp by timing them.
+ *
+ * This is collective over @p comm, since processes generally own different
+ * collections. Each process times the collections missing from the cache
+ * once per key, the keys timed anywhere are exchanged and the timings are
+ * averaged over the processes that timed them. Every process therefore
+ * selects the same implementations, including for collections it does not
+ * own, and the root process caches all of them.
+ */
+vector<OperatorImpMap> CollectionOptimisation::SetWithTimings(
+        LibUtilities::CommSharedPtr comm,
+        vector<vector<StdRegions::StdExpansionSharedPtr> > &pCollExp,
+        bool verbose)
+{
+    const int nImp   = SIZE_ImplementationType - 1;
+    const int nTimes = SIZE_OperatorType*nImp;
+
+    // Time the collections which were not selected before.
+    vector<string> keys(pCollExp.size());
+    map<string, vector<NekDouble> > localTimes;
+    for (int i = 0; i < pCollExp.size(); ++i)
+    {
+        keys[i] = GetTimingCacheKey(pCollExp[i]);
+        if (m_cacheMap.count(keys[i]) == 0 &&
+            localTimes.count(keys[i]) == 0)
         {
-            cout << "\t " << OperatorTypeMap[i] << ": "
-                 << ImplementationTypeMap[minImp] << "\t (";
-            for(int j = 0; j < coll.size(); ++j)
+            localTimes[keys[i]] = TimeOperators(pCollExp[i]);
+        }
+    }
+
+    // Gather the keys timed by any process.
+    set<string> allKeys;
+    for (auto &it : localTimes)
+    {
+        allKeys.insert(it.first);
+    }
+
+    const int nProc = comm->GetSize();
+    if (nProc > 1)
+    {
+        string send;
+        for (auto &it : localTimes)
+        {
+            send += it.first + "\n";
+        }
+
+        Array<OneD, int> sizes  (nProc, 0);
+        Array<OneD, int> offsets(nProc, 0);
+        sizes[comm->GetRank()] = send.size();
+        comm->AllReduce(sizes, LibUtilities::ReduceSum);
+        for (int i = 1; i < nProc; ++i)
+        {
+            offsets[i] = offsets[i-1] + sizes[i-1];
+        }
+
+        Array<OneD, int> sendBuf(send.size());
+        Array<OneD, int> recvBuf(offsets[nProc-1] + sizes[nProc-1]);
+        copy(send.begin(), send.end(), sendBuf.begin());
+        comm->AllGatherv(sendBuf, recvBuf, sizes, offsets);
+
+        string recv(recvBuf.begin(), recvBuf.end());
+        stringstream ss(recv);
+        string key;
+        while (getline(ss, key))
+        {
+            allKeys.insert(key);
+        }
+    }
+
+    // Sum the timings of each key and the number of processes timing it.
+    Array<OneD, NekDouble> timing(allKeys.size()*(nTimes + 1), 0.0);
+    int k = 0;
+    for (auto &key : allKeys)
+    {
+        auto it = localTimes.find(key);
+        if (it != localTimes.end())
+        {
+            copy(it->second.begin(), it->second.end(),
+                 timing.begin() + k*(nTimes + 1));
+            timing[k*(nTimes + 1) + nTimes] = 1.0;
+        }
+        ++k;
+    }
+    comm->AllReduce(timing, LibUtilities::ReduceSum);
+
+    // Select the fastest implementation of each operator and store it for
+    // other expansions and later runs.
+    ofstream out;
+    if (!m_cacheFile.empty() && comm->GetRank() == 0)
+    {
+        out.open(m_cacheFile.c_str(), ios::app);
+    }
+
+    k = 0;
+    for (auto &key : allKeys)
+    {
+        const NekDouble *time  = timing.get() + k*(nTimes + 1);
+        const NekDouble  count = time[nTimes];
+        ++k;
+
+        if (verbose)
+        {
+            cout << "Collection Implementation for " << key
+                 << " timed on " << count << " process(es)" << endl;
+        }
+
+        OperatorImpMap impMap;
+        for (int i = 0; i < SIZE_OperatorType; ++i)
+        {
+            // Note +1 to remove NoImplementationType flag
+            int minImp = Vmath::Imin(nImp, time + i*nImp, 1) + 1;
+            impMap[(OperatorType)i] = (ImplementationType)minImp;
+
+            if (verbose)
             {
-                if (timing[j] > 999.0)
-                {
-                    cout << "-";
-                }
-                else
+                cout << "\t " << OperatorTypeMap[i] << ": "
+                     << ImplementationTypeMap[minImp] << "\t (";
+                for (int j = 0; j < nImp; ++j)
                 {
-                    cout << timing[j] ;
-                }
-                if(j != coll.size()-1)
-                {
-                    cout <<", ";
+                    if (time[i*nImp + j] > 999.0*count)
+                    {
+                        cout << "-";
+                    }
+                    else
+                    {
+                        cout << time[i*nImp + j]/count;
+                    }
+                    if (j != nImp - 1)
+                    {
+                        cout << ", ";
+                    }
                 }
+                cout << ")" << endl;
             }
-            cout << ")" <<endl;
         }
-        // could reset global map if reusing  method?
-        //m_global[OpType][pExp->DetShapeType()] = (ImplementationType)minImp;
-        // set up new map
-        ret[OpType] = (ImplementationType)minImp;
+
+        m_cacheMap[key] = impMap;
+
+        if (out.is_open())
+        {
+            out << key;
+            for (auto &it : impMap)
+            {
+                out << " " << OperatorTypeMap[it.first] << "="
+                    << ImplementationTypeMap[it.second];
+            }
+            out << endl;
+        }
+    }
+
+    vector<OperatorImpMap> ret(pCollExp.size());
+    for (int i = 0; i < pCollExp.size(); ++i)
+    {
+        ret[i] = m_cacheMap[keys[i]];
     }
 
-    // store map for use by another expansion.
-    m_opImpMap[OpKey] = ret;
     return ret;
 }
 
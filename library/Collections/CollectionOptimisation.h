@@ -45,71 +45,6 @@ namespace Nektar
 namespace Collections
 {
 
-class OpImpTimingKey
-{
-    public:
-        /// Constructor
-        OpImpTimingKey(StdRegions::StdExpansionSharedPtr pExp,
-                int ngeoms, int nbases):
-            m_exp(pExp),
-            m_ngeoms(ngeoms),
-            m_nbasis(nbases)
-        {
-        }
-
-        /// Destructor
-        ~OpImpTimingKey(void)
-        {
-        }
-
-
-        bool operator<(const OpImpTimingKey &rhs) const
-        {
-
-            if(m_nbasis <   rhs.m_nbasis)
-            {
-                return true;
-            }
-
-            if(m_nbasis > rhs.m_nbasis)
-            {
-                return false;
-            }
-
-            for(int i = 0; i < m_nbasis; ++i)
-            {
-                if( m_exp->GetBasis(i)->GetBasisKey() !=
-                    rhs.m_exp->GetBasis(i)->GetBasisKey() )
-                {
-                    return (m_exp->GetBasis(i)->GetBasisKey() <
-                            rhs.m_exp->GetBasis(i)->GetBasisKey());
-                }
-            }
-
-            if( (m_ngeoms < 100) && (rhs.m_ngeoms < 100) )
-            {
-                if(m_ngeoms < rhs.m_ngeoms)
-                {
-                    return true;
-                }
-                else
-                {
-                    return false;
-                }
-            }
-
-            return false;
-        }
-
-        StdRegions::StdExpansionSharedPtr m_exp;
-        int m_ngeoms;
-        int m_nbasis;
-
-    private:
-
-};
-
-
 class CollectionOptimisation
 {
     public:
@@ -130,6 +65,11 @@ class CollectionOptimisation
             return m_maxCollSize;
         }
 
+        unsigned int GetNumThreads()
+        {
+            return m_numThreads;
+        }
+
         bool IsUsingAutotuning()
         {
             return m_autotune;
@@ -139,10 +79,11 @@ class CollectionOptimisation
         COLLECTIONS_EXPORT OperatorImpMap  GetOperatorImpMap(
                 StdRegions::StdExpansionSharedPtr pExp);
 
-        // Get Map by doing autotuning testing.
-        COLLECTIONS_EXPORT OperatorImpMap SetWithTimings(
-                std::vector<StdRegions::StdExpansionSharedPtr> pGeom,
-                OperatorImpMap &impTypes,
+        // Get Maps by doing autotuning testing, collectively over comm.
+        COLLECTIONS_EXPORT std::vector<OperatorImpMap> SetWithTimings(
+                LibUtilities::CommSharedPtr comm,
+                std::vector<std::vector<StdRegions::StdExpansionSharedPtr> >
+                    &pCollExp,
                 bool verbose = true);
 
         bool SetByXml(void)
@@ -153,12 +94,28 @@ class CollectionOptimisation
     private:
         typedef std::pair<LibUtilities::ShapeType, int> ElmtOrder;
 
-        static std::map<OpImpTimingKey,OperatorImpMap> m_opImpMap;
+        /// Implementation maps selected by autotuning or read from the
+        /// autotuning cache file.
+        static std::map<std::string, OperatorImpMap> m_cacheMap;
+        /// Autotuning cache file appended to by this process, if any.
+        static std::string m_cacheFile;
+        /// Whether the autotuning cache file has been read.
+        static bool m_cacheLoaded;
+
+        void LoadTimingCache(
+                LibUtilities::CommSharedPtr comm,
+                const std::string &filename);
+        std::vector<NekDouble> TimeOperators(
+                std::vector<StdRegions::StdExpansionSharedPtr> &pCollExp);
+        std::string GetTimingCacheKey(
+                std::vector<StdRegions::StdExpansionSharedPtr> &pCollExp);
+
         std::map<OperatorType, std::map<ElmtOrder, ImplementationType> > m_global;
         bool m_setByXml;
         bool m_autotune;
         ImplementationType m_defaultType;
         unsigned int m_maxCollSize;
+        unsigned int m_numThreads;
 };
 
 }
@@ -0,0 +1,439 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: FwdTrans.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: FwdTrans operator implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+#include <LocalRegions/Expansion.h>
+#include <SpatialDomains/GeomFactors.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eTriangle;
+using LibUtilities::eHexahedron;
+using LibUtilities::eTetrahedron;
+using LibUtilities::ePrism;
+using LibUtilities::ePyramid;
+
+/**
+ * @brief Forward transform operator assembled from the IProductWRTBase
+ * operator of a single implementation type and the elemental inverse mass
+ * matrices.
+ *
+ * The elemental inverse mass matrix of an undeformed element is the
+ * standard inverse mass matrix scaled by the inverse of the (constant)
+ * Jacobian, so that it is applied to all elements with a single
+ * matrix-matrix multiplication. The result is then replaced by the local
+ * inverse mass matrix for each deformed element. These matrices are only
+ * built on the first application of the operator.
+ */
+class FwdTrans_Helper : public Operator
+{
+    public:
+        virtual ~FwdTrans_Helper()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            ASSERTL1(wsp.size() == m_wspSize,
+                     "Incorrect workspace size");
+
+            Array<OneD, NekDouble> iprod(m_ncoeffs*m_numElmt, wsp);
+            Array<OneD, NekDouble> wspIP(m_iprod->GetWspSize(),
+                                         wsp + m_ncoeffs*m_numElmt);
+
+            (*m_iprod)(input, iprod, NullNekDouble1DArray,
+                       NullNekDouble1DArray, wspIP);
+
+            Blas::Dgemm('N', 'N', m_ncoeffs, m_numElmt, m_ncoeffs,
+                        1.0, m_invMass->GetRawPtr(), m_ncoeffs,
+                        iprod.get(), m_ncoeffs, 0.0,
+                        output.get(), m_ncoeffs);
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                Vmath::Smul(m_ncoeffs, m_invJac[i],
+                            &output[i*m_ncoeffs], 1,
+                            &output[i*m_ncoeffs], 1);
+            }
+
+            if (m_deformed.size() > 0 && m_locInvMass.size() == 0)
+            {
+                for (auto &exp : m_deformedExp)
+                {
+                    m_locInvMass.push_back(
+                        exp->GetLocMatrix(StdRegions::eInvMass));
+                }
+            }
+
+            for (int j = 0; j < m_deformed.size(); ++j)
+            {
+                const int i = m_deformed[j];
+                NekVector<NekDouble> in (m_ncoeffs, iprod + i*m_ncoeffs,
+                                         eWrapper);
+                NekVector<NekDouble> out(m_ncoeffs, output + i*m_ncoeffs,
+                                         eWrapper);
+                out = (*m_locInvMass[j])*in;
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+    protected:
+        OperatorSharedPtr                         m_iprod;
+        int                                       m_ncoeffs;
+        DNekMatSharedPtr                          m_invMass;
+        Array<OneD, NekDouble>                    m_invJac;
+        /// Indices of the deformed elements in the collection.
+        vector<int>                               m_deformed;
+        vector<LocalRegions::ExpansionSharedPtr>  m_deformedExp;
+        /// Local inverse mass matrices of the deformed elements.
+        vector<DNekScalMatSharedPtr>              m_locInvMass;
+
+        FwdTrans_Helper(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData,
+                ImplementationType                        impType)
+            : Operator (pCollExp, pGeomData),
+              m_ncoeffs(m_stdExp->GetNcoeffs())
+        {
+            m_iprod = GetOperatorFactory().CreateInstance(
+                OperatorKey(pCollExp[0]->DetShapeType(), eIProductWRTBase,
+                            impType, pCollExp[0]->IsNodalNonTensorialExp()),
+                pCollExp, pGeomData);
+
+            m_wspSize = m_ncoeffs*m_numElmt + m_iprod->GetWspSize();
+
+            StdRegions::StdMatrixKey key(StdRegions::eInvMass,
+                                         m_stdExp->DetShapeType(),
+                                         *m_stdExp);
+            m_invMass = m_stdExp->GetStdMatrix(key);
+
+            // The Jacobian of an undeformed element is constant.
+            LibUtilities::PointsKeyVector ptsKeys =
+                m_stdExp->GetPointsKeys();
+            m_invJac = Array<OneD, NekDouble>(m_numElmt, 0.0);
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                LocalRegions::ExpansionSharedPtr exp =
+                    dynamic_pointer_cast<LocalRegions::Expansion>(pCollExp[i]);
+                if (exp->GetMetricInfo()->GetGtype() ==
+                        SpatialDomains::eDeformed)
+                {
+                    m_deformed.push_back(i);
+                    m_deformedExp.push_back(exp);
+                }
+                else
+                {
+                    m_invJac[i] =
+                        1.0/exp->GetMetricInfo()->GetJac(ptsKeys)[0];
+                }
+            }
+        }
+};
+
+
+/**
+ * @brief Forward transform operator using standard matrix approach
+ */
+class FwdTrans_StdMat : public FwdTrans_Helper
+{
+    public:
+        OPERATOR_CREATE(FwdTrans_StdMat)
+
+        virtual ~FwdTrans_StdMat()
+        {
+        }
+
+    private:
+        FwdTrans_StdMat(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : FwdTrans_Helper(pCollExp, pGeomData, eStdMat)
+        {
+        }
+};
+
+/// Factory initialisation for the FwdTrans_StdMat operators
+OperatorKey FwdTrans_StdMat::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eStdMat, true),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eStdMat, true),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eStdMat, true),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eFwdTrans, eStdMat, false),
+        FwdTrans_StdMat::create, "FwdTrans_StdMat_Hex")
+};
+
+
+/**
+ * @brief Forward transform operator using element-wise operation
+ */
+class FwdTrans_IterPerExp : public FwdTrans_Helper
+{
+    public:
+        OPERATOR_CREATE(FwdTrans_IterPerExp)
+
+        virtual ~FwdTrans_IterPerExp()
+        {
+        }
+
+    private:
+        FwdTrans_IterPerExp(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : FwdTrans_Helper(pCollExp, pGeomData, eIterPerExp)
+        {
+        }
+};
+
+/// Factory initialisation for the FwdTrans_IterPerExp operators
+OperatorKey FwdTrans_IterPerExp::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eIterPerExp, true),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eIterPerExp, true),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eIterPerExp, true),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eFwdTrans, eIterPerExp, false),
+        FwdTrans_IterPerExp::create, "FwdTrans_IterPerExp_Hex")
+};
+
+
+/**
+ * @brief Forward transform operator using sum-factorisation
+ */
+class FwdTrans_SumFac : public FwdTrans_Helper
+{
+    public:
+        OPERATOR_CREATE(FwdTrans_SumFac)
+
+        virtual ~FwdTrans_SumFac()
+        {
+        }
+
+    private:
+        FwdTrans_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : FwdTrans_Helper(pCollExp, pGeomData, eSumFac)
+        {
+        }
+};
+
+/// Factory initialisation for the FwdTrans_SumFac operators
+OperatorKey FwdTrans_SumFac::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eFwdTrans, eSumFac, false),
+        FwdTrans_SumFac::create, "FwdTrans_SumFac_Hex")
+};
+
+
+/**
+ * @brief Forward transform operator using original LocalRegions
+ * implementation.
+ */
+class FwdTrans_NoCollection : public Operator
+{
+    public:
+        OPERATOR_CREATE(FwdTrans_NoCollection)
+
+        virtual ~FwdTrans_NoCollection()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2, wsp);
+
+            const int nCoeffs = m_expList[0]->GetNcoeffs();
+            const int nPhys   = m_expList[0]->GetTotPoints();
+            Array<OneD, NekDouble> tmp;
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                m_expList[i]->FwdTrans(input + i*nPhys,
+                                       tmp = output + i*nCoeffs);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+    protected:
+        vector<StdRegions::StdExpansionSharedPtr> m_expList;
+
+    private:
+        FwdTrans_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator(pCollExp, pGeomData),
+              m_expList(pCollExp)
+        {
+        }
+};
+
+/// Factory initialisation for the FwdTrans_NoCollection operators
+OperatorKey FwdTrans_NoCollection::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eFwdTrans, eNoCollection, true),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eFwdTrans, eNoCollection, true),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eFwdTrans, eNoCollection, true),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eFwdTrans, eNoCollection, false),
+        FwdTrans_NoCollection::create, "FwdTrans_NoCollection_Hex")
+};
+
+}
+}
@@ -0,0 +1,681 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Helmholtz.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Helmholtz and Laplacian operator implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eTriangle;
+using LibUtilities::eHexahedron;
+using LibUtilities::eTetrahedron;
+using LibUtilities::ePrism;
+using LibUtilities::ePyramid;
+
+/**
+ * @brief Matrix-free Helmholtz operator assembled from the collection
+ * operators of a single implementation type.
+ *
+ * The operator evaluates
+ * \f[ \mathbf{H}\hat{u} = \mathbf{L}\hat{u} + \lambda\mathbf{M}\hat{u} \f]
+ * for all elements of the collection at once by chaining BwdTrans,
+ * PhysDeriv, IProductWRTDerivBase and IProductWRTBase. No elemental
+ * Helmholtz, Laplacian or mass matrices are ever formed, so that with the
+ * SumFac implementation the memory footprint is that of the geometric
+ * factors only.
+ */
+class Helmholtz_Helper : public Operator
+{
+    public:
+        virtual ~Helmholtz_Helper()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            const int nqcol = m_nqtot   * m_numElmt;
+            const int nmcol = m_ncoeffs * m_numElmt;
+
+            ASSERTL1(wsp.size() == m_wspSize,
+                     "Incorrect workspace size");
+
+            // Partition workspace: physical values, their derivatives, a
+            // coefficient space mass term and the sub-operator workspace.
+            Array<OneD, NekDouble> phys(nqcol, wsp);
+            Array<OneD, Array<OneD, NekDouble> > deriv(4);
+            for (int i = 0; i < 3; ++i)
+            {
+                deriv[i] = (i < m_coordim)
+                    ? Array<OneD, NekDouble>(nqcol, wsp + (i+1)*nqcol)
+                    : NullNekDouble1DArray;
+            }
+            int offset = (m_coordim+1)*nqcol;
+            Array<OneD, NekDouble> mass(nmcol, wsp + offset);
+            offset += nmcol;
+
+            Array<OneD, NekDouble> wspBwd  (m_bwdTrans ->GetWspSize(),
+                                            wsp + offset);
+            Array<OneD, NekDouble> wspDeriv(m_physDeriv->GetWspSize(),
+                                            wsp + offset);
+            Array<OneD, NekDouble> wspIPD  (m_iprodDeriv->GetWspSize(),
+                                            wsp + offset);
+            Array<OneD, NekDouble> wspIP   (m_iprod    ->GetWspSize(),
+                                            wsp + offset);
+
+            // u = B c
+            (*m_bwdTrans)(input, phys, NullNekDouble1DArray,
+                          NullNekDouble1DArray, wspBwd);
+
+            // grad u
+            (*m_physDeriv)(phys, deriv[0], deriv[1], deriv[2], wspDeriv);
+
+            // (grad phi, grad u): the inner product operator takes its
+            // output as the argument following the last gradient component.
+            deriv[m_coordim] = output;
+            (*m_iprodDeriv)(deriv[0], deriv[1], deriv[2], deriv[3],
+                            wspIPD);
+
+            // + lambda (phi, u)
+            if (m_addMass && m_lambda != 0.0)
+            {
+                (*m_iprod)(phys, mass, NullNekDouble1DArray,
+                           NullNekDouble1DArray, wspIP);
+                Blas::Daxpy(nmcol, m_lambda, mass.get(), 1, output.get(), 1);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+        virtual void UpdateFactors(const StdRegions::ConstFactorMap &factors)
+        {
+            auto x = factors.find(StdRegions::eFactorLambda);
+            m_lambda = (x == factors.end()) ? 0.0 : x->second;
+        }
+
+    protected:
+        OperatorSharedPtr               m_bwdTrans;
+        OperatorSharedPtr               m_physDeriv;
+        OperatorSharedPtr               m_iprodDeriv;
+        OperatorSharedPtr               m_iprod;
+        int                             m_coordim;
+        int                             m_nqtot;
+        int                             m_ncoeffs;
+        bool                            m_addMass;
+        NekDouble                       m_lambda;
+
+        Helmholtz_Helper(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData,
+                ImplementationType                        impType,
+                bool                                      addMass)
+            : Operator (pCollExp, pGeomData),
+              m_coordim(pCollExp[0]->GetCoordim()),
+              m_nqtot  (m_stdExp->GetTotPoints()),
+              m_ncoeffs(m_stdExp->GetNcoeffs()),
+              m_addMass(addMass),
+              m_lambda (0.0)
+        {
+            LibUtilities::ShapeType shape = pCollExp[0]->DetShapeType();
+            bool nodal = pCollExp[0]->IsNodalNonTensorialExp();
+
+            m_bwdTrans   = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eBwdTrans, impType, nodal),
+                pCollExp, pGeomData);
+            m_physDeriv  = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, ePhysDeriv, impType, nodal),
+                pCollExp, pGeomData);
+            m_iprodDeriv = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eIProductWRTDerivBase, impType, nodal),
+                pCollExp, pGeomData);
+            m_iprod      = GetOperatorFactory().CreateInstance(
+                OperatorKey(shape, eIProductWRTBase, impType, nodal),
+                pCollExp, pGeomData);
+
+            int subWsp = max(max(m_bwdTrans->GetWspSize(),
+                                 m_physDeriv->GetWspSize()),
+                             max(m_iprodDeriv->GetWspSize(),
+                                 m_iprod->GetWspSize()));
+
+            m_wspSize = (m_coordim+1)*m_nqtot*m_numElmt
+                      + m_ncoeffs*m_numElmt + subWsp;
+        }
+};
+
+
+/**
+ * @brief Helmholtz operator using standard matrix approach
+ */
+class Helmholtz_StdMat : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_StdMat)
+
+        virtual ~Helmholtz_StdMat()
+        {
+        }
+
+    private:
+        Helmholtz_StdMat(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eStdMat, true)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_StdMat operators
+OperatorKey Helmholtz_StdMat::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eStdMat, true),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eStdMat, true),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eStdMat, true),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eStdMat, false),
+        Helmholtz_StdMat::create, "Helmholtz_StdMat_Hex")
+};
+
+
+/**
+ * @brief Helmholtz operator using element-wise operation
+ */
+class Helmholtz_IterPerExp : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_IterPerExp)
+
+        virtual ~Helmholtz_IterPerExp()
+        {
+        }
+
+    private:
+        Helmholtz_IterPerExp(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eIterPerExp, true)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_IterPerExp operators
+OperatorKey Helmholtz_IterPerExp::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eIterPerExp, true),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eIterPerExp, true),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eIterPerExp, true),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eIterPerExp, false),
+        Helmholtz_IterPerExp::create, "Helmholtz_IterPerExp_Hex")
+};
+
+
+/**
+ * @brief Helmholtz operator using sum-factorisation
+ */
+class Helmholtz_SumFac : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_SumFac)
+
+        virtual ~Helmholtz_SumFac()
+        {
+        }
+
+    private:
+        Helmholtz_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eSumFac, true)
+        {
+        }
+};
+
+/// Factory initialisation for the Helmholtz_SumFac operators
+OperatorKey Helmholtz_SumFac::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eSumFac, false),
+        Helmholtz_SumFac::create, "Helmholtz_SumFac_Hex")
+};
+
+
+/**
+ * @brief Helmholtz operator using original LocalRegions implementation.
+ */
+class Helmholtz_NoCollection : public Operator
+{
+    public:
+        OPERATOR_CREATE(Helmholtz_NoCollection)
+
+        virtual ~Helmholtz_NoCollection()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2, wsp);
+
+            const int nCoeffs = m_expList[0]->GetNcoeffs();
+            Array<OneD, NekDouble> tmp;
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                StdRegions::StdMatrixKey mkey(m_matType,
+                                              m_expList[i]->DetShapeType(),
+                                              *m_expList[i], m_factors);
+                m_expList[i]->GeneralMatrixOp(input + i*nCoeffs,
+                                              tmp = output + i*nCoeffs,
+                                              mkey);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+        virtual void UpdateFactors(const StdRegions::ConstFactorMap &factors)
+        {
+            m_factors = factors;
+            if (m_matType == StdRegions::eHelmholtz &&
+                m_factors.count(StdRegions::eFactorLambda) == 0)
+            {
+                m_factors[StdRegions::eFactorLambda] = 0.0;
+            }
+        }
+
+    protected:
+        vector<StdRegions::StdExpansionSharedPtr> m_expList;
+        StdRegions::MatrixType                    m_matType;
+        StdRegions::ConstFactorMap                m_factors;
+
+        Helmholtz_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData,
+                StdRegions::MatrixType                    matType
+                                                 = StdRegions::eHelmholtz)
+            : Operator(pCollExp, pGeomData),
+              m_expList(pCollExp),
+              m_matType(matType)
+        {
+            UpdateFactors(StdRegions::NullConstFactorMap);
+        }
+};
+
+/// Factory initialisation for the Helmholtz_NoCollection operators
+OperatorKey Helmholtz_NoCollection::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eHelmholtz, eNoCollection, true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eHelmholtz, eNoCollection, true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eHelmholtz, eNoCollection, true),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eHelmholtz, eNoCollection, false),
+        Helmholtz_NoCollection::create, "Helmholtz_NoCollection_Hex")
+};
+
+
+/**
+ * @brief Laplacian operator using standard matrix approach
+ */
+class Laplacian_StdMat : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Laplacian_StdMat)
+
+        virtual ~Laplacian_StdMat()
+        {
+        }
+
+    private:
+        Laplacian_StdMat(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eStdMat, false)
+        {
+        }
+};
+
+/// Factory initialisation for the Laplacian_StdMat operators
+OperatorKey Laplacian_StdMat::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eStdMat, true),
+        Laplacian_StdMat::create, "Laplacian_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eStdMat, true),
+        Laplacian_StdMat::create, "Laplacian_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eStdMat, true),
+        Laplacian_StdMat::create, "Laplacian_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eLaplacian, eStdMat, false),
+        Laplacian_StdMat::create, "Laplacian_StdMat_Hex")
+};
+
+
+/**
+ * @brief Laplacian operator using element-wise operation
+ */
+class Laplacian_IterPerExp : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Laplacian_IterPerExp)
+
+        virtual ~Laplacian_IterPerExp()
+        {
+        }
+
+    private:
+        Laplacian_IterPerExp(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eIterPerExp, false)
+        {
+        }
+};
+
+/// Factory initialisation for the Laplacian_IterPerExp operators
+OperatorKey Laplacian_IterPerExp::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eIterPerExp, true),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eIterPerExp, true),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eIterPerExp, true),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eLaplacian, eIterPerExp, false),
+        Laplacian_IterPerExp::create, "Laplacian_IterPerExp_Hex")
+};
+
+
+/**
+ * @brief Laplacian operator using sum-factorisation
+ */
+class Laplacian_SumFac : public Helmholtz_Helper
+{
+    public:
+        OPERATOR_CREATE(Laplacian_SumFac)
+
+        virtual ~Laplacian_SumFac()
+        {
+        }
+
+    private:
+        Laplacian_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_Helper(pCollExp, pGeomData, eSumFac, false)
+        {
+        }
+};
+
+/// Factory initialisation for the Laplacian_SumFac operators
+OperatorKey Laplacian_SumFac::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eLaplacian, eSumFac, false),
+        Laplacian_SumFac::create, "Laplacian_SumFac_Hex")
+};
+
+
+/**
+ * @brief Laplacian operator using original LocalRegions implementation.
+ */
+class Laplacian_NoCollection : public Helmholtz_NoCollection
+{
+    public:
+        OPERATOR_CREATE(Laplacian_NoCollection)
+
+        virtual ~Laplacian_NoCollection()
+        {
+        }
+
+    private:
+        Laplacian_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Helmholtz_NoCollection(pCollExp, pGeomData,
+                                     StdRegions::eLaplacian)
+        {
+        }
+};
+
+/// Factory initialisation for the Laplacian_NoCollection operators
+OperatorKey Laplacian_NoCollection::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      eLaplacian, eNoCollection, true),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   eLaplacian, eNoCollection, true),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         eLaplacian, eNoCollection, true),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eLaplacian, eNoCollection, false),
+        Laplacian_NoCollection::create, "Laplacian_NoCollection_Hex")
+};
+
+}
+}
@@ -37,6 +37,8 @@
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
 #include <Collections/IProduct.h>
+#include <Collections/SumFacKernels.h>
+#include <Collections/SumFacSIMD.h>
 
 using namespace std;
 
@@ -75,12 +77,33 @@ class IProductWRTBase_StdMat : public Operator
             ASSERTL1(wsp.size() == m_wspSize,
                      "Incorrect workspace size");
 
-            Vmath::Vmul(m_jac.size(),m_jac,1,input,1,wsp,1);
+            if (m_isDeformed)
+            {
+                Vmath::Vmul(m_jac.size(),m_jac,1,input,1,wsp,1);
 
-            Blas::Dgemm('N', 'N', m_mat->GetRows(), m_numElmt,
-                        m_mat->GetColumns(), 1.0, m_mat->GetRawPtr(),
-                        m_mat->GetRows(), wsp.get(), m_stdExp->GetTotPoints(),
-                        0.0, output.get(), m_stdExp->GetNcoeffs());
+                Blas::Dgemm('N', 'N', m_mat->GetRows(), m_numElmt,
+                            m_mat->GetColumns(), 1.0, m_mat->GetRawPtr(),
+                            m_mat->GetRows(), wsp.get(),
+                            m_stdExp->GetTotPoints(), 0.0, output.get(),
+                            m_stdExp->GetNcoeffs());
+            }
+            else
+            {
+                // The Jacobian is constant within each element, so it is
+                // applied to the coefficients instead.
+                const int nmodes = m_stdExp->GetNcoeffs();
+
+                Blas::Dgemm('N', 'N', m_mat->GetRows(), m_numElmt,
+                            m_mat->GetColumns(), 1.0, m_mat->GetRawPtr(),
+                            m_mat->GetRows(), input.get(),
+                            m_stdExp->GetTotPoints(), 0.0, output.get(),
+                            nmodes);
+
+                for (int i = 0; i < m_numElmt; ++i)
+                {
+                    Blas::Dscal(nmodes, m_jac[i], &output[i*nmodes], 1);
+                }
+            }
         }
 
         virtual void operator()(
@@ -96,6 +119,7 @@ class IProductWRTBase_StdMat : public Operator
     protected:
         DNekMatSharedPtr                m_mat;
         Array<OneD, const NekDouble>    m_jac;
+        bool                            m_isDeformed;
 
     private:
         IProductWRTBase_StdMat(
@@ -103,7 +127,8 @@ class IProductWRTBase_StdMat : public Operator
                 CoalescedGeomDataSharedPtr                pGeomData)
             : Operator(pCollExp, pGeomData)
         {
-            m_jac = pGeomData->GetJac(pCollExp);
+            m_jac        = pGeomData->GetJac(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             StdRegions::StdMatrixKey key(StdRegions::eIProductWRTBase,
                                          m_stdExp->DetShapeType(), *m_stdExp);
             m_mat = m_stdExp->GetStdMatrix(key);
@@ -466,6 +491,13 @@ class IProductWRTBase_SumFac_Quad : public Operator
             ASSERTL1(wsp.size() == m_wspSize,
                      "Incorrect workspace size");
 
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(), nullptr,
+                         m_jac.get(), input.get(), output.get());
+                return;
+            }
+
             QuadIProduct(m_colldir0,m_colldir1,m_numElmt,
                          m_nquad0,  m_nquad1,
                          m_nmodes0, m_nmodes1,
@@ -493,6 +525,7 @@ class IProductWRTBase_SumFac_Quad : public Operator
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
+        SumFacIProductKernel            m_kernel;
 
     private:
         IProductWRTBase_SumFac_Quad(
@@ -506,7 +539,8 @@ class IProductWRTBase_SumFac_Quad : public Operator
               m_colldir0(m_stdExp->GetBasis(0)->Collocation()),
               m_colldir1(m_stdExp->GetBasis(1)->Collocation()),
               m_base0   (m_stdExp->GetBasis(0)->GetBdata()),
-              m_base1   (m_stdExp->GetBasis(1)->GetBdata())
+              m_base1   (m_stdExp->GetBasis(1)->GetBdata()),
+              m_kernel  (GetSumFacIProductKernel(m_stdExp))
         {
             m_jac     = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize = 2 * m_numElmt
@@ -628,6 +662,14 @@ class IProductWRTBase_SumFac_Hex : public Operator
             ASSERTL1(wsp.size() == m_wspSize,
                      "Incorrect workspace size");
 
+            if (m_kernel)
+            {
+                m_kernel(m_numElmt, m_base0.get(), m_base1.get(),
+                         m_base2.get(), m_jac.get(), input.get(),
+                         output.get());
+                return;
+            }
+
             HexIProduct(m_colldir0,m_colldir1,m_colldir2, m_numElmt,
                         m_nquad0,  m_nquad1,  m_nquad2,
                         m_nmodes0, m_nmodes1, m_nmodes2,
@@ -659,6 +701,7 @@ class IProductWRTBase_SumFac_Hex : public Operator
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
         Array<OneD, const NekDouble>    m_base2;
+        SumFacIProductKernel            m_kernel;
 
     private:
         IProductWRTBase_SumFac_Hex(
@@ -676,8 +719,8 @@ class IProductWRTBase_SumFac_Hex : public Operator
               m_colldir2(m_stdExp->GetBasis(2)->Collocation()),
               m_base0    (m_stdExp->GetBasis(0)->GetBdata()),
               m_base1    (m_stdExp->GetBasis(1)->GetBdata()),
-              m_base2    (m_stdExp->GetBasis(2)->GetBdata())
-
+              m_base2    (m_stdExp->GetBasis(2)->GetBdata()),
+              m_kernel   (GetSumFacIProductKernel(m_stdExp))
         {
             m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize = 3 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
@@ -977,6 +1020,124 @@ OperatorKey IProductWRTBase_SumFac_Pyr::m_type = GetOperatorFactory().
         OperatorKey(ePyramid, eIProductWRTBase, eSumFac,false),
         IProductWRTBase_SumFac_Pyr::create, "IProductWRTBase_SumFac_Pyr");
 
+/**
+ * @brief Inner product operator using sum-factorisation on blocks of
+ * #SIMD_WIDTH interleaved elements (Seg, Quad and Hex).
+ *
+ * The Jacobian with quadrature weights is interleaved once at
+ * construction so that only the input field is reordered per call.
+ */
+class IProductWRTBase_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(IProductWRTBase_SumFacSIMD)
+
+        virtual ~IProductWRTBase_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(const Array<OneD, const NekDouble> &input,
+                                Array<OneD,       NekDouble> &output,
+                                Array<OneD,       NekDouble> &output1,
+                                Array<OneD,       NekDouble> &output2,
+                                Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            ASSERTL1(wsp.size() == m_wspSize,
+                     "Incorrect workspace size");
+
+            const int nblocks = SIMDNumBlocks(m_numElmt);
+            NekDouble *buf[2] = { wsp.get(), wsp.get() + m_bufSize };
+
+            for (int b = 0; b < nblocks; ++b)
+            {
+                const int nelmt = min(SIMD_WIDTH,
+                                      int(m_numElmt) - b*SIMD_WIDTH);
+                const int el0   = b*SIMD_WIDTH;
+
+                SIMDInterleave(m_nqtot, nelmt,
+                               input.get() + el0*m_nqtot, buf[1]);
+                SIMDMultiply(m_nqtot, m_jac.get() + el0*m_nqtot,
+                             buf[1], buf[0]);
+
+                int nbefore = 1;
+                int nafter  = m_nqtot;
+                int cur     = 0;
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    nafter /= m_nquad[d];
+                    SIMDTensorContract(true, m_nquad[d], m_nmodes[d],
+                                       nbefore, nafter, m_base[d].get(),
+                                       buf[cur], buf[1-cur]);
+                    nbefore *= m_nmodes[d];
+                    cur      = 1 - cur;
+                }
+
+                SIMDDeinterleave(m_ncoeffs, nelmt, buf[cur],
+                                 output.get() + el0*m_ncoeffs);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+    protected:
+        const int                                m_dim;
+        const int                                m_ncoeffs;
+        const int                                m_nqtot;
+        int                                      m_bufSize;
+        vector<int>                              m_nmodes;
+        vector<int>                              m_nquad;
+        vector<Array<OneD, const NekDouble> >    m_base;
+        Array<OneD, NekDouble>                   m_jac;
+
+    private:
+        IProductWRTBase_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator  (pCollExp, pGeomData),
+              m_dim     (m_stdExp->GetShapeDimension()),
+              m_ncoeffs (m_stdExp->GetNcoeffs()),
+              m_nqtot   (m_stdExp->GetTotPoints())
+        {
+            int maxsize = 1;
+            for (int d = 0; d < m_dim; ++d)
+            {
+                m_nmodes.push_back(m_stdExp->GetBasisNumModes(d));
+                m_nquad .push_back(m_stdExp->GetNumPoints(d));
+                m_base  .push_back(m_stdExp->GetBasis(d)->GetBdata());
+                maxsize *= max(m_nmodes[d], m_nquad[d]);
+            }
+
+            m_jac     = SIMDInterleaveArray(
+                m_nqtot, m_numElmt,
+                pGeomData->GetJacWithStdWeights(pCollExp).get());
+            m_bufSize = maxsize*SIMD_WIDTH;
+            m_wspSize = 2*m_bufSize;
+        }
+};
+
+/// Factory initialisation for the IProductWRTBase_SumFacSIMD operators
+OperatorKey IProductWRTBase_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       eIProductWRTBase, eSumFacSIMD, false),
+        IProductWRTBase_SumFacSIMD::create, "IProductWRTBase_SumFacSIMD_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, eIProductWRTBase, eSumFacSIMD, false),
+        IProductWRTBase_SumFacSIMD::create, "IProductWRTBase_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    eIProductWRTBase, eSumFacSIMD, false),
+        IProductWRTBase_SumFacSIMD::create, "IProductWRTBase_SumFacSIMD_Hex")
+};
+
 
 }
 }
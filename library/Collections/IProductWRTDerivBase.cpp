@@ -91,19 +91,19 @@ class IProductWRTDerivBase_StdMat : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
             for(int i = 0; i < m_dim; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < m_coordim; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*m_dim],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i +j*m_dim], in[j], tmp[i]);
                 }
             }
 
             // calculate Iproduct WRT Std Deriv
 
             // First component
-            Vmath::Vmul(ntot,m_jac,1,tmp[0],1,tmp[0],1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed, m_jac, tmp[0], tmp[0]);
             Blas::Dgemm('N', 'N', m_iProdWRTStdDBase[0]->GetRows(),
                         m_numElmt,m_iProdWRTStdDBase[0]->GetColumns(),
                         1.0, m_iProdWRTStdDBase[0]->GetRawPtr(),
@@ -114,7 +114,7 @@ class IProductWRTDerivBase_StdMat : public Operator
             // Other components
             for(int i = 1; i < m_dim; ++i)
             {
-                Vmath::Vmul(ntot,m_jac,1,tmp[i],1,tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed, m_jac, tmp[i], tmp[i]);
                 Blas::Dgemm('N', 'N', m_iProdWRTStdDBase[i]->GetRows(),
                             m_numElmt,m_iProdWRTStdDBase[i]->GetColumns(),
                             1.0, m_iProdWRTStdDBase[i]->GetRawPtr(),
@@ -137,6 +137,7 @@ class IProductWRTDerivBase_StdMat : public Operator
     protected:
         Array<OneD, DNekMatSharedPtr>   m_iProdWRTStdDBase;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, const NekDouble>    m_jac;
         int                             m_dim;
         int                             m_coordim;
@@ -172,6 +173,7 @@ class IProductWRTDerivBase_StdMat : public Operator
                 }
             }
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_jac      = pGeomData->GetJac(pCollExp);
             m_wspSize = m_dim*nqtot*m_numElmt;
         }
@@ -265,18 +267,18 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[2] + dz/dxi in[3]
             for(int i = 0; i < m_dim; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < m_coordim; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*m_dim],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i +j*m_dim], in[j], tmp[i]);
                 }
             }
 
             // calculate Iproduct WRT Std Deriv
             // first component
-            Vmath::Vmul(ntot,m_jac,1,tmp[0],1,tmp[0],1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed, m_jac, tmp[0], tmp[0]);
             for(int n = 0; n < m_numElmt; ++n)
             {
                 m_stdExp->IProductWRTDerivBase(0,tmp[0]+n*nPhys,
@@ -287,7 +289,7 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             for(int i = 1; i < m_dim; ++i)
             {
                 // multiply by Jacobian
-                Vmath::Vmul(ntot,m_jac,1,tmp[i],1,tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed, m_jac, tmp[i], tmp[i]);
                 for(int n = 0; n < m_numElmt; ++n)
                 {
                     m_stdExp->IProductWRTDerivBase(i,tmp[i]+n*nPhys,tmp[0]);
@@ -309,6 +311,7 @@ class IProductWRTDerivBase_IterPerExp : public Operator
 
     protected:
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, const NekDouble>    m_jac;
         int                             m_dim;
         int                             m_coordim;
@@ -326,6 +329,7 @@ class IProductWRTDerivBase_IterPerExp : public Operator
             int nqtot  = m_stdExp->GetTotPoints();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_jac      = pGeomData->GetJac(pCollExp);
             m_wspSize  = m_dim*nqtot*m_numElmt;
         }
@@ -523,9 +527,8 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
             boost::ignore_unused(output1, output2);
 
             Vmath::Vmul(m_numElmt*m_nquad0, m_jac, 1, input, 1, wsp, 1);
-            Vmath::Vmul(m_numElmt*m_nquad0, &m_derivFac[0][0], 1,
-                                            &wsp[0],           1,
-                                            &wsp[0],           1);
+            GeomVmul(m_numElmt*m_nquad0, m_numElmt, m_isDeformed,
+                     m_derivFac[0], wsp, wsp);
 
             // out = B0*in;
             Blas::Dgemm('T', 'N', m_nmodes0, m_numElmt, m_nquad0,
@@ -550,6 +553,7 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_derbase0;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
 
     private:
         IProductWRTDerivBase_SumFac_Seg(
@@ -562,6 +566,7 @@ class IProductWRTDerivBase_SumFac_Seg : public Operator
         {
             m_wspSize = m_numElmt*m_nquad0;
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_jac = pGeomData->GetJacWithStdWeights(pCollExp);
         }
 };
@@ -611,12 +616,12 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[1]
             for(int i = 0; i < 2; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < 2; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*2],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i +j*2], in[j], tmp[i]);
                 }
             }
 
@@ -656,6 +661,7 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
         const bool                      m_colldir1;
         int                             m_coordim;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
@@ -682,6 +688,7 @@ class IProductWRTDerivBase_SumFac_Quad : public Operator
             m_coordim  = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
@@ -763,12 +770,13 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
 
             for(int i = 0; i < 2; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1, tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
 
                 for(int j = 1; j < 2; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i +j*2],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i +j*2], in[j], tmp[i]);
                 }
             }
 
@@ -816,6 +824,7 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
         const bool                      m_colldir1;
         int                             m_coordim;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, const NekDouble>    m_jac;
         Array<OneD, const NekDouble>    m_base0;
         Array<OneD, const NekDouble>    m_base1;
@@ -845,6 +854,7 @@ class IProductWRTDerivBase_SumFac_Tri : public Operator
             m_coordim  = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_jac      = pGeomData->GetJacWithStdWeights(pCollExp);
             m_wspSize  = 4 * m_numElmt * (max(m_nquad0*m_nquad1,
                                               m_nmodes0*m_nmodes1));
@@ -934,12 +944,12 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
             // calculate dx/dxi in[0] + dy/dxi in[1] + dz/dxi in[2]
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i+3*j], in[j], tmp[i]);
                 }
             }
 
@@ -995,6 +1005,7 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
 
     private:
         IProductWRTDerivBase_SumFac_Hex(
@@ -1022,6 +1033,7 @@ class IProductWRTDerivBase_SumFac_Hex : public Operator
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
         }
 };
 
@@ -1122,11 +1134,12 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
 
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i+3*j], in[j], tmp[i]);
                 }
             }
 
@@ -1205,6 +1218,7 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         Array<OneD, NekDouble>          m_fac2;
@@ -1234,6 +1248,7 @@ class IProductWRTDerivBase_SumFac_Tet : public Operator
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
 
             const Array<OneD, const NekDouble>& z0
@@ -1373,12 +1388,12 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
 
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1,
-                             tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i+3*j], in[j], tmp[i]);
                 }
             }
             wsp1   = wsp + 3*nmax;
@@ -1443,6 +1458,7 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         bool                            m_sortTopVertex;
@@ -1470,6 +1486,7 @@ class IProductWRTDerivBase_SumFac_Prism : public Operator
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             if(m_stdExp->GetBasis(0)->GetBasisType()
                     == LibUtilities::eModified_A)
@@ -1610,11 +1627,12 @@ class IProductWRTDerivBase_SumFac_Pyr : public Operator
             
             for(int i = 0; i < 3; ++i)
             {
-                Vmath::Vmul (ntot,m_derivFac[i],1, in[0],1, tmp[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i], in[0], tmp[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot,m_derivFac[i+3*j],1,
-                                  in[j],1, tmp[i], 1, tmp[i],1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i+3*j], in[j], tmp[i]);
                 }
             }
             wsp1   = wsp + 3*nmax;
@@ -1687,6 +1705,7 @@ class IProductWRTDerivBase_SumFac_Pyr : public Operator
         Array<OneD, const NekDouble>    m_derbase1;
         Array<OneD, const NekDouble>    m_derbase2;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         Array<OneD, NekDouble>          m_fac0;
         Array<OneD, NekDouble>          m_fac1;
         Array<OneD, NekDouble>          m_fac2;
@@ -1715,6 +1734,7 @@ class IProductWRTDerivBase_SumFac_Pyr : public Operator
             m_wspSize  = 6 * m_numElmt * (max(m_nquad0*m_nquad1*m_nquad2,
                                               m_nmodes0*m_nmodes1*m_nmodes2));
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             if(m_stdExp->GetBasis(0)->GetBasisType()
                     == LibUtilities::eModified_A)
@@ -68,6 +68,12 @@ enum OperatorType
     eIProductWRTBase,
     eIProductWRTDerivBase,
     ePhysDeriv,
+    eHelmholtz,
+    eLaplacian,
+    eFwdTrans,
+    ePhysInterp1DScaled,
+    ePhysGalerkinProjection1DScaled,
+    ePhysDerivIProductWRTDerivBase,
     SIZE_OperatorType
 };
 
@@ -76,7 +82,13 @@ const char* const OperatorTypeMap[] =
     "BwdTrans",
     "IProductWRTBase",
     "IProductWRTDerivBase",
-    "PhysDeriv"
+    "PhysDeriv",
+    "Helmholtz",
+    "Laplacian",
+    "FwdTrans",
+    "PhysInterp1DScaled",
+    "PhysGalerkinProjection1DScaled",
+    "PhysDerivIProductWRTDerivBase"
 };
 
 enum ImplementationType
@@ -86,6 +98,7 @@ enum ImplementationType
     eIterPerExp,
     eStdMat,
     eSumFac,
+    eSumFacSIMD,
     SIZE_ImplementationType
 };
 
@@ -95,7 +108,8 @@ const char* const ImplementationTypeMap[] =
     "NoCollection",
     "IterPerExp",
     "StdMat",
-    "SumFac"
+    "SumFac",
+    "SumFacSIMD"
 };
 
 typedef bool ExpansionIsNodal;
@@ -138,6 +152,22 @@ class Operator
 
         COLLECTIONS_EXPORT virtual ~Operator();
 
+        /// Update the constant factors (e.g. the Helmholtz constant) used by
+        /// operators which depend on them
+        COLLECTIONS_EXPORT virtual void UpdateFactors(
+                const StdRegions::ConstFactorMap &factors)
+        {
+            boost::ignore_unused(factors);
+        }
+
+        /// Update the variable coefficients, given at the quadrature points
+        /// of the collection, used by operators which depend on them
+        COLLECTIONS_EXPORT virtual void UpdateVarCoeffs(
+                const StdRegions::VarCoeffMap &varcoeffs)
+        {
+            boost::ignore_unused(varcoeffs);
+        }
+
         /// Get the size of the required workspace
         int GetWspSize()
         {
@@ -36,6 +36,7 @@
 
 #include <Collections/Operator.h>
 #include <Collections/Collection.h>
+#include <Collections/SumFacSIMD.h>
 
 using namespace std;
 
@@ -97,10 +98,8 @@ class PhysDeriv_StdMat : public Operator
                 Vmath::Zero(ntot,out[i],1);
                 for(int j = 0; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i*m_dim+j], Diff[j], out[i]);
                 }
             }
         }
@@ -135,16 +134,15 @@ class PhysDeriv_StdMat : public Operator
             Vmath::Zero(ntot,output,1);
             for(int j = 0; j < m_dim; ++j)
             {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*m_dim+j], 1,
-                                    Diff[j],               1,
-                                    output,                1,
-                                    output,                1);
+                GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                          m_derivFac[dir*m_dim+j], Diff[j], output);
             }
         }
 
     protected:
         Array<OneD, DNekMatSharedPtr>   m_derivMat;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         int                             m_dim;
         int                             m_coordim;
 
@@ -180,6 +178,7 @@ class PhysDeriv_StdMat : public Operator
                 }
             }
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_wspSize = 3*nqtot*m_numElmt;
         }
 };
@@ -266,13 +265,12 @@ class PhysDeriv_IterPerExp : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*m_dim],1,Diff[0],1,out[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i*m_dim], Diff[0], out[i]);
                 for(int j = 1; j < m_dim; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*m_dim+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i*m_dim+j], Diff[j], out[i]);
                 }
             }
         }
@@ -303,18 +301,18 @@ class PhysDeriv_IterPerExp : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*m_dim],1,Diff[0],1,output,1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed,
+                     m_derivFac[dir*m_dim], Diff[0], output);
             for(int j = 1; j < m_dim; ++j)
             {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*m_dim+j], 1,
-                                    Diff[j],               1,
-                                    output,                1,
-                                    output,                1);
+                GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                          m_derivFac[dir*m_dim+j], Diff[j], output);
             }
         }
 
     protected:
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         int                             m_dim;
         int                             m_coordim;
 
@@ -334,6 +332,7 @@ class PhysDeriv_IterPerExp : public Operator
                 nqtot *= PtsKey[i].GetNumPoints();
             }
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
             m_wspSize = 3*nqtot*m_numElmt;
         }
 };
@@ -537,16 +536,20 @@ class PhysDeriv_SumFac_Seg : public Operator
                         input.get(), m_nquad0, 0.0,
                         diff0.get(), m_nquad0);
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[0], diff0, output0);
 
             if (m_coordim == 2)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[1], 1, diff0, 1, output1, 1);
+                GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                         m_derivFac[1], diff0, output1);
             }
             else if (m_coordim == 3)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[1], 1, diff0, 1, output1, 1);
-                Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output2, 1);
+                GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                         m_derivFac[1], diff0, output1);
+                GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                         m_derivFac[2], diff0, output2);
             }
         }
 
@@ -570,13 +573,15 @@ class PhysDeriv_SumFac_Seg : public Operator
                         input.get(), m_nquad0, 0.0,
                         diff0.get(), m_nquad0);
 
-            Vmath::Vmul(nqcol, m_derivFac[dir], 1, diff0, 1, output, 1);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[dir], diff0, output);
         }
 
     protected:
         int                             m_coordim;
         const int                       m_nquad0;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         NekDouble                      *m_Deriv0;
 
     private:
@@ -590,6 +595,7 @@ class PhysDeriv_SumFac_Seg : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_wspSize = m_nquad0*m_numElmt;
@@ -649,18 +655,21 @@ class PhysDeriv_SumFac_Quad : public Operator
                             diff1.get() + cnt, m_nquad0);
             }
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[1], 1, diff1, 1, output0, 1,
-                                                             output0, 1);
-            Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output1, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[3], 1, diff1, 1, output1, 1,
-                                                             output1, 1);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[0], diff0, output0);
+            GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                      m_derivFac[1], diff1, output0);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[2], diff0, output1);
+            GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                      m_derivFac[3], diff1, output1);
 
             if (m_coordim == 3)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[4], 1, diff0, 1, output2, 1);
-                Vmath::Vvtvp (nqcol, m_derivFac[5], 1, diff1, 1, output2, 1,
-                                                                 output2, 1);
+                GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                         m_derivFac[4], diff0, output2);
+                GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                          m_derivFac[5], diff1, output2);
             }
         }
 
@@ -695,9 +704,10 @@ class PhysDeriv_SumFac_Quad : public Operator
                             diff1.get() + cnt, m_nquad0);
             }
 
-            Vmath::Vmul  (nqcol, m_derivFac[2*dir]  , 1, diff0, 1, output, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[2*dir+1], 1, diff1, 1, output, 1,
-                                                                   output, 1);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[2*dir], diff0, output);
+            GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                      m_derivFac[2*dir+1], diff1, output);
         }
 
     protected:
@@ -705,6 +715,7 @@ class PhysDeriv_SumFac_Quad : public Operator
         const int                       m_nquad0;
         const int                       m_nquad1;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
 
@@ -720,6 +731,7 @@ class PhysDeriv_SumFac_Quad : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -788,19 +800,21 @@ class PhysDeriv_SumFac_Tri : public Operator
             }
 
 
-            Vmath::Vmul  (nqcol, m_derivFac[0], 1, diff0, 1, output0, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[1], 1, diff1, 1,
-                          output0, 1, output0, 1);
-            Vmath::Vmul  (nqcol, m_derivFac[2], 1, diff0, 1, output1, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[3], 1, diff1, 1,
-                          output1, 1, output1, 1);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[0], diff0, output0);
+            GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                      m_derivFac[1], diff1, output0);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[2], diff0, output1);
+            GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                      m_derivFac[3], diff1, output1);
 
             if (m_coordim == 3)
             {
-                Vmath::Vmul  (nqcol, m_derivFac[4], 1, diff0, 1,
-                              output2, 1);
-                Vmath::Vvtvp (nqcol, m_derivFac[5], 1, diff1, 1,
-                              output2, 1, output2, 1);
+                GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                         m_derivFac[4], diff0, output2);
+                GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                          m_derivFac[5], diff1, output2);
             }
         }
 
@@ -845,9 +859,10 @@ class PhysDeriv_SumFac_Tri : public Operator
             }
 
 
-            Vmath::Vmul  (nqcol, m_derivFac[2*dir]  , 1, diff0, 1, output, 1);
-            Vmath::Vvtvp (nqcol, m_derivFac[2*dir+1], 1, diff1, 1, output, 1,
-                                                                   output, 1);
+            GeomVmul(nqcol, m_numElmt, m_isDeformed,
+                     m_derivFac[2*dir], diff0, output);
+            GeomVvtvp(nqcol, m_numElmt, m_isDeformed,
+                      m_derivFac[2*dir+1], diff1, output);
         }
 
     protected:
@@ -855,6 +870,7 @@ class PhysDeriv_SumFac_Tri : public Operator
         const int                       m_nquad0;
         const int                       m_nquad1;
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         NekDouble                      *m_Deriv0;
         NekDouble                      *m_Deriv1;
         Array<OneD, NekDouble>          m_fac0;
@@ -872,6 +888,7 @@ class PhysDeriv_SumFac_Tri : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -971,13 +988,12 @@ class PhysDeriv_SumFac_Hex : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i*3], Diff[0], out[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j],               1,
-                                        out[i],                1,
-                                        out[i],                1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i*3+j], Diff[j], out[i]);
                 }
             }
         }
@@ -1020,18 +1036,18 @@ class PhysDeriv_SumFac_Hex : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed,
+                     m_derivFac[dir*3], Diff[0], output);
             for(int j = 1; j < 3; ++j)
             {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j],               1,
-                                    output,                1,
-                                    output,                1);
+                GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                          m_derivFac[dir*3+j], Diff[j], output);
             }
         }
 
     protected:
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1054,6 +1070,7 @@ class PhysDeriv_SumFac_Hex : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -1163,11 +1180,12 @@ class PhysDeriv_SumFac_Tet : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i*3], Diff[0], out[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i*3+j], Diff[j], out[i]);
                 }
             }
         }
@@ -1246,16 +1264,18 @@ class PhysDeriv_SumFac_Tet : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed,
+                     m_derivFac[dir*3], Diff[0], output);
             for(int j = 1; j < 3; ++j)
             {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j], 1, output, 1, output, 1);
+                GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                          m_derivFac[dir*3+j], Diff[j], output);
             }
         }
 
     protected:
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1282,6 +1302,7 @@ class PhysDeriv_SumFac_Tet : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             m_Deriv0 = &((m_stdExp->GetBasis(0)->GetD())->GetPtr())[0];
             m_Deriv1 = &((m_stdExp->GetBasis(1)->GetD())->GetPtr())[0];
@@ -1401,11 +1422,12 @@ class PhysDeriv_SumFac_Prism : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i*3], Diff[0], out[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i*3+j], Diff[j], out[i]);
                 }
             }
         }
@@ -1462,16 +1484,18 @@ class PhysDeriv_SumFac_Prism : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed,
+                     m_derivFac[dir*3], Diff[0], output);
             for(int j = 1; j < 3; ++j)
             {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j], 1, output, 1, output, 1);
+                GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                          m_derivFac[dir*3+j], Diff[j], output);
             }
         }
 
     protected:
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1496,6 +1520,7 @@ class PhysDeriv_SumFac_Prism : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -1611,11 +1636,12 @@ class PhysDeriv_SumFac_Pyr : public Operator
             // calculate full derivative
             for(int i = 0; i < m_coordim; ++i)
             {
-                Vmath::Vmul(ntot,m_derivFac[i*3],1,Diff[0],1,out[i],1);
+                GeomVmul(ntot, m_numElmt, m_isDeformed,
+                         m_derivFac[i*3], Diff[0], out[i]);
                 for(int j = 1; j < 3; ++j)
                 {
-                    Vmath::Vvtvp (ntot, m_derivFac[i*3+j], 1,
-                                        Diff[j], 1, out[i], 1, out[i], 1);
+                    GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                              m_derivFac[i*3+j], Diff[j], out[i]);
                 }
             }
         }
@@ -1678,16 +1704,18 @@ class PhysDeriv_SumFac_Pyr : public Operator
             }
 
             // calculate full derivative
-            Vmath::Vmul(ntot,m_derivFac[dir*3],1,Diff[0],1,output,1);
+            GeomVmul(ntot, m_numElmt, m_isDeformed,
+                     m_derivFac[dir*3], Diff[0], output);
             for(int j = 1; j < 3; ++j)
             {
-                Vmath::Vvtvp (ntot, m_derivFac[dir*3+j], 1,
-                                    Diff[j], 1, output, 1, output, 1);
+                GeomVvtvp(ntot, m_numElmt, m_isDeformed,
+                          m_derivFac[dir*3+j], Diff[j], output);
             }
         }
 
     protected:
         Array<TwoD, const NekDouble>    m_derivFac;
+        bool                            m_isDeformed;
         int                             m_coordim;
         const int                       m_nquad0;
         const int                       m_nquad1;
@@ -1713,6 +1741,7 @@ class PhysDeriv_SumFac_Pyr : public Operator
             m_coordim = pCollExp[0]->GetCoordim();
 
             m_derivFac = pGeomData->GetDerivFactors(pCollExp);
+            m_isDeformed = pGeomData->IsDeformed(pCollExp);
 
             const Array<OneD, const NekDouble>& z0
                                             = m_stdExp->GetBasis(0)->GetZ();
@@ -1757,5 +1786,168 @@ OperatorKey PhysDeriv_SumFac_Pyr::m_typeArr[] = {
         PhysDeriv_SumFac_Pyr::create, "PhysDeriv_SumFac_Pyr")
 };
 
+/**
+ * @brief Phys deriv operator using sum-factorisation on blocks of
+ * #SIMD_WIDTH interleaved elements (Seg, Quad and Hex).
+ *
+ * The derivative factors are interleaved once at construction.
+ */
+class PhysDeriv_SumFacSIMD : public Operator
+{
+    public:
+        OPERATOR_CREATE(PhysDeriv_SumFacSIMD)
+
+        virtual ~PhysDeriv_SumFacSIMD()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output0,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            Array<OneD, NekDouble> output[3] = { output0, output1, output2 };
+            ApplyBlocks(0, m_coordim, input, output, wsp);
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            Array<OneD, NekDouble> outputs[3];
+            outputs[dir] = output;
+            ApplyBlocks(dir, dir + 1, input, outputs, wsp);
+        }
+
+    protected:
+        const int                                m_dim;
+        const int                                m_nqtot;
+        int                                      m_coordim;
+        vector<int>                              m_nquad;
+        vector<const NekDouble *>                m_Deriv;
+        vector<Array<OneD, NekDouble> >          m_derivFac;
+
+        /// Evaluate the derivatives in coordinate directions [start,end)
+        void ApplyBlocks(
+                      int                           start,
+                      int                           end,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> *output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            ASSERTL1(wsp.size() == m_wspSize,
+                     "Incorrect workspace size");
+            ASSERTL1(input.size() >= m_nqtot*m_numElmt,
+                     "Incorrect input size");
+
+            const int nblock  = m_nqtot*SIMD_WIDTH;
+            const int nblocks = SIMDNumBlocks(m_numElmt);
+            NekDouble *in     = wsp.get();
+            NekDouble *out    = wsp.get() +   nblock;
+            NekDouble *diff   = wsp.get() + 2*nblock;
+
+            for (int b = 0; b < nblocks; ++b)
+            {
+                const int nelmt = min(SIMD_WIDTH,
+                                      int(m_numElmt) - b*SIMD_WIDTH);
+                const int el0   = b*SIMD_WIDTH;
+
+                SIMDInterleave(m_nqtot, nelmt,
+                               input.get() + el0*m_nqtot, in);
+
+                // Derivatives with respect to the standard coordinates
+                int nbefore = 1;
+                for (int d = 0; d < m_dim; ++d)
+                {
+                    const int nafter = m_nqtot / (nbefore*m_nquad[d]);
+                    SIMDTensorContract(false, m_nquad[d], m_nquad[d],
+                                       nbefore, nafter, m_Deriv[d], in,
+                                       diff + d*nblock);
+                    nbefore *= m_nquad[d];
+                }
+
+                // Apply the chain rule for each requested direction
+                for (int j = start; j < end; ++j)
+                {
+                    SIMDMultiply(m_nqtot,
+                                 m_derivFac[j*m_dim].get() + el0*m_nqtot,
+                                 diff, out);
+                    for (int d = 1; d < m_dim; ++d)
+                    {
+                        SIMDMultiplyAdd(m_nqtot,
+                                 m_derivFac[j*m_dim+d].get() + el0*m_nqtot,
+                                 diff + d*nblock, out);
+                    }
+
+                    SIMDDeinterleave(m_nqtot, nelmt, out,
+                                     output[j].get() + el0*m_nqtot);
+                }
+            }
+        }
+
+    private:
+        PhysDeriv_SumFacSIMD(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : Operator (pCollExp, pGeomData),
+              m_dim    (m_stdExp->GetShapeDimension()),
+              m_nqtot  (m_stdExp->GetTotPoints())
+        {
+            m_coordim = pCollExp[0]->GetCoordim();
+
+            for (int d = 0; d < m_dim; ++d)
+            {
+                m_nquad.push_back(m_stdExp->GetNumPoints(d));
+                m_Deriv.push_back(
+                    &((m_stdExp->GetBasis(d)->GetD())->GetPtr())[0]);
+            }
+
+            // The interleaved kernels need the factors at every point, so
+            // expand those stored once per element.
+            Array<TwoD, const NekDouble> derivFac =
+                pGeomData->GetDerivFactors(pCollExp);
+            const bool deformed = pGeomData->IsDeformed(pCollExp);
+            Array<OneD, NekDouble> fac(m_nqtot*m_numElmt);
+            for (int i = 0; i < m_dim*m_coordim; ++i)
+            {
+                if (deformed)
+                {
+                    Vmath::Vcopy(m_nqtot*m_numElmt, &derivFac[i][0], 1,
+                                 &fac[0], 1);
+                }
+                else
+                {
+                    for (int e = 0; e < m_numElmt; ++e)
+                    {
+                        Vmath::Fill(m_nqtot, derivFac[i][e],
+                                    &fac[e*m_nqtot], 1);
+                    }
+                }
+
+                m_derivFac.push_back(SIMDInterleaveArray(
+                                         m_nqtot, m_numElmt, fac.get()));
+            }
+
+            m_wspSize = (2 + m_dim)*m_nqtot*SIMD_WIDTH;
+        }
+};
+
+/// Factory initialisation for the PhysDeriv_SumFacSIMD operators
+OperatorKey PhysDeriv_SumFacSIMD::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       ePhysDeriv, eSumFacSIMD, false),
+        PhysDeriv_SumFacSIMD::create, "PhysDeriv_SumFacSIMD_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDeriv, eSumFacSIMD, false),
+        PhysDeriv_SumFacSIMD::create, "PhysDeriv_SumFacSIMD_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDeriv, eSumFacSIMD, false),
+        PhysDeriv_SumFacSIMD::create, "PhysDeriv_SumFacSIMD_Hex")
+};
+
 }
 }
@@ -0,0 +1,628 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: PhysDerivIProductWRTDerivBase.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Fused PhysDeriv and IProductWRTDerivBase operator
+// implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eTriangle;
+using LibUtilities::eHexahedron;
+using LibUtilities::eTetrahedron;
+using LibUtilities::ePrism;
+using LibUtilities::ePyramid;
+
+/**
+ * @brief Fused operator evaluating
+ * \f$ (\nabla \phi, \mathbf{D} \nabla u) \f$ for a function \f$ u \f$ given
+ * at the quadrature points, where \f$ \mathbf{D} \f$ is a symmetric tensor.
+ *
+ * The tensor is given pointwise by the StdRegions::eVarCoeffD00 to
+ * StdRegions::eVarCoeffD22 variable coefficients, with missing diagonal
+ * entries taken as one and missing off-diagonal entries as zero, which
+ * matches StdExpansion::LaplacianMatrixOp. Without any variable coefficients
+ * this is the weak Laplacian.
+ *
+ * Rather than sweeping the whole collection with PhysDeriv and then
+ * IProductWRTDerivBase, the collection is split into blocks of elements
+ * whose gradients fit in cache, and the reference derivatives, the
+ * geometric factors and the reference inner products are applied to one
+ * block before moving on to the next. The geometric factors are those of
+ * the whole collection, shared with its other operators through
+ * CoalescedGeomData, and are only retrieved on the first application.
+ *
+ * The reference operations use dense matrices for the StdMat variant and
+ * the elemental operations of the standard expansion, which are
+ * sum-factorised for tensor-product shapes, otherwise.
+ */
+class PhysDerivIProductWRTDerivBase_Helper : public Operator
+{
+    public:
+        virtual ~PhysDerivIProductWRTDerivBase_Helper()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            ASSERTL1(wsp.size() == m_wspSize,
+                     "Incorrect workspace size");
+
+            if (m_geomData)
+            {
+                Initialise();
+            }
+
+            const int nqblk = m_nqtot*m_blockSize;
+            const bool hasDiff = m_diff.size() > 0;
+
+            // Partition workspace: reference gradient, gradient, its
+            // product with the tensor and the coefficients of one element.
+            Array<OneD, Array<OneD, NekDouble> > ref(3), grad(3), flux(3);
+            for (int k = 0; k < m_dim; ++k)
+            {
+                ref[k] = Array<OneD, NekDouble>(nqblk, wsp + k*nqblk);
+            }
+            for (int i = 0; i < m_coordim; ++i)
+            {
+                grad[i] = Array<OneD, NekDouble>(
+                    nqblk, wsp + (m_dim + i)*nqblk);
+                flux[i] = hasDiff ? Array<OneD, NekDouble>(
+                    nqblk, wsp + (m_dim + m_coordim + i)*nqblk) : grad[i];
+            }
+            Array<OneD, NekDouble> tmp(
+                m_ncoeffs, wsp + (m_dim + 2*m_coordim)*nqblk);
+
+            for (int e0 = 0; e0 < m_numElmt; e0 += m_blockSize)
+            {
+                const int ne   = min(m_blockSize, (int) m_numElmt - e0);
+                const int nq   = m_nqtot*ne;
+                const int qoff = m_nqtot*e0;
+
+                // Offset of the block in the geometric factors, which hold
+                // one value per element if the collection is not deformed.
+                const int foff = m_isDeformed ? qoff : e0;
+
+                // grad u
+                ReferencePhysDeriv(ne, input + qoff, ref);
+                for (int i = 0; i < m_coordim; ++i)
+                {
+                    Vmath::Zero(nq, grad[i], 1);
+                    for (int k = 0; k < m_dim; ++k)
+                    {
+                        GeomVvtvp(nq, ne, m_isDeformed,
+                                  &m_derivFac[i*m_dim + k][0] + foff,
+                                  ref[k], grad[i]);
+                    }
+                }
+
+                // D grad u
+                if (hasDiff)
+                {
+                    for (int i = 0; i < m_coordim; ++i)
+                    {
+                        Vmath::Zero(nq, flux[i], 1);
+                        for (int j = 0; j < m_coordim; ++j)
+                        {
+                            const Array<OneD, const NekDouble> &d =
+                                m_diff[i*m_coordim + j];
+                            if (d.size())
+                            {
+                                Vmath::Vvtvp(nq, d + qoff, 1, grad[j], 1,
+                                             flux[i], 1, flux[i], 1);
+                            }
+                            else if (i == j)
+                            {
+                                Vmath::Vadd(nq, grad[j], 1, flux[i], 1,
+                                            flux[i], 1);
+                            }
+                        }
+                    }
+                }
+
+                // (grad phi, D grad u)
+                for (int k = 0; k < m_dim; ++k)
+                {
+                    GeomVmul(nq, ne, m_isDeformed,
+                             &m_derivFac[k][0] + foff, flux[0], ref[k]);
+                    for (int i = 1; i < m_coordim; ++i)
+                    {
+                        GeomVvtvp(nq, ne, m_isDeformed,
+                                  &m_derivFac[k + i*m_dim][0] + foff,
+                                  flux[i], ref[k]);
+                    }
+                    GeomVmul(nq, ne, m_isDeformed, &m_jac[0] + foff,
+                             ref[k], ref[k]);
+                }
+                ReferenceIProductWRTDerivBase(
+                    ne, ref, output + m_ncoeffs*e0, tmp);
+            }
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+        virtual void UpdateVarCoeffs(const StdRegions::VarCoeffMap &varcoeffs)
+        {
+            const StdRegions::VarCoeffType keys[3][3] = {
+                {StdRegions::eVarCoeffD00, StdRegions::eVarCoeffD01,
+                 StdRegions::eVarCoeffD02},
+                {StdRegions::eVarCoeffD01, StdRegions::eVarCoeffD11,
+                 StdRegions::eVarCoeffD12},
+                {StdRegions::eVarCoeffD02, StdRegions::eVarCoeffD12,
+                 StdRegions::eVarCoeffD22}
+            };
+
+            m_diff.clear();
+            bool hasDiff = false;
+            vector<Array<OneD, const NekDouble> > diff(m_coordim*m_coordim);
+
+            for (int i = 0; i < m_coordim; ++i)
+            {
+                for (int j = 0; j < m_coordim; ++j)
+                {
+                    auto x = varcoeffs.find(keys[i][j]);
+                    if (x != varcoeffs.end())
+                    {
+                        diff[i*m_coordim + j] = x->second;
+                        hasDiff = true;
+                    }
+                }
+            }
+
+            if (hasDiff)
+            {
+                m_diff = diff;
+            }
+        }
+
+    protected:
+        vector<StdRegions::StdExpansionSharedPtr> m_collExp;
+        /// Geometric data of the collection, reset once retrieved
+        CoalescedGeomDataSharedPtr              m_geomData;
+        bool                                    m_stdMat;
+        int                                     m_blockSize;
+        int                                     m_dim;
+        int                                     m_coordim;
+        int                                     m_nqtot;
+        int                                     m_ncoeffs;
+        Array<TwoD, const NekDouble>            m_derivFac;
+        Array<OneD, const NekDouble>            m_jac;
+        bool                                    m_isDeformed;
+        /// Reference derivative and inner product matrices for StdMat
+        vector<DNekMatSharedPtr>                m_derivMat;
+        vector<DNekMatSharedPtr>                m_iprodMat;
+        /// Entries of the tensor, row by row; empty if not set
+        vector<Array<OneD, const NekDouble> >   m_diff;
+
+        PhysDerivIProductWRTDerivBase_Helper(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData,
+                ImplementationType                        impType)
+            : Operator (pCollExp, pGeomData),
+              m_collExp(pCollExp),
+              m_geomData(pGeomData),
+              m_stdMat (impType == eStdMat),
+              m_dim    (m_stdExp->GetShapeDimension()),
+              m_coordim(pCollExp[0]->GetCoordim()),
+              m_nqtot  (m_stdExp->GetTotPoints()),
+              m_ncoeffs(m_stdExp->GetNcoeffs())
+        {
+            // Aim for the reference gradient, gradient and flux arrays of a
+            // block to fit in 256kB.
+            const int cacheSize = 32768;
+            const int narrays   = m_dim + 2*m_coordim;
+            m_blockSize = max(1, cacheSize/(narrays*m_nqtot));
+            m_blockSize = min(m_blockSize, (int) m_numElmt);
+
+            m_wspSize = narrays*m_nqtot*m_blockSize + m_ncoeffs;
+        }
+
+        /// Retrieve the geometric factors and set up the reference matrices
+        void Initialise()
+        {
+            m_derivFac   = m_geomData->GetDerivFactors(m_collExp);
+            m_jac        = m_geomData->GetJac(m_collExp);
+            m_isDeformed = m_geomData->IsDeformed(m_collExp);
+            m_geomData.reset();
+
+            if (!m_stdMat)
+            {
+                return;
+            }
+
+            Array<OneD, NekDouble> tmp(m_nqtot), tmp1(m_nqtot),
+                tmp2(m_ncoeffs);
+            for (int k = 0; k < m_dim; ++k)
+            {
+                m_derivMat.push_back(MemoryManager<DNekMat>
+                    ::AllocateSharedPtr(m_nqtot, m_nqtot));
+                m_iprodMat.push_back(MemoryManager<DNekMat>
+                    ::AllocateSharedPtr(m_ncoeffs, m_nqtot));
+
+                for (int j = 0; j < m_nqtot; ++j)
+                {
+                    Vmath::Zero(m_nqtot, tmp, 1);
+                    tmp[j] = 1.0;
+                    m_stdExp->PhysDeriv(k, tmp, tmp1);
+                    Vmath::Vcopy(m_nqtot, &tmp1[0], 1,
+                                 &(m_derivMat[k]->GetPtr())[0] + j*m_nqtot,
+                                 1);
+                    m_stdExp->IProductWRTDerivBase(k, tmp, tmp2);
+                    Vmath::Vcopy(m_ncoeffs, &tmp2[0], 1,
+                                 &(m_iprodMat[k]->GetPtr())[0] +
+                                     j*m_ncoeffs, 1);
+                }
+            }
+        }
+
+        /// Reference derivatives of @p ne elements
+        void ReferencePhysDeriv(
+                const int                             ne,
+                const Array<OneD, const NekDouble>   &input,
+                Array<OneD, Array<OneD, NekDouble> > &ref)
+        {
+            if (m_stdMat)
+            {
+                for (int k = 0; k < m_dim; ++k)
+                {
+                    Blas::Dgemm('N', 'N', m_nqtot, ne, m_nqtot, 1.0,
+                                m_derivMat[k]->GetRawPtr(), m_nqtot,
+                                input.get(), m_nqtot, 0.0,
+                                ref[k].get(), m_nqtot);
+                }
+                return;
+            }
+
+            Array<OneD, NekDouble> d0, d1, d2;
+            for (int e = 0; e < ne; ++e)
+            {
+                d0 = ref[0] + e*m_nqtot;
+                d1 = m_dim > 1 ? ref[1] + e*m_nqtot : NullNekDouble1DArray;
+                d2 = m_dim > 2 ? ref[2] + e*m_nqtot : NullNekDouble1DArray;
+                m_stdExp->PhysDeriv(input + e*m_nqtot, d0, d1, d2);
+            }
+        }
+
+        /// Reference inner products of @p ne elements with respect to the
+        /// derivatives of the basis, summed over the directions
+        void ReferenceIProductWRTDerivBase(
+                const int                             ne,
+                Array<OneD, Array<OneD, NekDouble> > &ref,
+                Array<OneD, NekDouble>                output,
+                Array<OneD, NekDouble>               &tmp)
+        {
+            if (m_stdMat)
+            {
+                for (int k = 0; k < m_dim; ++k)
+                {
+                    Blas::Dgemm('N', 'N', m_ncoeffs, ne, m_nqtot, 1.0,
+                                m_iprodMat[k]->GetRawPtr(), m_ncoeffs,
+                                ref[k].get(), m_nqtot, k > 0 ? 1.0 : 0.0,
+                                output.get(), m_ncoeffs);
+                }
+                return;
+            }
+
+            Array<OneD, NekDouble> out;
+            for (int e = 0; e < ne; ++e)
+            {
+                out = output + e*m_ncoeffs;
+                m_stdExp->IProductWRTDerivBase(0, ref[0] + e*m_nqtot, out);
+                for (int k = 1; k < m_dim; ++k)
+                {
+                    m_stdExp->IProductWRTDerivBase(
+                        k, ref[k] + e*m_nqtot, tmp);
+                    Vmath::Vadd(m_ncoeffs, tmp, 1, out, 1, out, 1);
+                }
+            }
+        }
+};
+
+
+/**
+ * @brief Fused PhysDeriv and IProductWRTDerivBase operator using standard matrix approach
+ */
+class PhysDerivIProductWRTDerivBase_StdMat : public PhysDerivIProductWRTDerivBase_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysDerivIProductWRTDerivBase_StdMat)
+
+        virtual ~PhysDerivIProductWRTDerivBase_StdMat()
+        {
+        }
+
+    private:
+        PhysDerivIProductWRTDerivBase_StdMat(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysDerivIProductWRTDerivBase_Helper(pCollExp, pGeomData,
+                                                   eStdMat)
+        {
+        }
+};
+
+/// Factory initialisation for the PhysDerivIProductWRTDerivBase_StdMat operators
+OperatorKey PhysDerivIProductWRTDerivBase_StdMat::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eStdMat, true),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eStdMat, true),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eStdMat, true),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDerivIProductWRTDerivBase, eStdMat, false),
+        PhysDerivIProductWRTDerivBase_StdMat::create,
+        "PhysDerivIProductWRTDerivBase_StdMat_Hex")
+};
+
+/**
+ * @brief Fused PhysDeriv and IProductWRTDerivBase operator using element-wise operation
+ */
+class PhysDerivIProductWRTDerivBase_IterPerExp : public PhysDerivIProductWRTDerivBase_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysDerivIProductWRTDerivBase_IterPerExp)
+
+        virtual ~PhysDerivIProductWRTDerivBase_IterPerExp()
+        {
+        }
+
+    private:
+        PhysDerivIProductWRTDerivBase_IterPerExp(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysDerivIProductWRTDerivBase_Helper(pCollExp, pGeomData,
+                                                   eIterPerExp)
+        {
+        }
+};
+
+/// Factory initialisation for the PhysDerivIProductWRTDerivBase_IterPerExp operators
+OperatorKey PhysDerivIProductWRTDerivBase_IterPerExp::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eIterPerExp, true),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eIterPerExp, true),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eIterPerExp, true),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDerivIProductWRTDerivBase, eIterPerExp, false),
+        PhysDerivIProductWRTDerivBase_IterPerExp::create,
+        "PhysDerivIProductWRTDerivBase_IterPerExp_Hex")
+};
+
+/**
+ * @brief Fused PhysDeriv and IProductWRTDerivBase operator using sum-factorisation
+ */
+class PhysDerivIProductWRTDerivBase_SumFac : public PhysDerivIProductWRTDerivBase_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysDerivIProductWRTDerivBase_SumFac)
+
+        virtual ~PhysDerivIProductWRTDerivBase_SumFac()
+        {
+        }
+
+    private:
+        PhysDerivIProductWRTDerivBase_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysDerivIProductWRTDerivBase_Helper(pCollExp, pGeomData,
+                                                   eSumFac)
+        {
+        }
+};
+
+/// Factory initialisation for the PhysDerivIProductWRTDerivBase_SumFac operators
+OperatorKey PhysDerivIProductWRTDerivBase_SumFac::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDerivIProductWRTDerivBase, eSumFac, false),
+        PhysDerivIProductWRTDerivBase_SumFac::create,
+        "PhysDerivIProductWRTDerivBase_SumFac_Hex")
+};
+
+/**
+ * @brief Fused PhysDeriv and IProductWRTDerivBase operator using the elemental operations
+ */
+class PhysDerivIProductWRTDerivBase_NoCollection : public PhysDerivIProductWRTDerivBase_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysDerivIProductWRTDerivBase_NoCollection)
+
+        virtual ~PhysDerivIProductWRTDerivBase_NoCollection()
+        {
+        }
+
+    private:
+        PhysDerivIProductWRTDerivBase_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysDerivIProductWRTDerivBase_Helper(pCollExp, pGeomData,
+                                                   eNoCollection)
+        {
+        }
+};
+
+/// Factory initialisation for the PhysDerivIProductWRTDerivBase_NoCollection operators
+OperatorKey PhysDerivIProductWRTDerivBase_NoCollection::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment,       ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle,      ePhysDerivIProductWRTDerivBase, eNoCollection, true),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron,   ePhysDerivIProductWRTDerivBase, eNoCollection, true),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid,       ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism,         ePhysDerivIProductWRTDerivBase, eNoCollection, true),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron,    ePhysDerivIProductWRTDerivBase, eNoCollection, false),
+        PhysDerivIProductWRTDerivBase_NoCollection::create,
+        "PhysDerivIProductWRTDerivBase_NoCollection_Hex")
+};
+
+}
+}
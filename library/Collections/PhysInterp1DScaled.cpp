@@ -0,0 +1,714 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: PhysInterp1DScaled.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: PhysInterp1DScaled and PhysGalerkinProjection1DScaled operator
+// implementations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <Collections/Operator.h>
+#include <Collections/Collection.h>
+#include <LibUtilities/Foundations/ManagerAccess.h>
+#include <LibUtilities/Foundations/Interp.h>
+#include <LibUtilities/Foundations/PhysGalerkinProject.h>
+
+using namespace std;
+
+namespace Nektar {
+namespace Collections {
+
+using LibUtilities::eSegment;
+using LibUtilities::eQuadrilateral;
+using LibUtilities::eTriangle;
+using LibUtilities::eHexahedron;
+using LibUtilities::eTetrahedron;
+using LibUtilities::ePrism;
+using LibUtilities::ePyramid;
+
+/**
+ * @brief Base class for the operators mapping between the quadrature points
+ * of the collection and a set of points whose number is scaled by a constant
+ * factor in each direction, as used for dealiasing.
+ *
+ * The ePhysInterp1DScaled operators interpolate from the quadrature points to
+ * the scaled points, whilst the ePhysGalerkinProjection1DScaled operators
+ * project from the scaled points back onto the quadrature points. In both
+ * cases the operation is a tensor product of one-dimensional matrices. The
+ * scaling is taken from the StdRegions::eFactorConst factor and defaults to
+ * 1.5.
+ */
+class PhysInterp1DScaled_Helper : public Operator
+{
+    public:
+        virtual ~PhysInterp1DScaled_Helper()
+        {
+        }
+
+        virtual void operator()(
+                      int                           dir,
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(dir, input, output, wsp);
+            NEKERROR(ErrorUtil::efatal, "Not valid for this operator.");
+        }
+
+        virtual void UpdateFactors(const StdRegions::ConstFactorMap &factors)
+        {
+            auto x = factors.find(StdRegions::eFactorConst);
+            NekDouble scale = x == factors.end() ? 1.5 : x->second;
+
+            if (scale != m_scale)
+            {
+                m_scale = scale;
+                SetUp();
+            }
+        }
+
+    protected:
+        /// Project from the scaled points rather than interpolate to them.
+        bool                                m_project;
+        NekDouble                           m_scale;
+        int                                 m_dim;
+        /// Number of input and output points in each direction.
+        vector<int>                         m_nIn;
+        vector<int>                         m_nOut;
+        int                                 m_nqIn;
+        int                                 m_nqOut;
+        /// Quadrature points of the collection in each direction.
+        LibUtilities::PointsKeyVector       m_pointsKeys;
+        /// Scaled points in each direction.
+        LibUtilities::PointsKeyVector       m_scaledKeys;
+        /// One-dimensional operators, null if the points are unchanged.
+        vector<DNekMatSharedPtr>            m_mat1D;
+
+        PhysInterp1DScaled_Helper(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData,
+                bool                                      project)
+            : Operator    (pCollExp, pGeomData),
+              m_project   (project),
+              m_scale     (1.5),
+              m_dim       (pCollExp[0]->GetShapeDimension()),
+              m_pointsKeys(pCollExp[0]->GetPointsKeys())
+        {
+        }
+
+        /// Set up the one-dimensional operators for the current scaling.
+        virtual void SetUp()
+        {
+            m_scaledKeys.clear();
+            m_mat1D.clear();
+            m_nIn.resize(m_dim);
+            m_nOut.resize(m_dim);
+            m_nqIn = m_nqOut = 1;
+
+            for (int i = 0; i < m_dim; ++i)
+            {
+                const LibUtilities::PointsKey &pkey = m_pointsKeys[i];
+                int npts = pkey.GetNumPoints();
+                LibUtilities::PointsKey skey((int) (npts*m_scale),
+                                             pkey.GetPointsType());
+                m_scaledKeys.push_back(skey);
+
+                if (pkey == skey)
+                {
+                    m_mat1D.push_back(DNekMatSharedPtr());
+                }
+                else if (m_project)
+                {
+                    m_mat1D.push_back(LibUtilities::PointsManager()[pkey]
+                                      ->GetGalerkinProjection(skey));
+                }
+                else
+                {
+                    m_mat1D.push_back(LibUtilities::PointsManager()[pkey]
+                                      ->GetI(skey));
+                }
+
+                m_nIn[i]  = m_project ? skey.GetNumPoints() : npts;
+                m_nOut[i] = m_project ? npts : skey.GetNumPoints();
+                m_nqIn   *= m_nIn[i];
+                m_nqOut  *= m_nOut[i];
+            }
+
+            // Two buffers holding the largest intermediate result.
+            int maxSize = 0;
+            for (int i = 0; i < m_dim - 1; ++i)
+            {
+                int size = m_numElmt;
+                for (int j = 0; j < m_dim; ++j)
+                {
+                    size *= j <= i ? m_nOut[j] : m_nIn[j];
+                }
+                maxSize = max(maxSize, size);
+            }
+            m_wspSize = 2*maxSize;
+        }
+
+        /**
+         * @brief Apply the one-dimensional operators to @a nElmt consecutive
+         * elements, one direction at a time.
+         */
+        void ApplyTensor(
+                const int                      nElmt,
+                const NekDouble               *input,
+                      NekDouble               *output,
+                      NekDouble               *wsp)
+        {
+            const NekDouble *in  = input;
+            NekDouble       *buf[2] = {wsp, wsp + m_wspSize/2};
+
+            // Directions before i have already been transformed.
+            int before = 1;
+            for (int i = 0; i < m_dim; ++i)
+            {
+                int after = nElmt;
+                for (int j = i + 1; j < m_dim; ++j)
+                {
+                    after *= m_nIn[j];
+                }
+
+                NekDouble *out = i == m_dim - 1 ? output : buf[i % 2];
+
+                if (!m_mat1D[i])
+                {
+                    Vmath::Vcopy(before*m_nIn[i]*after, in, 1, out, 1);
+                }
+                else if (i == 0)
+                {
+                    Blas::Dgemm('N', 'N', m_nOut[0], after, m_nIn[0], 1.0,
+                                m_mat1D[0]->GetRawPtr(), m_nOut[0],
+                                in, m_nIn[0], 0.0, out, m_nOut[0]);
+                }
+                else
+                {
+                    for (int j = 0; j < after; ++j)
+                    {
+                        Blas::Dgemm('N', 'T', before, m_nOut[i], m_nIn[i],
+                                    1.0, in + j*before*m_nIn[i], before,
+                                    m_mat1D[i]->GetRawPtr(), m_nOut[i], 0.0,
+                                    out + j*before*m_nOut[i], before);
+                    }
+                }
+
+                before *= m_nOut[i];
+                in      = out;
+            }
+        }
+};
+
+/**
+ * @brief Scaled interpolation/projection operator using the elemental
+ * LibUtilities routines.
+ */
+template<bool PROJECT>
+class PhysInterp1DScaled_NoCollection : public PhysInterp1DScaled_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysInterp1DScaled_NoCollection)
+
+        virtual ~PhysInterp1DScaled_NoCollection()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            const LibUtilities::PointsKeyVector &from =
+                PROJECT ? m_scaledKeys : m_pointsKeys;
+            const LibUtilities::PointsKeyVector &to   =
+                PROJECT ? m_pointsKeys : m_scaledKeys;
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                const NekDouble *in  = &input [i*m_nqIn];
+                      NekDouble *out = &output[i*m_nqOut];
+
+                switch (m_dim)
+                {
+                    case 1:
+                        // The one-dimensional Galerkin projection is
+                        // applied through the tensor kernel, matching the
+                        // two- and three-dimensional routines.
+                        if (PROJECT)
+                        {
+                            ApplyTensor(1, in, out, wsp.get());
+                        }
+                        else
+                        {
+                            LibUtilities::Interp1D(from[0], in, to[0], out);
+                        }
+                        break;
+                    case 2:
+                        if (PROJECT)
+                        {
+                            LibUtilities::PhysGalerkinProject2D(
+                                from[0], from[1], in, to[0], to[1], out);
+                        }
+                        else
+                        {
+                            LibUtilities::Interp2D(
+                                from[0], from[1], in, to[0], to[1], out);
+                        }
+                        break;
+                    case 3:
+                        if (PROJECT)
+                        {
+                            LibUtilities::PhysGalerkinProject3D(
+                                from[0], from[1], from[2], in,
+                                to[0], to[1], to[2], out);
+                        }
+                        else
+                        {
+                            LibUtilities::Interp3D(
+                                from[0], from[1], from[2], in,
+                                to[0], to[1], to[2], out);
+                        }
+                        break;
+                }
+            }
+        }
+
+    private:
+        PhysInterp1DScaled_NoCollection(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysInterp1DScaled_Helper(pCollExp, pGeomData, PROJECT)
+        {
+            SetUp();
+        }
+};
+
+template<> OperatorKey PhysInterp1DScaled_NoCollection<false>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eNoCollection, true),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eNoCollection, true),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eNoCollection, true),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysInterp1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<false>::create, "PhysInterp1DScaled_NoCollection_Hex")
+};
+
+template<> OperatorKey PhysInterp1DScaled_NoCollection<true>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eNoCollection, true),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eNoCollection, true),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eNoCollection, true),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysGalerkinProjection1DScaled, eNoCollection, false),
+        PhysInterp1DScaled_NoCollection<true>::create, "PhysGalerkinProjection1DScaled_NoCollection_Hex")
+};
+
+
+/**
+ * @brief Scaled interpolation/projection operator applying the tensor product
+ * of the one-dimensional matrices element by element.
+ */
+template<bool PROJECT>
+class PhysInterp1DScaled_IterPerExp : public PhysInterp1DScaled_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysInterp1DScaled_IterPerExp)
+
+        virtual ~PhysInterp1DScaled_IterPerExp()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            for (int i = 0; i < m_numElmt; ++i)
+            {
+                ApplyTensor(1, &input[i*m_nqIn], &output[i*m_nqOut],
+                            wsp.get());
+            }
+        }
+
+    private:
+        PhysInterp1DScaled_IterPerExp(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysInterp1DScaled_Helper(pCollExp, pGeomData, PROJECT)
+        {
+            SetUp();
+        }
+};
+
+template<> OperatorKey PhysInterp1DScaled_IterPerExp<false>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eIterPerExp, true),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eIterPerExp, true),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eIterPerExp, true),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysInterp1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<false>::create, "PhysInterp1DScaled_IterPerExp_Hex")
+};
+
+template<> OperatorKey PhysInterp1DScaled_IterPerExp<true>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eIterPerExp, true),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eIterPerExp, true),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eIterPerExp, true),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysGalerkinProjection1DScaled, eIterPerExp, false),
+        PhysInterp1DScaled_IterPerExp<true>::create, "PhysGalerkinProjection1DScaled_IterPerExp_Hex")
+};
+
+
+/**
+ * @brief Scaled interpolation/projection operator using a single matrix,
+ * formed as the Kronecker product of the one-dimensional matrices, applied
+ * to all elements with one matrix-matrix multiplication.
+ */
+template<bool PROJECT>
+class PhysInterp1DScaled_StdMat : public PhysInterp1DScaled_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysInterp1DScaled_StdMat)
+
+        virtual ~PhysInterp1DScaled_StdMat()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2, wsp);
+
+            Blas::Dgemm('N', 'N', m_nqOut, m_numElmt, m_nqIn, 1.0,
+                        m_mat->GetRawPtr(), m_nqOut, input.get(), m_nqIn,
+                        0.0, output.get(), m_nqOut);
+        }
+
+    protected:
+        DNekMatSharedPtr m_mat;
+
+        virtual void SetUp()
+        {
+            PhysInterp1DScaled_Helper::SetUp();
+            m_wspSize = 0;
+
+            m_mat = MemoryManager<DNekMat>::AllocateSharedPtr(
+                m_nqOut, m_nqIn, 0.0);
+
+            for (int q = 0; q < m_nqIn; ++q)
+            {
+                for (int p = 0; p < m_nqOut; ++p)
+                {
+                    NekDouble val = 1.0;
+                    for (int i = 0, pi = p, qi = q; i < m_dim; ++i)
+                    {
+                        int pd = pi % m_nOut[i], qd = qi % m_nIn[i];
+                        pi /= m_nOut[i];
+                        qi /= m_nIn[i];
+
+                        val *= m_mat1D[i] ? (*m_mat1D[i])(pd, qd)
+                                          : (NekDouble) (pd == qd);
+                    }
+                    (*m_mat)(p, q) = val;
+                }
+            }
+        }
+
+    private:
+        PhysInterp1DScaled_StdMat(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysInterp1DScaled_Helper(pCollExp, pGeomData, PROJECT)
+        {
+            SetUp();
+        }
+};
+
+template<> OperatorKey PhysInterp1DScaled_StdMat<false>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eStdMat, true),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eStdMat, true),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eStdMat, true),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysInterp1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<false>::create, "PhysInterp1DScaled_StdMat_Hex")
+};
+
+template<> OperatorKey PhysInterp1DScaled_StdMat<true>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eStdMat, true),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_NodalTri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eStdMat, true),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_NodalTet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eStdMat, true),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_NodalPrism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysGalerkinProjection1DScaled, eStdMat, false),
+        PhysInterp1DScaled_StdMat<true>::create, "PhysGalerkinProjection1DScaled_StdMat_Hex")
+};
+
+
+/**
+ * @brief Scaled interpolation/projection operator using sum-factorisation
+ * over all elements of the collection at once.
+ */
+template<bool PROJECT>
+class PhysInterp1DScaled_SumFac : public PhysInterp1DScaled_Helper
+{
+    public:
+        OPERATOR_CREATE(PhysInterp1DScaled_SumFac)
+
+        virtual ~PhysInterp1DScaled_SumFac()
+        {
+        }
+
+        virtual void operator()(
+                const Array<OneD, const NekDouble> &input,
+                      Array<OneD,       NekDouble> &output,
+                      Array<OneD,       NekDouble> &output1,
+                      Array<OneD,       NekDouble> &output2,
+                      Array<OneD,       NekDouble> &wsp)
+        {
+            boost::ignore_unused(output1, output2);
+
+            ApplyTensor(m_numElmt, input.get(), output.get(), wsp.get());
+        }
+
+    private:
+        PhysInterp1DScaled_SumFac(
+                vector<StdRegions::StdExpansionSharedPtr> pCollExp,
+                CoalescedGeomDataSharedPtr                pGeomData)
+            : PhysInterp1DScaled_Helper(pCollExp, pGeomData, PROJECT)
+        {
+            SetUp();
+        }
+};
+
+template<> OperatorKey PhysInterp1DScaled_SumFac<false>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysInterp1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<false>::create, "PhysInterp1DScaled_SumFac_Hex")
+};
+
+template<> OperatorKey PhysInterp1DScaled_SumFac<true>::m_typeArr[] = {
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eSegment, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Seg"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTriangle, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Tri"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eQuadrilateral, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Quad"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eTetrahedron, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Tet"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePyramid, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Pyr"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(ePrism, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Prism"),
+    GetOperatorFactory().RegisterCreatorFunction(
+        OperatorKey(eHexahedron, ePhysGalerkinProjection1DScaled, eSumFac, false),
+        PhysInterp1DScaled_SumFac<true>::create, "PhysGalerkinProjection1DScaled_SumFac_Hex")
+};
+
+}
+}
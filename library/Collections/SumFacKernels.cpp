@@ -0,0 +1,405 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacKernels.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sum-factorisation kernels specialised at compile time for
+// fixed numbers of modes and quadrature points.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <tuple>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <Collections/SumFacKernels.h>
+
+using namespace std;
+
+namespace Nektar
+{
+namespace Collections
+{
+
+namespace
+{
+
+/**
+ * @brief Quadrilateral backward transform for NM modes and NQ quadrature
+ * points in both directions.
+ */
+template<int NM, int NQ>
+void QuadBwdTransKernel(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *input, NekDouble *output)
+{
+    boost::ignore_unused(base2);
+
+    NekDouble tmp[NQ*NM];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NM*NM;
+        NekDouble       *out = output + e*NQ*NQ;
+
+        // tmp(i,q) = sum_p B0(i,p) in(p,q)
+        for (int q = 0; q < NM; ++q)
+        {
+            for (int i = 0; i < NQ; ++i)
+            {
+                NekDouble sum = 0.0;
+                for (int p = 0; p < NM; ++p)
+                {
+                    sum += base0[p*NQ+i] * in[p+q*NM];
+                }
+                tmp[i+q*NQ] = sum;
+            }
+        }
+
+        // out(i,j) = sum_q B1(j,q) tmp(i,q)
+        for (int j = 0; j < NQ; ++j)
+        {
+            for (int i = 0; i < NQ; ++i)
+            {
+                NekDouble sum = 0.0;
+                for (int q = 0; q < NM; ++q)
+                {
+                    sum += base1[q*NQ+j] * tmp[i+q*NQ];
+                }
+                out[i+j*NQ] = sum;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Quadrilateral inner product for NM modes and NQ quadrature points
+ * in both directions.
+ */
+template<int NM, int NQ>
+void QuadIProductKernel(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output)
+{
+    boost::ignore_unused(base2);
+
+    NekDouble f  [NQ*NQ];
+    NekDouble tmp[NM*NQ];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NQ*NQ;
+        const NekDouble *jc  = jac    + e*NQ*NQ;
+        NekDouble       *out = output + e*NM*NM;
+
+        for (int i = 0; i < NQ*NQ; ++i)
+        {
+            f[i] = jc[i] * in[i];
+        }
+
+        // tmp(p,j) = sum_i B0(i,p) f(i,j)
+        for (int j = 0; j < NQ; ++j)
+        {
+            for (int p = 0; p < NM; ++p)
+            {
+                NekDouble sum = 0.0;
+                for (int i = 0; i < NQ; ++i)
+                {
+                    sum += base0[p*NQ+i] * f[i+j*NQ];
+                }
+                tmp[p+j*NM] = sum;
+            }
+        }
+
+        // out(p,q) = sum_j B1(j,q) tmp(p,j)
+        for (int q = 0; q < NM; ++q)
+        {
+            for (int p = 0; p < NM; ++p)
+            {
+                NekDouble sum = 0.0;
+                for (int j = 0; j < NQ; ++j)
+                {
+                    sum += base1[q*NQ+j] * tmp[p+j*NM];
+                }
+                out[p+q*NM] = sum;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Hexahedral backward transform for NM modes and NQ quadrature
+ * points in all three directions.
+ */
+template<int NM, int NQ>
+void HexBwdTransKernel(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *input, NekDouble *output)
+{
+    NekDouble tmp1[NQ*NM*NM];
+    NekDouble tmp2[NQ*NQ*NM];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NM*NM*NM;
+        NekDouble       *out = output + e*NQ*NQ*NQ;
+
+        // tmp1(i,q,r) = sum_p B0(i,p) in(p,q,r)
+        for (int qr = 0; qr < NM*NM; ++qr)
+        {
+            for (int i = 0; i < NQ; ++i)
+            {
+                NekDouble sum = 0.0;
+                for (int p = 0; p < NM; ++p)
+                {
+                    sum += base0[p*NQ+i] * in[p+qr*NM];
+                }
+                tmp1[i+qr*NQ] = sum;
+            }
+        }
+
+        // tmp2(i,j,r) = sum_q B1(j,q) tmp1(i,q,r)
+        for (int r = 0; r < NM; ++r)
+        {
+            for (int j = 0; j < NQ; ++j)
+            {
+                for (int i = 0; i < NQ; ++i)
+                {
+                    NekDouble sum = 0.0;
+                    for (int q = 0; q < NM; ++q)
+                    {
+                        sum += base1[q*NQ+j] * tmp1[i+q*NQ+r*NQ*NM];
+                    }
+                    tmp2[i+j*NQ+r*NQ*NQ] = sum;
+                }
+            }
+        }
+
+        // out(i,j,k) = sum_r B2(k,r) tmp2(i,j,r)
+        for (int k = 0; k < NQ; ++k)
+        {
+            for (int ij = 0; ij < NQ*NQ; ++ij)
+            {
+                NekDouble sum = 0.0;
+                for (int r = 0; r < NM; ++r)
+                {
+                    sum += base2[r*NQ+k] * tmp2[ij+r*NQ*NQ];
+                }
+                out[ij+k*NQ*NQ] = sum;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Hexahedral inner product for NM modes and NQ quadrature points in
+ * all three directions.
+ */
+template<int NM, int NQ>
+void HexIProductKernel(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output)
+{
+    NekDouble f   [NQ*NQ*NQ];
+    NekDouble tmp1[NM*NQ*NQ];
+    NekDouble tmp2[NM*NM*NQ];
+
+    for (int e = 0; e < numElmt; ++e)
+    {
+        const NekDouble *in  = input  + e*NQ*NQ*NQ;
+        const NekDouble *jc  = jac    + e*NQ*NQ*NQ;
+        NekDouble       *out = output + e*NM*NM*NM;
+
+        for (int i = 0; i < NQ*NQ*NQ; ++i)
+        {
+            f[i] = jc[i] * in[i];
+        }
+
+        // tmp1(p,j,k) = sum_i B0(i,p) f(i,j,k)
+        for (int jk = 0; jk < NQ*NQ; ++jk)
+        {
+            for (int p = 0; p < NM; ++p)
+            {
+                NekDouble sum = 0.0;
+                for (int i = 0; i < NQ; ++i)
+                {
+                    sum += base0[p*NQ+i] * f[i+jk*NQ];
+                }
+                tmp1[p+jk*NM] = sum;
+            }
+        }
+
+        // tmp2(p,q,k) = sum_j B1(j,q) tmp1(p,j,k)
+        for (int k = 0; k < NQ; ++k)
+        {
+            for (int q = 0; q < NM; ++q)
+            {
+                for (int p = 0; p < NM; ++p)
+                {
+                    NekDouble sum = 0.0;
+                    for (int j = 0; j < NQ; ++j)
+                    {
+                        sum += base1[q*NQ+j] * tmp1[p+j*NM+k*NM*NQ];
+                    }
+                    tmp2[p+q*NM+k*NM*NM] = sum;
+                }
+            }
+        }
+
+        // out(p,q,r) = sum_k B2(k,r) tmp2(p,q,k)
+        for (int r = 0; r < NM; ++r)
+        {
+            for (int pq = 0; pq < NM*NM; ++pq)
+            {
+                NekDouble sum = 0.0;
+                for (int k = 0; k < NQ; ++k)
+                {
+                    sum += base2[r*NQ+k] * tmp2[pq+k*NM*NM];
+                }
+                out[pq+r*NM*NM] = sum;
+            }
+        }
+    }
+}
+
+typedef tuple<LibUtilities::ShapeType, int, int> KernelKey;
+
+/// Register the kernels for NM modes and NQ = NM + 1 quadrature points.
+template<int NM>
+void RegisterKernels(map<KernelKey, SumFacBwdTransKernel> &bwd,
+                     map<KernelKey, SumFacIProductKernel> &iprod)
+{
+    bwd  [KernelKey(LibUtilities::eQuadrilateral, NM, NM+1)] =
+        QuadBwdTransKernel<NM, NM+1>;
+    bwd  [KernelKey(LibUtilities::eHexahedron,    NM, NM+1)] =
+        HexBwdTransKernel <NM, NM+1>;
+    iprod[KernelKey(LibUtilities::eQuadrilateral, NM, NM+1)] =
+        QuadIProductKernel<NM, NM+1>;
+    iprod[KernelKey(LibUtilities::eHexahedron,    NM, NM+1)] =
+        HexIProductKernel <NM, NM+1>;
+}
+
+struct KernelTable
+{
+    map<KernelKey, SumFacBwdTransKernel> m_bwdTrans;
+    map<KernelKey, SumFacIProductKernel> m_iproduct;
+
+    KernelTable()
+    {
+        // Polynomial orders P = 1..10, i.e. P+1 modes
+        RegisterKernels< 2>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 3>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 4>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 5>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 6>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 7>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 8>(m_bwdTrans, m_iproduct);
+        RegisterKernels< 9>(m_bwdTrans, m_iproduct);
+        RegisterKernels<10>(m_bwdTrans, m_iproduct);
+        RegisterKernels<11>(m_bwdTrans, m_iproduct);
+    }
+};
+
+KernelTable &GetKernelTable()
+{
+    static KernelTable table;
+    return table;
+}
+
+/**
+ * @brief Build the lookup key for @p pExp, or return false if its bases
+ * do not qualify for a specialised kernel.
+ *
+ * All directions must share the same number of modes and quadrature
+ * points and none may be collocated, since the generic operators already
+ * skip the transform in that case.
+ */
+bool GetKernelKey(StdRegions::StdExpansionSharedPtr pExp, KernelKey &key)
+{
+    const int nmodes = pExp->GetBasisNumModes(0);
+    const int nquad  = pExp->GetNumPoints(0);
+
+    for (int i = 0; i < pExp->GetNumBases(); ++i)
+    {
+        if (pExp->GetBasisNumModes(i) != nmodes ||
+            pExp->GetNumPoints(i)     != nquad  ||
+            pExp->GetBasis(i)->Collocation())
+        {
+            return false;
+        }
+    }
+
+    key = KernelKey(pExp->DetShapeType(), nmodes, nquad);
+    return true;
+}
+
+}
+
+/**
+ * @brief Return the specialised backward transform kernel for the bases of
+ * @p pExp, or a null pointer if the generic path should be used.
+ */
+SumFacBwdTransKernel GetSumFacBwdTransKernel(
+    StdRegions::StdExpansionSharedPtr pExp)
+{
+    KernelKey key;
+    if (!GetKernelKey(pExp, key))
+    {
+        return nullptr;
+    }
+
+    map<KernelKey, SumFacBwdTransKernel> &table = GetKernelTable().m_bwdTrans;
+    auto it = table.find(key);
+    return it == table.end() ? nullptr : it->second;
+}
+
+/**
+ * @brief Return the specialised inner product kernel for the bases of
+ * @p pExp, or a null pointer if the generic path should be used.
+ */
+SumFacIProductKernel GetSumFacIProductKernel(
+    StdRegions::StdExpansionSharedPtr pExp)
+{
+    KernelKey key;
+    if (!GetKernelKey(pExp, key))
+    {
+        return nullptr;
+    }
+
+    map<KernelKey, SumFacIProductKernel> &table = GetKernelTable().m_iproduct;
+    auto it = table.find(key);
+    return it == table.end() ? nullptr : it->second;
+}
+
+}
+}
@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacKernels.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sum-factorisation kernels specialised at compile time for
+// fixed numbers of modes and quadrature points.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIBRARY_COLLECTIONS_SUMFACKERNELS_H
+#define NEKTAR_LIBRARY_COLLECTIONS_SUMFACKERNELS_H
+
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+#include <LibUtilities/BasicUtils/ShapeType.hpp>
+#include <StdRegions/StdExpansion.h>
+#include <Collections/CollectionsDeclspec.h>
+
+namespace Nektar
+{
+namespace Collections
+{
+
+/// Backward transform of @p numElmt element-contiguous elements.
+typedef void (*SumFacBwdTransKernel)(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *input, NekDouble *output);
+
+/// Inner product of @p numElmt element-contiguous elements, where @p jac
+/// holds the Jacobian multiplied by the quadrature weights.
+typedef void (*SumFacIProductKernel)(
+    int numElmt,
+    const NekDouble *base0, const NekDouble *base1, const NekDouble *base2,
+    const NekDouble *jac,   const NekDouble *input, NekDouble *output);
+
+COLLECTIONS_EXPORT SumFacBwdTransKernel GetSumFacBwdTransKernel(
+    StdRegions::StdExpansionSharedPtr pExp);
+
+COLLECTIONS_EXPORT SumFacIProductKernel GetSumFacIProductKernel(
+    StdRegions::StdExpansionSharedPtr pExp);
+
+}
+}
+
+#endif
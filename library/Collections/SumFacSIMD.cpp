@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacSIMD.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Kernels acting on element-interleaved (AoSoA) data for the
+// SumFacSIMD collection operators.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <Collections/SumFacSIMD.h>
+
+namespace Nektar
+{
+namespace Collections
+{
+
+/**
+ * @brief Interleave up to #SIMD_WIDTH elements into a single block.
+ *
+ * The element-contiguous data in @p input holding @p nelmt elements of
+ * @p ndof entries each is copied into @p output such that entry @a i of
+ * element @a e is stored at <tt>i*SIMD_WIDTH + e</tt>. Lanes beyond
+ * @p nelmt are zero-filled.
+ */
+void SIMDInterleave(int ndof, int nelmt,
+                    const NekDouble *input,
+                    NekDouble       *output)
+{
+    for (int e = 0; e < nelmt; ++e)
+    {
+        const NekDouble *in = input + e*ndof;
+        for (int i = 0; i < ndof; ++i)
+        {
+            output[i*SIMD_WIDTH + e] = in[i];
+        }
+    }
+
+    for (int e = nelmt; e < SIMD_WIDTH; ++e)
+    {
+        for (int i = 0; i < ndof; ++i)
+        {
+            output[i*SIMD_WIDTH + e] = 0.0;
+        }
+    }
+}
+
+/**
+ * @brief Inverse of SIMDInterleave, copying only the first @p nelmt lanes
+ * of the block back to element-contiguous storage.
+ */
+void SIMDDeinterleave(int ndof, int nelmt,
+                      const NekDouble *input,
+                      NekDouble       *output)
+{
+    for (int e = 0; e < nelmt; ++e)
+    {
+        NekDouble *out = output + e*ndof;
+        for (int i = 0; i < ndof; ++i)
+        {
+            out[i] = input[i*SIMD_WIDTH + e];
+        }
+    }
+}
+
+/**
+ * @brief Interleave a complete collection array, e.g. geometric factors,
+ * block by block. The last block is padded with zeros.
+ */
+Array<OneD, NekDouble> SIMDInterleaveArray(
+                    int ndof, int numElmt,
+                    const NekDouble *input)
+{
+    const int nblocks = SIMDNumBlocks(numElmt);
+    Array<OneD, NekDouble> output(nblocks*ndof*SIMD_WIDTH);
+
+    for (int b = 0; b < nblocks; ++b)
+    {
+        const int nelmt = std::min(SIMD_WIDTH, numElmt - b*SIMD_WIDTH);
+        SIMDInterleave(ndof, nelmt,
+                       input        + b*SIMD_WIDTH*ndof,
+                       output.get() + b*SIMD_WIDTH*ndof);
+    }
+
+    return output;
+}
+
+/**
+ * @brief Apply a 1D operator along one tensor direction of an
+ * interleaved block.
+ *
+ * The block is viewed as a three-index array (a,k,c) of extents
+ * (@p nbefore, @p nin, @p nafter) with @a a running fastest, and
+ * \f$ out(a,m,c) = \sum_k M(m,k)\, in(a,k,c) \f$ is evaluated for every
+ * lane. @p mat is column-major and is either the @p nout x @p nin matrix
+ * \f$M\f$ or, if @p trans is set, the @p nin x @p nout matrix
+ * \f$M^\top\f$. This matches the storage of basis and differentiation
+ * matrices so that neither needs to be copied.
+ */
+void SIMDTensorContract(bool trans, int nin, int nout,
+                        int nbefore, int nafter,
+                        const NekDouble *mat,
+                        const NekDouble *input,
+                        NekDouble       *output)
+{
+    const int mstride = trans ? nin : 1;
+    const int kstride = trans ? 1   : nout;
+
+    for (int c = 0; c < nafter; ++c)
+    {
+        const NekDouble *in  = input  + c*nin *nbefore*SIMD_WIDTH;
+        NekDouble       *out = output + c*nout*nbefore*SIMD_WIDTH;
+
+        for (int m = 0; m < nout; ++m)
+        {
+            const NekDouble *row = mat + m*mstride;
+
+            for (int a = 0; a < nbefore; ++a)
+            {
+                NekDouble sum[SIMD_WIDTH] = {};
+
+                for (int k = 0; k < nin; ++k)
+                {
+                    const NekDouble  coef = row[k*kstride];
+                    const NekDouble *src  =
+                        in + (k*nbefore + a)*SIMD_WIDTH;
+
+                    for (int l = 0; l < SIMD_WIDTH; ++l)
+                    {
+                        sum[l] += coef * src[l];
+                    }
+                }
+
+                NekDouble *dst = out + (m*nbefore + a)*SIMD_WIDTH;
+                for (int l = 0; l < SIMD_WIDTH; ++l)
+                {
+                    dst[l] = sum[l];
+                }
+            }
+        }
+    }
+}
+
+/// output = x*y for @p n interleaved entries.
+void SIMDMultiply(int n, const NekDouble *x, const NekDouble *y,
+                  NekDouble *output)
+{
+    for (int i = 0; i < n*SIMD_WIDTH; ++i)
+    {
+        output[i] = x[i] * y[i];
+    }
+}
+
+/// output += x*y for @p n interleaved entries.
+void SIMDMultiplyAdd(int n, const NekDouble *x, const NekDouble *y,
+                     NekDouble *output)
+{
+    for (int i = 0; i < n*SIMD_WIDTH; ++i)
+    {
+        output[i] += x[i] * y[i];
+    }
+}
+
+}
+}
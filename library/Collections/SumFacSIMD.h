@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SumFacSIMD.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Kernels acting on element-interleaved (AoSoA) data for the
+// SumFacSIMD collection operators.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIBRARY_COLLECTIONS_SUMFACSIMD_H
+#define NEKTAR_LIBRARY_COLLECTIONS_SUMFACSIMD_H
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+#include <Collections/CollectionsDeclspec.h>
+
+namespace Nektar
+{
+namespace Collections
+{
+
+/**
+ * Number of elements processed together by the SumFacSIMD operators. Data
+ * for a block of this many elements is stored with the element index
+ * running fastest, so that each degree of freedom of the block occupies
+ * one contiguous vector of this length.
+ *
+ * The kernels are written as plain loops over the lanes of a block and
+ * rely on the compiler to vectorise them; no intrinsics are used. This
+ * requires optimisation (-O2 with -ftree-vectorize, or -O3) and a target
+ * architecture with vector registers of at least this width, e.g.
+ * -march=native on AVX hardware. Otherwise the interleaved layout is still
+ * correct but performs like the scalar sum-factorisation.
+ */
+static const int SIMD_WIDTH = 4;
+
+/// Number of SIMD blocks needed to hold @p numElmt elements.
+inline int SIMDNumBlocks(int numElmt)
+{
+    return (numElmt + SIMD_WIDTH - 1) / SIMD_WIDTH;
+}
+
+COLLECTIONS_EXPORT void SIMDInterleave(
+    int ndof, int nelmt,
+    const NekDouble *input,
+    NekDouble       *output);
+
+COLLECTIONS_EXPORT void SIMDDeinterleave(
+    int ndof, int nelmt,
+    const NekDouble *input,
+    NekDouble       *output);
+
+COLLECTIONS_EXPORT Array<OneD, NekDouble> SIMDInterleaveArray(
+    int ndof, int numElmt,
+    const NekDouble *input);
+
+COLLECTIONS_EXPORT void SIMDTensorContract(
+    bool trans, int nin, int nout,
+    int nbefore, int nafter,
+    const NekDouble *mat,
+    const NekDouble *input,
+    NekDouble       *output);
+
+COLLECTIONS_EXPORT void SIMDMultiply(
+    int n, const NekDouble *x, const NekDouble *y,
+    NekDouble *output);
+
+COLLECTIONS_EXPORT void SIMDMultiplyAdd(
+    int n, const NekDouble *x, const NekDouble *y,
+    NekDouble *output);
+
+}
+}
+
+#endif
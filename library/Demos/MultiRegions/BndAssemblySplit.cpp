@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: BndAssemblySplit.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compares the split-phase universal assembly of the global
+// boundary coefficients against the blocking one, for the continuous and the
+// discontinuous (trace) assembly maps.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ContField2D.h>
+#include <MultiRegions/ContField3D.h>
+#include <MultiRegions/DisContField2D.h>
+#include <MultiRegions/DisContField3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+/**
+ * Assembles rank-dependent boundary values with UniversalAssembleBnd and with
+ * UniversalAssembleBndBegin/End, updating the coefficients which are not
+ * shared between the two calls as a solver overlapping the exchange does,
+ * and returns the maximum difference over all processes.
+ */
+NekDouble CompareAssembly(const MultiRegions::AssemblyMapSharedPtr &map,
+                          const LibUtilities::CommSharedPtr &comm)
+{
+    const int nBnd = map->GetNumGlobalBndCoeffs();
+    const int rank = comm->GetRank();
+
+    Array<OneD, int> shared = map->GetSharedBndCoeffs();
+
+    Array<OneD, NekDouble> blocking(nBnd), split(nBnd);
+    for (int i = 0; i < nBnd; ++i)
+    {
+        blocking[i] = sin(0.1*i + rank) + rank;
+    }
+    Vmath::Vcopy(nBnd, blocking, 1, split, 1);
+
+    map->UniversalAssembleBnd(blocking);
+
+    map->UniversalAssembleBndBegin(split);
+    for (int i = 0; i < nBnd; ++i)
+    {
+        if (!shared[i])
+        {
+            split[i] += 1.0;
+        }
+    }
+    map->UniversalAssembleBndEnd(split);
+
+    NekDouble diff = 0.0;
+    for (int i = 0; i < nBnd; ++i)
+    {
+        diff = max(diff, fabs(split[i] - (shared[i] ? 0.0 : 1.0)
+                                       - blocking[i]));
+    }
+    comm->AllReduce(diff, LibUtilities::ReduceMax);
+
+    return diff;
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr session =
+        LibUtilities::SessionReader::CreateInstance(argc, argv);
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+    LibUtilities::CommSharedPtr comm = session->GetComm();
+
+    MultiRegions::AssemblyMapSharedPtr cgMap, dgMap;
+    switch (graph->GetMeshDimension())
+    {
+        case 2:
+        {
+            MultiRegions::ContField2DSharedPtr cont =
+                MemoryManager<MultiRegions::ContField2D>::AllocateSharedPtr(
+                    session, graph, session->GetVariable(0));
+            MultiRegions::DisContField2DSharedPtr discont =
+                MemoryManager<MultiRegions::DisContField2D>::AllocateSharedPtr(
+                    session, graph, session->GetVariable(0));
+            cgMap = cont->GetLocalToGlobalMap();
+            dgMap = discont->GetTraceMap();
+            break;
+        }
+        case 3:
+        {
+            MultiRegions::ContField3DSharedPtr cont =
+                MemoryManager<MultiRegions::ContField3D>::AllocateSharedPtr(
+                    session, graph, session->GetVariable(0));
+            MultiRegions::DisContField3DSharedPtr discont =
+                MemoryManager<MultiRegions::DisContField3D>::AllocateSharedPtr(
+                    session, graph, session->GetVariable(0));
+            cgMap = cont->GetLocalToGlobalMap();
+            dgMap = discont->GetTraceMap();
+            break;
+        }
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    NekDouble diff = max(CompareAssembly(cgMap, comm),
+                         CompareAssembly(dgMap, comm));
+
+    if (comm->GetRank() == 0)
+    {
+        cout << "L infinity error: " << diff << endl;
+    }
+
+    session->Finalise();
+
+    return 0;
+}
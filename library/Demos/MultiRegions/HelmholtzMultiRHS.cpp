@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: HelmholtzMultiRHS.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compares the Helmholtz solution of several right-hand sides
+// solved together against solving them one at a time.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ContField2D.h>
+#include <MultiRegions/ContField3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr session =
+        LibUtilities::SessionReader::CreateInstance(argc, argv);
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+
+    const int nrhs = 3;
+
+    // All right-hand sides use copies of the first field, so that they
+    // share its boundary conditions and global linear system.
+    Array<OneD, MultiRegions::ExpListSharedPtr> fields(nrhs);
+    switch (graph->GetMeshDimension())
+    {
+        case 2:
+            fields[0] = MemoryManager<MultiRegions::ContField2D>::
+                AllocateSharedPtr(session, graph, session->GetVariable(0));
+            for (int i = 1; i < nrhs; ++i)
+            {
+                fields[i] = MemoryManager<MultiRegions::ContField2D>::
+                    AllocateSharedPtr(*std::dynamic_pointer_cast<
+                        MultiRegions::ContField2D>(fields[0]));
+            }
+            break;
+        case 3:
+            fields[0] = MemoryManager<MultiRegions::ContField3D>::
+                AllocateSharedPtr(session, graph, session->GetVariable(0));
+            for (int i = 1; i < nrhs; ++i)
+            {
+                fields[i] = MemoryManager<MultiRegions::ContField3D>::
+                    AllocateSharedPtr(*std::dynamic_pointer_cast<
+                        MultiRegions::ContField3D>(fields[0]));
+            }
+            break;
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    StdRegions::ConstFactorMap factors;
+    factors[StdRegions::eFactorLambda] = session->GetParameter("Lambda");
+
+    const int nq      = fields[0]->GetTotPoints();
+    const int ncoeffs = fields[0]->GetNcoeffs();
+
+    Array<OneD, NekDouble> x(nq, 0.0), y(nq, 0.0), z(nq, 0.0);
+    fields[0]->GetCoords(x, y, z);
+
+    Array<OneD, NekDouble> fce(nq);
+    session->GetFunction("Forcing", 0)->Evaluate(x, y, z, fce);
+
+    // Right-hand sides of different magnitudes and shapes
+    Array<OneD, Array<OneD, NekDouble> > rhs(nrhs), single(nrhs), multi(nrhs);
+    for (int i = 0; i < nrhs; ++i)
+    {
+        rhs[i] = Array<OneD, NekDouble>(nq);
+        for (int j = 0; j < nq; ++j)
+        {
+            rhs[i][j] = (1.0 + 0.5*i) * fce[j] + i * x[j] * y[j];
+        }
+
+        single[i] = Array<OneD, NekDouble>(ncoeffs, 0.0);
+        multi[i]  = Array<OneD, NekDouble>(ncoeffs, 0.0);
+    }
+
+    // One right-hand side at a time
+    for (int i = 0; i < nrhs; ++i)
+    {
+        fields[i]->HelmSolve(rhs[i], single[i], factors);
+    }
+
+    // All right-hand sides together
+    fields[0]->HelmSolveMultiRHS(fields, rhs, multi, factors);
+
+    NekDouble diff = 0.0;
+    for (int i = 0; i < nrhs; ++i)
+    {
+        for (int j = 0; j < ncoeffs; ++j)
+        {
+            diff = max(diff, fabs(single[i][j] - multi[i][j]));
+        }
+    }
+    session->GetComm()->AllReduce(diff, LibUtilities::ReduceMax);
+
+    if (session->GetComm()->GetRank() == 0)
+    {
+        cout << "L infinity error: " << diff << endl;
+    }
+
+    session->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,15 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Split-phase boundary assembly against the blocking one in 2D in parallel</description>
+    <executable>BndAssemblySplit</executable>
+    <parameters>--use-scotch Helmholtz2D_P7_Periodic.xml</parameters>
+    <processes>2</processes>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_Periodic.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-12">0</value>
+        </metric>
+    </metrics>
+</test>
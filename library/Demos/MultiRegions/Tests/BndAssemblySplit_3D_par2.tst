@@ -0,0 +1,15 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Split-phase boundary assembly against the blocking one in 3D in parallel</description>
+    <executable>BndAssemblySplit</executable>
+    <parameters>--use-scotch Helmholtz3D_Prism.xml</parameters>
+    <processes>2</processes>
+    <files>
+        <file description="Session File">Helmholtz3D_Prism.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-12">0</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,29 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 2D CG with P=7, all BCs, iterative sc, mixed precision</description>
+    <executable>Helmholtz2D</executable>
+    <parameters>-v -I GlobalSysSoln=IterativeStaticCond -I LinSysMixedPrecision=True Helmholtz2D_P7_AllBCs.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_AllBCs.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-7">0.00888406</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-7">0.0102587</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^CG iterations made = \d+ using tolerance of \S+ \(error = ([\d.e+-]+),.*</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="5e-10">5e-10</field>
+                </match>
+            </matches>
+        </metric>
+        <metric type="Precon" id="4">
+            <value tolerance="2">64</value>
+        </metric>
+    </metrics>
+</test>
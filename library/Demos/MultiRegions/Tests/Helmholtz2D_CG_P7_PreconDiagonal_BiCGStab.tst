@@ -0,0 +1,17 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Helmholtz 2D CG with P=7, diagonal preconditioner and BiCGStab</description>
+    <executable>Helmholtz2D</executable>
+    <parameters>-I Preconditioner=Diagonal -I LinSysIterSolver=BiCGStab Helmholtz2D_P7_Periodic.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_Periodic.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-8">6.82374e-07</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-8">9.43919e-07</value>
+        </metric>
+    </metrics>
+</test>
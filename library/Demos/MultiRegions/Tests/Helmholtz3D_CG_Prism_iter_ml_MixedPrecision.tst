@@ -0,0 +1,26 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 3D CG, prisms, Neumann BCs, iterative ML, mixed precision</description>
+    <executable>Helmholtz3D</executable>
+    <parameters>-v -I GlobalSysSoln=IterativeMultiLevelStaticCond -I LinSysMixedPrecision=True Helmholtz3D_Prism.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz3D_Prism.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-8">0.000384858</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-8">0.00539787</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^CG iterations made = \d+ using tolerance of \S+ \(error = ([\d.e+-]+),.*</regex>
+            <matches>
+                <match>
+                    <field id="0" tolerance="5e-10">5e-10</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
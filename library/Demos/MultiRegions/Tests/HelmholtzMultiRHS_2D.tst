@@ -0,0 +1,22 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Multi-RHS Helmholtz solve against per-RHS solves in 2D, iterative sc</description>
+    <executable>HelmholtzMultiRHS</executable>
+    <parameters>-v -I GlobalSysSoln=IterativeStaticCond Helmholtz2D_P7_AllBCs.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_AllBCs.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-6">0</value>
+        </metric>
+        <metric type="Precon" id="2">
+            <value tolerance="1">57</value>
+            <value tolerance="1">59</value>
+            <value tolerance="1">59</value>
+            <value tolerance="1">55</value>
+            <value tolerance="1">58</value>
+            <value tolerance="1">59</value>
+        </metric>
+    </metrics>
+</test>
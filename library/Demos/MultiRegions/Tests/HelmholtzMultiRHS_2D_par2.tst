@@ -0,0 +1,15 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Multi-RHS Helmholtz solve against per-RHS solves in 2D in parallel, iterative sc</description>
+    <executable>HelmholtzMultiRHS</executable>
+    <parameters>--use-scotch -I GlobalSysSoln=IterativeStaticCond Helmholtz2D_P7_AllBCs.xml</parameters>
+    <processes>2</processes>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_AllBCs.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-6">0</value>
+        </metric>
+    </metrics>
+</test>
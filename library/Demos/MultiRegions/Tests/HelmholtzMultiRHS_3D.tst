@@ -0,0 +1,22 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Multi-RHS Helmholtz solve against per-RHS solves in 3D, iterative sc</description>
+    <executable>HelmholtzMultiRHS</executable>
+    <parameters>-v -I GlobalSysSoln=IterativeStaticCond Helmholtz3D_Prism.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz3D_Prism.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-6">0</value>
+        </metric>
+        <metric type="Precon" id="2">
+            <value tolerance="1">41</value>
+            <value tolerance="1">41</value>
+            <value tolerance="1">41</value>
+            <value tolerance="1">41</value>
+            <value tolerance="1">41</value>
+            <value tolerance="1">41</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,14 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Multi-variable trace operators against per-variable ones in 2D</description>
+    <executable>TraceMultiField</executable>
+    <parameters>Helmholtz2D_P7_Periodic.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_Periodic.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-12">0</value>
+        </metric>
+    </metrics>
+</test>
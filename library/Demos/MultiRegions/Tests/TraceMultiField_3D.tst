@@ -0,0 +1,14 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>Multi-variable trace operators against per-variable ones in 3D</description>
+    <executable>TraceMultiField</executable>
+    <parameters>Helmholtz3D_Prism.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz3D_Prism.xml</file>
+    </files>
+    <metrics>
+        <metric type="Linf" id="1">
+            <value tolerance="1e-12">0</value>
+        </metric>
+    </metrics>
+</test>
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TraceMultiField.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Compares the multi-variable trace gather and trace integral
+// of a discontinuous field against applying them one variable at a time.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/DisContField2D.h>
+#include <MultiRegions/DisContField3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+using namespace std;
+using namespace Nektar;
+
+/// Maximum absolute difference between @p a and @p b over all variables.
+NekDouble MaxDiff(const Array<OneD, Array<OneD, NekDouble> > &a,
+                  const Array<OneD, Array<OneD, NekDouble> > &b)
+{
+    NekDouble diff = 0.0;
+    for (int i = 0; i < a.size(); ++i)
+    {
+        for (int j = 0; j < a[i].size(); ++j)
+        {
+            diff = max(diff, fabs(a[i][j] - b[i][j]));
+        }
+    }
+    return diff;
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReaderSharedPtr session =
+        LibUtilities::SessionReader::CreateInstance(argc, argv);
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+
+    const int nvar = 4;
+
+    // All variables are copies of the first one so that they share its
+    // trace, as the variables of a solver do.
+    Array<OneD, MultiRegions::ExpListSharedPtr> fields(nvar);
+    switch (graph->GetMeshDimension())
+    {
+        case 2:
+            fields[0] = MemoryManager<MultiRegions::DisContField2D>::
+                AllocateSharedPtr(session, graph, session->GetVariable(0));
+            for (int i = 1; i < nvar; ++i)
+            {
+                fields[i] = MemoryManager<MultiRegions::DisContField2D>::
+                    AllocateSharedPtr(*std::dynamic_pointer_cast<
+                        MultiRegions::DisContField2D>(fields[0]));
+            }
+            break;
+        case 3:
+            fields[0] = MemoryManager<MultiRegions::DisContField3D>::
+                AllocateSharedPtr(session, graph, session->GetVariable(0));
+            for (int i = 1; i < nvar; ++i)
+            {
+                fields[i] = MemoryManager<MultiRegions::DisContField3D>::
+                    AllocateSharedPtr(*std::dynamic_pointer_cast<
+                        MultiRegions::DisContField3D>(fields[0]));
+            }
+            break;
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    const int nq      = fields[0]->GetTotPoints();
+    const int ncoeffs = fields[0]->GetNcoeffs();
+    const int ntrace  = fields[0]->GetTrace()->GetTotPoints();
+
+    Array<OneD, NekDouble> x(nq, 0.0), y(nq, 0.0), z(nq, 0.0);
+    fields[0]->GetCoords(x, y, z);
+
+    Array<OneD, Array<OneD, NekDouble> > phys(nvar);
+    Array<OneD, Array<OneD, NekDouble> > fwd[2], bwd[2], coeffs[2];
+    for (int k = 0; k < 2; ++k)
+    {
+        fwd[k]    = Array<OneD, Array<OneD, NekDouble> >(nvar);
+        bwd[k]    = Array<OneD, Array<OneD, NekDouble> >(nvar);
+        coeffs[k] = Array<OneD, Array<OneD, NekDouble> >(nvar);
+    }
+
+    for (int i = 0; i < nvar; ++i)
+    {
+        phys[i] = Array<OneD, NekDouble>(nq);
+        for (int j = 0; j < nq; ++j)
+        {
+            phys[i][j] = sin(x[j] + i) * cos(y[j] - 0.5*i) + z[j]*i;
+        }
+
+        for (int k = 0; k < 2; ++k)
+        {
+            fwd[k][i]    = Array<OneD, NekDouble>(ntrace, 0.0);
+            bwd[k][i]    = Array<OneD, NekDouble>(ntrace, 0.0);
+            coeffs[k][i] = Array<OneD, NekDouble>(ncoeffs, 0.0);
+        }
+    }
+
+    // One variable at a time
+    for (int i = 0; i < nvar; ++i)
+    {
+        fields[i]->GetFwdBwdTracePhys(phys[i], fwd[0][i], bwd[0][i]);
+        fields[i]->AddTraceIntegral(fwd[0][i], coeffs[0][i]);
+    }
+
+    // All variables together
+    fields[0]->GetFwdBwdTracePhysInterior(phys, fwd[1], bwd[1]);
+    for (int i = 0; i < nvar; ++i)
+    {
+        fields[i]->FillBwdWithBound(fwd[1][i], bwd[1][i]);
+    }
+    fields[0]->BeginTraceExchange(fwd[1]);
+    fields[0]->FinishTraceExchange(bwd[1]);
+    fields[0]->AddTraceIntegral(fwd[1], coeffs[1]);
+
+    NekDouble diff = max(MaxDiff(fwd[0], fwd[1]), MaxDiff(bwd[0], bwd[1]));
+    diff = max(diff, MaxDiff(coeffs[0], coeffs[1]));
+    session->GetComm()->AllReduce(diff, LibUtilities::ReduceMax);
+
+    if (session->GetComm()->GetRank() == 0)
+    {
+        cout << "L infinity error: " << diff << endl;
+    }
+
+    session->Finalise();
+
+    return 0;
+}
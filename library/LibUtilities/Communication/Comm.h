@@ -113,11 +113,22 @@ public:
     void SendRecvReplace(int pSendProc, int pRecvProc, T &pData);
 
     template <class T> void AllReduce(T &pData, enum ReduceOperator pOp);
+    template <class T>
+    void IAllReduce(T &pData, enum ReduceOperator pOp,
+                    const CommRequestSharedPtr &request, int loc);
 
     template <class T> void AlltoAll(T &pSendData, T &pRecvData);
     template <class T1, class T2>
     void AlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap, T2 &pSendDataOffsetMap,
                    T1 &pRecvData, T2 &pRecvDataSizeMap, T2 &pRecvDataOffsetMap);
+    template <class T>
+    void IAlltoAll(T &pSendData, T &pRecvData,
+                   const CommRequestSharedPtr &request, int loc);
+    template <class T1, class T2>
+    void IAlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
+                    T2 &pSendDataOffsetMap, T1 &pRecvData,
+                    T2 &pRecvDataSizeMap, T2 &pRecvDataOffsetMap,
+                    const CommRequestSharedPtr &request, int loc);
 
     template <class T> void AllGather(T &pSendData, T &pRecvData);
     template <class T>
@@ -141,6 +152,11 @@ public:
     void NeighborAlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
                            T2 &pSendDataOffsetMap, T1 &pRecvData,
                            T2 &pRecvDataSizeMap, T2 &pRecvDataOffsetMap);
+    template <class T1, class T2>
+    void INeighborAlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
+                            T2 &pSendDataOffsetMap, T1 &pRecvData,
+                            T2 &pRecvDataSizeMap, T2 &pRecvDataOffsetMap,
+                            const CommRequestSharedPtr &request, int loc);
     template <class T>
     void Irsend(int pProc, T &pData, int count,
                 const CommRequestSharedPtr &request, int loc);
@@ -155,6 +171,7 @@ public:
                   const CommRequestSharedPtr &request, int loc);
     inline void StartAll(const CommRequestSharedPtr &request);
     inline void WaitAll(const CommRequestSharedPtr &request);
+    inline void Wait(const CommRequestSharedPtr &request, int loc);
     inline CommRequestSharedPtr CreateRequest(int num);
 
     LIB_UTILITIES_EXPORT inline CommSharedPtr CommCreateIf(int flag);
@@ -189,6 +206,9 @@ protected:
                                    int pSendProc, int pRecvProc)           = 0;
     virtual void v_AllReduce(void *buf, int count, CommDataType dt,
                              enum ReduceOperator pOp)                      = 0;
+    virtual void v_IAllReduce(void *buf, int count, CommDataType dt,
+                              enum ReduceOperator pOp,
+                              CommRequestSharedPtr request, int loc)       = 0;
     virtual void v_AlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
                             void *recvbuf, int recvcount,
                             CommDataType recvtype)                         = 0;
@@ -196,6 +216,15 @@ protected:
                              CommDataType sendtype, void *recvbuf,
                              int recvcounts[], int rdispls[],
                              CommDataType recvtype)                        = 0;
+    virtual void v_IAlltoAll(void *sendbuf, int sendcount,
+                             CommDataType sendtype, void *recvbuf,
+                             int recvcount, CommDataType recvtype,
+                             CommRequestSharedPtr request, int loc)        = 0;
+    virtual void v_IAlltoAllv(void *sendbuf, int sendcounts[],
+                              int sensdispls[], CommDataType sendtype,
+                              void *recvbuf, int recvcounts[], int rdispls[],
+                              CommDataType recvtype,
+                              CommRequestSharedPtr request, int loc)       = 0;
     virtual void v_AllGather(void *sendbuf, int sendcount,
                              CommDataType sendtype, void *recvbuf,
                              int recvcount, CommDataType recvtype)         = 0;
@@ -229,6 +258,12 @@ protected:
                                      int sdispls[], CommDataType sendtype,
                                      void *recvbuf, int recvcounts[],
                                      int rdispls[], CommDataType recvtype) = 0;
+    virtual void v_INeighborAlltoAllv(void *sendbuf, int sendcounts[],
+                                      int sdispls[], CommDataType sendtype,
+                                      void *recvbuf, int recvcounts[],
+                                      int rdispls[], CommDataType recvtype,
+                                      CommRequestSharedPtr request,
+                                      int loc)                             = 0;
 
     virtual void v_Irsend(void *buf, int count, CommDataType dt, int dest,
                           CommRequestSharedPtr request, int loc)   = 0;
@@ -240,6 +275,7 @@ protected:
                             CommRequestSharedPtr request, int loc) = 0;
     virtual void v_StartAll(CommRequestSharedPtr request)          = 0;
     virtual void v_WaitAll(CommRequestSharedPtr request)           = 0;
+    virtual void v_Wait(CommRequestSharedPtr request, int loc)     = 0;
     virtual CommRequestSharedPtr v_CreateRequest(int num)          = 0;
 
     virtual void v_SplitComm(int pRows, int pColumns) = 0;
@@ -348,6 +384,25 @@ template <class T> void Comm::AllReduce(T &pData, enum ReduceOperator pOp)
                 CommDataTypeTraits<T>::GetDataType(), pOp);
 }
 
+/**
+ * Begins a nonblocking in-place reduction of @p pData over all processes.
+ * The contents of @p pData must not be read or modified until the request
+ * has been completed with Wait() or WaitAll().
+ *
+ * @param pData   Array/vector/scalar to reduce
+ * @param pOp     Reduction operator
+ * @param request Communication request object
+ * @param loc     Location in request to use
+ */
+template <class T>
+void Comm::IAllReduce(T &pData, enum ReduceOperator pOp,
+                      const CommRequestSharedPtr &request, int loc)
+{
+    v_IAllReduce(CommDataTypeTraits<T>::GetPointer(pData),
+                 CommDataTypeTraits<T>::GetCount(pData),
+                 CommDataTypeTraits<T>::GetDataType(), pOp, request, loc);
+}
+
 template <class T> void Comm::AlltoAll(T &pSendData, T &pRecvData)
 {
     static_assert(CommDataTypeTraits<T>::IsVector,
@@ -390,6 +445,63 @@ void Comm::AlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
                 CommDataTypeTraits<T1>::GetDataType());
 }
 
+/**
+ * Begins a nonblocking all-to-all exchange with the same semantics as
+ * AlltoAll(). Neither array may be accessed until the request has been
+ * completed with Wait() or WaitAll().
+ *
+ * @param pSendData Array/vector to send
+ * @param pRecvData Array/vector to receive into
+ * @param request   Communication request object
+ * @param loc       Location in request to use
+ */
+template <class T>
+void Comm::IAlltoAll(T &pSendData, T &pRecvData,
+                     const CommRequestSharedPtr &request, int loc)
+{
+    static_assert(CommDataTypeTraits<T>::IsVector,
+                  "IAlltoAll only valid with Array or vector arguments.");
+    int sendSize = CommDataTypeTraits<T>::GetCount(pSendData);
+    int recvSize = CommDataTypeTraits<T>::GetCount(pRecvData);
+    ASSERTL0(sendSize == recvSize,
+             "Send and Recv arrays have incompatible sizes in IAlltoAll");
+
+    int count = sendSize / GetSize();
+    ASSERTL0(count * GetSize() == sendSize,
+             "Array size incompatible with size of communicator");
+
+    v_IAlltoAll(CommDataTypeTraits<T>::GetPointer(pSendData), count,
+                CommDataTypeTraits<T>::GetDataType(),
+                CommDataTypeTraits<T>::GetPointer(pRecvData), count,
+                CommDataTypeTraits<T>::GetDataType(), request, loc);
+}
+
+/**
+ * Begins a nonblocking all-to-all exchange with the same semantics as
+ * AlltoAllv(). Neither data array may be accessed until the request has been
+ * completed with Wait() or WaitAll().
+ */
+template <class T1, class T2>
+void Comm::IAlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
+                      T2 &pSendDataOffsetMap, T1 &pRecvData,
+                      T2 &pRecvDataSizeMap, T2 &pRecvDataOffsetMap,
+                      const CommRequestSharedPtr &request, int loc)
+{
+    static_assert(CommDataTypeTraits<T1>::IsVector,
+                  "IAlltoAllv only valid with Array or vector arguments.");
+    static_assert(std::is_same<T2, std::vector<int>>::value ||
+                      std::is_same<T2, Array<OneD, int>>::value,
+                  "IAlltoAllv size and offset maps should be integer vectors.");
+    v_IAlltoAllv(CommDataTypeTraits<T1>::GetPointer(pSendData),
+                 (int *)CommDataTypeTraits<T2>::GetPointer(pSendDataSizeMap),
+                 (int *)CommDataTypeTraits<T2>::GetPointer(pSendDataOffsetMap),
+                 CommDataTypeTraits<T1>::GetDataType(),
+                 CommDataTypeTraits<T1>::GetPointer(pRecvData),
+                 (int *)CommDataTypeTraits<T2>::GetPointer(pRecvDataSizeMap),
+                 (int *)CommDataTypeTraits<T2>::GetPointer(pRecvDataOffsetMap),
+                 CommDataTypeTraits<T1>::GetDataType(), request, loc);
+}
+
 template <class T> void Comm::AllGather(T &pSendData, T &pRecvData)
 {
     BOOST_STATIC_ASSERT_MSG(
@@ -578,6 +690,35 @@ void Comm::NeighborAlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
         CommDataTypeTraits<T1>::GetDataType());
 }
 
+/**
+ * Begins a nonblocking neighbourhood exchange with the same semantics as
+ * NeighborAlltoAllv(). Neither data array may be accessed until the request
+ * has been completed with Wait() or WaitAll().
+ */
+template <class T1, class T2>
+void Comm::INeighborAlltoAllv(T1 &pSendData, T2 &pSendDataSizeMap,
+                              T2 &pSendDataOffsetMap, T1 &pRecvData,
+                              T2 &pRecvDataSizeMap, T2 &pRecvDataOffsetMap,
+                              const CommRequestSharedPtr &request, int loc)
+{
+    static_assert(
+        CommDataTypeTraits<T1>::IsVector,
+        "INeighbourAlltoAllv only valid with Array or vector arguments.");
+    static_assert(
+        std::is_same<T2, std::vector<int>>::value ||
+            std::is_same<T2, Array<OneD, int>>::value,
+        "INeighborAllToAllv size and offset maps should be integer vectors.");
+    v_INeighborAlltoAllv(
+        CommDataTypeTraits<T1>::GetPointer(pSendData),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pSendDataSizeMap),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pSendDataOffsetMap),
+        CommDataTypeTraits<T1>::GetDataType(),
+        CommDataTypeTraits<T1>::GetPointer(pRecvData),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pRecvDataSizeMap),
+        (int *)CommDataTypeTraits<T2>::GetPointer(pRecvDataOffsetMap),
+        CommDataTypeTraits<T1>::GetDataType(), request, loc);
+}
+
 /**
  * Starts a ready-mode nonblocking send
  *
@@ -666,6 +807,17 @@ inline void Comm::WaitAll(const CommRequestSharedPtr &request)
     v_WaitAll(request);
 }
 
+/**
+ * Waits for a single CommRequest in the request object to complete.
+ *
+ * @param request Communication request object
+ * @param loc     Location in request to wait on
+ */
+inline void Comm::Wait(const CommRequestSharedPtr &request, int loc)
+{
+    v_Wait(request, loc);
+}
+
 /**
  * Creates a number of CommRequests.
  *
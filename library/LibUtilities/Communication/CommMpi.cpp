@@ -256,6 +256,43 @@ void CommMpi::v_AllReduce(void *buf, int count, CommDataType dt,
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-reduce.");
 }
 
+/**
+ *
+ */
+void CommMpi::v_IAllReduce(void *buf, int count, CommDataType dt,
+                           enum ReduceOperator pOp,
+                           CommRequestSharedPtr request, int loc)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+
+    if (GetSize() == 1)
+    {
+        *req->GetRequest(loc) = MPI_REQUEST_NULL;
+        return;
+    }
+
+    MPI_Op vOp;
+    switch (pOp)
+    {
+        case ReduceMax:
+            vOp = MPI_MAX;
+            break;
+        case ReduceMin:
+            vOp = MPI_MIN;
+            break;
+        case ReduceSum:
+        default:
+            vOp = MPI_SUM;
+            break;
+    }
+    int retval = MPI_Iallreduce(MPI_IN_PLACE, buf, count, dt, vOp, m_comm,
+                                req->GetRequest(loc));
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking All-reduce.");
+}
+
 /**
  *
  */
@@ -282,6 +319,42 @@ void CommMpi::v_AlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
     ASSERTL0(retval == MPI_SUCCESS, "MPI error performing All-to-All-v.");
 }
 
+/**
+ *
+ */
+void CommMpi::v_IAlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
+                          void *recvbuf, int recvcount, CommDataType recvtype,
+                          CommRequestSharedPtr request, int loc)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Ialltoall(sendbuf, sendcount, sendtype, recvbuf,
+                               recvcount, recvtype, m_comm,
+                               req->GetRequest(loc));
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking All-to-All.");
+}
+
+/**
+ *
+ */
+void CommMpi::v_IAlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
+                           CommDataType sendtype, void *recvbuf,
+                           int recvcounts[], int rdispls[],
+                           CommDataType recvtype,
+                           CommRequestSharedPtr request, int loc)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Ialltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                recvbuf, recvcounts, rdispls, recvtype,
+                                m_comm, req->GetRequest(loc));
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking All-to-All-v.");
+}
+
 /**
  *
  */
@@ -401,6 +474,30 @@ void CommMpi::v_NeighborAlltoAllv(void *sendbuf, int sendcounts[],
 #endif
 }
 
+void CommMpi::v_INeighborAlltoAllv(void *sendbuf, int sendcounts[],
+                                   int sdispls[], CommDataType sendtype,
+                                   void *recvbuf, int recvcounts[],
+                                   int rdispls[], CommDataType recvtype,
+                                   CommRequestSharedPtr request, int loc)
+{
+#if MPI_VERSION < 3
+    boost::ignore_unused(sendbuf, sendcounts, sdispls, sendtype, recvbuf,
+                         recvcounts, rdispls, recvtype, request, loc);
+    ASSERTL0(false, "MPI_Ineighbor_alltoallv is not supported in your "
+                    "installed MPI version.");
+#else
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    int retval = MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls,
+                                         sendtype, recvbuf, recvcounts,
+                                         rdispls, recvtype, m_comm,
+                                         req->GetRequest(loc));
+
+    ASSERTL0(retval == MPI_SUCCESS,
+             "MPI error performing non-blocking NeighborAllToAllV.");
+#endif
+}
+
 void CommMpi::v_Irsend(void *buf, int count, CommDataType dt, int dest,
                        CommRequestSharedPtr request, int loc)
 {
@@ -447,6 +544,13 @@ void CommMpi::v_WaitAll(CommRequestSharedPtr request)
     MPI_Waitall(req->GetNumRequest(), req->GetRequest(0), MPI_STATUSES_IGNORE);
 }
 
+void CommMpi::v_Wait(CommRequestSharedPtr request, int loc)
+{
+    CommRequestMpiSharedPtr req =
+        std::static_pointer_cast<CommRequestMpi>(request);
+    MPI_Wait(req->GetRequest(loc), MPI_STATUS_IGNORE);
+}
+
 CommRequestSharedPtr CommMpi::v_CreateRequest(int num)
 {
     return std::shared_ptr<CommRequest>(new CommRequestMpi(num));
@@ -128,6 +128,9 @@ protected:
                                    int pSendProc, int pRecvProc) final;
     virtual void v_AllReduce(void *buf, int count, CommDataType dt,
                              enum ReduceOperator pOp) final;
+    virtual void v_IAllReduce(void *buf, int count, CommDataType dt,
+                              enum ReduceOperator pOp,
+                              CommRequestSharedPtr request, int loc) final;
     virtual void v_AlltoAll(void *sendbuf, int sendcount, CommDataType sendtype,
                             void *recvbuf, int recvcount,
                             CommDataType recvtype) final;
@@ -135,6 +138,15 @@ protected:
                              CommDataType sendtype, void *recvbuf,
                              int recvcounts[], int rdispls[],
                              CommDataType recvtype) final;
+    virtual void v_IAlltoAll(void *sendbuf, int sendcount,
+                             CommDataType sendtype, void *recvbuf,
+                             int recvcount, CommDataType recvtype,
+                             CommRequestSharedPtr request, int loc) final;
+    virtual void v_IAlltoAllv(void *sendbuf, int sendcounts[],
+                              int sensdispls[], CommDataType sendtype,
+                              void *recvbuf, int recvcounts[], int rdispls[],
+                              CommDataType recvtype,
+                              CommRequestSharedPtr request, int loc) final;
     virtual void v_AllGather(void *sendbuf, int sendcount,
                              CommDataType sendtype, void *recvbuf,
                              int recvcount, CommDataType recvtype) final;
@@ -165,6 +177,12 @@ protected:
                                      void *recvbuf, int recvcounts[],
                                      int rdispls[],
                                      CommDataType recvtype) final;
+    virtual void v_INeighborAlltoAllv(void *sendbuf, int sendcounts[],
+                                      int sensdispls[], CommDataType sendtype,
+                                      void *recvbuf, int recvcounts[],
+                                      int rdispls[], CommDataType recvtype,
+                                      CommRequestSharedPtr request,
+                                      int loc) final;
     virtual void v_Irsend(void *buf, int count, CommDataType dt, int dest,
                           CommRequestSharedPtr request, int loc) final;
     virtual void v_SendInit(void *buf, int count, CommDataType dt, int dest,
@@ -175,6 +193,7 @@ protected:
                             CommRequestSharedPtr request, int loc) final;
     virtual void v_StartAll(CommRequestSharedPtr request) final;
     virtual void v_WaitAll(CommRequestSharedPtr request) final;
+    virtual void v_Wait(CommRequestSharedPtr request, int loc) final;
     virtual CommRequestSharedPtr v_CreateRequest(int num) final;
 
     virtual void v_SplitComm(int pRows, int pColumns) override;
@@ -157,6 +157,16 @@ void CommSerial::v_AllReduce(void *buf, int count, CommDataType dt,
     boost::ignore_unused(buf, count, dt, pOp);
 }
 
+/**
+ *
+ */
+void CommSerial::v_IAllReduce(void *buf, int count, CommDataType dt,
+                              enum ReduceOperator pOp,
+                              CommRequestSharedPtr request, int loc)
+{
+    boost::ignore_unused(buf, count, dt, pOp, request, loc);
+}
+
 /**
  *
  */
@@ -179,6 +189,31 @@ void CommSerial::v_AlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
                          recvcounts, rdispls, recvtype);
 }
 
+/**
+ *
+ */
+void CommSerial::v_IAlltoAll(void *sendbuf, int sendcount,
+                             CommDataType sendtype, void *recvbuf,
+                             int recvcount, CommDataType recvtype,
+                             CommRequestSharedPtr request, int loc)
+{
+    boost::ignore_unused(sendbuf, sendcount, sendtype, recvbuf, recvcount,
+                         recvtype, request, loc);
+}
+
+/**
+ *
+ */
+void CommSerial::v_IAlltoAllv(void *sendbuf, int sendcounts[], int sdispls[],
+                              CommDataType sendtype, void *recvbuf,
+                              int recvcounts[], int rdispls[],
+                              CommDataType recvtype,
+                              CommRequestSharedPtr request, int loc)
+{
+    boost::ignore_unused(sendbuf, sendcounts, sdispls, sendtype, recvbuf,
+                         recvcounts, rdispls, recvtype, request, loc);
+}
+
 /**
  *
  */
@@ -249,6 +284,16 @@ void CommSerial::v_NeighborAlltoAllv(void *sendbuf, int sendcounts[],
                          recvcounts, rdispls, recvtype);
 }
 
+void CommSerial::v_INeighborAlltoAllv(void *sendbuf, int sendcounts[],
+                                      int senddispls[], CommDataType sendtype,
+                                      void *recvbuf, int recvcounts[],
+                                      int rdispls[], CommDataType recvtype,
+                                      CommRequestSharedPtr request, int loc)
+{
+    boost::ignore_unused(sendbuf, sendcounts, senddispls, sendtype, recvbuf,
+                         recvcounts, rdispls, recvtype, request, loc);
+}
+
 void CommSerial::v_Irsend(void *buf, int count, CommDataType dt, int dest,
                           CommRequestSharedPtr request, int loc)
 {
@@ -278,6 +323,11 @@ void CommSerial::v_WaitAll(CommRequestSharedPtr request)
     boost::ignore_unused(request);
 }
 
+void CommSerial::v_Wait(CommRequestSharedPtr request, int loc)
+{
+    boost::ignore_unused(request, loc);
+}
+
 void CommSerial::v_StartAll(CommRequestSharedPtr request)
 {
     boost::ignore_unused(request);
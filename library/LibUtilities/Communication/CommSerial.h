@@ -88,6 +88,9 @@ protected:
                                                         int pRecvProc) final;
     LIB_UTILITIES_EXPORT virtual void v_AllReduce(
         void *buf, int count, CommDataType dt, enum ReduceOperator pOp) final;
+    LIB_UTILITIES_EXPORT virtual void v_IAllReduce(
+        void *buf, int count, CommDataType dt, enum ReduceOperator pOp,
+        CommRequestSharedPtr request, int loc) final;
     LIB_UTILITIES_EXPORT virtual void v_AlltoAll(void *sendbuf, int sendcount,
                                                  CommDataType sendtype,
                                                  void *recvbuf, int recvcount,
@@ -96,6 +99,14 @@ protected:
         void *sendbuf, int sendcounts[], int sensdispls[],
         CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
         CommDataType recvtype) final;
+    LIB_UTILITIES_EXPORT virtual void v_IAlltoAll(
+        void *sendbuf, int sendcount, CommDataType sendtype, void *recvbuf,
+        int recvcount, CommDataType recvtype, CommRequestSharedPtr request,
+        int loc) final;
+    LIB_UTILITIES_EXPORT virtual void v_IAlltoAllv(
+        void *sendbuf, int sendcounts[], int sensdispls[],
+        CommDataType sendtype, void *recvbuf, int recvcounts[], int rdispls[],
+        CommDataType recvtype, CommRequestSharedPtr request, int loc) final;
     LIB_UTILITIES_EXPORT virtual void v_AllGather(void *sendbuf, int sendcount,
                                                   CommDataType sendtype,
                                                   void *recvbuf, int recvcount,
@@ -131,6 +142,10 @@ protected:
         void *sendbuf, int sendcounts[], int sdispls[], CommDataType sendtype,
         void *recvbuf, int recvcounts[], int rdispls[],
         CommDataType recvtype) final;
+    LIB_UTILITIES_EXPORT virtual void v_INeighborAlltoAllv(
+        void *sendbuf, int sendcounts[], int sdispls[], CommDataType sendtype,
+        void *recvbuf, int recvcounts[], int rdispls[], CommDataType recvtype,
+        CommRequestSharedPtr request, int loc) final;
 
     LIB_UTILITIES_EXPORT virtual void v_Irsend(void *buf, int count,
                                                CommDataType dt, int dest,
@@ -156,6 +171,8 @@ protected:
         CommRequestSharedPtr request) final;
     LIB_UTILITIES_EXPORT virtual void v_WaitAll(
         CommRequestSharedPtr request) final;
+    LIB_UTILITIES_EXPORT virtual void v_Wait(CommRequestSharedPtr request,
+                                             int loc) final;
     LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_CreateRequest(
         int num) final;
 
@@ -35,12 +35,18 @@
 #ifndef NEKTAR_LIB_UTILITIES_COMMUNICATION_GSLIB_HPP
 #define NEKTAR_LIB_UTILITIES_COMMUNICATION_GSLIB_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/Communication/Comm.h>
 #ifdef NEKTAR_USE_MPI
 #include <LibUtilities/Communication/CommMpi.h>
 #endif
@@ -141,9 +147,42 @@ typedef enum {
     gs_all_reduce
 } gs_method;
 
+/**
+ * @brief Exchange pattern of the split-phase gather-scatter operation.
+ *
+ * The values of each universal ID which is shared with other processes, or
+ * appears more than once on this process, are combined locally and exchanged
+ * with the neighbouring processes using persistent point-to-point requests.
+ * Values are ordered by ascending ID in the messages, so that both sides of
+ * an exchange agree on their layout.
+ */
+struct gs_split
+{
+    /// Communicator used for the exchange.
+    LibUtilities::CommSharedPtr comm;
+    /// Offsets in #idx of the entries of each exchanged ID.
+    std::vector<unsigned int> idPtr;
+    /// Entries of the exchanged IDs, in ascending order of ID.
+    std::vector<unsigned int> idx;
+    /// Exchanged ID of each value in the message buffers.
+    std::vector<unsigned int> bufId;
+    /// Number of neighbouring processes.
+    unsigned int nProcs;
+    /// Locally combined value of each exchanged ID.
+    Nektar::Array<OneD, NekDouble> idVal;
+    Nektar::Array<OneD, NekDouble> sendBuf;
+    Nektar::Array<OneD, NekDouble> recvBuf;
+    /// Receive requests followed by send requests.
+    LibUtilities::CommRequestSharedPtr request;
+    /// 1 for entries which are modified by the exchange, 0 otherwise.
+    Nektar::Array<OneD, int> shared;
+};
+
 extern "C" {
 void nektar_gs(void *u, gs_dom dom, gs_op op, unsigned transpose, gs_data *gsh,
                buffer *buf);
+void nektar_gs_many(void *const *u, unsigned vn, gs_dom dom, gs_op op,
+                    unsigned transpose, gs_data *gsh, buffer *buf);
 gs_data *nektar_gs_setup(const long *id, unsigned int n,
                          const struct comm *comm, int unique, gs_method method,
                          int verbose);
@@ -266,6 +305,312 @@ static inline void Gather(
     boost::ignore_unused(pU, pOp, pGsh, pBuffer);
 #endif
 }
+
+/**
+ * @brief Performs a gather-scatter operation of several arrays at once.
+ *
+ * Each array in @p pU must have the size of the array used to set up @p pGsh.
+ * The values of all arrays are exchanged together, so that one set of
+ * messages is sent rather than one for each array.
+ */
+static inline void Gather(
+    Nektar::Array<OneD, Nektar::Array<OneD, NekDouble> > pU, gs_op pOp,
+    gs_data *pGsh,
+    Nektar::Array<OneD, NekDouble> pBuffer = NullNekDouble1DArray)
+{
+#ifdef NEKTAR_USE_MPI
+    if (!pGsh || pU.size() == 0)
+    {
+        return;
+    }
+
+    std::vector<void *> ptrs(pU.size());
+    for (size_t i = 0; i < pU.size(); ++i)
+    {
+        ptrs[i] = pU[i].get();
+    }
+
+    if (pBuffer.size() == 0)
+    {
+        nektar_gs_many(ptrs.data(), ptrs.size(), gs_double, pOp, false, pGsh,
+                       0);
+    }
+    else
+    {
+        array buf;
+        buf.ptr = &pBuffer[0];
+        buf.n   = pBuffer.size();
+        nektar_gs_many(ptrs.data(), ptrs.size(), gs_double, pOp, false, pGsh,
+                       &buf);
+    }
+#else
+    boost::ignore_unused(pU, pOp, pGsh, pBuffer);
+#endif
+}
+
+/**
+ * @brief Initialise the split-phase gather-scatter for a GSLib mapping.
+ *
+ * The processes sharing each universal ID are found with one gs_min
+ * operation on @p pGsh for each process sharing the most widely shared ID,
+ * after which the exchange uses persistent point-to-point requests. This
+ * must be called with the IDs used to set up @p pGsh, before they are
+ * modified by Unique.
+ *
+ * @param   pId         Universal IDs of each entry; zero IDs are ignored.
+ * @param   pComm       Communicator used to set up @p pGsh.
+ * @param   pGsh        GSLib mapping of @p pId.
+ * @return Split-phase exchange data, or 0 in serial.
+ */
+static inline gs_split *InitSplit(const Nektar::Array<OneD, long> pId,
+                                  const LibUtilities::CommSharedPtr &pComm,
+                                  gs_data *pGsh)
+{
+#ifdef NEKTAR_USE_MPI
+    if (!pGsh)
+    {
+        return 0;
+    }
+
+    // Group the entries of each universal ID in ascending order of ID
+    std::vector<std::pair<long, unsigned int> > ids;
+    for (unsigned int i = 0; i < pId.size(); ++i)
+    {
+        if (pId[i] > 0)
+        {
+            ids.push_back(std::make_pair(pId[i], i));
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+
+    std::vector<unsigned int> uniqPtr(1, 0);
+    for (size_t i = 1; i <= ids.size(); ++i)
+    {
+        if (i == ids.size() || ids[i].first != ids[i - 1].first)
+        {
+            uniqPtr.push_back(i);
+        }
+    }
+    const size_t nUniq = uniqPtr.size() - 1;
+
+    // Find the ranks sharing each ID in ascending order, one per round
+    const int rank         = pComm->GetRank();
+    const NekDouble noRank = std::numeric_limits<NekDouble>::max();
+    std::vector<std::vector<int> > sharers(nUniq);
+    std::vector<bool> reported(nUniq, false);
+    Nektar::Array<OneD, NekDouble> val(pId.size(), noRank);
+
+    while (true)
+    {
+        for (size_t u = 0; u < nUniq; ++u)
+        {
+            for (unsigned int j = uniqPtr[u]; j < uniqPtr[u + 1]; ++j)
+            {
+                val[ids[j].second] = reported[u] ? noRank : rank;
+            }
+        }
+
+        Gather(val, gs_min, pGsh);
+
+        int found = 0;
+        for (size_t u = 0; u < nUniq; ++u)
+        {
+            const NekDouble minRank = val[ids[uniqPtr[u]].second];
+            if (minRank == noRank)
+            {
+                continue;
+            }
+
+            found = 1;
+            if (minRank == rank)
+            {
+                reported[u] = true;
+            }
+            else
+            {
+                sharers[u].push_back(static_cast<int>(minRank));
+            }
+        }
+
+        pComm->AllReduce(found, LibUtilities::ReduceMax);
+        if (!found)
+        {
+            break;
+        }
+    }
+
+    // Keep the IDs which are shared or appear more than once locally
+    gs_split *split = new gs_split;
+    split->comm     = pComm;
+    split->shared   = Nektar::Array<OneD, int>(pId.size(), 0);
+    split->idPtr.push_back(0);
+
+    std::vector<int> procs;
+    std::vector<std::vector<unsigned int> > procIds;
+    for (size_t u = 0; u < nUniq; ++u)
+    {
+        if (sharers[u].empty() && uniqPtr[u + 1] - uniqPtr[u] == 1)
+        {
+            continue;
+        }
+
+        const unsigned int id = split->idPtr.size() - 1;
+        for (unsigned int j = uniqPtr[u]; j < uniqPtr[u + 1]; ++j)
+        {
+            split->idx.push_back(ids[j].second);
+            split->shared[ids[j].second] = 1;
+        }
+        split->idPtr.push_back(split->idx.size());
+
+        for (size_t k = 0; k < sharers[u].size(); ++k)
+        {
+            size_t p = std::find(procs.begin(), procs.end(), sharers[u][k]) -
+                procs.begin();
+            if (p == procs.size())
+            {
+                procs.push_back(sharers[u][k]);
+                procIds.push_back(std::vector<unsigned int>());
+            }
+            procIds[p].push_back(id);
+        }
+    }
+
+    split->nProcs = procs.size();
+    std::vector<unsigned int> bufPtr(1, 0);
+    for (size_t p = 0; p < procs.size(); ++p)
+    {
+        split->bufId.insert(split->bufId.end(), procIds[p].begin(),
+                            procIds[p].end());
+        bufPtr.push_back(split->bufId.size());
+    }
+
+    split->idVal   = Nektar::Array<OneD, NekDouble>(split->idPtr.size() - 1);
+    split->sendBuf = Nektar::Array<OneD, NekDouble>(split->bufId.size());
+    split->recvBuf = Nektar::Array<OneD, NekDouble>(split->bufId.size());
+    split->request = pComm->CreateRequest(2 * split->nProcs);
+
+    for (unsigned int p = 0; p < split->nProcs; ++p)
+    {
+        const int count = bufPtr[p + 1] - bufPtr[p];
+        Nektar::Array<OneD, NekDouble> recv = split->recvBuf + bufPtr[p];
+        Nektar::Array<OneD, NekDouble> send = split->sendBuf + bufPtr[p];
+        pComm->RecvInit(procs[p], recv, count, split->request, p);
+        pComm->SendInit(procs[p], send, count, split->request,
+                        split->nProcs + p);
+    }
+
+    return split;
+#else
+    boost::ignore_unused(pId, pComm, pGsh);
+    return 0;
+#endif
+}
+
+/**
+ * @brief Deallocates the split-phase gather-scatter data.
+ */
+static inline void FinaliseSplit(gs_split *pSplit)
+{
+    delete pSplit;
+}
+
+/**
+ * @brief Combines two values with a gather-scatter operation.
+ */
+static inline NekDouble Combine(NekDouble pA, NekDouble pB, gs_op pOp)
+{
+    switch (pOp)
+    {
+        case gs_add:
+            return pA + pB;
+        case gs_mul:
+            return pA * pB;
+        case gs_min:
+            return std::min(pA, pB);
+        case gs_max:
+            return std::max(pA, pB);
+        case gs_amax:
+            return std::max(std::abs(pA), std::abs(pB));
+        default:
+            NEKERROR(ErrorUtil::efatal,
+                     "Operation not supported by the split-phase gather.");
+            return pA;
+    }
+}
+
+/**
+ * @brief Starts a split-phase gather-scatter operation of @p pU.
+ *
+ * The values of the shared entries, given by gs_split::shared, are sent to
+ * the neighbouring processes. Until the matching GatherEnd, the caller may
+ * modify the remaining entries of @p pU but not the shared ones.
+ */
+static inline void GatherBegin(Nektar::Array<OneD, NekDouble> pU, gs_op pOp,
+                               gs_split *pSplit)
+{
+    if (!pSplit)
+    {
+        return;
+    }
+
+    const size_t nId = pSplit->idPtr.size() - 1;
+    for (size_t i = 0; i < nId; ++i)
+    {
+        NekDouble v = pU[pSplit->idx[pSplit->idPtr[i]]];
+        for (unsigned int j = pSplit->idPtr[i] + 1; j < pSplit->idPtr[i + 1];
+             ++j)
+        {
+            v = Combine(v, pU[pSplit->idx[j]], pOp);
+        }
+        pSplit->idVal[i] = v;
+    }
+
+    for (size_t k = 0; k < pSplit->bufId.size(); ++k)
+    {
+        pSplit->sendBuf[k] = pSplit->idVal[pSplit->bufId[k]];
+    }
+
+    if (pSplit->nProcs > 0)
+    {
+        pSplit->comm->StartAll(pSplit->request);
+    }
+}
+
+/**
+ * @brief Completes a split-phase gather-scatter operation of @p pU.
+ *
+ * Waits for the messages started by GatherBegin and writes the combined
+ * values to the shared entries of @p pU. The result is that of Gather, up to
+ * the order in which values are combined.
+ */
+static inline void GatherEnd(Nektar::Array<OneD, NekDouble> pU, gs_op pOp,
+                             gs_split *pSplit)
+{
+    if (!pSplit)
+    {
+        return;
+    }
+
+    if (pSplit->nProcs > 0)
+    {
+        pSplit->comm->WaitAll(pSplit->request);
+    }
+
+    for (size_t k = 0; k < pSplit->bufId.size(); ++k)
+    {
+        NekDouble &v = pSplit->idVal[pSplit->bufId[k]];
+        v = Combine(v, pSplit->recvBuf[k], pOp);
+    }
+
+    const size_t nId = pSplit->idPtr.size() - 1;
+    for (size_t i = 0; i < nId; ++i)
+    {
+        for (unsigned int j = pSplit->idPtr[i]; j < pSplit->idPtr[i + 1]; ++j)
+        {
+            pU[pSplit->idx[j]] = pSplit->idVal[i];
+        }
+    }
+}
 }
 
 #endif
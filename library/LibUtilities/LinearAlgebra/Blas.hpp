@@ -70,6 +70,12 @@ namespace Blas
                  const double* x,    const int& incx,
                  const double& beta, double* y, const int& incy);
 
+        void F77NAME(sgemv) (const char& trans,  const int& m,
+                 const int& n,       const float& alpha,
+                 const float* a,     const int& lda,
+                 const float* x,     const int& incx,
+                 const float& beta,  float* y, const int& incy);
+
         void F77NAME(dgbmv) (const char& trans,  const int& m,
                  const int& n, const int& kl, const int& ku,
                  const double& alpha,
@@ -90,6 +96,10 @@ namespace Blas
                  const double* x,    const int& incx,
                  const double& beta, double* y, const int& incy);
 
+        void F77NAME(dtrsv) (const char& uplo, const char& trans, const char& diag,
+                 const int& n, const double* a, const int& lda,
+                 double* x, const int& incx);
+
         // -- BLAS level 3:
         void F77NAME(dgemm) (const char& trans,   const char& transb,
                  const int& m1,       const int& n,
@@ -97,6 +107,19 @@ namespace Blas
                  const double* a,     const int& lda,
                  const double* b,     const int& ldb,
                  const double& beta,  double* c, const int& ldc);
+
+        void F77NAME(sgemm) (const char& trans,   const char& transb,
+                 const int& m1,       const int& n,
+                 const int& k,        const float& alpha,
+                 const float* a,      const int& lda,
+                 const float* b,      const int& ldb,
+                 const float& beta,   float* c, const int& ldc);
+
+        void F77NAME(dtrsm) (const char& side,    const char& uplo,
+                 const char& transa,  const char& diag,
+                 const int& m,        const int& n,
+                 const double& alpha, const double* a, const int& lda,
+                 double* b,           const int& ldb);
     }
 
     /// \brief BLAS level 1: Copy \a x to \a y
@@ -173,6 +196,16 @@ namespace Blas
         F77NAME(dgemv) (trans,m,n,alpha,a,lda,x,incx,beta,y,incy);
     }
 
+    /// \brief BLAS level 2: Single precision matrix vector multiply y = A \e x
+    /// where A[m x n]
+    static inline void Sgemv (const char& trans,   const int& m,    const int& n,
+             const float& alpha,  const float* a,  const int& lda,
+             const float* x,      const int& incx, const float& beta,
+             float* y,      const int& incy)
+    {
+        F77NAME(sgemv) (trans,m,n,alpha,a,lda,x,incx,beta,y,incy);
+    }
+
     static inline void Dgbmv (const char& trans,  const int& m,
                  const int& n, const int& kl, const int& ku,
                  const double& alpha,
@@ -207,6 +240,15 @@ namespace Blas
         F77NAME(dsbmv) (uplo,m,k,alpha,a,lda,x,incx,beta,y,incy);
     }
 
+    /// \brief BLAS level 2: Solve the triangular system A \e x = b or
+    /// A^T \e x = b, overwriting \e x with the solution
+    static inline void Dtrsv (const char& uplo,  const char& trans,
+             const char& diag,   const int& n,     const double* a,
+             const int& lda,     double* x,        const int& incx)
+    {
+        F77NAME(dtrsv) (uplo,trans,diag,n,a,lda,x,incx);
+    }
+
 
     /// \brief BLAS level 3: Matrix-matrix multiply C = A x B 
     /// where op(A)[m x k], op(B)[k x n], C[m x n]
@@ -221,6 +263,27 @@ namespace Blas
         F77NAME(dgemm) (transa,transb,m,n,k,alpha,a,lda,b,ldb,beta,c,ldc);
     }
 
+    /// \brief BLAS level 3: Single precision matrix-matrix multiply
+    /// C = alpha*op( A )*op( B ) + beta*C
+    static inline void Sgemm (const char& transa,  const char& transb, const int& m,
+          const int& n,        const int& k,       const float& alpha,
+          const float* a,      const int& lda,     const float* b,
+          const int& ldb,      const float& beta,        float* c,
+          const int& ldc)
+    {
+        F77NAME(sgemm) (transa,transb,m,n,k,alpha,a,lda,b,ldb,beta,c,ldc);
+    }
+
+    /// \brief BLAS level 3: Solve the triangular matrix equation
+    /// op( A )*X = alpha*B or X*op( A ) = alpha*B, overwriting B with X
+    static inline void Dtrsm (const char& side,   const char& uplo,
+          const char& transa,  const char& diag,  const int& m,
+          const int& n,        const double& alpha, const double* a,
+          const int& lda,      double* b,         const int& ldb)
+    {
+        F77NAME(dtrsm) (side,uplo,transa,diag,m,n,alpha,a,lda,b,ldb);
+    }
+
     // \brief Wrapper to mutliply two (row major) matrices together C =
     // a*A*B + b*C
     static inline void Cdgemm(const int M, const int N, const int K, const double a,
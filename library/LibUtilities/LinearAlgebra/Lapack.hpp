@@ -57,6 +57,8 @@ namespace Lapack
         void F77NAME(dtptrs) (const char& uplo, const char& trans, const char& diag,
                               const int& n, const int& nrhs, const double* a,
                               double* b, const int& ldb, int& info);
+        void F77NAME(dpotrf) (const char& uplo, const int& n,
+                  double* a, const int& lda, int& info);
         void F77NAME(dpptrf) (const char& uplo, const int& n,
                   double* ap, int& info);
         void F77NAME(dpptrs) (const char& uplo, const int& n,
@@ -127,6 +129,13 @@ namespace Lapack
         F77NAME(dsptri) (uplo,n,ap,ipiv,work,info);
     }
 
+    /// \brief Cholesky factor a real Positive Definite symmetric matrix.
+    static inline void Dpotrf (const char& uplo, const int& n,
+              double *a, const int& lda, int& info)
+    {
+        F77NAME(dpotrf) (uplo,n,a,lda,info);
+    }
+
     /// \brief Cholesky factor a real Positive Definite packed-symmetric matrix.
     static inline void Dpptrf (const char& uplo, const int& n,
               double *ap, int& info)
@@ -0,0 +1,1072 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SparseCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Supernodal sparse Cholesky factorisation of symmetric
+// positive definite matrices.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <queue>
+#include <string>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
+
+namespace Nektar
+{
+    namespace
+    {
+        /**
+         * Builds the lower triangular part of \f$ PAP^T \f$ in compressed
+         * row format from the upper triangular entries of @a cooMat, where
+         * @a iperm maps old to new indices. Columns within a row are not
+         * sorted.
+         */
+        void PermutedLowerRows(
+            const int                 n,
+            const COOMatType         &cooMat,
+            const std::vector<int>   &iperm,
+                  std::vector<int>   &rowPtr,
+                  std::vector<int>   &colIdx,
+                  std::vector<NekDouble> &vals)
+        {
+            rowPtr.assign(n + 1, 0);
+            for (auto &it : cooMat)
+            {
+                const int r = iperm[it.first.first];
+                const int c = iperm[it.first.second];
+                ++rowPtr[std::max(r, c) + 1];
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                rowPtr[i + 1] += rowPtr[i];
+            }
+
+            std::vector<int> cursor(rowPtr.begin(), rowPtr.end() - 1);
+            colIdx.resize(cooMat.size());
+            vals  .resize(cooMat.size());
+
+            for (auto &it : cooMat)
+            {
+                const int r = iperm[it.first.first];
+                const int c = iperm[it.first.second];
+                const int p = cursor[std::max(r, c)]++;
+                colIdx[p] = std::min(r, c);
+                vals  [p] = it.second;
+            }
+        }
+    }
+
+    /**
+     * Factorises the supernodes of a contiguous range, which must not
+     * depend on any supernode being factorised concurrently.
+     */
+    class SparseCholesky::FactorJob : public Thread::ThreadJob
+    {
+    public:
+        FactorJob(SparseCholesky               *chol,
+                  const int                     first,
+                  const int                     last,
+                  const std::vector<int>       &colPtr,
+                  const std::vector<int>       &rowIdx,
+                  const std::vector<NekDouble> &vals)
+            : m_chol(chol), m_first(first), m_last(last),
+              m_colPtr(colPtr), m_rowIdx(rowIdx), m_vals(vals)
+        {
+        }
+
+        virtual void Run()
+        {
+            std::vector<NekDouble> wsp;
+            std::vector<int>       rel;
+            for (int s = m_first; s < m_last; ++s)
+            {
+                m_chol->FactoriseSupernode(
+                    s, m_colPtr, m_rowIdx, m_vals, wsp, rel);
+            }
+        }
+
+    private:
+        SparseCholesky               *m_chol;
+        const int                     m_first;
+        const int                     m_last;
+        const std::vector<int>       &m_colPtr;
+        const std::vector<int>       &m_rowIdx;
+        const std::vector<NekDouble> &m_vals;
+    };
+
+    /**
+     * Performs the forward or backward substitution for the supernodes of a
+     * contiguous range.
+     */
+    class SparseCholesky::SolveJob : public Thread::ThreadJob
+    {
+    public:
+        SolveJob(const SparseCholesky *chol,
+                 const int             first,
+                 const int             last,
+                 const bool            forward,
+                       NekDouble      *x)
+            : m_chol(chol), m_first(first), m_last(last),
+              m_forward(forward), m_x(x)
+        {
+        }
+
+        virtual void Run()
+        {
+            std::vector<NekDouble> wsp;
+            if (m_forward)
+            {
+                for (int s = m_first; s < m_last; ++s)
+                {
+                    m_chol->ForwardSupernode(s, m_x, wsp);
+                }
+            }
+            else
+            {
+                for (int s = m_last - 1; s >= m_first; --s)
+                {
+                    m_chol->BackwardSupernode(s, m_x, wsp);
+                }
+            }
+        }
+
+    private:
+        const SparseCholesky *m_chol;
+        const int             m_first;
+        const int             m_last;
+        const bool            m_forward;
+              NekDouble      *m_x;
+    };
+
+    /**
+     * The factorisation proceeds in the usual three steps:
+     *
+     * - the rows are reordered with @a perm, or with NestedDissection() if
+     *   no ordering is given, and then relabelled in a postorder of the
+     *   elimination tree so that each supernode is a contiguous range of
+     *   columns;
+     * - the symbolic factorisation determines the supernodes and their row
+     *   structure;
+     * - the numeric factorisation computes each supernode in a left-looking
+     *   fashion from the updates of its descendants.
+     */
+    SparseCholesky::SparseCholesky(
+        const unsigned int              nRows,
+        const COOMatType               &cooMat,
+        const std::vector<int>         &perm,
+        Thread::ThreadManagerSharedPtr  threadMan)
+        : m_nRows(nRows),
+          m_nSuper(0),
+          m_threadMan(threadMan)
+    {
+        const int n = nRows;
+
+        if (perm.size())
+        {
+            ASSERTL0(perm.size() == nRows,
+                     "Ordering does not match the size of the matrix");
+            m_perm = perm;
+        }
+        else
+        {
+            // Build the adjacency graph of the matrix.
+            std::vector<int> xadj(n + 1, 0), adjncy;
+            for (auto &it : cooMat)
+            {
+                ASSERTL1(it.first.first <= it.first.second,
+                         "Only the upper triangular part should be given");
+                if (it.first.first != it.first.second)
+                {
+                    ++xadj[it.first.first  + 1];
+                    ++xadj[it.first.second + 1];
+                }
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                xadj[i + 1] += xadj[i];
+            }
+
+            std::vector<int> cursor(xadj.begin(), xadj.end() - 1);
+            adjncy.resize(xadj[n]);
+            for (auto &it : cooMat)
+            {
+                if (it.first.first != it.first.second)
+                {
+                    adjncy[cursor[it.first.first]++]  = it.first.second;
+                    adjncy[cursor[it.first.second]++] = it.first.first;
+                }
+            }
+
+            NestedDissection(n, xadj, adjncy, m_perm);
+        }
+
+        std::vector<int> iperm(n);
+        for (int i = 0; i < n; ++i)
+        {
+            iperm[m_perm[i]] = i;
+        }
+
+        // Compute the elimination tree of the reordered matrix, whose
+        // strictly upper triangular column k is given by the lower row k.
+        std::vector<int>       rowPtr, colIdx;
+        std::vector<NekDouble> vals;
+        PermutedLowerRows(n, cooMat, iperm, rowPtr, colIdx, vals);
+
+        std::vector<int> parent(n, -1), ancestor(n, -1);
+        for (int k = 0; k < n; ++k)
+        {
+            for (int p = rowPtr[k]; p < rowPtr[k + 1]; ++p)
+            {
+                int i = colIdx[p];
+                while (i != -1 && i < k)
+                {
+                    const int inext = ancestor[i];
+                    ancestor[i] = k;
+                    if (inext == -1)
+                    {
+                        parent[i] = k;
+                    }
+                    i = inext;
+                }
+            }
+        }
+
+        // Postorder the elimination tree, visiting children in increasing
+        // order, and relabel the rows accordingly.
+        std::vector<int> head(n, -1), next(n, -1), post, stack;
+        for (int j = n - 1; j >= 0; --j)
+        {
+            if (parent[j] != -1)
+            {
+                next[j] = head[parent[j]];
+                head[parent[j]] = j;
+            }
+        }
+
+        post.reserve(n);
+        for (int j = 0; j < n; ++j)
+        {
+            if (parent[j] != -1)
+            {
+                continue;
+            }
+
+            stack.push_back(j);
+            while (stack.size())
+            {
+                const int p = stack.back();
+                const int c = head[p];
+                if (c == -1)
+                {
+                    stack.pop_back();
+                    post.push_back(p);
+                }
+                else
+                {
+                    head[p] = next[c];
+                    stack.push_back(c);
+                }
+            }
+        }
+
+        std::vector<int> newPerm(n), newParent(n);
+        for (int k = 0; k < n; ++k)
+        {
+            iperm[post[k]] = k;
+        }
+        for (int k = 0; k < n; ++k)
+        {
+            newPerm  [k] = m_perm[post[k]];
+            newParent[k] = parent[post[k]] == -1 ? -1 :
+                                iperm[parent[post[k]]];
+        }
+        m_perm.swap(newPerm);
+
+        for (int i = 0; i < n; ++i)
+        {
+            iperm[m_perm[i]] = i;
+        }
+
+        // Transpose the relabelled lower triangle into compressed column
+        // format, which leaves the rows of each column sorted.
+        PermutedLowerRows(n, cooMat, iperm, rowPtr, colIdx, vals);
+
+        std::vector<int>       colPtr(n + 1, 0), rowIdx(colIdx.size());
+        std::vector<NekDouble> colVals(colIdx.size());
+        for (size_t p = 0; p < colIdx.size(); ++p)
+        {
+            ++colPtr[colIdx[p] + 1];
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            colPtr[i + 1] += colPtr[i];
+        }
+
+        std::vector<int> cursor(colPtr.begin(), colPtr.end() - 1);
+        for (int r = 0; r < n; ++r)
+        {
+            for (int p = rowPtr[r]; p < rowPtr[r + 1]; ++p)
+            {
+                const int q = cursor[colIdx[p]]++;
+                rowIdx [q] = r;
+                colVals[q] = vals[p];
+            }
+        }
+
+        std::vector<int>().swap(rowPtr);
+        std::vector<int>().swap(colIdx);
+        std::vector<NekDouble>().swap(vals);
+
+        SymbolicFactorisation(colPtr, rowIdx, newParent);
+
+        // Numeric factorisation.
+        if (m_subtrees.empty())
+        {
+            std::vector<NekDouble> wsp;
+            std::vector<int>       rel;
+            for (int s = 0; s < m_nSuper; ++s)
+            {
+                FactoriseSupernode(s, colPtr, rowIdx, colVals, wsp, rel);
+            }
+        }
+        else
+        {
+            std::vector<Thread::ThreadJob*> jobs(m_subtrees.size());
+            for (size_t i = 0; i < m_subtrees.size(); ++i)
+            {
+                jobs[i] = new FactorJob(this, m_subtrees[i].first,
+                                        m_subtrees[i].second,
+                                        colPtr, rowIdx, colVals);
+            }
+            RunJobs(jobs);
+
+            std::vector<NekDouble> wsp;
+            std::vector<int>       rel;
+            for (auto &s : m_topSuper)
+            {
+                FactoriseSupernode(s, colPtr, rowIdx, colVals, wsp, rel);
+            }
+        }
+    }
+
+    SparseCholesky::~SparseCholesky()
+    {
+    }
+
+    /**
+     * The structure of each column is the union of the entries of the
+     * matrix below the diagonal with the structures of its children in the
+     * elimination tree. Consecutive columns form a fundamental supernode if
+     * each is the only child of the next and their structures are nested.
+     */
+    void SparseCholesky::SymbolicFactorisation(
+        const std::vector<int>       &colPtr,
+        const std::vector<int>       &rowIdx,
+        const std::vector<int>       &parent)
+    {
+        const int n = m_nRows;
+
+        std::vector<int> head(n, -1), next(n, -1), nChild(n, 0);
+        for (int j = n - 1; j >= 0; --j)
+        {
+            if (parent[j] != -1)
+            {
+                next[j] = head[parent[j]];
+                head[parent[j]] = j;
+                ++nChild[parent[j]];
+            }
+        }
+
+        // The structure of a column is only kept until its parent has been
+        // processed.
+        std::vector<std::vector<int> > colStruct(n);
+        std::vector<int> mark(n, -1);
+
+        m_superStart.assign(1, 0);
+        m_rowPtr    .assign(1, 0);
+        m_rowIdx    .clear();
+
+        auto closeSupernode = [&](const int last)
+        {
+            for (int c = m_superStart.back(); c <= last; ++c)
+            {
+                m_rowIdx.push_back(c);
+            }
+            m_rowIdx.insert(m_rowIdx.end(), colStruct[last].begin(),
+                            colStruct[last].end());
+            m_rowPtr    .push_back(m_rowIdx.size());
+            m_superStart.push_back(last + 1);
+        };
+
+        for (int j = 0; j < n; ++j)
+        {
+            std::vector<int> &cs = colStruct[j];
+            mark[j] = j;
+
+            for (int p = colPtr[j]; p < colPtr[j + 1]; ++p)
+            {
+                const int r = rowIdx[p];
+                if (r > j && mark[r] != j)
+                {
+                    mark[r] = j;
+                    cs.push_back(r);
+                }
+            }
+
+            for (int c = head[j]; c != -1; c = next[c])
+            {
+                for (auto &r : colStruct[c])
+                {
+                    if (r > j && mark[r] != j)
+                    {
+                        mark[r] = j;
+                        cs.push_back(r);
+                    }
+                }
+            }
+
+            std::sort(cs.begin(), cs.end());
+
+            if (j > 0 && !(parent[j - 1] == j && nChild[j] == 1 &&
+                           colStruct[j - 1].size() == cs.size() + 1))
+            {
+                closeSupernode(j - 1);
+            }
+
+            for (int c = head[j]; c != -1; c = next[c])
+            {
+                std::vector<int>().swap(colStruct[c]);
+            }
+        }
+
+        if (n > 0)
+        {
+            closeSupernode(n - 1);
+        }
+
+        m_nSuper = m_superStart.size() - 1;
+
+        std::vector<int> superOf(n);
+        for (int s = 0; s < m_nSuper; ++s)
+        {
+            for (int c = m_superStart[s]; c < m_superStart[s + 1]; ++c)
+            {
+                superOf[c] = s;
+            }
+        }
+
+        // Allocate the dense blocks and find the descendants updating each
+        // supernode from the rows below their diagonal blocks.
+        std::vector<int> superParent(m_nSuper, -1);
+        m_LxPtr .assign(m_nSuper + 1, 0);
+        m_updPtr.assign(m_nSuper + 1, 0);
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            std::vector<int> cursor(m_updPtr.begin(), m_updPtr.end() - 1);
+
+            for (int s = 0; s < m_nSuper; ++s)
+            {
+                const int w = m_superStart[s + 1] - m_superStart[s];
+                const int m = m_rowPtr[s + 1] - m_rowPtr[s];
+                const int *rows = &m_rowIdx[0] + m_rowPtr[s];
+
+                int p = w;
+                while (p < m)
+                {
+                    const int t = superOf[rows[p]];
+                    const int p0 = p;
+                    while (p < m && rows[p] < m_superStart[t + 1])
+                    {
+                        ++p;
+                    }
+
+                    if (pass == 0)
+                    {
+                        ++m_updPtr[t + 1];
+                    }
+                    else
+                    {
+                        const int u = cursor[t]++;
+                        m_updSuper   [u] = s;
+                        m_updRowStart[u] = p0;
+                        m_updRowEnd  [u] = p;
+                    }
+                }
+
+                if (pass == 0)
+                {
+                    m_LxPtr[s + 1] = m_LxPtr[s] + size_t(m) * w;
+                    if (m > w)
+                    {
+                        superParent[s] = superOf[rows[w]];
+                    }
+                }
+            }
+
+            if (pass == 0)
+            {
+                for (int s = 0; s < m_nSuper; ++s)
+                {
+                    m_updPtr[s + 1] += m_updPtr[s];
+                }
+                m_updSuper   .resize(m_updPtr[m_nSuper]);
+                m_updRowStart.resize(m_updPtr[m_nSuper]);
+                m_updRowEnd  .resize(m_updPtr[m_nSuper]);
+            }
+        }
+
+        m_Lx.assign(m_LxPtr[m_nSuper], 0.0);
+
+        PartitionTree(superParent);
+    }
+
+    /**
+     * Splits the supernodal elimination tree into independent subtrees for
+     * the worker threads by repeatedly replacing the subtree with the
+     * largest estimated work by those of its children, until there are a
+     * few subtrees per worker. The roots removed in the process form the
+     * top of the tree.
+     */
+    void SparseCholesky::PartitionTree(const std::vector<int> &superParent)
+    {
+        m_subtrees.clear();
+        m_topSuper.clear();
+
+        if (!m_threadMan || m_threadMan->GetMaxNumWorkers() < 2)
+        {
+            return;
+        }
+
+        const size_t nSubtrees = 4 * m_threadMan->GetMaxNumWorkers();
+
+        std::vector<NekDouble> work(m_nSuper);
+        std::vector<int>       first(m_nSuper);
+        std::vector<int>       head(m_nSuper, -1), next(m_nSuper, -1);
+
+        for (int s = 0; s < m_nSuper; ++s)
+        {
+            const NekDouble w = m_superStart[s + 1] - m_superStart[s];
+            const NekDouble m = m_rowPtr[s + 1] - m_rowPtr[s];
+            work [s] = w * m * m;
+            first[s] = s;
+        }
+
+        // In a postorder all descendants precede their ancestor.
+        for (int s = 0; s < m_nSuper; ++s)
+        {
+            const int p = superParent[s];
+            if (p != -1)
+            {
+                work [p] += work[s];
+                first[p]  = std::min(first[p], first[s]);
+                next [s]  = head[p];
+                head [p]  = s;
+            }
+        }
+
+        std::priority_queue<std::pair<NekDouble, int> > subtrees;
+        for (int s = 0; s < m_nSuper; ++s)
+        {
+            if (superParent[s] == -1)
+            {
+                subtrees.push(std::make_pair(work[s], s));
+            }
+        }
+
+        while (subtrees.size() < nSubtrees)
+        {
+            const int s = subtrees.top().second;
+            if (head[s] == -1)
+            {
+                break;
+            }
+
+            subtrees.pop();
+            m_topSuper.push_back(s);
+            for (int c = head[s]; c != -1; c = next[c])
+            {
+                subtrees.push(std::make_pair(work[c], c));
+            }
+        }
+
+        while (subtrees.size())
+        {
+            const int s = subtrees.top().second;
+            m_subtrees.push_back(std::make_pair(first[s], s + 1));
+            subtrees.pop();
+        }
+
+        std::sort(m_topSuper.begin(), m_topSuper.end());
+    }
+
+    /**
+     * Computes the dense block of supernode @a s from the entries of the
+     * matrix and the updates \f$ L_{rd} L_{cd}^T \f$ of each descendant
+     * \f$ d \f$, followed by a dense Cholesky factorisation of its diagonal
+     * block and a triangular solve for the rows below.
+     */
+    void SparseCholesky::FactoriseSupernode(
+        const int                     s,
+        const std::vector<int>       &colPtr,
+        const std::vector<int>       &rowIdx,
+        const std::vector<NekDouble> &vals,
+              std::vector<NekDouble> &wsp,
+              std::vector<int>       &rel)
+    {
+        const int  f    = m_superStart[s];
+        const int  w    = m_superStart[s + 1] - f;
+        const int  m    = m_rowPtr[s + 1] - m_rowPtr[s];
+        const int *rows = &m_rowIdx[0] + m_rowPtr[s];
+        NekDouble *Ls   = &m_Lx[0] + m_LxPtr[s];
+
+        // The rows of each column of the matrix are a subset of the rows
+        // of the supernode.
+        for (int k = 0; k < w; ++k)
+        {
+            int q = k;
+            for (int p = colPtr[f + k]; p < colPtr[f + k + 1]; ++p)
+            {
+                while (rows[q] != rowIdx[p])
+                {
+                    ++q;
+                }
+                Ls[q + k * m] = vals[p];
+            }
+        }
+
+        for (int u = m_updPtr[s]; u < m_updPtr[s + 1]; ++u)
+        {
+            const int  d     = m_updSuper[u];
+            const int  p0    = m_updRowStart[u];
+            const int  p1    = m_updRowEnd[u];
+            const int  wd    = m_superStart[d + 1] - m_superStart[d];
+            const int  md    = m_rowPtr[d + 1] - m_rowPtr[d];
+            const int *drows = &m_rowIdx[0] + m_rowPtr[d];
+            const NekDouble *Ld = &m_Lx[0] + m_LxPtr[d];
+
+            const int nr = md - p0;
+            const int nc = p1 - p0;
+
+            if (wsp.size() < size_t(nr) * nc)
+            {
+                wsp.resize(size_t(nr) * nc);
+            }
+            if (rel.size() < size_t(nr))
+            {
+                rel.resize(nr);
+            }
+
+            Blas::Dgemm('N', 'T', nr, nc, wd, 1.0, Ld + p0, md, Ld + p0, md,
+                        0.0, &wsp[0], nr);
+
+            // The rows of the descendant from p0 onwards are a subset of
+            // the rows of this supernode.
+            for (int i = 0, q = 0; i < nr; ++i)
+            {
+                while (rows[q] != drows[p0 + i])
+                {
+                    ++q;
+                }
+                rel[i] = q;
+            }
+
+            for (int j = 0; j < nc; ++j)
+            {
+                NekDouble       *Lc = Ls + size_t(rel[j]) * m;
+                const NekDouble *Uc = &wsp[0] + size_t(j) * nr;
+                for (int i = j; i < nr; ++i)
+                {
+                    Lc[rel[i]] -= Uc[i];
+                }
+            }
+        }
+
+        int info = 0;
+        Lapack::Dpotrf('L', w, Ls, m, info);
+        ASSERTL0(info == 0, "Matrix is not positive definite: Dpotrf "
+                 "returned info = " + std::to_string(info) +
+                 " for supernode " + std::to_string(s));
+
+        if (m > w)
+        {
+            Blas::Dtrsm('R', 'L', 'T', 'N', m - w, w, 1.0, Ls, m,
+                        Ls + w, m);
+        }
+    }
+
+    /**
+     * Solves \f$ L_{ss} y_s = b_s - \sum_d L_{sd} y_d \f$ over the
+     * descendants \f$ d \f$ updating supernode @a s. Only the entries of
+     * @a x belonging to @a s are modified.
+     */
+    void SparseCholesky::ForwardSupernode(
+        const int                     s,
+              NekDouble              *x,
+              std::vector<NekDouble> &wsp) const
+    {
+        const int        f  = m_superStart[s];
+        const int        w  = m_superStart[s + 1] - f;
+        const int        m  = m_rowPtr[s + 1] - m_rowPtr[s];
+        const NekDouble *Ls = &m_Lx[0] + m_LxPtr[s];
+
+        for (int u = m_updPtr[s]; u < m_updPtr[s + 1]; ++u)
+        {
+            const int  d     = m_updSuper[u];
+            const int  p0    = m_updRowStart[u];
+            const int  nc    = m_updRowEnd[u] - p0;
+            const int  fd    = m_superStart[d];
+            const int  wd    = m_superStart[d + 1] - fd;
+            const int  md    = m_rowPtr[d + 1] - m_rowPtr[d];
+            const int *drows = &m_rowIdx[0] + m_rowPtr[d];
+            const NekDouble *Ld = &m_Lx[0] + m_LxPtr[d];
+
+            if (wsp.size() < size_t(nc))
+            {
+                wsp.resize(nc);
+            }
+
+            Blas::Dgemv('N', nc, wd, 1.0, Ld + p0, md, x + fd, 1,
+                        0.0, &wsp[0], 1);
+
+            for (int i = 0; i < nc; ++i)
+            {
+                x[drows[p0 + i]] -= wsp[i];
+            }
+        }
+
+        Blas::Dtrsv('L', 'N', 'N', w, Ls, m, x + f, 1);
+    }
+
+    /**
+     * Solves \f$ L_{ss}^T x_s = y_s - L_{rs}^T x_r \f$, where \f$ r \f$
+     * are the rows of supernode @a s below its diagonal block, which belong
+     * to its ancestors.
+     */
+    void SparseCholesky::BackwardSupernode(
+        const int                     s,
+              NekDouble              *x,
+              std::vector<NekDouble> &wsp) const
+    {
+        const int        f    = m_superStart[s];
+        const int        w    = m_superStart[s + 1] - f;
+        const int        m    = m_rowPtr[s + 1] - m_rowPtr[s];
+        const int       *rows = &m_rowIdx[0] + m_rowPtr[s];
+        const NekDouble *Ls   = &m_Lx[0] + m_LxPtr[s];
+
+        if (m > w)
+        {
+            if (wsp.size() < size_t(m - w))
+            {
+                wsp.resize(m - w);
+            }
+
+            for (int i = w; i < m; ++i)
+            {
+                wsp[i - w] = x[rows[i]];
+            }
+
+            Blas::Dgemv('T', m - w, w, -1.0, Ls + w, m, &wsp[0], 1,
+                        1.0, x + f, 1);
+        }
+
+        Blas::Dtrsv('L', 'T', 'N', w, Ls, m, x + f, 1);
+    }
+
+    void SparseCholesky::Solve(
+        const NekDouble *pInput,
+              NekDouble *pOutput) const
+    {
+        const int n = m_nRows;
+        std::vector<NekDouble> x(n);
+
+        for (int i = 0; i < n; ++i)
+        {
+            x[i] = pInput[m_perm[i]];
+        }
+
+        std::vector<NekDouble> wsp;
+        if (m_subtrees.empty())
+        {
+            for (int s = 0; s < m_nSuper; ++s)
+            {
+                ForwardSupernode(s, &x[0], wsp);
+            }
+            for (int s = m_nSuper - 1; s >= 0; --s)
+            {
+                BackwardSupernode(s, &x[0], wsp);
+            }
+        }
+        else
+        {
+            std::vector<Thread::ThreadJob*> jobs(m_subtrees.size());
+            for (size_t i = 0; i < m_subtrees.size(); ++i)
+            {
+                jobs[i] = new SolveJob(this, m_subtrees[i].first,
+                                       m_subtrees[i].second, true, &x[0]);
+            }
+            RunJobs(jobs);
+
+            for (auto &s : m_topSuper)
+            {
+                ForwardSupernode(s, &x[0], wsp);
+            }
+            for (auto it = m_topSuper.rbegin(); it != m_topSuper.rend(); ++it)
+            {
+                BackwardSupernode(*it, &x[0], wsp);
+            }
+
+            for (size_t i = 0; i < m_subtrees.size(); ++i)
+            {
+                jobs[i] = new SolveJob(this, m_subtrees[i].first,
+                                       m_subtrees[i].second, false, &x[0]);
+            }
+            RunJobs(jobs);
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            pOutput[m_perm[i]] = x[i];
+        }
+    }
+
+    /**
+     * Runs the jobs on the thread manager and waits for their completion;
+     * the jobs are deleted by the workers.
+     */
+    void SparseCholesky::RunJobs(std::vector<Thread::ThreadJob*> &jobs) const
+    {
+        unsigned int nWorkers = m_threadMan->GetNumWorkers();
+        m_threadMan->SetNumWorkers(0);
+        m_threadMan->QueueJobs(jobs);
+        m_threadMan->SetNumWorkers(nWorkers);
+        m_threadMan->Wait();
+    }
+
+    /**
+     * Each connected part of the graph is split by a level structure rooted
+     * at a pseudo-peripheral vertex: the level containing the median
+     * vertex, reduced to the vertices adjacent to the next level, separates
+     * the levels above it from those below. The two halves are ordered
+     * recursively before the separator, and parts of at most 64 vertices
+     * are numbered in breadth-first order.
+     */
+    void SparseCholesky::NestedDissection(
+        const int                nVerts,
+        const std::vector<int>  &xadj,
+        const std::vector<int>  &adjncy,
+              std::vector<int>  &perm)
+    {
+        const int leafSize = 64;
+
+        perm.resize(nVerts);
+
+        // Vertices of each pending part and the first new index assigned
+        // to it.
+        std::vector<std::pair<std::vector<int>, int> > parts;
+        std::vector<int> part(nVerts, 0), visit(nVerts, -1), level(nVerts);
+        int nPart = 0, nVisit = 0;
+
+        // Breadth-first search from root within the current part; returns
+        // the vertices in order of their level, with the level offsets in
+        // levelPtr.
+        std::vector<int> order, levelPtr;
+        auto bfs = [&](const int root, const int id)
+        {
+            order.assign(1, root);
+            levelPtr.assign(1, 0);
+            visit[root] = nVisit;
+            level[root] = 0;
+
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                const int v = order[i];
+                if (level[v] == int(levelPtr.size()) - 1)
+                {
+                    levelPtr.push_back(i);
+                }
+                for (int p = xadj[v]; p < xadj[v + 1]; ++p)
+                {
+                    const int u = adjncy[p];
+                    if (part[u] == id && visit[u] != nVisit)
+                    {
+                        visit[u] = nVisit;
+                        level[u] = level[v] + 1;
+                        order.push_back(u);
+                    }
+                }
+            }
+            levelPtr.push_back(order.size());
+            levelPtr.erase(levelPtr.begin());
+            ++nVisit;
+        };
+
+        std::vector<int> all(nVerts);
+        for (int i = 0; i < nVerts; ++i)
+        {
+            all[i] = i;
+        }
+        parts.push_back(std::make_pair(all, 0));
+
+        while (parts.size())
+        {
+            std::vector<int> verts;
+            verts.swap(parts.back().first);
+            const int lo = parts.back().second;
+            parts.pop_back();
+
+            const int id = ++nPart;
+            for (auto &v : verts)
+            {
+                part[v] = id;
+            }
+
+            // Treat each connected component separately.
+            const int first = nVisit;
+            bfs(verts[0], id);
+            if (order.size() < verts.size())
+            {
+                int offset = lo;
+                parts.push_back(std::make_pair(order, offset));
+                offset += order.size();
+                for (auto &v : verts)
+                {
+                    if (visit[v] < first)
+                    {
+                        bfs(v, id);
+                        parts.push_back(std::make_pair(order, offset));
+                        offset += order.size();
+                    }
+                }
+                continue;
+            }
+
+            const int size = verts.size();
+            if (size <= leafSize)
+            {
+                std::copy(order.begin(), order.end(), perm.begin() + lo);
+                continue;
+            }
+
+            // Find a pseudo-peripheral vertex by repeatedly restarting from
+            // a vertex of minimum degree in the last level.
+            int nLevels = levelPtr.size() - 1;
+            for (int iter = 0; iter < 8; ++iter)
+            {
+                int root = order[levelPtr[nLevels - 1]], minDeg = nVerts;
+                for (int i = levelPtr[nLevels - 1]; i < size; ++i)
+                {
+                    const int deg = xadj[order[i] + 1] - xadj[order[i]];
+                    if (deg < minDeg)
+                    {
+                        minDeg = deg;
+                        root   = order[i];
+                    }
+                }
+
+                std::vector<int> prevOrder(order), prevLevelPtr(levelPtr);
+                bfs(root, id);
+
+                const int newLevels = levelPtr.size() - 1;
+                if (newLevels < nLevels)
+                {
+                    order.swap(prevOrder);
+                    levelPtr.swap(prevLevelPtr);
+                    for (int l = 0, i = 0; i < size; ++i)
+                    {
+                        while (i >= levelPtr[l + 1])
+                        {
+                            ++l;
+                        }
+                        level[order[i]] = l;
+                    }
+                }
+                if (newLevels <= nLevels)
+                {
+                    break;
+                }
+                nLevels = newLevels;
+            }
+
+            if (nLevels < 3)
+            {
+                std::copy(order.begin(), order.end(), perm.begin() + lo);
+                continue;
+            }
+
+            // Separate at the level containing the median vertex.
+            int sep = 0;
+            while (levelPtr[sep + 1] <= size / 2)
+            {
+                ++sep;
+            }
+            sep = std::max(1, std::min(sep, nLevels - 2));
+
+            std::vector<int> lower, upper, separator;
+            for (int i = 0; i < size; ++i)
+            {
+                const int v = order[i];
+                if (level[v] < sep)
+                {
+                    lower.push_back(v);
+                }
+                else if (level[v] > sep)
+                {
+                    upper.push_back(v);
+                }
+                else
+                {
+                    bool adjacent = false;
+                    for (int p = xadj[v]; p < xadj[v + 1]; ++p)
+                    {
+                        const int u = adjncy[p];
+                        if (part[u] == id && level[u] == sep + 1)
+                        {
+                            adjacent = true;
+                            break;
+                        }
+                    }
+                    (adjacent ? separator : lower).push_back(v);
+                }
+            }
+
+            std::copy(separator.begin(), separator.end(),
+                      perm.begin() + lo + lower.size() + upper.size());
+            parts.push_back(std::make_pair(upper, lo + int(lower.size())));
+            parts.push_back(std::make_pair(lower, lo));
+        }
+    }
+}
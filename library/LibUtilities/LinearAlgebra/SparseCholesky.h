@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SparseCholesky.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Supernodal sparse Cholesky factorisation of symmetric
+// positive definite matrices.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_H
+#define NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SPARSE_CHOLESKY_H
+
+#include <memory>
+#include <vector>
+
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+
+namespace Nektar
+{
+    class SparseCholesky;
+    typedef std::shared_ptr<SparseCholesky> SparseCholeskySharedPtr;
+
+    /**
+     * @brief Supernodal Cholesky factorisation \f$ PAP^T = LL^T \f$ of a
+     * sparse symmetric positive definite matrix.
+     *
+     * The rows are permuted with a fill-reducing ordering, which is either
+     * supplied by the caller or computed with a level-structure nested
+     * dissection. Columns of \f$ L \f$ sharing the same sparsity pattern are
+     * grouped into supernodes, which are stored as dense column-major blocks
+     * and factorised with level 3 BLAS.
+     *
+     * Disjoint subtrees of the supernodal elimination tree do not depend on
+     * each other; if a thread manager with more than one worker is given,
+     * these subtrees are factorised and solved concurrently and only the
+     * top of the tree is processed serially.
+     */
+    class SparseCholesky
+    {
+    public:
+        /// Factorises the matrix given by the upper triangular part
+        /// (row <= column) of @a cooMat, using the ordering @a perm (new to
+        /// old index) if given.
+        LIB_UTILITIES_EXPORT SparseCholesky(
+            const unsigned int                     nRows,
+            const COOMatType                      &cooMat,
+            const std::vector<int>                &perm = std::vector<int>(),
+            Thread::ThreadManagerSharedPtr         threadMan =
+                Thread::ThreadManagerSharedPtr());
+
+        LIB_UTILITIES_EXPORT ~SparseCholesky();
+
+        /// Solves \f$ Ax = b \f$, where @a pInput and @a pOutput may alias.
+        LIB_UTILITIES_EXPORT void Solve(
+            const NekDouble *pInput,
+                  NekDouble *pOutput) const;
+
+        /// Returns the number of rows of the matrix.
+        unsigned int GetRows() const
+        {
+            return m_nRows;
+        }
+
+        /// Returns the number of entries stored for the factor \f$ L \f$.
+        size_t GetNumNonZeroEntries() const
+        {
+            return m_Lx.size();
+        }
+
+        /// Returns the number of supernodes of the factor.
+        int GetNumSupernodes() const
+        {
+            return m_nSuper;
+        }
+
+        /// Computes a nested dissection ordering of the graph given in
+        /// compressed adjacency format; @a perm maps new to old indices.
+        LIB_UTILITIES_EXPORT static void NestedDissection(
+            const int                nVerts,
+            const std::vector<int>  &xadj,
+            const std::vector<int>  &adjncy,
+                  std::vector<int>  &perm);
+
+    private:
+        class FactorJob;
+        class SolveJob;
+
+        unsigned int               m_nRows;
+        int                        m_nSuper;
+
+        /// New to old row index.
+        std::vector<int>           m_perm;
+
+        /// First column of each supernode, of size #m_nSuper + 1.
+        std::vector<int>           m_superStart;
+        /// Offsets of the row indices of each supernode in #m_rowIdx.
+        std::vector<size_t>        m_rowPtr;
+        /// Row indices of each supernode, starting with its own columns.
+        std::vector<int>           m_rowIdx;
+        /// Offsets of the dense block of each supernode in #m_Lx.
+        std::vector<size_t>        m_LxPtr;
+        /// Dense column-major blocks of the factor.
+        std::vector<NekDouble>     m_Lx;
+
+        /// Descendant supernodes updating each supernode, stored by
+        /// supernode in the ranges given by #m_updPtr together with the
+        /// range of rows of the descendant lying in the updated supernode.
+        std::vector<int>           m_updPtr;
+        std::vector<int>           m_updSuper;
+        std::vector<int>           m_updRowStart;
+        std::vector<int>           m_updRowEnd;
+
+        /// Ranges of supernodes forming independent subtrees, followed by
+        /// the supernodes at the top of the tree which depend on them.
+        std::vector<std::pair<int, int> > m_subtrees;
+        std::vector<int>           m_topSuper;
+
+        Thread::ThreadManagerSharedPtr m_threadMan;
+
+        void SymbolicFactorisation(
+            const std::vector<int>       &colPtr,
+            const std::vector<int>       &rowIdx,
+            const std::vector<int>       &parent);
+
+        void PartitionTree(const std::vector<int> &superParent);
+
+        void FactoriseSupernode(
+            const int                     s,
+            const std::vector<int>       &colPtr,
+            const std::vector<int>       &rowIdx,
+            const std::vector<NekDouble> &vals,
+                  std::vector<NekDouble> &wsp,
+                  std::vector<int>       &rel);
+
+        void ForwardSupernode(
+            const int                     s,
+                  NekDouble              *x,
+                  std::vector<NekDouble> &wsp) const;
+
+        void BackwardSupernode(
+            const int                     s,
+                  NekDouble              *x,
+                  std::vector<NekDouble> &wsp) const;
+
+        void RunJobs(std::vector<Thread::ThreadJob*> &jobs) const;
+    };
+}
+
+#endif
@@ -334,6 +334,302 @@ void Pairwise::PerformExchange(const Array<OneD, NekDouble> &testFwd,
     }
 }
 
+ExchangeMethod::SplitBuffers &AllToAll::GetSplitBuffers(const int nVar)
+{
+    auto it = m_splitBuffers.find(nVar);
+    if (it == m_splitBuffers.end())
+    {
+        int size = nVar * m_maxQuad * m_maxCount * m_nRanks;
+
+        SplitBuffers &buff = m_splitBuffers[nVar];
+        buff.m_sendBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_recvBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_sendRequest = m_comm->CreateRequest(1);
+        return buff;
+    }
+
+    return it->second;
+}
+
+void AllToAll::BeginExchange(
+    const Array<OneD, const Array<OneD, NekDouble>> &testFwd)
+{
+    m_splitNumVar      = testFwd.size();
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+
+    // Each rank receives the values of all variables in one block
+    int block = m_maxQuad * m_maxCount;
+    for (size_t r = 0; r < m_nRanks; ++r)
+    {
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            int offset = (r * m_splitNumVar + v) * block;
+            for (size_t j = 0; j < block; ++j)
+            {
+                int idx = m_allEdgeIndex[r * block + j];
+                buff.m_sendBuff[offset + j] = idx == -1 ? 0 : testFwd[v][idx];
+            }
+        }
+    }
+
+    m_comm->IAlltoAll(buff.m_sendBuff, buff.m_recvBuff, buff.m_sendRequest, 0);
+}
+
+void AllToAll::FinishExchange(Array<OneD, Array<OneD, NekDouble>> &testBwd)
+{
+    ASSERTL1(testBwd.size() == m_splitNumVar,
+             "Number of variables differs from the exchange in progress.");
+
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+    m_comm->WaitAll(buff.m_sendRequest);
+
+    int block = m_maxQuad * m_maxCount;
+    for (size_t r = 0; r < m_nRanks; ++r)
+    {
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            int offset = (r * m_splitNumVar + v) * block;
+            for (size_t j = 0; j < block; ++j)
+            {
+                int idx = m_allEdgeIndex[r * block + j];
+                if (idx != -1)
+                {
+                    testBwd[v][idx] = buff.m_recvBuff[offset + j];
+                }
+            }
+        }
+    }
+}
+
+ExchangeMethod::SplitBuffers &AllToAllV::GetSplitBuffers(const int nVar)
+{
+    auto it = m_splitBuffers.find(nVar);
+    if (it == m_splitBuffers.end())
+    {
+        int size = nVar * m_allVEdgeIndex.size();
+
+        SplitBuffers &buff = m_splitBuffers[nVar];
+        buff.m_sendBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_recvBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_count       = Array<OneD, int>(m_allVSendCount.size());
+        buff.m_disp        = Array<OneD, int>(m_allVSendDisp.size());
+        for (size_t i = 0; i < m_allVSendCount.size(); ++i)
+        {
+            buff.m_count[i] = nVar * m_allVSendCount[i];
+            buff.m_disp[i]  = nVar * m_allVSendDisp[i];
+        }
+        buff.m_sendRequest = m_comm->CreateRequest(1);
+        return buff;
+    }
+
+    return it->second;
+}
+
+void AllToAllV::BeginExchange(
+    const Array<OneD, const Array<OneD, NekDouble>> &testFwd)
+{
+    m_splitNumVar      = testFwd.size();
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+
+    for (size_t i = 0; i < m_allVSendCount.size(); ++i)
+    {
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            int offset = buff.m_disp[i] + v * m_allVSendCount[i];
+            for (size_t j = 0; j < m_allVSendCount[i]; ++j)
+            {
+                buff.m_sendBuff[offset + j] =
+                    testFwd[v][m_allVEdgeIndex[m_allVSendDisp[i] + j]];
+            }
+        }
+    }
+
+    m_comm->IAlltoAllv(buff.m_sendBuff, buff.m_count, buff.m_disp,
+                       buff.m_recvBuff, buff.m_count, buff.m_disp,
+                       buff.m_sendRequest, 0);
+}
+
+void AllToAllV::FinishExchange(Array<OneD, Array<OneD, NekDouble>> &testBwd)
+{
+    ASSERTL1(testBwd.size() == m_splitNumVar,
+             "Number of variables differs from the exchange in progress.");
+
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+    m_comm->WaitAll(buff.m_sendRequest);
+
+    for (size_t i = 0; i < m_allVSendCount.size(); ++i)
+    {
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            int offset = buff.m_disp[i] + v * m_allVSendCount[i];
+            for (size_t j = 0; j < m_allVSendCount[i]; ++j)
+            {
+                testBwd[v][m_allVEdgeIndex[m_allVSendDisp[i] + j]] =
+                    buff.m_recvBuff[offset + j];
+            }
+        }
+    }
+}
+
+ExchangeMethod::SplitBuffers &NeighborAllToAllV::GetSplitBuffers(
+    const int nVar)
+{
+    auto it = m_splitBuffers.find(nVar);
+    if (it == m_splitBuffers.end())
+    {
+        int size = nVar * m_edgeTraceIndex.size();
+
+        SplitBuffers &buff = m_splitBuffers[nVar];
+        buff.m_sendBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_recvBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_count       = Array<OneD, int>(m_sendCount.size());
+        buff.m_disp        = Array<OneD, int>(m_sendDisp.size());
+        for (size_t i = 0; i < m_sendCount.size(); ++i)
+        {
+            buff.m_count[i] = nVar * m_sendCount[i];
+            buff.m_disp[i]  = nVar * m_sendDisp[i];
+        }
+        buff.m_sendRequest = m_comm->CreateRequest(1);
+        return buff;
+    }
+
+    return it->second;
+}
+
+void NeighborAllToAllV::BeginExchange(
+    const Array<OneD, const Array<OneD, NekDouble>> &testFwd)
+{
+    m_splitNumVar      = testFwd.size();
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+
+    for (size_t i = 0; i < m_sendCount.size(); ++i)
+    {
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            int offset = buff.m_disp[i] + v * m_sendCount[i];
+            for (size_t j = 0; j < m_sendCount[i]; ++j)
+            {
+                buff.m_sendBuff[offset + j] =
+                    testFwd[v][m_edgeTraceIndex[m_sendDisp[i] + j]];
+            }
+        }
+    }
+
+    m_comm->INeighborAlltoAllv(buff.m_sendBuff, buff.m_count, buff.m_disp,
+                               buff.m_recvBuff, buff.m_count, buff.m_disp,
+                               buff.m_sendRequest, 0);
+}
+
+void NeighborAllToAllV::FinishExchange(
+    Array<OneD, Array<OneD, NekDouble>> &testBwd)
+{
+    ASSERTL1(testBwd.size() == m_splitNumVar,
+             "Number of variables differs from the exchange in progress.");
+
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+    m_comm->WaitAll(buff.m_sendRequest);
+
+    for (size_t i = 0; i < m_sendCount.size(); ++i)
+    {
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            int offset = buff.m_disp[i] + v * m_sendCount[i];
+            for (size_t j = 0; j < m_sendCount[i]; ++j)
+            {
+                testBwd[v][m_edgeTraceIndex[m_sendDisp[i] + j]] =
+                    buff.m_recvBuff[offset + j];
+            }
+        }
+    }
+}
+
+ExchangeMethod::SplitBuffers &Pairwise::GetSplitBuffers(const int nVar)
+{
+    auto it = m_splitBuffers.find(nVar);
+    if (it == m_splitBuffers.end())
+    {
+        size_t nNeighbours = m_vecPairPartitionTrace.size();
+        int size           = nVar * m_sendBuff.size();
+
+        SplitBuffers &buff = m_splitBuffers[nVar];
+        buff.m_sendBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_recvBuff    = Array<OneD, NekDouble>(size, 0.0);
+        buff.m_sendRequest = m_comm->CreateRequest(nNeighbours);
+        buff.m_recvRequest = m_comm->CreateRequest(nNeighbours);
+
+        // Construct persistent requests sending all variables at once
+        for (size_t i = 0; i < nNeighbours; ++i)
+        {
+            size_t len = nVar * m_vecPairPartitionTrace[i].second.size();
+
+            m_comm->RecvInit(m_vecPairPartitionTrace[i].first,
+                             buff.m_recvBuff[nVar * m_sendDisp[i]], len,
+                             buff.m_recvRequest, i);
+            m_comm->SendInit(m_vecPairPartitionTrace[i].first,
+                             buff.m_sendBuff[nVar * m_sendDisp[i]], len,
+                             buff.m_sendRequest, i);
+        }
+        return buff;
+    }
+
+    return it->second;
+}
+
+void Pairwise::BeginExchange(
+    const Array<OneD, const Array<OneD, NekDouble>> &testFwd)
+{
+    m_splitNumVar      = testFwd.size();
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+
+    // Perform receive posts
+    m_comm->StartAll(buff.m_recvRequest);
+
+    // Fill send buffer from Fwd trace
+    for (size_t i = 0; i < m_vecPairPartitionTrace.size(); ++i)
+    {
+        size_t len = m_vecPairPartitionTrace[i].second.size();
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            size_t offset = m_splitNumVar * m_sendDisp[i] + v * len;
+            for (size_t j = 0; j < len; ++j)
+            {
+                buff.m_sendBuff[offset + j] =
+                    testFwd[v][m_vecPairPartitionTrace[i].second[j]];
+            }
+        }
+    }
+
+    // Perform send posts
+    m_comm->StartAll(buff.m_sendRequest);
+}
+
+void Pairwise::FinishExchange(Array<OneD, Array<OneD, NekDouble>> &testBwd)
+{
+    ASSERTL1(testBwd.size() == m_splitNumVar,
+             "Number of variables differs from the exchange in progress.");
+
+    SplitBuffers &buff = GetSplitBuffers(m_splitNumVar);
+
+    // Wait for all send/recvs to complete
+    m_comm->WaitAll(buff.m_sendRequest);
+    m_comm->WaitAll(buff.m_recvRequest);
+
+    // Fill Bwd trace from recv buffer
+    for (size_t i = 0; i < m_vecPairPartitionTrace.size(); ++i)
+    {
+        size_t len = m_vecPairPartitionTrace[i].second.size();
+        for (size_t v = 0; v < m_splitNumVar; ++v)
+        {
+            size_t offset = m_splitNumVar * m_sendDisp[i] + v * len;
+            for (size_t j = 0; j < len; ++j)
+            {
+                testBwd[v][m_vecPairPartitionTrace[i].second[j]] =
+                    buff.m_recvBuff[offset + j];
+            }
+        }
+    }
+}
+
 AssemblyCommDG::AssemblyCommDG(
     const ExpList &locExp, const ExpListSharedPtr &trace,
     const Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr>>
@@ -401,6 +697,8 @@ AssemblyCommDG::AssemblyCommDG(
             Timing(comm, warmup, numPoints, MPIFuncs[i]);
             std::tie(avg[i], min, max) =
                 Timing(comm, iter, numPoints, MPIFuncs[i]);
+            m_exchangeTimings.emplace_back(
+                MPIFuncsNames[i], std::make_tuple(avg[i], min, max));
             if (verbose && comm->GetRank() == 0)
             {
                 std::cout << "  " << MPIFuncsNames[i]
@@ -726,7 +1024,7 @@ void AssemblyCommDG::InitialiseStructure(
  *
  * @return tuple of loop times {avg, min, max}
  */
-std::tuple<NekDouble, NekDouble, NekDouble> AssemblyCommDG::Timing(
+ExchangeTiming AssemblyCommDG::Timing(
     const LibUtilities::CommSharedPtr &comm, const int &count, const int &num,
     const ExchangeMethodSharedPtr& f)
 {
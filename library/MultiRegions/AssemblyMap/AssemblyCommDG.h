@@ -70,10 +70,58 @@ public:
     MULTI_REGIONS_EXPORT virtual void PerformExchange(
         const Array<OneD, NekDouble> &testFwd,
         Array<OneD, NekDouble> &testBwd) = 0;
+
+    /**
+     * Start a nonblocking exchange of the Fwd traces of several variables.
+     * The partition edge values are copied to internal buffers, so @p testFwd
+     * may be modified once this returns. The exchange must be completed with
+     * FinishExchange() before another split exchange is started on this
+     * object.
+     *
+     * @param[in] testFwd The values of each variable to send to adjacent
+     *                    partitions
+     */
+    MULTI_REGIONS_EXPORT virtual void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd) = 0;
+
+    /**
+     * Complete the exchange started by BeginExchange() and place the received
+     * values in the Bwd trace of each variable.
+     *
+     * @param[out] testBwd The values received from adjacent partitions
+     */
+    MULTI_REGIONS_EXPORT virtual void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd) = 0;
+
+protected:
+    /// Buffers and requests of a split exchange of a number of variables
+    struct SplitBuffers
+    {
+        /// Send buffer
+        Array<OneD, NekDouble> m_sendBuff;
+        /// Receive buffer
+        Array<OneD, NekDouble> m_recvBuff;
+        /// Send and receive counts
+        Array<OneD, int> m_count;
+        /// Send and receive displacements
+        Array<OneD, int> m_disp;
+        /// Send requests, or the request of the collective operation
+        LibUtilities::CommRequestSharedPtr m_sendRequest;
+        /// Receive requests
+        LibUtilities::CommRequestSharedPtr m_recvRequest;
+    };
+
+    /// Split exchange buffers for each number of variables exchanged
+    std::map<int, SplitBuffers> m_splitBuffers;
+    /// Number of variables of the split exchange in progress
+    int m_splitNumVar = 0;
 };
 
 typedef std::shared_ptr<ExchangeMethod> ExchangeMethodSharedPtr;
 
+/// Average, minimum and maximum time of an exchange method across ranks
+typedef std::tuple<NekDouble, NekDouble, NekDouble> ExchangeTiming;
+
 /**
  * If parallel operation is not indicated then use the Serial subclass which
  * does not perform any exchange.
@@ -90,6 +138,18 @@ public:
     {
         boost::ignore_unused(testFwd, testBwd);
     }
+
+    MULTI_REGIONS_EXPORT inline void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd) final
+    {
+        boost::ignore_unused(testFwd);
+    }
+
+    MULTI_REGIONS_EXPORT inline void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd) final
+    {
+        boost::ignore_unused(testBwd);
+    }
 };
 
 /**
@@ -113,6 +173,12 @@ public:
         const Array<OneD, NekDouble> &testFwd,
         Array<OneD, NekDouble> &testBwd) final;
 
+    MULTI_REGIONS_EXPORT void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd) final;
+
+    MULTI_REGIONS_EXPORT void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd) final;
+
 private:
     /// Communicator
     LibUtilities::CommSharedPtr m_comm;
@@ -124,6 +190,9 @@ private:
     std::vector<int> m_allEdgeIndex;
     /// Largest shared partition edge
     int m_maxCount = 0;
+
+    /// Returns the split exchange buffers for @p nVar variables
+    SplitBuffers &GetSplitBuffers(const int nVar);
 };
 
 /**
@@ -146,6 +215,12 @@ public:
         const Array<OneD, NekDouble> &testFwd,
         Array<OneD, NekDouble> &testBwd) final;
 
+    MULTI_REGIONS_EXPORT void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd) final;
+
+    MULTI_REGIONS_EXPORT void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd) final;
+
 private:
     /// Communicator
     LibUtilities::CommSharedPtr m_comm;
@@ -155,6 +230,9 @@ private:
     Array<OneD, int> m_allVSendCount;
     /// List of displacements for MPI_alltoallv
     Array<OneD, int> m_allVSendDisp;
+
+    /// Returns the split exchange buffers for @p nVar variables
+    SplitBuffers &GetSplitBuffers(const int nVar);
 };
 
 /**
@@ -179,6 +257,12 @@ public:
         const Array<OneD, NekDouble> &testFwd,
         Array<OneD, NekDouble> &testBwd) final;
 
+    MULTI_REGIONS_EXPORT void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd) final;
+
+    MULTI_REGIONS_EXPORT void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd) final;
+
 private:
     /// Communicator
     LibUtilities::CommSharedPtr m_comm;
@@ -188,6 +272,9 @@ private:
     std::vector<int> m_edgeTraceIndex;
     /// List of counts
     Array<OneD, int> m_sendCount;
+
+    /// Returns the split exchange buffers for @p nVar variables
+    SplitBuffers &GetSplitBuffers(const int nVar);
 };
 
 /**
@@ -211,6 +298,12 @@ public:
         const Array<OneD, NekDouble> &testFwd,
         Array<OneD, NekDouble> &testBwd) final;
 
+    MULTI_REGIONS_EXPORT void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd) final;
+
+    MULTI_REGIONS_EXPORT void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd) final;
+
 private:
     /// Communicator
     LibUtilities::CommSharedPtr m_comm;
@@ -226,6 +319,9 @@ private:
     LibUtilities::CommRequestSharedPtr m_recvRequest;
     /// List of send requests
     LibUtilities::CommRequestSharedPtr m_sendRequest;
+
+    /// Returns the split exchange buffers for @p nVar variables
+    SplitBuffers &GetSplitBuffers(const int nVar);
 };
 
 /**
@@ -241,7 +337,8 @@ private:
  * to determine the fastest method for the particular system configuration, if
  * running in serial configuration it assigns the #Serial exchange method. It
  * then acts as a pass through to the chosen exchange method for the
- * #PerformExchange function.
+ * #PerformExchange function and its split-phase counterparts #BeginExchange
+ * and #FinishExchange.
  */
 class AssemblyCommDG
 {
@@ -273,6 +370,43 @@ public:
         m_exchange->PerformExchange(testFwd, testBwd);
     }
 
+    /**
+     * @brief Start the trace exchange of several variables between
+     * processors, which is completed by #FinishExchange. This allows local
+     * work which does not depend on the backwards space to be overlapped with
+     * the communication.
+     *
+     * @param testFwd  Local forwards space of the trace of each variable
+     */
+    MULTI_REGIONS_EXPORT inline void BeginExchange(
+        const Array<OneD, const Array<OneD, NekDouble>> &testFwd)
+    {
+        m_exchange->BeginExchange(testFwd);
+    }
+
+    /**
+     * @brief Complete the trace exchange started by #BeginExchange.
+     *
+     * @param testBwd  Local backwards space of the trace of each variable
+     *                 (which will receive contributions)
+     */
+    MULTI_REGIONS_EXPORT inline void FinishExchange(
+        Array<OneD, Array<OneD, NekDouble>> &testBwd)
+    {
+        m_exchange->FinishExchange(testBwd);
+    }
+
+    /**
+     * @brief Return the timings of the exchange methods measured during
+     * construction, in the order in which they were tried. This is empty in
+     * serial.
+     */
+    MULTI_REGIONS_EXPORT inline const std::vector<
+        std::pair<std::string, ExchangeTiming>> &GetExchangeTimings() const
+    {
+        return m_exchangeTimings;
+    }
+
 private:
     /// Chosen exchange method (either fastest parallel or serial)
     ExchangeMethodSharedPtr m_exchange;
@@ -284,6 +418,8 @@ private:
     std::map<int, std::vector<int>> m_rankSharedEdges;
     /// Map of edge ID to quad point trace indices
     std::map<int, std::vector<int>> m_edgeToTrace;
+    /// Timings of each exchange method tried during construction
+    std::vector<std::pair<std::string, ExchangeTiming>> m_exchangeTimings;
 
     /// Initalises the structure for the MPI communication
     void InitialiseStructure(
@@ -296,7 +432,7 @@ private:
         const PeriodicMap &perMap, const LibUtilities::CommSharedPtr &comm);
 
     /// Timing of the MPI exchange method.
-    static std::tuple<NekDouble, NekDouble, NekDouble> Timing(
+    static ExchangeTiming Timing(
         const LibUtilities::CommSharedPtr &comm, const int &count,
         const int &num, const ExchangeMethodSharedPtr& f);
 };
@@ -33,6 +33,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <boost/core/ignore_unused.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 
 #include <MultiRegions/AssemblyMap/AssemblyMap.h>
 
@@ -87,9 +88,15 @@ namespace Nektar
             m_numGlobalDirBndCoeffs(0),
             m_solnType(eNoSolnType),
             m_bndSystemBandWidth(0),
+            m_linSysIterSolver(eConjugateGradient),
+            m_linSysMixedPrecision(false),
+            m_linSysSparseDirect(false),
             m_successiveRHS(0),
+            m_initialGuessExtrapolation(0),
             m_gsh(0),
-            m_bndGsh(0)
+            m_bndGsh(0),
+            m_bndGshSplit(0),
+            m_bndGshSplitInit(false)
         {
         }
 
@@ -104,15 +111,23 @@ namespace Nektar
             m_numLocalDirBndCoeffs(0),
             m_numGlobalDirBndCoeffs(0),
             m_bndSystemBandWidth(0),
+            m_linSysMixedPrecision(false),
+            m_linSysSparseDirect(false),
             m_successiveRHS(0),
+            m_initialGuessExtrapolation(0),
             m_gsh(0),
-            m_bndGsh(0)
+            m_bndGsh(0),
+            m_bndGshSplit(0),
+            m_bndGshSplitInit(false)
         {
             // Default value from Solver Info
             m_solnType = pSession->GetSolverInfoAsEnum<GlobalSysSolnType>(
                                                             "GlobalSysSoln");
             m_preconType = pSession->GetSolverInfoAsEnum<PreconditionerType>(
                                                             "Preconditioner");
+            m_linSysIterSolver =
+                pSession->GetSolverInfoAsEnum<IterativeMethodType>(
+                                                        "LinSysIterSolver");
 
             // Override values with data from GlobalSysSolnInfo section
             if(pSession->DefinesGlobalSysSolnInfo(variable, "GlobalSysSoln"))
@@ -130,6 +145,37 @@ namespace Nektar
                 m_preconType = pSession->GetValueAsEnum<PreconditionerType>(
                                                     "Preconditioner", precon);
             }
+
+            if(pSession->DefinesGlobalSysSolnInfo(variable, "LinSysIterSolver"))
+            {
+                std::string iterSolver = pSession->GetGlobalSysSolnInfo(
+                                                variable, "LinSysIterSolver");
+                m_linSysIterSolver =
+                    pSession->GetValueAsEnum<IterativeMethodType>(
+                                            "LinSysIterSolver", iterSolver);
+            }
+
+            pSession->MatchSolverInfo("LinSysMixedPrecision", "True",
+                                      m_linSysMixedPrecision, false);
+            if(pSession->DefinesGlobalSysSolnInfo(variable,
+                                                  "LinSysMixedPrecision"))
+            {
+                m_linSysMixedPrecision = boost::iequals(
+                    pSession->GetGlobalSysSolnInfo(variable,
+                                                   "LinSysMixedPrecision"),
+                    "True");
+            }
+
+            pSession->MatchSolverInfo("LinSysSparseDirect", "True",
+                                      m_linSysSparseDirect, false);
+            if(pSession->DefinesGlobalSysSolnInfo(variable,
+                                                  "LinSysSparseDirect"))
+            {
+                m_linSysSparseDirect = boost::iequals(
+                    pSession->GetGlobalSysSolnInfo(variable,
+                                                   "LinSysSparseDirect"),
+                    "True");
+            }
             
             if(pSession->DefinesGlobalSysSolnInfo(variable,
                                                   "IterativeSolverTolerance"))
@@ -173,6 +219,19 @@ namespace Nektar
                                         m_successiveRHS,0);
             }
 
+            if(pSession->DefinesGlobalSysSolnInfo(variable,
+                                                  "InitialGuessExtrapolation"))
+            {
+                m_initialGuessExtrapolation = boost::lexical_cast<int>(
+                        pSession->GetGlobalSysSolnInfo(variable,
+                                "InitialGuessExtrapolation").c_str());
+            }
+            else
+            {
+                pSession->LoadParameter("InitialGuessExtrapolation",
+                                        m_initialGuessExtrapolation, 0);
+            }
+
         }
 
         /**
@@ -187,12 +246,19 @@ namespace Nektar
             m_hash(0),
             m_solnType(oldLevelMap->m_solnType),
             m_preconType(oldLevelMap->m_preconType),
+            m_linSysIterSolver(oldLevelMap->m_linSysIterSolver),
+            m_linSysMixedPrecision(oldLevelMap->m_linSysMixedPrecision),
+            m_linSysSparseDirect(oldLevelMap->m_linSysSparseDirect),
             m_maxIterations(oldLevelMap->m_maxIterations),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
+            m_initialGuessExtrapolation(
+                oldLevelMap->m_initialGuessExtrapolation),
             m_gsh(oldLevelMap->m_gsh),
             m_bndGsh(oldLevelMap->m_bndGsh),
-            m_lowestStaticCondLevel(oldLevelMap->m_lowestStaticCondLevel)
+            m_bndGshSplit(0),
+            m_lowestStaticCondLevel(oldLevelMap->m_lowestStaticCondLevel),
+            m_bndGshSplitInit(false)
         {
             int i;
             int j;
@@ -1303,6 +1369,34 @@ namespace Nektar
             UniversalAssembleBnd(global);
         }
 
+        /**
+         * Assemble several local boundary vectors, exchanging the values of
+         * all of them in a single gather-scatter operation.
+         */
+        void AssemblyMap::AssembleBnd(
+                    const Array<OneD, const Array<OneD, NekDouble> >& loc,
+                          Array<OneD,       Array<OneD, NekDouble> >& global) const
+        {
+            for (int i = 0; i < loc.size(); ++i)
+            {
+                ASSERTL1(loc[i].size() >= m_numLocalBndCoeffs,"Local vector is not of correct dimension");
+                ASSERTL1(global[i].size() >= m_numGlobalBndCoeffs,"Global vector is not of correct dimension");
+
+                Vmath::Zero(m_numGlobalBndCoeffs, global[i].get(), 1);
+
+                if(m_signChange)
+                {
+                    Vmath::Assmb(m_numLocalBndCoeffs,m_localToGlobalBndSign.get(),
+                                 loc[i].get(), m_localToGlobalBndMap.get(), global[i].get());
+                }
+                else
+                {
+                    Vmath::Assmb(m_numLocalBndCoeffs,loc[i].get(), m_localToGlobalBndMap.get(), global[i].get());
+                }
+            }
+            UniversalAssembleBnd(global);
+        }
+
         void AssemblyMap::UniversalAssembleBnd(
                       Array<OneD,     NekDouble>& pGlobal) const
         {
@@ -1327,6 +1421,84 @@ namespace Nektar
             if (offset > 0)  Vmath::Vcopy(offset, tmp, 1, pGlobal, 1);
         }
 
+        void AssemblyMap::UniversalAssembleBnd(
+                      Array<OneD, Array<OneD, NekDouble> >& pGlobal) const
+        {
+            Gs::Gather(pGlobal, Gs::gs_add, m_bndGsh);
+        }
+
+        /**
+         * Starts the exchange of the coefficients returned by
+         * GetSharedBndCoeffs. Until UniversalAssembleBndEnd is called, the
+         * remaining coefficients of @a pGlobal may still be updated, which
+         * allows local work to overlap with the communication. Without a
+         * split-phase exchange the whole assembly is carried out by
+         * UniversalAssembleBndEnd.
+         */
+        void AssemblyMap::UniversalAssembleBndBegin(
+                      Array<OneD,     NekDouble>& pGlobal) const
+        {
+            ASSERTL1(pGlobal.size() >= m_numGlobalBndCoeffs,
+                     "Wrong size.");
+            Gs::GatherBegin(pGlobal, Gs::gs_add, GetBndGshSplit());
+        }
+
+        void AssemblyMap::UniversalAssembleBndEnd(
+                      Array<OneD,     NekDouble>& pGlobal) const
+        {
+            ASSERTL1(pGlobal.size() >= m_numGlobalBndCoeffs,
+                     "Wrong size.");
+            if (GetBndGshSplit())
+            {
+                Gs::GatherEnd(pGlobal, Gs::gs_add, m_bndGshSplit);
+            }
+            else
+            {
+                Gs::Gather(pGlobal, Gs::gs_add, m_bndGsh);
+            }
+        }
+
+        Array<OneD, int> AssemblyMap::GetSharedBndCoeffs() const
+        {
+            if (GetBndGshSplit())
+            {
+                return m_bndGshSplit->shared;
+            }
+
+            // Without a split-phase exchange all coefficients are treated as
+            // shared in parallel.
+            return Array<OneD, int>(m_numGlobalBndCoeffs, m_bndGsh ? 1 : 0);
+        }
+
+        /**
+         * Returns the split-phase exchange of the boundary coefficients,
+         * setting it up from the universal boundary IDs on the first call.
+         * The set-up communicates with all processes sharing #m_bndGsh, so
+         * the first call must be made collectively; it is only made by
+         * solvers which overlap the exchange. Returns 0 in serial and for
+         * maps without #m_bndGshComm, which use the blocking exchange.
+         */
+        Gs::gs_split *AssemblyMap::GetBndGshSplit() const
+        {
+            if (!m_bndGshSplitInit)
+            {
+                m_bndGshSplitInit = true;
+
+                if (m_bndGshComm)
+                {
+                    Array<OneD, long> tmp(m_globalToUniversalBndMap.size());
+                    for (int i = 0; i < tmp.size(); ++i)
+                    {
+                        tmp[i] = m_globalToUniversalBndMap[i];
+                    }
+                    m_bndGshSplit = Gs::InitSplit(tmp, m_bndGshComm,
+                                                  m_bndGsh);
+                }
+            }
+
+            return m_bndGshSplit;
+        }
+
         void AssemblyMap::UniversalAbsMaxBnd(Array<OneD, NekDouble> &bndvals)
         {
             Gs::Gather(bndvals, Gs::gs_amax, m_dirBndGsh);
@@ -1389,6 +1561,21 @@ namespace Nektar
             return m_preconType;
         }
 
+        IterativeMethodType AssemblyMap::GetLinSysIterSolver() const
+        {
+            return m_linSysIterSolver;
+        }
+
+        bool AssemblyMap::GetLinSysMixedPrecision() const
+        {
+            return m_linSysMixedPrecision;
+        }
+
+        bool AssemblyMap::GetLinSysSparseDirect() const
+        {
+            return m_linSysSparseDirect;
+        }
+
         NekDouble AssemblyMap::GetIterativeTolerance() const
         {
             return m_iterativeTolerance;
@@ -1404,6 +1591,11 @@ namespace Nektar
             return m_successiveRHS;
         }
 
+        int AssemblyMap::GetInitialGuessExtrapolation() const
+        {
+            return m_initialGuessExtrapolation;
+        }
+
         void AssemblyMap::GlobalToLocalBndWithoutSign(
                     const Array<OneD, const NekDouble>& global,
                     Array<OneD,NekDouble>& loc)
@@ -240,6 +240,10 @@ namespace Nektar
             MULTI_REGIONS_EXPORT void AssembleBnd(const Array<OneD, const NekDouble>& loc,
                     Array<OneD, NekDouble>& global) const;
 
+            MULTI_REGIONS_EXPORT void AssembleBnd(
+                    const Array<OneD, const Array<OneD, NekDouble> >& loc,
+                          Array<OneD,       Array<OneD, NekDouble> >& global) const;
+
             MULTI_REGIONS_EXPORT void UniversalAssembleBnd(
                           Array<OneD,     NekDouble>& pGlobal) const;
 
@@ -250,6 +254,23 @@ namespace Nektar
                           Array<OneD,     NekDouble>& pGlobal,
                           int                         offset) const;
 
+            MULTI_REGIONS_EXPORT void UniversalAssembleBnd(
+                          Array<OneD, Array<OneD, NekDouble> >& pGlobal) const;
+
+            /// Start the universal assembly of the shared global boundary
+            /// coefficients, see UniversalAssembleBndEnd.
+            MULTI_REGIONS_EXPORT void UniversalAssembleBndBegin(
+                          Array<OneD,     NekDouble>& pGlobal) const;
+
+            /// Complete the universal assembly started by
+            /// UniversalAssembleBndBegin.
+            MULTI_REGIONS_EXPORT void UniversalAssembleBndEnd(
+                          Array<OneD,     NekDouble>& pGlobal) const;
+
+            /// Returns 1 for the global boundary coefficients which may be
+            /// modified by the universal assembly, and 0 otherwise.
+            MULTI_REGIONS_EXPORT Array<OneD, int> GetSharedBndCoeffs() const;
+
             MULTI_REGIONS_EXPORT int GetFullSystemBandWidth() const;
 
             MULTI_REGIONS_EXPORT int GetNumNonDirVertexModes() const;
@@ -303,9 +324,13 @@ namespace Nektar
             /// Returns the method of solving global systems.
             MULTI_REGIONS_EXPORT GlobalSysSolnType GetGlobalSysSolnType() const;
             MULTI_REGIONS_EXPORT PreconditionerType GetPreconType() const;
+            MULTI_REGIONS_EXPORT IterativeMethodType GetLinSysIterSolver() const;
+            MULTI_REGIONS_EXPORT bool GetLinSysMixedPrecision() const;
+            MULTI_REGIONS_EXPORT bool GetLinSysSparseDirect() const;
             MULTI_REGIONS_EXPORT NekDouble GetIterativeTolerance() const;
             MULTI_REGIONS_EXPORT int GetMaxIterations() const;
             MULTI_REGIONS_EXPORT int GetSuccessiveRHS() const;
+            MULTI_REGIONS_EXPORT int GetInitialGuessExtrapolation() const;
 
             MULTI_REGIONS_EXPORT int GetLowestStaticCondLevel() const
             {
@@ -398,6 +423,17 @@ namespace Nektar
             /// Type type of preconditioner to use in iterative solver.
             PreconditionerType m_preconType;
 
+            /// Krylov method to use in iterative solver.
+            IterativeMethodType m_linSysIterSolver;
+
+            /// Whether to store the iterative solver matrices in single
+            /// precision and solve with iterative refinement.
+            bool m_linSysMixedPrecision;
+
+            /// Whether to factorise direct solver matrices with a sparse
+            /// Cholesky factorisation.
+            bool m_linSysSparseDirect;
+
             /// Maximum iterations for iterative solver
             int m_maxIterations;
 
@@ -407,8 +443,18 @@ namespace Nektar
             /// sucessive RHS  for iterative solver
             int  m_successiveRHS;
 
+            /// Number of previous solutions extrapolated to form the initial
+            /// guess of the iterative solver
+            int  m_initialGuessExtrapolation;
+
             Gs::gs_data * m_gsh;
             Gs::gs_data * m_bndGsh;
+            /// Split-phase exchange of the shared boundary coefficients,
+            /// set up on first use by GetBndGshSplit.
+            mutable Gs::gs_split * m_bndGshSplit;
+            /// Communicator of #m_bndGsh. Left unset when the boundary
+            /// assembly does not support a split-phase exchange.
+            LibUtilities::CommSharedPtr m_bndGshComm;
             /// gs gather communication to impose Dirhichlet BCs. 
             Gs::gs_data * m_dirBndGsh; 
             
@@ -439,6 +485,10 @@ namespace Nektar
         private:
             /// Mapping information for previous level in MultiLevel Solver
             PatchMapSharedPtr m_patchMapFromPrevLevel;
+            /// Whether #m_bndGshSplit has been set up.
+            mutable bool m_bndGshSplitInit;
+
+            Gs::gs_split *GetBndGshSplit() const;
 
             virtual int v_GetLocalToGlobalMap(const int i) const;
 
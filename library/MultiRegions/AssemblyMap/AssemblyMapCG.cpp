@@ -2146,6 +2146,7 @@ namespace Nektar
         {
             Gs::Finalise(m_gsh);
             Gs::Finalise(m_bndGsh);
+            Gs::FinaliseSplit(m_bndGshSplit);
         }
 
         /**
@@ -2460,6 +2461,7 @@ namespace Nektar
 
             m_gsh = Gs::Init(tmp, vCommRow, verbose);
             m_bndGsh = Gs::Init(tmp2, vCommRow, verbose);
+            m_bndGshComm = vCommRow;
             Gs::Unique(tmp, vCommRow);
             for (unsigned int i = 0; i < m_numGlobalCoeffs; ++i)
             {
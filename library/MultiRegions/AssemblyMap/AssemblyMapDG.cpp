@@ -58,6 +58,7 @@ namespace Nektar
 
         AssemblyMapDG::~AssemblyMapDG()
         {
+            Gs::FinaliseSplit(m_bndGshSplit);
         }
 
         AssemblyMapDG::AssemblyMapDG(
@@ -730,6 +731,7 @@ namespace Nektar
                 tmp[i] = m_globalToUniversalBndMap[i];
             }
             m_bndGsh = m_gsh = Gs::Init(tmp, m_comm);
+            m_bndGshComm = m_comm;
             Gs::Unique(tmp, m_comm);
             for (i = 0; i < m_globalToUniversalBndMap.size(); ++i)
             {
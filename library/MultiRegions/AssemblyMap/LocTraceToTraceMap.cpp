@@ -922,6 +922,32 @@ void LocTraceToTraceMap::LocTracesFromField(
                  faces);
 }
 
+/**
+ * @brief Gather the local traces of several fields in physical space using
+ * #m_fieldToLocTraceMap, traversing the map once for all fields.
+ *
+ * @param field  Solution fields in physical space
+ * @param faces  Resulting local traces of each field.
+ */
+void LocTraceToTraceMap::LocTracesFromField(
+    const Array<OneD, const Array<OneD, NekDouble> > &field,
+    Array<OneD, Array<OneD, NekDouble> > &faces)
+{
+    ASSERTL1(faces.size() >= field.size(), "not enough output fields");
+
+    const int nvar = field.size();
+    const int npts = m_fieldToLocTraceMap.size();
+
+    for (int i = 0; i < npts; ++i)
+    {
+        const int id = m_fieldToLocTraceMap[i];
+        for (int v = 0; v < nvar; ++v)
+        {
+            faces[v][i] = field[v][id];
+        }
+    }
+}
+
 /**
  * @brief Reverse process of LocTracesFromField()
  * Add the local traces in physical space to field using
@@ -984,68 +1010,12 @@ void LocTraceToTraceMap::InterpLocEdgesToTrace(
         // Check if there are edges to interpolate
         if (m_interpNfaces[dir][i])
         {
-            // Get to/from points
-            LibUtilities::PointsKey fromPointsKey0 =
-                std::get<0>(m_interpPoints[dir][i]);
-            LibUtilities::PointsKey toPointsKey0 =
-                std::get<2>(m_interpPoints[dir][i]);
-
-            int fnp    = fromPointsKey0.GetNumPoints();
-            int tnp    = toPointsKey0.GetNumPoints();
+            int fnp    = std::get<0>(m_interpPoints[dir][i]).GetNumPoints();
+            int tnp    = std::get<2>(m_interpPoints[dir][i]).GetNumPoints();
             int nedges = m_interpNfaces[dir][i];
 
-            // Do interpolation here if required
-            switch (m_interpTrace[dir][i])
-            {
-                case eNoInterp: // Just copy
-                {
-                    Vmath::Vcopy(nedges * fnp,
-                                 locedges.get() + cnt,
-                                 1,
-                                 tmp.get() + cnt1,
-                                 1);
-                }
-                break;
-                case eInterpDir0:
-                {
-                    DNekMatSharedPtr I0 = m_interpTraceI0[dir][i];
-                    Blas::Dgemm('N',
-                                'N',
-                                tnp,
-                                nedges,
-                                fnp,
-                                1.0,
-                                I0->GetPtr().get(),
-                                tnp,
-                                locedges.get() + cnt,
-                                fnp,
-                                0.0,
-                                tmp.get() + cnt1,
-                                tnp);
-                }
-                break;
-                case eInterpEndPtDir0:
-                {
-                    Array<OneD, NekDouble> I0 = m_interpEndPtI0[dir][i];
-
-                    for (int k = 0; k < nedges; ++k)
-                    {
-                        Vmath::Vcopy(fnp,
-                                     &locedges[cnt + k * fnp],
-                                     1,
-                                     &tmp[cnt1 + k * tnp],
-                                     1);
-
-                        tmp[cnt1 + k * tnp + tnp - 1] = Blas::Ddot(
-                            fnp, locedges.get() + cnt + k * fnp, 1, &I0[0], 1);
-                    }
-                }
-                break;
-                default:
-                    ASSERTL0(false,
-                             "Invalid interpolation type for 2D elements");
-                    break;
-            }
+            InterpLocEdgesGroup(dir, i, nedges, locedges.get() + cnt,
+                                tmp.get() + cnt1);
 
             cnt += nedges * fnp;
             cnt1 += nedges * tnp;
@@ -1058,6 +1028,150 @@ void LocTraceToTraceMap::InterpLocEdgesToTrace(
                  edges.get());
 }
 
+/**
+ * @brief Interpolate the local trace edges of several fields to the global
+ * trace edge point distributions.
+ *
+ * This is equivalent to calling InterpLocEdgesToTrace for each field, but each
+ * group of edges sharing an interpolation type is interpolated for all fields
+ * with a single call, and the index map to the global trace is traversed once.
+ *
+ * @param dir       Selects forwards (0) or backwards (1) direction.
+ * @param locedges  Local trace edge storage of each field.
+ * @param edges     Global trace edge storage of each field.
+ */
+void LocTraceToTraceMap::InterpLocEdgesToTrace(
+    const int dir,
+    const Array<OneD, const Array<OneD, NekDouble> > &locedges,
+    Array<OneD, Array<OneD, NekDouble> > &edges)
+{
+    ASSERTL1(dir < 2,
+             "option dir out of range, "
+             " dir=0 is fwd, dir=1 is bwd");
+    ASSERTL1(edges.size() >= locedges.size(),
+             "not enough output fields");
+
+    const int nvar = locedges.size();
+    const Array<OneD, const int> &traceMap = m_LocTraceToTraceMap[dir];
+
+    int cnt  = 0;
+    int cnt1 = 0;
+
+    for (int i = 0; i < m_interpTrace[dir].size(); ++i)
+    {
+        int nedges = m_interpNfaces[dir][i];
+        if (nedges == 0)
+        {
+            continue;
+        }
+
+        int fnp  = std::get<0>(m_interpPoints[dir][i]).GetNumPoints();
+        int tnp  = std::get<2>(m_interpPoints[dir][i]).GetNumPoints();
+        int nin  = nedges * fnp;
+        int nout = nedges * tnp;
+
+        if (m_interpTrace[dir][i] == eNoInterp)
+        {
+            for (int j = 0; j < nin; ++j)
+            {
+                const int id = traceMap[cnt1 + j];
+                for (int v = 0; v < nvar; ++v)
+                {
+                    edges[v][id] = locedges[v][cnt + j];
+                }
+            }
+        }
+        else
+        {
+            // Stack the fields so that they are interpolated as one group.
+            Array<OneD, NekDouble> in(nvar * nin), out(nvar * nout);
+            for (int v = 0; v < nvar; ++v)
+            {
+                Vmath::Vcopy(nin, &locedges[v][cnt], 1, &in[v * nin], 1);
+            }
+
+            InterpLocEdgesGroup(dir, i, nvar * nedges, in.get(), out.get());
+
+            for (int j = 0; j < nout; ++j)
+            {
+                const int id = traceMap[cnt1 + j];
+                for (int v = 0; v < nvar; ++v)
+                {
+                    edges[v][id] = out[v * nout + j];
+                }
+            }
+        }
+
+        cnt += nin;
+        cnt1 += nout;
+    }
+}
+
+/**
+ * @brief Interpolate @p nedges contiguous local trace edges of interpolation
+ * group @p i to the global trace point distribution.
+ *
+ * @param dir     Selects forwards (0) or backwards (1) direction.
+ * @param i       Index of the interpolation group.
+ * @param nedges  Number of edges stored in @p in.
+ * @param in      Local trace edge values.
+ * @param out     Interpolated edge values.
+ */
+void LocTraceToTraceMap::InterpLocEdgesGroup(
+    const int        dir,
+    const int        i,
+    const int        nedges,
+    const NekDouble *in,
+    NekDouble       *out)
+{
+    int fnp = std::get<0>(m_interpPoints[dir][i]).GetNumPoints();
+    int tnp = std::get<2>(m_interpPoints[dir][i]).GetNumPoints();
+
+    switch (m_interpTrace[dir][i])
+    {
+        case eNoInterp: // Just copy
+        {
+            Vmath::Vcopy(nedges * fnp, in, 1, out, 1);
+        }
+        break;
+        case eInterpDir0:
+        {
+            DNekMatSharedPtr I0 = m_interpTraceI0[dir][i];
+            Blas::Dgemm('N',
+                        'N',
+                        tnp,
+                        nedges,
+                        fnp,
+                        1.0,
+                        I0->GetPtr().get(),
+                        tnp,
+                        in,
+                        fnp,
+                        0.0,
+                        out,
+                        tnp);
+        }
+        break;
+        case eInterpEndPtDir0:
+        {
+            Array<OneD, NekDouble> I0 = m_interpEndPtI0[dir][i];
+
+            for (int k = 0; k < nedges; ++k)
+            {
+                Vmath::Vcopy(fnp, in + k * fnp, 1, out + k * tnp, 1);
+
+                out[k * tnp + tnp - 1] =
+                    Blas::Ddot(fnp, in + k * fnp, 1, &I0[0], 1);
+            }
+        }
+        break;
+        default:
+            ASSERTL0(false,
+                     "Invalid interpolation type for 2D elements");
+            break;
+    }
+}
+
 /**
  * @brief Right inner product with localedgetoTrace Interpolation Matrix.
  *
@@ -1187,208 +1301,293 @@ void LocTraceToTraceMap::InterpLocFacesToTrace(
         // Check if there are faces to interpolate
         if (m_interpNfaces[dir][i])
         {
-            // Get to/from points
-            LibUtilities::PointsKey fromPointsKey0 =
-                std::get<0>(m_interpPoints[dir][i]);
-            LibUtilities::PointsKey fromPointsKey1 =
-                std::get<1>(m_interpPoints[dir][i]);
-            LibUtilities::PointsKey toPointsKey0 =
-                std::get<2>(m_interpPoints[dir][i]);
-            LibUtilities::PointsKey toPointsKey1 =
-                std::get<3>(m_interpPoints[dir][i]);
+            int fnp0   = std::get<0>(m_interpPoints[dir][i]).GetNumPoints();
+            int fnp1   = std::get<1>(m_interpPoints[dir][i]).GetNumPoints();
+            int tnp0   = std::get<2>(m_interpPoints[dir][i]).GetNumPoints();
+            int tnp1   = std::get<3>(m_interpPoints[dir][i]).GetNumPoints();
+            int nfaces = m_interpNfaces[dir][i];
 
-            int fnp0         = fromPointsKey0.GetNumPoints();
-            int fnp1         = fromPointsKey1.GetNumPoints();
-            int tnp0         = toPointsKey0.GetNumPoints();
-            int tnp1         = toPointsKey1.GetNumPoints();
-            int nfromfacepts = m_interpNfaces[dir][i] * fnp0 * fnp1;
-            ;
+            InterpLocFacesGroup(dir, i, nfaces, locfaces.get() + cnt,
+                                tmp.get() + cnt1);
 
-            // Do interpolation here if required
-            switch (m_interpTrace[dir][i])
+            cnt += nfaces * fnp0 * fnp1;
+            cnt1 += nfaces * tnp0 * tnp1;
+        }
+    }
+
+    Vmath::Scatr(m_LocTraceToTraceMap[dir].size(),
+                 tmp.get(),
+                 m_LocTraceToTraceMap[dir].get(),
+                 faces.get());
+}
+
+/**
+ * @brief Interpolate the local trace faces of several fields to the global
+ * trace face point distributions.
+ *
+ * This is equivalent to calling InterpLocFacesToTrace for each field, but each
+ * group of faces sharing an interpolation type is interpolated for all fields
+ * with a single call, and the index map to the global trace is traversed once.
+ *
+ * @param dir       Selects forwards (0) or backwards (1) direction.
+ * @param locfaces  Local trace face storage of each field.
+ * @param faces     Global trace face storage of each field.
+ */
+void LocTraceToTraceMap::InterpLocFacesToTrace(
+    const int dir,
+    const Array<OneD, const Array<OneD, NekDouble> > &locfaces,
+    Array<OneD, Array<OneD, NekDouble> > &faces)
+{
+    ASSERTL1(dir < 2,
+             "option dir out of range, "
+             " dir=0 is fwd, dir=1 is bwd");
+    ASSERTL1(faces.size() >= locfaces.size(),
+             "not enough output fields");
+
+    const int nvar = locfaces.size();
+    const Array<OneD, const int> &traceMap = m_LocTraceToTraceMap[dir];
+
+    int cnt  = 0;
+    int cnt1 = 0;
+
+    for (int i = 0; i < m_interpTrace[dir].size(); ++i)
+    {
+        int nfaces = m_interpNfaces[dir][i];
+        if (nfaces == 0)
+        {
+            continue;
+        }
+
+        int fnp0 = std::get<0>(m_interpPoints[dir][i]).GetNumPoints();
+        int fnp1 = std::get<1>(m_interpPoints[dir][i]).GetNumPoints();
+        int tnp0 = std::get<2>(m_interpPoints[dir][i]).GetNumPoints();
+        int tnp1 = std::get<3>(m_interpPoints[dir][i]).GetNumPoints();
+        int nin  = nfaces * fnp0 * fnp1;
+        int nout = nfaces * tnp0 * tnp1;
+
+        if (m_interpTrace[dir][i] == eNoInterp)
+        {
+            for (int j = 0; j < nin; ++j)
             {
-                case eNoInterp: // Just copy
-                {
-                    Vmath::Vcopy(nfromfacepts,
-                                 locfaces.get() + cnt,
-                                 1,
-                                 tmp.get() + cnt1,
-                                 1);
-                }
-                break;
-                case eInterpDir0:
+                const int id = traceMap[cnt1 + j];
+                for (int v = 0; v < nvar; ++v)
                 {
-                    DNekMatSharedPtr I0 = m_interpTraceI0[dir][i];
-                    Blas::Dgemm('N',
-                                'N',
-                                tnp0,
-                                tnp1,
-                                fnp0,
-                                1.0,
-                                I0->GetPtr().get(),
-                                tnp0,
-                                locfaces.get() + cnt,
-                                fnp0,
-                                0.0,
-                                tmp.get() + cnt1,
-                                tnp0);
-                }
-                break;
-                case eInterpEndPtDir0:
-                {
-                    int nfaces = m_interpNfaces[dir][i];
-                    for (int k = 0; k < fnp0; ++k)
-                    {
-                        Vmath::Vcopy(nfaces * fnp1,
-                                     locfaces.get() + cnt + k,
-                                     fnp0,
-                                     tmp.get() + cnt1 + k,
-                                     tnp0);
-                    }
-                    Array<OneD, NekDouble> I0 = m_interpEndPtI0[dir][i];
-                    Blas::Dgemv('T',
-                                fnp0,
-                                tnp1 * m_interpNfaces[dir][i],
-                                1.0,
-                                tmp.get() + cnt1,
-                                tnp0,
-                                I0.get(),
-                                1,
-                                0.0,
-                                tmp.get() + cnt1 + tnp0 - 1,
-                                tnp0);
+                    faces[v][id] = locfaces[v][cnt + j];
                 }
-                break;
-                case eInterpDir1:
+            }
+        }
+        else
+        {
+            // Stack the fields so that they are interpolated as one group.
+            Array<OneD, NekDouble> in(nvar * nin), out(nvar * nout);
+            for (int v = 0; v < nvar; ++v)
+            {
+                Vmath::Vcopy(nin, &locfaces[v][cnt], 1, &in[v * nin], 1);
+            }
+
+            InterpLocFacesGroup(dir, i, nvar * nfaces, in.get(), out.get());
+
+            for (int j = 0; j < nout; ++j)
+            {
+                const int id = traceMap[cnt1 + j];
+                for (int v = 0; v < nvar; ++v)
                 {
-                    DNekMatSharedPtr I1 = m_interpTraceI1[dir][i];
-                    for (int j = 0; j < m_interpNfaces[dir][i]; ++j)
-                    {
-                        Blas::Dgemm('N',
-                                    'T',
-                                    tnp0,
-                                    tnp1,
-                                    fnp1,
-                                    1.0,
-                                    locfaces.get() + cnt + j * fnp0 * fnp1,
-                                    tnp0,
-                                    I1->GetPtr().get(),
-                                    tnp1,
-                                    0.0,
-                                    tmp.get() + cnt1 + j * tnp0 * tnp1,
-                                    tnp0);
-                    }
+                    faces[v][id] = out[v * nout + j];
                 }
-                break;
-                case eInterpEndPtDir1:
-                {
-                    Array<OneD, NekDouble> I1 = m_interpEndPtI1[dir][i];
-                    for (int j = 0; j < m_interpNfaces[dir][i]; ++j)
-                    {
-                        // copy all points
-                        Vmath::Vcopy(fnp0 * fnp1,
-                                     locfaces.get() + cnt + j * fnp0 * fnp1,
-                                     1,
-                                     tmp.get() + cnt1 + j * tnp0 * tnp1,
-                                     1);
+            }
+        }
 
-                        // interpolate end points
-                        for (int k = 0; k < tnp0; ++k)
-                        {
-                            tmp[cnt1 + k + (j + 1) * tnp0 * tnp1 - tnp0] =
-                                Blas::Ddot(fnp1,
-                                           locfaces.get() + cnt +
-                                               j * fnp0 * fnp1 + k,
-                                           fnp0,
-                                           &I1[0],
-                                           1);
-                        }
-                    }
-                }
-                break;
-                case eInterpBothDirs:
-                {
-                    DNekMatSharedPtr I0 = m_interpTraceI0[dir][i];
-                    DNekMatSharedPtr I1 = m_interpTraceI1[dir][i];
-                    Array<OneD, NekDouble> wsp(m_interpNfaces[dir][i] * fnp0 *
-                                               tnp1 * fnp0);
+        cnt += nin;
+        cnt1 += nout;
+    }
+}
 
-                    for (int j = 0; j < m_interpNfaces[dir][i]; ++j)
-                    {
-                        Blas::Dgemm('N',
-                                    'T',
-                                    fnp0,
-                                    tnp1,
-                                    fnp1,
-                                    1.0,
-                                    locfaces.get() + cnt + j * fnp0 * fnp1,
-                                    fnp0,
-                                    I1->GetPtr().get(),
-                                    tnp1,
-                                    0.0,
-                                    wsp.get() + j * fnp0 * tnp1,
-                                    fnp0);
-                    }
-                    Blas::Dgemm('N',
-                                'N',
-                                tnp0,
-                                tnp1 * m_interpNfaces[dir][i],
-                                fnp0,
-                                1.0,
-                                I0->GetPtr().get(),
-                                tnp0,
-                                wsp.get(),
-                                fnp0,
-                                0.0,
-                                tmp.get() + cnt1,
-                                tnp0);
-                }
-                break;
-                case eInterpEndPtDir0InterpDir1:
+/**
+ * @brief Interpolate @p nfaces contiguous local trace faces of interpolation
+ * group @p i to the global trace point distribution.
+ *
+ * @param dir     Selects forwards (0) or backwards (1) direction.
+ * @param i       Index of the interpolation group.
+ * @param nfaces  Number of faces stored in @p in.
+ * @param in      Local trace face values.
+ * @param out     Interpolated face values.
+ */
+void LocTraceToTraceMap::InterpLocFacesGroup(
+    const int        dir,
+    const int        i,
+    const int        nfaces,
+    const NekDouble *in,
+    NekDouble       *out)
+{
+    int fnp0 = std::get<0>(m_interpPoints[dir][i]).GetNumPoints();
+    int fnp1 = std::get<1>(m_interpPoints[dir][i]).GetNumPoints();
+    int tnp0 = std::get<2>(m_interpPoints[dir][i]).GetNumPoints();
+    int tnp1 = std::get<3>(m_interpPoints[dir][i]).GetNumPoints();
+
+    switch (m_interpTrace[dir][i])
+    {
+        case eNoInterp: // Just copy
+        {
+            Vmath::Vcopy(nfaces * fnp0 * fnp1, in, 1, out, 1);
+        }
+        break;
+        case eInterpDir0:
+        {
+            DNekMatSharedPtr I0 = m_interpTraceI0[dir][i];
+            Blas::Dgemm('N',
+                        'N',
+                        tnp0,
+                        tnp1 * nfaces,
+                        fnp0,
+                        1.0,
+                        I0->GetPtr().get(),
+                        tnp0,
+                        in,
+                        fnp0,
+                        0.0,
+                        out,
+                        tnp0);
+        }
+        break;
+        case eInterpEndPtDir0:
+        {
+            for (int k = 0; k < fnp0; ++k)
+            {
+                Vmath::Vcopy(nfaces * fnp1, in + k, fnp0, out + k, tnp0);
+            }
+            Array<OneD, NekDouble> I0 = m_interpEndPtI0[dir][i];
+            Blas::Dgemv('T',
+                        fnp0,
+                        tnp1 * nfaces,
+                        1.0,
+                        out,
+                        tnp0,
+                        I0.get(),
+                        1,
+                        0.0,
+                        out + tnp0 - 1,
+                        tnp0);
+        }
+        break;
+        case eInterpDir1:
+        {
+            DNekMatSharedPtr I1 = m_interpTraceI1[dir][i];
+            for (int j = 0; j < nfaces; ++j)
+            {
+                Blas::Dgemm('N',
+                            'T',
+                            tnp0,
+                            tnp1,
+                            fnp1,
+                            1.0,
+                            in + j * fnp0 * fnp1,
+                            tnp0,
+                            I1->GetPtr().get(),
+                            tnp1,
+                            0.0,
+                            out + j * tnp0 * tnp1,
+                            tnp0);
+            }
+        }
+        break;
+        case eInterpEndPtDir1:
+        {
+            Array<OneD, NekDouble> I1 = m_interpEndPtI1[dir][i];
+            for (int j = 0; j < nfaces; ++j)
+            {
+                // copy all points
+                Vmath::Vcopy(fnp0 * fnp1,
+                             in + j * fnp0 * fnp1,
+                             1,
+                             out + j * tnp0 * tnp1,
+                             1);
+
+                // interpolate end points
+                for (int k = 0; k < tnp0; ++k)
                 {
-                    DNekMatSharedPtr I1 = m_interpTraceI1[dir][i];
+                    out[k + (j + 1) * tnp0 * tnp1 - tnp0] =
+                        Blas::Ddot(fnp1,
+                                   in + j * fnp0 * fnp1 + k,
+                                   fnp0,
+                                   &I1[0],
+                                   1);
+                }
+            }
+        }
+        break;
+        case eInterpBothDirs:
+        {
+            DNekMatSharedPtr I0 = m_interpTraceI0[dir][i];
+            DNekMatSharedPtr I1 = m_interpTraceI1[dir][i];
+            Array<OneD, NekDouble> wsp(nfaces * fnp0 * tnp1);
 
-                    for (int j = 0; j < m_interpNfaces[dir][i]; ++j)
-                    {
-                        Blas::Dgemm('N',
-                                    'T',
-                                    fnp0,
-                                    tnp1,
-                                    fnp1,
-                                    1.0,
-                                    locfaces.get() + cnt + j * fnp0 * fnp1,
-                                    fnp0,
-                                    I1->GetPtr().get(),
-                                    tnp1,
-                                    0.0,
-                                    tmp.get() + cnt1 + j * tnp0 * tnp1,
-                                    tnp0);
-                    }
+            for (int j = 0; j < nfaces; ++j)
+            {
+                Blas::Dgemm('N',
+                            'T',
+                            fnp0,
+                            tnp1,
+                            fnp1,
+                            1.0,
+                            in + j * fnp0 * fnp1,
+                            fnp0,
+                            I1->GetPtr().get(),
+                            tnp1,
+                            0.0,
+                            wsp.get() + j * fnp0 * tnp1,
+                            fnp0);
+            }
+            Blas::Dgemm('N',
+                        'N',
+                        tnp0,
+                        tnp1 * nfaces,
+                        fnp0,
+                        1.0,
+                        I0->GetPtr().get(),
+                        tnp0,
+                        wsp.get(),
+                        fnp0,
+                        0.0,
+                        out,
+                        tnp0);
+        }
+        break;
+        case eInterpEndPtDir0InterpDir1:
+        {
+            DNekMatSharedPtr I1 = m_interpTraceI1[dir][i];
 
-                    Array<OneD, NekDouble> I0 = m_interpEndPtI0[dir][i];
-                    Blas::Dgemv('T',
-                                fnp0,
-                                tnp1 * m_interpNfaces[dir][i],
-                                1.0,
-                                tmp.get() + cnt1,
-                                tnp0,
-                                I0.get(),
-                                1,
-                                0.0,
-                                tmp.get() + cnt1 + tnp0 - 1,
-                                tnp0);
-                }
-                break;
+            for (int j = 0; j < nfaces; ++j)
+            {
+                Blas::Dgemm('N',
+                            'T',
+                            fnp0,
+                            tnp1,
+                            fnp1,
+                            1.0,
+                            in + j * fnp0 * fnp1,
+                            fnp0,
+                            I1->GetPtr().get(),
+                            tnp1,
+                            0.0,
+                            out + j * tnp0 * tnp1,
+                            tnp0);
             }
-            cnt += nfromfacepts;
-            cnt1 += m_interpNfaces[dir][i] * tnp0 * tnp1;
+
+            Array<OneD, NekDouble> I0 = m_interpEndPtI0[dir][i];
+            Blas::Dgemv('T',
+                        fnp0,
+                        tnp1 * nfaces,
+                        1.0,
+                        out,
+                        tnp0,
+                        I0.get(),
+                        1,
+                        0.0,
+                        out + tnp0 - 1,
+                        tnp0);
         }
+        break;
     }
-
-    Vmath::Scatr(m_LocTraceToTraceMap[dir].size(),
-                 tmp.get(),
-                 m_LocTraceToTraceMap[dir].get(),
-                 faces.get());
 }
 
 /**
@@ -1649,5 +1848,34 @@ void LocTraceToTraceMap::AddTraceCoeffsToFieldCoeffs(
     }
 }
 
+/**
+ * @brief Add contributions from the trace coefficients of several fields to
+ * their elemental coefficient storage, traversing the maps once for all
+ * fields.
+ *
+ * @param trace  Array of global trace coefficients of each field.
+ * @param field  Array containing coefficient storage of each field.
+ */
+void LocTraceToTraceMap::AddTraceCoeffsToFieldCoeffs(
+    const Array<OneD, const Array<OneD, NekDouble> > &trace,
+    Array<OneD, Array<OneD, NekDouble> > &field)
+{
+    ASSERTL1(field.size() >= trace.size(), "not enough output fields");
+
+    const int nvar  = trace.size();
+    const int nvals = m_nTraceCoeffs[0] + m_nTraceCoeffs[1];
+
+    for (int i = 0; i < nvals; ++i)
+    {
+        const int       id   = m_traceCoeffsToElmtMap[0][i];
+        const int       tid  = m_traceCoeffsToElmtTrace[0][i];
+        const NekDouble sign = m_traceCoeffsToElmtSign[0][i];
+        for (int v = 0; v < nvar; ++v)
+        {
+            field[v][id] += sign * trace[v][tid];
+        }
+    }
+}
+
 }
 }
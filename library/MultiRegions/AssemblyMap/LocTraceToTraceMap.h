@@ -182,6 +182,10 @@ public:
         const Array<OneD, const NekDouble> &field,
         Array<OneD, NekDouble> faces);
 
+    MULTI_REGIONS_EXPORT void LocTracesFromField(
+        const Array<OneD, const Array<OneD, NekDouble> > &field,
+        Array<OneD, Array<OneD, NekDouble> > &faces);
+
     MULTI_REGIONS_EXPORT void FwdLocTracesFromField(
         const Array<OneD, const NekDouble> &field,
         Array<OneD, NekDouble> faces);
@@ -194,6 +198,11 @@ public:
         const Array<OneD, const NekDouble> &locfaces,
         Array<OneD, NekDouble> edges);
 
+    MULTI_REGIONS_EXPORT void InterpLocEdgesToTrace(
+        const int dir,
+        const Array<OneD, const Array<OneD, NekDouble> > &locedges,
+        Array<OneD, Array<OneD, NekDouble> > &edges);
+
     /// Right inner product with(IPTW) localedgetoTrace Interpolation Matrix.
     MULTI_REGIONS_EXPORT void RightIPTWLocEdgesToTraceInterpMat(
         const int                           dir,
@@ -204,6 +213,11 @@ public:
         const Array<OneD, const NekDouble> &locfaces,
         Array<OneD, NekDouble> faces);
 
+    MULTI_REGIONS_EXPORT void InterpLocFacesToTrace(
+        const int dir,
+        const Array<OneD, const Array<OneD, NekDouble> > &locfaces,
+        Array<OneD, Array<OneD, NekDouble> > &faces);
+
     /// Right inner product with(IPTW) FacesToTrace Interpolation Matrix.
     MULTI_REGIONS_EXPORT void RightIPTWLocFacesToTraceInterpMat(
         const int                           dir,
@@ -219,6 +233,10 @@ public:
         const Array<OneD, const NekDouble> &race,
         Array<OneD, NekDouble> &field);
 
+    MULTI_REGIONS_EXPORT void AddTraceCoeffsToFieldCoeffs(
+        const Array<OneD, const Array<OneD, NekDouble> > &trace,
+        Array<OneD, Array<OneD, NekDouble> > &field);
+
     /**
      * @brief Return the number of `forward' local trace points.
      */
@@ -357,6 +375,19 @@ private:
         m_tracePhysToLeftRightExpPhysMap;
     bool m_flagTracePhysToLeftRightExpPhysMap;
 
+    void InterpLocEdgesGroup(
+        const int        dir,
+        const int        i,
+        const int        nedges,
+        const NekDouble *in,
+        NekDouble       *out);
+
+    void InterpLocFacesGroup(
+        const int        dir,
+        const int        i,
+        const int        nfaces,
+        const NekDouble *in,
+        NekDouble       *out);
 };
 
 typedef std::shared_ptr<LocTraceToTraceMap> LocTraceToTraceMapSharedPtr;
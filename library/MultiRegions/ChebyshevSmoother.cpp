@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File ChebyshevSmoother.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Chebyshev polynomial smoother definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <MultiRegions/ChebyshevSmoother.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        ChebyshevSmoother::ChebyshevSmoother()
+            : m_n(0)
+        {
+        }
+
+        /**
+         * Allocate the work space for vectors of length @p n.
+         */
+        void ChebyshevSmoother::Initialise(int n)
+        {
+            m_n = n;
+            m_r = Array<OneD, NekDouble>(n);
+            m_d = Array<OneD, NekDouble>(n);
+            m_w = Array<OneD, NekDouble>(n);
+        }
+
+        /**
+         * Apply @p degree steps of Chebyshev iteration for the operator
+         * @p op, preconditioned by @p jacobi, to the system with right hand
+         * side @p pInput. The polynomial is constructed on the interval
+         * [@p lambdaMin, @p lambdaMax], which should bound the spectrum of
+         * the preconditioned operator from above. If @p zeroGuess is false,
+         * @p pOutput holds the initial guess on entry.
+         */
+        void ChebyshevSmoother::Smooth(
+            int                            degree,
+            NekDouble                      lambdaMin,
+            NekDouble                      lambdaMax,
+            const OperatorType            &op,
+            const OperatorType            &jacobi,
+            const Array<OneD, NekDouble>  &pInput,
+                  Array<OneD, NekDouble>  &pOutput,
+            bool                           zeroGuess)
+        {
+            NekDouble theta = 0.5 * (lambdaMax + lambdaMin);
+            NekDouble delta = 0.5 * (lambdaMax - lambdaMin);
+            NekDouble sigma = theta / delta;
+            NekDouble rho   = 1.0 / sigma;
+
+            // r = f - A x
+            if (zeroGuess)
+            {
+                Vmath::Vcopy(m_n, pInput, 1, m_r, 1);
+                Vmath::Zero(m_n, pOutput, 1);
+            }
+            else
+            {
+                op(pOutput, m_r);
+                Vmath::Vsub(m_n, pInput, 1, m_r, 1, m_r, 1);
+            }
+
+            // d = D^{-1} r / theta
+            jacobi(m_r, m_d);
+            Vmath::Smul(m_n, 1.0 / theta, m_d, 1, m_d, 1);
+
+            for (int k = 0; k < degree; ++k)
+            {
+                Vmath::Vadd(m_n, pOutput, 1, m_d, 1, pOutput, 1);
+
+                if (k == degree - 1)
+                {
+                    break;
+                }
+
+                op(m_d, m_w);
+                Vmath::Vsub(m_n, m_r, 1, m_w, 1, m_r, 1);
+
+                NekDouble rhoNew = 1.0 / (2.0 * sigma - rho);
+                jacobi(m_r, m_w);
+                Vmath::Smul(m_n, rhoNew * rho, m_d, 1, m_d, 1);
+                Vmath::Svtvp(m_n, 2.0 * rhoNew / delta, m_w, 1, m_d, 1,
+                             m_d, 1);
+                rho = rhoNew;
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File ChebyshevSmoother.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Chebyshev polynomial smoother header
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NEKTAR_LIB_MULTIREGIONS_CHEBYSHEVSMOOTHER_H
+#define NEKTAR_LIB_MULTIREGIONS_CHEBYSHEVSMOOTHER_H
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+
+#include <functional>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Applies a fixed number of Chebyshev iterations for a Jacobi
+         * preconditioned operator, as used by the polynomial preconditioners
+         * and smoothers. The work space is owned by the smoother, so that
+         * repeated applications do not allocate.
+         */
+        class ChebyshevSmoother
+        {
+        public:
+            /// Applies an operator to the first argument.
+            typedef std::function<void (
+                const Array<OneD, NekDouble> &,
+                      Array<OneD, NekDouble> &)> OperatorType;
+
+            MULTI_REGIONS_EXPORT ChebyshevSmoother();
+
+            MULTI_REGIONS_EXPORT void Initialise(int n);
+
+            MULTI_REGIONS_EXPORT void Smooth(
+                int                            degree,
+                NekDouble                      lambdaMin,
+                NekDouble                      lambdaMax,
+                const OperatorType            &op,
+                const OperatorType            &jacobi,
+                const Array<OneD, NekDouble>  &pInput,
+                      Array<OneD, NekDouble>  &pOutput,
+                bool                           zeroGuess);
+
+        private:
+            /// Size of the vectors
+            int                               m_n;
+            /// Residual
+            Array<OneD, NekDouble>            m_r;
+            /// Update direction
+            Array<OneD, NekDouble>            m_d;
+            /// Operator and preconditioner evaluations
+            Array<OneD, NekDouble>            m_w;
+        };
+    }
+}
+
+#endif
@@ -179,6 +179,12 @@ namespace Nektar
                              const Array<OneD, const NekDouble> &dirForcing
                                                         = NullNekDouble1DArray);
 
+            /// Constructs the right-hand side of the Helmholtz problem.
+            MULTI_REGIONS_EXPORT void SetupHelmSolveRhs(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp,
+                    const bool PhysSpaceForcing);
+
             /// Returns the global matrix specified by \a mkey.
             MULTI_REGIONS_EXPORT GlobalMatrixSharedPtr GetGlobalMatrix(const GlobalMatrixKey &mkey);
 
@@ -243,6 +249,17 @@ namespace Nektar
                     const Array<OneD, const NekDouble> &dirForcing,
                     const bool PhysSpaceForcing);
 
+            /// Solves the Helmholtz equation of several fields which share
+            /// this global linear system.
+            MULTI_REGIONS_EXPORT virtual void v_HelmSolveMultiRHS(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const bool PhysSpaceForcing);
+
             /// Calculates the result of the multiplication of a global
             /// matrix of type specified by \a mkey with a vector given by \a
             /// inarray.
@@ -476,6 +476,27 @@ namespace Nektar
                                     const MultiRegions::VarFactorsMap &varfactors,
                                     const Array<OneD, const NekDouble> &dirForcing,
                                     const bool PhysSpaceForcing)
+      {
+          Array<OneD,NekDouble> wsp(m_ncoeffs);
+          SetupHelmSolveRhs(inarray, wsp, PhysSpaceForcing);
+
+          // Solve the system
+          GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                              factors,varcoeff,varfactors);
+          
+          GlobalSolve(key,wsp,outarray,dirForcing);
+      }
+
+      /**
+       * Construct the right-hand side of the Helmholtz problem in local
+       * coefficient space, i.e. the negated inner product of the forcing
+       * function together with the weak Neumann and Robin boundary
+       * conditions of this field.
+       */
+      void ContField3D::SetupHelmSolveRhs(
+                                    const Array<OneD, const NekDouble> &inarray,
+                                    Array<OneD,       NekDouble> &wsp,
+                                    const bool PhysSpaceForcing)
       {
           int i,j;
 
@@ -483,7 +504,6 @@ namespace Nektar
           //  Setup RHS Inner product
           //----------------------------------
           // Inner product of forcing
-          Array<OneD,NekDouble> wsp(m_ncoeffs);
           if(PhysSpaceForcing)
           {
               IProductWRTBase(inarray,wsp);
@@ -529,12 +549,60 @@ namespace Nektar
               }
               bndcnt += m_bndCondExpansions[i]->GetNcoeffs();
           }
+      }
 
-          // Solve the system
-          GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
-                              factors,varcoeff,varfactors);
-          
-          GlobalSolve(key,wsp,outarray,dirForcing);
+      /**
+       * Solve the Helmholtz problems of several fields with one call to
+       * GlobalLinSys::SolveMultiRHS, so that iterative solvers can iterate
+       * on all of them together. This requires every field to be a
+       * ContField3D sharing the local to global map of this expansion;
+       * otherwise the fields are solved one after the other.
+       */
+      void ContField3D::v_HelmSolveMultiRHS(
+                                    const Array<OneD, ExpListSharedPtr> &fields,
+                                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                                    Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                                    const StdRegions::ConstFactorMap &factors,
+                                    const StdRegions::VarCoeffMap &varcoeff,
+                                    const MultiRegions::VarFactorsMap &varfactors,
+                                    const bool PhysSpaceForcing)
+      {
+          int nFields = fields.size();
+          Array<OneD, ContField3DSharedPtr> cfields(nFields);
+
+          for (int i = 0; i < nFields; ++i)
+          {
+              cfields[i] = std::dynamic_pointer_cast<ContField3D>(fields[i]);
+              if (!cfields[i] || cfields[i]->m_locToGloMap != m_locToGloMap)
+              {
+                  ExpList::v_HelmSolveMultiRHS(fields, inarray, outarray,
+                                               factors, varcoeff, varfactors,
+                                               PhysSpaceForcing);
+                  return;
+              }
+          }
+
+          int NumDirBcs = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+          int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+
+          Array<OneD, Array<OneD, NekDouble> > wsp(nFields);
+          for (int i = 0; i < nFields; ++i)
+          {
+              wsp[i] = Array<OneD, NekDouble>(m_ncoeffs);
+              cfields[i]->SetupHelmSolveRhs(inarray[i], wsp[i],
+                                            PhysSpaceForcing);
+
+              // Set the Dirichlet dofs of each field to the right value
+              cfields[i]->v_ImposeDirichletConditions(outarray[i]);
+          }
+
+          if(contNcoeffs - NumDirBcs > 0)
+          {
+              GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                                  factors,varcoeff,varfactors);
+              GetGlobalLinSys(key)->SolveMultiRHS(wsp, outarray,
+                                                  m_locToGloMap);
+          }
       }
 
       void ContField3D::v_GeneralMatrixOp(
@@ -140,6 +140,12 @@ namespace Nektar
                     const Array<OneD, const NekDouble> &dirForcing
                                                      = NullNekDouble1DArray);
 
+            /// Constructs the right-hand side of the Helmholtz problem.
+            void SetupHelmSolveRhs(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp,
+                    const bool PhysSpaceForcing);
+
             /// Impose the Dirichlet Boundary Conditions on outarray 
             virtual void v_ImposeDirichletConditions(Array<OneD,NekDouble>& outarray);
 
@@ -176,6 +182,16 @@ namespace Nektar
                     const MultiRegions::VarFactorsMap &varfactors,
                     const Array<OneD, const NekDouble> &dirForcing,
                     const bool PhysSpaceForcing);
+
+            virtual void v_HelmSolveMultiRHS(
+                    const Array<OneD, ExpListSharedPtr> &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff,
+                    const MultiRegions::VarFactorsMap &varfactors,
+                    const bool PhysSpaceForcing);
+
             virtual void v_GeneralMatrixOp(
                     const GlobalMatrixKey             &gkey,
                     const Array<OneD,const NekDouble> &inarray,
@@ -1640,6 +1640,45 @@ namespace Nektar
             }
         }
 
+        /**
+         * Multi-variable version of #v_GetFwdBwdTracePhysInterior, which
+         * gathers and interpolates the traces of all variables in @a field
+         * in a single pass over the trace maps.
+         */
+        void DisContField2D::v_GetFwdBwdTracePhysInterior(
+            const Array<OneD, const Array<OneD, NekDouble> > &field,
+                  Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD, Array<OneD, NekDouble> > &Bwd)
+        {
+            LibUtilities::BasisSharedPtr basis = (*m_exp)[0]->GetBasis(0);
+            if (basis->GetBasisType() == LibUtilities::eGauss_Lagrange)
+            {
+                ExpList::v_GetFwdBwdTracePhysInterior(field, Fwd, Bwd);
+                return;
+            }
+
+            int nvar  = field.size();
+            int nloc  = m_locTraceToTraceMap->GetNLocTracePts();
+            int nfwd  = m_locTraceToTraceMap->GetNFwdLocTracePts();
+            Array<OneD, Array<OneD, NekDouble> > edgevals(nvar), invals(nvar);
+            for (int i = 0; i < nvar; ++i)
+            {
+                Vmath::Zero(Fwd[i].size(), Fwd[i], 1);
+                Vmath::Zero(Bwd[i].size(), Bwd[i], 1);
+                edgevals[i] = Array<OneD, NekDouble>(nloc);
+                invals[i]   = edgevals[i] + nfwd;
+            }
+
+            m_locTraceToTraceMap->LocTracesFromField(field, edgevals);
+            m_locTraceToTraceMap->InterpLocEdgesToTrace(0, edgevals, Fwd);
+            m_locTraceToTraceMap->InterpLocEdgesToTrace(1, invals, Bwd);
+
+            for (int i = 0; i < nvar; ++i)
+            {
+                DisContField2D::v_PeriodicBwdCopy(Fwd[i], Bwd[i]);
+            }
+        }
+
         void DisContField2D::v_AddTraceIntegral(
             const Array<OneD, const NekDouble> &Fx,
             const Array<OneD, const NekDouble> &Fy,
@@ -1722,6 +1761,33 @@ namespace Nektar
         }
 
 
+        /**
+         * Multi-variable version of #v_AddTraceIntegral, which scatters the
+         * trace contributions of all variables in @a Fn in a single pass
+         * over the trace maps.
+         */
+        void DisContField2D::v_AddTraceIntegral(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                  Array<OneD, Array<OneD, NekDouble> > &outarray)
+        {
+            LibUtilities::BasisSharedPtr basis = (*m_exp)[0]->GetBasis(0);
+            if (basis->GetBasisType() == LibUtilities::eGauss_Lagrange)
+            {
+                ExpList::v_AddTraceIntegral(Fn, outarray);
+                return;
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > Fcoeffs(Fn.size());
+            for (int i = 0; i < Fn.size(); ++i)
+            {
+                Fcoeffs[i] = Array<OneD, NekDouble>(m_trace->GetNcoeffs());
+                m_trace->IProductWRTBase(Fn[i], Fcoeffs[i]);
+            }
+
+            m_locTraceToTraceMap->AddTraceCoeffsToFieldCoeffs(Fcoeffs,
+                                                              outarray);
+        }
+
         /**
          * @brief Add trace contributions into elemental coefficient spaces.
          *
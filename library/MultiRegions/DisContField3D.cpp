@@ -1910,6 +1910,38 @@ using namespace std;
             DisContField3D::v_PeriodicBwdCopy(Fwd, Bwd);
         }
 
+        /**
+         * Multi-variable version of #v_GetFwdBwdTracePhysInterior, which
+         * gathers and interpolates the traces of all variables in @a field
+         * in a single pass over the trace maps.
+         */
+        void DisContField3D::v_GetFwdBwdTracePhysInterior(
+            const Array<OneD, const Array<OneD, NekDouble> > &field,
+                  Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD, Array<OneD, NekDouble> > &Bwd)
+        {
+            int nvar  = field.size();
+            int nloc  = m_locTraceToTraceMap->GetNLocTracePts();
+            int nfwd  = m_locTraceToTraceMap->GetNFwdLocTracePts();
+            Array<OneD, Array<OneD, NekDouble> > facevals(nvar), invals(nvar);
+            for (int i = 0; i < nvar; ++i)
+            {
+                Vmath::Zero(Fwd[i].size(), Fwd[i], 1);
+                Vmath::Zero(Bwd[i].size(), Bwd[i], 1);
+                facevals[i] = Array<OneD, NekDouble>(nloc);
+                invals[i]   = facevals[i] + nfwd;
+            }
+
+            m_locTraceToTraceMap->LocTracesFromField(field, facevals);
+            m_locTraceToTraceMap->InterpLocFacesToTrace(0, facevals, Fwd);
+            m_locTraceToTraceMap->InterpLocFacesToTrace(1, invals, Bwd);
+
+            for (int i = 0; i < nvar; ++i)
+            {
+                DisContField3D::v_PeriodicBwdCopy(Fwd[i], Bwd[i]);
+            }
+        }
+
         void DisContField3D::v_AddTraceQuadPhysToField(
             const Array<OneD, const NekDouble> &Fwd,
             const Array<OneD, const NekDouble> &Bwd,
@@ -2186,6 +2218,26 @@ using namespace std;
             m_locTraceToTraceMap->AddTraceCoeffsToFieldCoeffs(Fcoeffs,
                                                               outarray);
         }
+
+        /**
+         * Multi-variable version of #v_AddTraceIntegral, which scatters the
+         * trace contributions of all variables in @a Fn in a single pass
+         * over the trace maps.
+         */
+        void DisContField3D::v_AddTraceIntegral(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                  Array<OneD, Array<OneD, NekDouble> > &outarray)
+        {
+            Array<OneD, Array<OneD, NekDouble> > Fcoeffs(Fn.size());
+            for (int i = 0; i < Fn.size(); ++i)
+            {
+                Fcoeffs[i] = Array<OneD, NekDouble>(m_trace->GetNcoeffs());
+                m_trace->IProductWRTBase(Fn[i], Fcoeffs[i]);
+            }
+
+            m_locTraceToTraceMap->AddTraceCoeffsToFieldCoeffs(Fcoeffs,
+                                                              outarray);
+        }
         /**
          * @brief Add trace contributions into elemental coefficient spaces.
          *
@@ -175,6 +175,9 @@ namespace Nektar
             virtual void v_AddTraceIntegral(
                 const Array<OneD, const NekDouble> &Fn,
                       Array<OneD,       NekDouble> &outarray);
+            virtual void v_AddTraceIntegral(
+                const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                      Array<OneD, Array<OneD, NekDouble> > &outarray);
             virtual void v_AddFwdBwdTraceIntegral(
                 const Array<OneD, const NekDouble> &Fwd, 
                 const Array<OneD, const NekDouble> &Bwd, 
@@ -277,6 +280,11 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &field,
                       Array<OneD,       NekDouble> &Fwd,
                       Array<OneD,       NekDouble> &Bwd);
+
+            virtual void v_GetFwdBwdTracePhysInterior(
+                const Array<OneD, const Array<OneD, NekDouble> > &field,
+                      Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD, Array<OneD, NekDouble> > &Bwd);
             
             virtual void v_AddTraceQuadPhysToField(
                 const Array<OneD, const NekDouble> &Fwd,
@@ -32,6 +32,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <boost/core/ignore_unused.hpp>
 
 #include <MultiRegions/ExpList.h>
@@ -221,6 +223,7 @@ namespace Nektar
             m_collections(in.m_collections),
             m_coll_coeff_offset(in.m_coll_coeff_offset),
             m_coll_phys_offset(in.m_coll_phys_offset),
+            m_collThreadManager(in.m_collThreadManager),
             m_coeff_offset(in.m_coeff_offset),
             m_phys_offset(in.m_phys_offset),
             m_blockMat(in.m_blockMat),
@@ -428,14 +431,8 @@ namespace Nektar
                                 const Array<OneD, const NekDouble> &inarray,
                                       Array<OneD,       NekDouble> &outarray)
         {
-            Array<OneD,NekDouble>  tmp;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-
-                m_collections[i].ApplyOperator(Collections::eIProductWRTBase,
-                                               inarray + m_coll_phys_offset[i],
-                                               tmp = outarray + m_coll_coeff_offset[i]);
-            }
+            ApplyCollectionOperator(Collections::eIProductWRTBase, -1,
+                                    inarray, true, {outarray}, {false});
         }
 
         /**
@@ -518,7 +515,6 @@ namespace Nektar
         void ExpList::IProductWRTDerivBase(const Array<OneD, const Array<OneD, NekDouble> > &inarray,
                                            Array<OneD, NekDouble> &outarray)
         {
-            Array<OneD, NekDouble> tmp0,tmp1,tmp2;
             // assume coord dimension defines the size of Deriv Base
             int dim = GetCoordim(0);
 
@@ -527,40 +523,125 @@ namespace Nektar
             switch(dim)
             {
             case 1:
-                for (int i = 0; i < m_collections.size(); ++i)
-                {
-                    m_collections[i].ApplyOperator(
-                                                   Collections::eIProductWRTDerivBase,
-                                                   inarray[0] + m_coll_phys_offset[i],
-                                                   tmp0 = outarray + m_coll_coeff_offset[i]);
-                }
+                ApplyCollectionOperator(Collections::eIProductWRTDerivBase, -1,
+                                        inarray[0], true,
+                                        {outarray}, {false});
                 break;
             case 2:
-                for (int i = 0; i < m_collections.size(); ++i)
-                {
-                    m_collections[i].ApplyOperator(
-                                                   Collections::eIProductWRTDerivBase,
-                                                   inarray[0] + m_coll_phys_offset[i],
-                                                   tmp0 = inarray[1] + m_coll_phys_offset[i],
-                                                   tmp1 = outarray + m_coll_coeff_offset[i]);
-                }
+                ApplyCollectionOperator(Collections::eIProductWRTDerivBase, -1,
+                                        inarray[0], true,
+                                        {inarray[1], outarray},
+                                        {true, false});
                 break;
             case 3:
-                for (int i = 0; i < m_collections.size(); ++i)
-                {
-                    m_collections[i].ApplyOperator(
-                                                   Collections::eIProductWRTDerivBase,
-                                                   inarray[0] + m_coll_phys_offset[i],
-                                                   tmp0 = inarray[1] + m_coll_phys_offset[i],
-                                                   tmp1 = inarray[2] + m_coll_phys_offset[i],
-                                                   tmp2 = outarray + m_coll_coeff_offset[i]);
-                }
+                ApplyCollectionOperator(Collections::eIProductWRTDerivBase, -1,
+                                        inarray[0], true,
+                                        {inarray[1], inarray[2], outarray},
+                                        {true, true, false});
                 break;
             default:
                 ASSERTL0(false,"Dimension of inarray not correct");
                 break;
             }
         }
+        /**
+         * Evaluates \f$ (\nabla \phi_n, \mathbf{D} \nabla u) \f$ for every
+         * local expansion mode, where \f$ \mathbf{D} \f$ is the symmetric
+         * tensor given by the StdRegions::eVarCoeffD00 to
+         * StdRegions::eVarCoeffD22 entries of \a varcoeffs, with missing
+         * diagonal entries taken as one and missing off-diagonal entries as
+         * zero. Without a tensor this is the weak Laplacian of \a inarray.
+         *
+         * If every collection provides it, the fused
+         * Collections::ePhysDerivIProductWRTDerivBase operator is used, so
+         * that the gradient is never stored for the whole expansion.
+         * Otherwise the gradient is evaluated by #PhysDeriv and the inner
+         * product by #IProductWRTDerivBase.
+         *
+         * @param   inarray         An array of size \f$Q_{\mathrm{tot}}\f$
+         *                          containing the values of \f$u\f$ at the
+         *                          quadrature points.
+         * @param   outarray        An array of size \f$N_{\mathrm{eof}}\f$
+         *                          used to store the result.
+         * @param   varcoeffs       Entries of the diagonal tensor, each of
+         *                          size \f$Q_{\mathrm{tot}}\f$.
+         */
+        void ExpList::PhysDerivIProductWRTDerivBase(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray,
+                const StdRegions::VarCoeffMap      &varcoeffs)
+        {
+            const Collections::OperatorType opType =
+                Collections::ePhysDerivIProductWRTDerivBase;
+
+            bool fused = m_collections.size() > 0;
+            for (int i = 0; i < m_collections.size(); ++i)
+            {
+                fused = fused && m_collections[i].HasOperator(opType);
+            }
+
+            if (fused)
+            {
+                for (int i = 0; i < m_collections.size(); ++i)
+                {
+                    StdRegions::VarCoeffMap collVarcoeffs;
+                    for (auto &x : varcoeffs)
+                    {
+                        collVarcoeffs[x.first] =
+                            x.second + m_coll_phys_offset[i];
+                    }
+                    m_collections[i].UpdateVarCoeffs(opType, collVarcoeffs);
+                }
+
+                ApplyCollectionOperator(opType, -1, inarray, true,
+                                        {outarray}, {false});
+                return;
+            }
+
+            const StdRegions::VarCoeffType keys[3][3] = {
+                {StdRegions::eVarCoeffD00, StdRegions::eVarCoeffD01,
+                 StdRegions::eVarCoeffD02},
+                {StdRegions::eVarCoeffD01, StdRegions::eVarCoeffD11,
+                 StdRegions::eVarCoeffD12},
+                {StdRegions::eVarCoeffD02, StdRegions::eVarCoeffD12,
+                 StdRegions::eVarCoeffD22}
+            };
+
+            int coordim = GetCoordim(0);
+            Array<OneD, Array<OneD, NekDouble> > grad(3), flux(coordim);
+            for (int i = 0; i < coordim; ++i)
+            {
+                grad[i] = Array<OneD, NekDouble>(m_npoints);
+            }
+            PhysDeriv(inarray, grad[0], grad[1], grad[2]);
+
+            if (varcoeffs.size() == 0)
+            {
+                IProductWRTDerivBase(grad, outarray);
+                return;
+            }
+
+            for (int i = 0; i < coordim; ++i)
+            {
+                flux[i] = Array<OneD, NekDouble>(m_npoints, 0.0);
+                for (int j = 0; j < coordim; ++j)
+                {
+                    auto x = varcoeffs.find(keys[i][j]);
+                    if (x != varcoeffs.end())
+                    {
+                        Vmath::Vvtvp(m_npoints, x->second, 1, grad[j], 1,
+                                     flux[i], 1, flux[i], 1);
+                    }
+                    else if (i == j)
+                    {
+                        Vmath::Vadd(m_npoints, grad[j], 1, flux[i], 1,
+                                    flux[i], 1);
+                    }
+                }
+            }
+            IProductWRTDerivBase(flux, outarray);
+        }
+
         /**
          * Given a function \f$f(\boldsymbol{x})\f$ evaluated at
          * the quadrature points, this function calculates the
@@ -600,22 +681,10 @@ namespace Nektar
                                   Array<OneD, NekDouble> &out_d1,
                                   Array<OneD, NekDouble> &out_d2)
         {
-            Array<OneD, NekDouble> e_out_d0;
-            Array<OneD, NekDouble> e_out_d1;
-            Array<OneD, NekDouble> e_out_d2;
-            int offset;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-                offset   = m_coll_phys_offset[i];
-                e_out_d0 = out_d0  + offset;
-                e_out_d1 = out_d1  + offset;
-                e_out_d2 = out_d2  + offset;
-
-                m_collections[i].ApplyOperator(Collections::ePhysDeriv,
-                                               inarray + offset,
-                                               e_out_d0,e_out_d1, e_out_d2);
-
-            }
+            ApplyCollectionOperator(Collections::ePhysDeriv, -1,
+                                    inarray, true,
+                                    {out_d0, out_d1, out_d2},
+                                    {true, true, true});
         }
 
         void ExpList::v_PhysDeriv(const int dir,
@@ -652,18 +721,8 @@ namespace Nektar
             {
                 // convert enum into int
                 int intdir= (int)edir;
-                Array<OneD, NekDouble> e_out_d;
-                int offset;
-                for (int i = 0; i < m_collections.size(); ++i)
-                {
-                    offset   = m_coll_phys_offset[i];
-                    e_out_d  = out_d  + offset;
-
-                    m_collections[i].ApplyOperator(Collections::ePhysDeriv,
-                                                   intdir,
-                                                   inarray + offset,
-                                                   e_out_d);
-                }
+                ApplyCollectionOperator(Collections::ePhysDeriv, intdir,
+                                        inarray, true, {out_d}, {true});
             }
         }
 
@@ -825,8 +884,9 @@ namespace Nektar
          * employing a discrete elemental Galerkin projection from
          * physical space to coefficient space. For each element,
          * the operation is evaluated locally by the function
-         * StdRegions#StdExpansion#IproductWRTBase followed by a
-         * call to #MultiRegions#MultiplyByElmtInvMass.
+         * StdRegions#StdExpansion#IproductWRTBase followed by the
+         * application of the elemental inverse mass matrix, which is
+         * evaluated through the Collections::eFwdTrans operator.
          *
          * @param   inarray         An array of size \f$Q_{\mathrm{tot}}\f$
          *                          containing the values of the function
@@ -839,11 +899,8 @@ namespace Nektar
         void ExpList::v_FwdTrans_IterPerExp(const Array<OneD, const NekDouble> &inarray,
                                             Array<OneD, NekDouble> &outarray)
         {
-            Array<OneD,NekDouble> f(m_ncoeffs);
-
-            IProductWRTBase_IterPerExp(inarray,f);
-            MultiplyByElmtInvMass(f,outarray);
-
+            ApplyCollectionOperator(Collections::eFwdTrans, -1,
+                                    inarray, true, {outarray}, {false});
         }
 
         void ExpList::v_FwdTrans_BndConstrained(
@@ -1095,6 +1152,406 @@ namespace Nektar
             }
         }
 
+        /**
+         * Helmholtz and Laplacian operators with constant coefficients are
+         * available as collection operators. Variable coefficients and
+         * additional factors such as spectral vanishing viscosity are only
+         * handled by the elemental GeneralMatrixOp routines.
+         *
+         * @param   gkey        Key defining the local operator.
+         * @returns True if #GeneralMatrixOp_Collections can be used.
+         */
+        bool ExpList::CollectionsSupportMatrixOp(const GlobalMatrixKey &gkey)
+        {
+            Collections::OperatorType opType;
+
+            switch (gkey.GetMatrixType())
+            {
+                case StdRegions::eHelmholtz:
+                    opType = Collections::eHelmholtz;
+                    break;
+                case StdRegions::eLaplacian:
+                    opType = Collections::eLaplacian;
+                    break;
+                default:
+                    return false;
+            }
+
+            if (m_collections.size() == 0)
+            {
+                return false;
+            }
+
+            // A variable diffusion tensor in the Laplacian is supported by
+            // the fused PhysDeriv and IProductWRTDerivBase operator.
+            if (gkey.GetNVarCoeffs() > 0)
+            {
+                if (opType != Collections::eLaplacian)
+                {
+                    return false;
+                }
+
+                for (auto &x : gkey.GetVarCoeffs())
+                {
+                    switch (x.first)
+                    {
+                        case StdRegions::eVarCoeffD00:
+                        case StdRegions::eVarCoeffD11:
+                        case StdRegions::eVarCoeffD22:
+                        case StdRegions::eVarCoeffD01:
+                        case StdRegions::eVarCoeffD02:
+                        case StdRegions::eVarCoeffD12:
+                            break;
+                        default:
+                            return false;
+                    }
+                }
+
+                for (int i = 0; i < m_collections.size(); ++i)
+                {
+                    if (!m_collections[i].HasOperator(Collections::eBwdTrans))
+                    {
+                        return false;
+                    }
+                }
+
+                opType = Collections::ePhysDerivIProductWRTDerivBase;
+            }
+
+            for (auto &x : gkey.GetConstFactors())
+            {
+                if (x.first != StdRegions::eFactorLambda)
+                {
+                    return false;
+                }
+            }
+
+            for (int i = 0; i < m_collections.size(); ++i)
+            {
+                if (!m_collections[i].HasOperator(opType))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Evaluates the local Helmholtz or Laplacian operator for all
+         * elements using the collection operators, so that no elemental
+         * matrices are constructed. A Laplacian with a variable diffusion
+         * tensor is evaluated by a backward transform followed by the fused
+         * Collections::ePhysDerivIProductWRTDerivBase operator. The key must
+         * satisfy #CollectionsSupportMatrixOp.
+         *
+         * @param   gkey        Key defining the local operator.
+         * @param   inarray     Local coefficients.
+         * @param   outarray    Result of the local operator.
+         */
+        void ExpList::GeneralMatrixOp_Collections(
+                                const GlobalMatrixKey             &gkey,
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            Collections::OperatorType opType =
+                gkey.GetMatrixType() == StdRegions::eHelmholtz ?
+                Collections::eHelmholtz : Collections::eLaplacian;
+
+            if (gkey.GetNVarCoeffs() > 0)
+            {
+                Array<OneD, NekDouble> phys(m_npoints);
+                ApplyCollectionOperator(Collections::eBwdTrans, -1,
+                                        inarray, false, {phys}, {true});
+                PhysDerivIProductWRTDerivBase(phys, outarray,
+                                              gkey.GetVarCoeffs());
+                return;
+            }
+
+            for (int i = 0; i < m_collections.size(); ++i)
+            {
+                m_collections[i].UpdateFactors(opType,
+                                               gkey.GetConstFactors());
+            }
+
+            ApplyCollectionOperator(opType, -1, inarray, false,
+                                    {outarray}, {false});
+        }
+
+        namespace
+        {
+            /**
+             * Applies the operator \a op of a collection, selecting the
+             * Collection::ApplyOperator overload from the number of
+             * arguments.
+             */
+            void ApplyCollection(
+                      Collections::Collection             &coll,
+                const Collections::OperatorType            op,
+                const int                                  dir,
+                const Array<OneD, const NekDouble>        &in,
+                      std::vector<Array<OneD, NekDouble> > &args)
+            {
+                if (dir >= 0)
+                {
+                    coll.ApplyOperator(op, dir, in, args[0]);
+                    return;
+                }
+
+                switch (args.size())
+                {
+                    case 1:
+                        coll.ApplyOperator(op, in, args[0]);
+                        break;
+                    case 2:
+                        coll.ApplyOperator(op, in, args[0], args[1]);
+                        break;
+                    case 3:
+                        coll.ApplyOperator(op, in, args[0], args[1], args[2]);
+                        break;
+                    default:
+                        ASSERTL0(false, "Unsupported number of arguments.");
+                        break;
+                }
+            }
+
+            /**
+             * @brief Thread job evaluating the operator of one collection.
+             *
+             * The reference counts of #Array are not safe to modify
+             * concurrently, and the operators create offset arrays of their
+             * arguments internally. The job therefore only holds raw
+             * pointers to the ranges of the caller's arrays that belong to
+             * its collection, and evaluates the operator on private copies
+             * of them which are allocated before the job is queued. The
+             * arguments must not alias each other.
+             */
+            class CollectionJob : public Thread::ThreadJob
+            {
+                public:
+                    CollectionJob(
+                              Collections::Collection  &coll,
+                        const Collections::OperatorType op,
+                        const int                       dir,
+                        const NekDouble                *in,
+                        const int                       nIn,
+                        const std::vector<NekDouble *> &args,
+                        const std::vector<int>         &nArgs)
+                        : m_coll(coll), m_op(op), m_dir(dir), m_in(in),
+                          m_args(args), m_inBuf(nIn),
+                          m_argsBuf(args.size())
+                    {
+                        for (int j = 0; j < args.size(); ++j)
+                        {
+                            m_argsBuf[j] = Array<OneD, NekDouble>(nArgs[j]);
+                        }
+                    }
+
+                    virtual void Run()
+                    {
+                        Vmath::Vcopy(m_inBuf.size(), m_in, 1,
+                                     m_inBuf.get(), 1);
+                        for (int j = 0; j < m_args.size(); ++j)
+                        {
+                            Vmath::Vcopy(m_argsBuf[j].size(), m_args[j], 1,
+                                         m_argsBuf[j].get(), 1);
+                        }
+
+                        ApplyCollection(m_coll, m_op, m_dir, m_inBuf,
+                                        m_argsBuf);
+
+                        for (int j = 0; j < m_args.size(); ++j)
+                        {
+                            Vmath::Vcopy(m_argsBuf[j].size(),
+                                         m_argsBuf[j].get(), 1,
+                                         m_args[j], 1);
+                        }
+                    }
+
+                private:
+                    Collections::Collection              &m_coll;
+                    const Collections::OperatorType       m_op;
+                    const int                             m_dir;
+                    const NekDouble                      *m_in;
+                    std::vector<NekDouble *>              m_args;
+                    Array<OneD, NekDouble>                m_inBuf;
+                    std::vector<Array<OneD, NekDouble> >  m_argsBuf;
+            };
+        }
+
+        /**
+         * Applies the operator \a op of every collection to \a inarray and
+         * \a args, which are offset to the start of each collection in
+         * either physical or coefficient space according to \a inPhys and
+         * \a argsPhys. The arguments are passed on to
+         * Collection::ApplyOperator in order, and \a dir is passed as the
+         * direction if it is non-negative.
+         *
+         * If a thread manager has been set up in #CreateCollections, the
+         * collections are queued as separate jobs and this call blocks until
+         * all of them have completed.
+         */
+        void ExpList::ApplyCollectionOperator(
+                const Collections::OperatorType             op,
+                const int                                   dir,
+                const Array<OneD, const NekDouble>         &inarray,
+                const bool                                  inPhys,
+                const std::vector<Array<OneD, NekDouble> > &args,
+                const std::vector<bool>                    &argsPhys)
+        {
+            const int ncoll = m_collections.size();
+            const int nargs = args.size();
+
+            ASSERTL1(argsPhys.size() == nargs,
+                     "Argument space not defined for every argument.");
+
+            CollectionRanges in(ncoll);
+            std::vector<CollectionRanges> out(nargs, CollectionRanges(ncoll));
+
+            for (int i = 0; i < ncoll; ++i)
+            {
+                // The elements of a collection are contiguous and of the
+                // same size, so only the first one needs to be found.
+                int eid = std::lower_bound(m_phys_offset.begin(),
+                                           m_phys_offset.end(),
+                                           m_coll_phys_offset[i]) -
+                          m_phys_offset.begin();
+                int nelmt = m_collections[i].GetNumElmt();
+
+                std::pair<int, int> phys(m_coll_phys_offset[i],
+                                         nelmt*(*m_exp)[eid]->GetTotPoints());
+                std::pair<int, int> coeff(m_coll_coeff_offset[i],
+                                          nelmt*(*m_exp)[eid]->GetNcoeffs());
+
+                in[i] = inPhys ? phys : coeff;
+                for (int j = 0; j < nargs; ++j)
+                {
+                    out[j][i] = argsPhys[j] ? phys : coeff;
+                }
+            }
+
+            ApplyCollectionOperator(op, dir, inarray, in, args, out);
+        }
+
+        /**
+         * Applies the operator \a op of collection \a i to the range
+         * \a in[i] of \a inarray and the ranges \a out[j][i] of the
+         * arguments \a args[j], given as pairs of offset and size. The
+         * collections are either evaluated in turn or as separate jobs on
+         * #m_collThreadManager.
+         */
+        void ExpList::ApplyCollectionOperator(
+                const Collections::OperatorType             op,
+                const int                                   dir,
+                const Array<OneD, const NekDouble>         &inarray,
+                const CollectionRanges                     &in,
+                const std::vector<Array<OneD, NekDouble> > &args,
+                const std::vector<CollectionRanges>        &out)
+        {
+            const int ncoll = m_collections.size();
+            const int nargs = args.size();
+
+            if (!m_collThreadManager || ncoll == 1)
+            {
+                std::vector<Array<OneD, NekDouble> > tmp(nargs);
+                for (int i = 0; i < ncoll; ++i)
+                {
+                    for (int j = 0; j < nargs; ++j)
+                    {
+                        tmp[j] = args[j] + out[j][i].first;
+                    }
+                    ApplyCollection(m_collections[i], op, dir,
+                                    inarray + in[i].first, tmp);
+                }
+                return;
+            }
+
+            std::vector<NekDouble *> ptr(nargs);
+            std::vector<int>         size(nargs);
+            std::vector<Thread::ThreadJob*> jobs(ncoll);
+            for (int i = 0; i < ncoll; ++i)
+            {
+                // Operators are constructed on first use, which must not
+                // happen concurrently.
+                m_collections[i].Initialise(op);
+
+                for (int j = 0; j < nargs; ++j)
+                {
+                    ptr[j]  = args[j].get() + out[j][i].first;
+                    size[j] = out[j][i].second;
+                }
+                jobs[i] = new CollectionJob(m_collections[i], op, dir,
+                                            inarray.get() + in[i].first,
+                                            in[i].second, ptr, size);
+            }
+
+            m_collThreadManager->QueueJobs(jobs);
+            m_collThreadManager->Wait();
+        }
+
+        /**
+         * Applies one of the operators between the quadrature points and
+         * the points scaled by \a scale in each direction,
+         * Collections::ePhysInterp1DScaled or
+         * Collections::ePhysGalerkinProjection1DScaled, to every collection.
+         * The scaled points of the elements are stored consecutively in
+         * element order.
+         */
+        void ExpList::ApplyScaledCollectionOperator(
+                const Collections::OperatorType     op,
+                const NekDouble                     scale,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            const int ncoll = m_collections.size();
+            const int nexp  = m_exp->size();
+
+            // Offsets of the scaled points of each element.
+            std::vector<int> scaledOffset(nexp + 1, 0);
+            for (int i = 0; i < nexp; ++i)
+            {
+                int npts = 1;
+                for (int j = 0; j < (*m_exp)[i]->GetNumBases(); ++j)
+                {
+                    npts *= (int) ((*m_exp)[i]->GetNumPoints(j)*scale);
+                }
+                scaledOffset[i+1] = scaledOffset[i] + npts;
+            }
+
+            const bool project =
+                op == Collections::ePhysGalerkinProjection1DScaled;
+
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorConst] = scale;
+
+            CollectionRanges in(ncoll);
+            std::vector<CollectionRanges> out(1, CollectionRanges(ncoll));
+
+            for (int i = 0; i < ncoll; ++i)
+            {
+                m_collections[i].UpdateFactors(op, factors);
+
+                // The elements of a collection are contiguous, so only the
+                // first one needs to be found.
+                int eid = std::lower_bound(m_phys_offset.begin(),
+                                           m_phys_offset.end(),
+                                           m_coll_phys_offset[i]) -
+                          m_phys_offset.begin();
+                int nelmt = m_collections[i].GetNumElmt();
+
+                std::pair<int, int> phys(m_coll_phys_offset[i],
+                                         nelmt*(*m_exp)[eid]->GetTotPoints());
+                std::pair<int, int> scaled(scaledOffset[eid],
+                                           scaledOffset[eid + nelmt] -
+                                           scaledOffset[eid]);
+
+                in[i]     = project ? scaled : phys;
+                out[0][i] = project ? phys   : scaled;
+            }
+
+            ApplyCollectionOperator(op, -1, inarray, in, {outarray}, out);
+        }
+
         /**
          * Retrieves local matrices from each expansion in the expansion list
          * and combines them together to generate a global matrix system.
@@ -1437,13 +1894,8 @@ namespace Nektar
         void ExpList::v_BwdTrans_IterPerExp(const Array<OneD, const NekDouble> &inarray,
                                             Array<OneD, NekDouble> &outarray)
         {
-            Array<OneD, NekDouble> tmp;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-                m_collections[i].ApplyOperator(Collections::eBwdTrans,
-                                               inarray + m_coll_coeff_offset[i],
-                                               tmp = outarray + m_coll_phys_offset[i]);
-            }
+            ApplyCollectionOperator(Collections::eBwdTrans, -1,
+                                    inarray, false, {outarray}, {true});
         }
 
         LocalRegions::ExpansionSharedPtr& ExpList::GetExp(
@@ -2679,6 +3131,21 @@ namespace Nektar
                      "This method is not defined or valid for this class type");
         }
 
+        /**
+         * Adds the trace integral of each variable in @a Fn to the
+         * corresponding entry of @a outarray. The default implementation
+         * treats one variable at a time.
+         */
+        void ExpList::v_AddTraceIntegral(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                  Array<OneD, Array<OneD, NekDouble> > &outarray)
+        {
+            for (int i = 0; i < Fn.size(); ++i)
+            {
+                v_AddTraceIntegral(Fn[i], outarray[i]);
+            }
+        }
+
         void ExpList::v_AddFwdBwdTraceIntegral(
                                 const Array<OneD, const NekDouble> &Fwd,
                                 const Array<OneD, const NekDouble> &Bwd,
@@ -2749,6 +3216,32 @@ namespace Nektar
                      "This method is not defined or valid for this class type");
         }
 
+        /**
+         * Begins the exchange of the forwards traces @a Fwd of several
+         * variables, which must have been filled with
+         * GetFwdBwdTracePhysSerial, with the adjacent partitions. Together
+         * with FinishTraceExchange this is equivalent to calling
+         * GetFwdBwdTracePhys for each variable, but allows work which does
+         * not depend on the backwards traces to be carried out while the
+         * communication is in progress.
+         */
+        void ExpList::BeginTraceExchange(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd)
+        {
+            GetTraceMap()->GetAssemblyCommDG()->BeginExchange(Fwd);
+        }
+
+        /**
+         * Waits for the exchange started by BeginTraceExchange and places
+         * the values received from the adjacent partitions in the backwards
+         * traces @a Bwd.
+         */
+        void ExpList::FinishTraceExchange(
+            Array<OneD, Array<OneD, NekDouble> > &Bwd)
+        {
+            GetTraceMap()->GetAssemblyCommDG()->FinishExchange(Bwd);
+        }
+
         void ExpList::v_GetFwdBwdTracePhysInterior(
             const Array<OneD, const NekDouble>  &field,
             Array<OneD, NekDouble>              &Fwd,
@@ -2759,6 +3252,22 @@ namespace Nektar
                      "This method is not defined or valid for this class type");
         }
 
+        /**
+         * Extracts the forwards and backwards traces of each variable in
+         * @a field, which must share the trace of this expansion. The
+         * default implementation treats one variable at a time.
+         */
+        void ExpList::v_GetFwdBwdTracePhysInterior(
+            const Array<OneD, const Array<OneD, NekDouble> > &field,
+                  Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD, Array<OneD, NekDouble> > &Bwd)
+        {
+            for (int i = 0; i < field.size(); ++i)
+            {
+                v_GetFwdBwdTracePhysInterior(field[i], Fwd[i], Bwd[i]);
+            }
+        }
+
         void ExpList::v_AddTraceQuadPhysToField(
             const Array<OneD, const NekDouble>  &Fwd,
             const Array<OneD, const NekDouble>  &Bwd,
@@ -2835,6 +3344,28 @@ namespace Nektar
             NEKERROR(ErrorUtil::efatal, "HelmSolve not implemented.");
         }
 
+        /**
+         * Solve the Helmholtz problem of each field in turn. Expansions which
+         * can share the global linear system between the fields override
+         * this method.
+         */
+        void ExpList::v_HelmSolveMultiRHS(
+                const Array<OneD, std::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const bool PhysSpaceForcing)
+        {
+            for (int i = 0; i < fields.size(); ++i)
+            {
+                fields[i]->HelmSolve(inarray[i], outarray[i], factors,
+                                     varcoeff, varfactors,
+                                     NullNekDouble1DArray, PhysSpaceForcing);
+            }
+        }
+
         void ExpList::v_LinearAdvectionDiffusionReactionSolve(
                        const Array<OneD, Array<OneD, NekDouble> > &velocity,
                        const Array<OneD, const NekDouble> &inarray,
@@ -3037,14 +3568,8 @@ namespace Nektar
                                 const Array<OneD, const NekDouble> &inarray,
                                 Array<OneD,       NekDouble> &outarray)
         {
-            Array<OneD,NekDouble>  tmp;
-            for (int i = 0; i < m_collections.size(); ++i)
-            {
-
-                m_collections[i].ApplyOperator(Collections::eIProductWRTBase,
-                                               inarray + m_coll_phys_offset[i],
-                                               tmp = outarray + m_coll_coeff_offset[i]);
-            }
+            ApplyCollectionOperator(Collections::eIProductWRTBase, -1,
+                                    inarray, true, {outarray}, {false});
         }
 
         void ExpList::v_GeneralMatrixOp(
@@ -3448,11 +3973,35 @@ namespace Nektar
             int  collmax    = (colOpt.GetMaxCollectionSize() > 0
                                         ? colOpt.GetMaxCollectionSize()
                                         : 2*m_exp->size());
+            int  nthreads   = colOpt.GetNumThreads();
 
             // clear vectors in case previously called
             m_collections.clear();
             m_coll_coeff_offset.clear();
             m_coll_phys_offset.clear();
+            m_collThreadManager.reset();
+
+            // Set up the thread manager used to evaluate the collections,
+            // which is shared with any other user of the session job.
+            if (nthreads > 1)
+            {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+                m_collThreadManager =
+                    tms.GetInstance(Thread::ThreadMaster::SessionJob);
+
+                if (!m_collThreadManager->IsInitialised())
+                {
+                    tms.SetThreadingType("ThreadManagerBoost");
+                    m_collThreadManager = tms.CreateInstance(
+                        Thread::ThreadMaster::SessionJob, nthreads);
+                }
+#else
+                WARNINGL0(false, "Threaded collections require "
+                          "NEKTAR_USE_THREAD_SAFETY; ignoring NUMTHREADS.");
+                nthreads = 1;
+#endif
+            }
 
             // Loop over expansions, and create collections for each element type
             for (int i = 0; i < m_exp->size(); ++i)
@@ -3461,17 +4010,26 @@ namespace Nektar
                     std::pair<LocalRegions::ExpansionSharedPtr,int> ((*m_exp)[i],i));
             }
 
+            // Group the elements into collections.
+            vector<vector<StdRegions::StdExpansionSharedPtr> > collExps;
+            vector<Collections::OperatorImpMap> impTypes;
+
             for (auto &it : collections)
             {
                 LocalRegions::ExpansionSharedPtr exp = it.second[0].first;
 
-                Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(exp);
+                Collections::OperatorImpMap impType =
+                    colOpt.GetOperatorImpMap(exp);
                 vector<StdRegions::StdExpansionSharedPtr> collExp;
 
                 int prevCoeffOffset     = m_coeff_offset[it.second[0].second];
                 int prevPhysOffset      = m_phys_offset [it.second[0].second];
                 int collcnt;
 
+                // split the elements over at least one collection per thread
+                int shapemax = min(collmax,
+                    (int(it.second.size()) + nthreads - 1) / nthreads);
+
                 m_coll_coeff_offset.push_back(prevCoeffOffset);
                 m_coll_phys_offset .push_back(prevPhysOffset);
 
@@ -3479,16 +4037,8 @@ namespace Nektar
                 {
                     collExp.push_back(it.second[0].first);
 
-                    // if no Imp Type provided and No settign in xml file.
-                    // reset impTypes using timings
-                    if(autotuning)
-                    {
-                        impTypes = colOpt.SetWithTimings(collExp,
-                                                         impTypes, verbose);
-                    }
-
-                    Collections::Collection tmp(collExp, impTypes);
-                    m_collections.push_back(tmp);
+                    collExps.push_back(collExp);
+                    impTypes.push_back(impType);
                 }
                 else
                 {
@@ -3511,22 +4061,10 @@ namespace Nektar
                         if(prevCoeffOffset + nCoeffs != coeffOffset ||
                            prevnCoeff != nCoeffs ||
                            prevPhysOffset + nPhys != physOffset ||
-                           prevnPhys != nPhys || collcnt >= collmax)
+                           prevnPhys != nPhys || collcnt >= shapemax)
                         {
-
-                            // if no Imp Type provided and No
-                            // settign in xml file. reset
-                            // impTypes using timings
-                            if(autotuning)
-                            {
-                                impTypes = colOpt.SetWithTimings(collExp,
-                                                                 impTypes,
-                                                                 verbose);
-                            }
-
-                            Collections::Collection tmp(collExp, impTypes);
-                            m_collections.push_back(tmp);
-
+                            collExps.push_back(collExp);
+                            impTypes.push_back(impType);
 
                             // start new geom list
                             collExp.clear();
@@ -3545,19 +4083,10 @@ namespace Nektar
                         // if end of list finish up collection
                         if (i == it.second.size() - 1)
                         {
-                            // if no Imp Type provided and No
-                            // settign in xml file.
-                            if(autotuning)
-                            {
-                                impTypes = colOpt.SetWithTimings(collExp,
-                                                                 impTypes,verbose);
-                            }
-
-                            Collections::Collection tmp(collExp, impTypes);
-                            m_collections.push_back(tmp);
+                            collExps.push_back(collExp);
+                            impTypes.push_back(impType);
                             collExp.clear();
                             collcnt = 0;
-
                         }
 
                         prevCoeffOffset = coeffOffset;
@@ -3567,6 +4096,21 @@ namespace Nektar
                     }
                 }
             }
+
+            // if no Imp Type provided and No settign in xml file, reset
+            // impTypes using timings. This is collective, so that all
+            // processes select the same implementations.
+            if (autotuning)
+            {
+                impTypes = colOpt.SetWithTimings(m_session->GetComm(),
+                                                 collExps, verbose);
+            }
+
+            for (int i = 0; i < collExps.size(); ++i)
+            {
+                Collections::Collection tmp(collExps[i], impTypes[i]);
+                m_collections.push_back(tmp);
+            }
         }
 
         void ExpList::ClearGlobalLinSysManager(void)
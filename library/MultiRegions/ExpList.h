@@ -40,6 +40,7 @@
 #include <LibUtilities/Communication/Transposition.h>
 #include <LibUtilities/Communication/Comm.h>
 #include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 #include <SpatialDomains/MeshGraph.h>
 #include <LocalRegions/Expansion.h>
 #include <Collections/Collection.h>
@@ -256,6 +257,16 @@ namespace Nektar
                 (const Array<OneD, const Array<OneD, NekDouble> > &inarray,
                  Array<OneD,       NekDouble> &outarray);
 
+            /// This function calculates the inner product of the gradient
+            /// of a function \f$u(\boldsymbol{x})\f$, multiplied by an
+            /// optional diffusion tensor, with respect to the gradient of
+            /// all \em local expansion modes.
+            MULTI_REGIONS_EXPORT void   PhysDerivIProductWRTDerivBase(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray,
+                const StdRegions::VarCoeffMap      &varcoeffs =
+                                            StdRegions::NullVarCoeffMap);
+
             /// This function elementally evaluates the forward transformation
             /// of a function \f$u(\boldsymbol{x})\f$ onto the global
             /// spectral/hp expansion.
@@ -304,6 +315,19 @@ namespace Nektar
                 NullNekDouble1DArray,
                 const bool PhysSpaceForcing = true);
 
+            /// Solve Helmholtz problems which share the operator of this
+            /// expansion, one for each of the given fields.
+            inline void HelmSolveMultiRHS(
+                const Array<OneD, std::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff =
+                                StdRegions::NullVarCoeffMap,
+                const MultiRegions::VarFactorsMap &varfactors =
+                                 MultiRegions::NullVarFactorsMap,
+                const bool PhysSpaceForcing = true);
+
             /// Solve Advection Diffusion Reaction
             inline void LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
@@ -807,6 +831,12 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &Fn,
                       Array<OneD, NekDouble> &outarray);
 
+            /// AddTraceIntegral for several variables sharing the trace of
+            /// this expansion
+            inline void AddTraceIntegral(
+                const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                      Array<OneD, Array<OneD, NekDouble> > &outarray);
+
             inline void AddFwdBwdTraceIntegral(
                 const Array<OneD, const NekDouble> &Fwd,
                 const Array<OneD, const NekDouble> &Bwd,
@@ -827,6 +857,14 @@ namespace Nektar
                       Array<OneD, NekDouble> &Fwd,
                       Array<OneD, NekDouble> &Bwd);
 
+            /// Forwards and backwards traces of several variables sharing
+            /// the trace of this expansion, without boundary conditions or
+            /// parallel communication
+            inline void GetFwdBwdTracePhysInterior(
+                const Array<OneD, const Array<OneD, NekDouble> > &field,
+                      Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD, Array<OneD, NekDouble> > &Bwd);
+
             /// GetFwdBwdTracePhys of derivatives
             inline void GetFwdBwdTracePhysDeriv(
                 const int                          Dir,
@@ -841,6 +879,17 @@ namespace Nektar
                       Array<OneD, NekDouble> &Fwd,
                       Array<OneD, NekDouble> &Bwd);
             
+            /// Start the parallel exchange of the forwards traces of
+            /// several variables sharing the trace of this expansion, for
+            /// use after GetFwdBwdTracePhysSerial
+            MULTI_REGIONS_EXPORT void BeginTraceExchange(
+                const Array<OneD, const Array<OneD, NekDouble> > &Fwd);
+
+            /// Complete the exchange started by BeginTraceExchange, filling
+            /// the backwards traces along partition boundaries
+            MULTI_REGIONS_EXPORT void FinishTraceExchange(
+                Array<OneD, Array<OneD, NekDouble> > &Bwd);
+
             /// GetFwdBwdTracePhys without filling boundary conditions
             inline void GetFwdBwdTracePhysNoBndFill(
                 const Array<OneD, const NekDouble> &field,
@@ -909,6 +958,47 @@ namespace Nektar
                 const Array<OneD,const NekDouble> &inarray,
                       Array<OneD,      NekDouble> &outarray);
 
+            /// Determine whether the local operator defined by \a gkey can
+            /// be evaluated matrix-free through the collections.
+            MULTI_REGIONS_EXPORT bool CollectionsSupportMatrixOp(
+                const GlobalMatrixKey      &gkey);
+
+            MULTI_REGIONS_EXPORT void GeneralMatrixOp_Collections(
+                const GlobalMatrixKey      &gkey,
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Apply the operator \a op of every collection, possibly
+            /// concurrently on #m_collThreadManager.
+            MULTI_REGIONS_EXPORT void ApplyCollectionOperator(
+                const Collections::OperatorType             op,
+                const int                                   dir,
+                const Array<OneD, const NekDouble>         &inarray,
+                const bool                                  inPhys,
+                const std::vector<Array<OneD, NekDouble> > &args,
+                const std::vector<bool>                    &argsPhys);
+
+            /// Offset and size of the range belonging to each collection.
+            typedef std::vector<std::pair<int, int> > CollectionRanges;
+
+            /// Apply an operator of every collection to explicit ranges of
+            /// the input and argument arrays.
+            MULTI_REGIONS_EXPORT void ApplyCollectionOperator(
+                const Collections::OperatorType             op,
+                const int                                   dir,
+                const Array<OneD, const NekDouble>         &inarray,
+                const CollectionRanges                     &in,
+                const std::vector<Array<OneD, NekDouble> > &args,
+                const std::vector<CollectionRanges>        &out);
+
+            /// Interpolate to, or project from, the quadrature points
+            /// scaled by \a scale through the collections.
+            MULTI_REGIONS_EXPORT void ApplyScaledCollectionOperator(
+                const Collections::OperatorType     op,
+                const NekDouble                     scale,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray);
+
             inline void SetUpPhysNormals();
 
             inline void GetBoundaryToElmtMap(Array<OneD, int> &ElmtID,
@@ -1172,6 +1262,10 @@ namespace Nektar
             /// Offset of elemental data into the array #m_phys
             std::vector<int>  m_coll_phys_offset;
 
+            /// Thread manager used to evaluate the collections concurrently,
+            /// or empty if they are evaluated serially.
+            Thread::ThreadManagerSharedPtr m_collThreadManager;
+
             /// Offset of elemental data into the array #m_coeffs
             Array<OneD, int>  m_coeff_offset;
 
@@ -1285,6 +1379,10 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &Fn,
                       Array<OneD, NekDouble> &outarray);
 
+            virtual void v_AddTraceIntegral(
+                const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                      Array<OneD, Array<OneD, NekDouble> > &outarray);
+
             virtual void v_AddFwdBwdTraceIntegral(
                 const Array<OneD, const NekDouble> &Fwd,
                 const Array<OneD, const NekDouble> &Bwd,
@@ -1324,6 +1422,11 @@ namespace Nektar
                 const Array<OneD,const NekDouble>  &field,
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
+
+            virtual void v_GetFwdBwdTracePhysInterior(
+                const Array<OneD, const Array<OneD, NekDouble> > &field,
+                      Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD, Array<OneD, NekDouble> > &Bwd);
             
             virtual void v_AddTraceQuadPhysToField(
                 const Array<OneD, const NekDouble>  &Fwd,
@@ -1369,6 +1472,15 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing,
                 const bool PhysSpaceForcing);
 
+            virtual void v_HelmSolveMultiRHS(
+                const Array<OneD, std::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff,
+                const MultiRegions::VarFactorsMap &varfactors,
+                const bool PhysSpaceForcing);
+
             virtual void v_LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
                 const Array<OneD, const NekDouble> &inarray,
@@ -1937,6 +2049,22 @@ namespace Nektar
                         varfactors, dirForcing, PhysSpaceForcing);
         }
 
+        /**
+         *
+         */
+        inline void ExpList::HelmSolveMultiRHS(
+            const Array<OneD, std::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const StdRegions::ConstFactorMap &factors,
+            const StdRegions::VarCoeffMap &varcoeff,
+            const MultiRegions::VarFactorsMap &varfactors,
+            const bool PhysSpaceForcing)
+        {
+            v_HelmSolveMultiRHS(fields, inarray, outarray, factors, varcoeff,
+                                varfactors, PhysSpaceForcing);
+        }
+
 
         /**
          *
@@ -2445,6 +2573,13 @@ namespace Nektar
             v_AddTraceIntegral(Fn,outarray);
         }
 
+        inline void ExpList::AddTraceIntegral(
+            const Array<OneD, const Array<OneD, NekDouble> > &Fn,
+                  Array<OneD, Array<OneD, NekDouble> > &outarray)
+        {
+            v_AddTraceIntegral(Fn, outarray);
+        }
+
         inline void ExpList::AddFwdBwdTraceIntegral(
             const Array<OneD, const NekDouble> &Fwd,
             const Array<OneD, const NekDouble> &Bwd,
@@ -2476,6 +2611,14 @@ namespace Nektar
             v_GetFwdBwdTracePhysSerial(field, Fwd, Bwd);
         }
 
+        inline void ExpList::GetFwdBwdTracePhysInterior(
+            const Array<OneD, const Array<OneD, NekDouble> > &field,
+                  Array<OneD, Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD, Array<OneD, NekDouble> > &Bwd)
+        {
+            v_GetFwdBwdTracePhysInterior(field, Fwd, Bwd);
+        }
+
         inline void ExpList::GetFwdBwdTracePhysNoBndFill(
             const Array<OneD, const NekDouble>  &field,
                   Array<OneD, NekDouble> &Fwd,
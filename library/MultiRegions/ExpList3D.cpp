@@ -526,6 +526,13 @@ namespace Nektar
                                   const Array<OneD, NekDouble> &inarray, 
                                   Array<OneD, NekDouble> &outarray)
         {
+            if (m_collections.size())
+            {
+                ApplyScaledCollectionOperator(
+                    Collections::ePhysInterp1DScaled, scale, inarray, outarray);
+                return;
+            }
+
             int cnt,cnt1;
 
             cnt = cnt1 = 0;
@@ -560,6 +567,13 @@ namespace Nektar
                                            const Array<OneD, NekDouble> &inarray,
                                            Array<OneD, NekDouble> &outarray)
         {
+            if (m_collections.size())
+            {
+                ApplyScaledCollectionOperator(
+                    Collections::ePhysGalerkinProjection1DScaled, scale, inarray, outarray);
+                return;
+            }
+
             int cnt,cnt1;
 
             cnt = cnt1 = 0;
@@ -431,6 +431,44 @@ namespace Nektar
             vExp->DropLocStaticCondMatrix(GetBlockMatrixKey(n));
         }
 
+        /**
+         * @brief Solve the system for several right-hand sides.
+         *
+         * The default implementation solves for each right-hand side in
+         * turn. Solvers which can share work between the right-hand sides
+         * override this method.
+         */
+        void GlobalLinSys::v_SolveMultiRHS(
+            const Array<OneD, const Array<OneD, NekDouble> > &in,
+                  Array<OneD,       Array<OneD, NekDouble> > &out,
+            const AssemblyMapSharedPtr                       &locToGloMap)
+        {
+            for (int i = 0; i < in.size(); ++i)
+            {
+                v_SelectRHS(i);
+                v_Solve(in[i], out[i], locToGloMap);
+            }
+            v_SelectRHS(0);
+        }
+
+        /**
+         * @brief Solve the matrix system for several right-hand sides, by
+         * default one after the other.
+         */
+        void GlobalLinSys::v_SolveLinearSystemMultiRHS(
+            const int                                         pNumRows,
+            const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                  Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+            const AssemblyMapSharedPtr                       &locToGloMap,
+            const int                                         pNumDir)
+        {
+            for (int i = 0; i < pInput.size(); ++i)
+            {
+                v_SolveLinearSystem(pNumRows, pInput[i], pOutput[i],
+                                    locToGloMap, pNumDir);
+            }
+        }
+
         void GlobalLinSys::v_InitObject()
         {
             NEKERROR(ErrorUtil::efatal, "Method does not exist" );
@@ -101,6 +101,14 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides which
+            /// share the same operator and local to global map.
+            MULTI_REGIONS_EXPORT
+            inline void SolveMultiRHS(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
             /// Returns a shared pointer to the current object.
             std::shared_ptr<GlobalLinSys> GetSharedThisPtr()
             {
@@ -120,6 +128,14 @@ namespace Nektar
                 const AssemblyMapSharedPtr        &locToGloMap,
                 const int                          pNumDir = 0);
 
+            /// Solve the linear system for several input and output vectors.
+            inline void SolveLinearSystemMultiRHS(
+                const int                                         pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const int                                         pNumDir = 0);
+
         protected:
             /// Key associated with this linear system.
             const GlobalLinSysKey                m_linSysKey;
@@ -135,6 +151,13 @@ namespace Nektar
             virtual DNekScalBlkMatSharedPtr v_GetStaticCondBlock(unsigned int n);
             virtual void                    v_DropStaticCondBlock(unsigned int n);
 
+            /// Selects the right-hand side of a multi-RHS solve that the
+            /// following single solves belong to.
+            virtual void v_SelectRHS(const int pRHS)
+            {
+                boost::ignore_unused(pRHS);
+            }
+
             PreconditionerSharedPtr CreatePrecon(AssemblyMapSharedPtr asmMap);
 
         private:
@@ -156,6 +179,20 @@ namespace Nektar
                 const AssemblyMapSharedPtr        &locToGloMap,
                 const int                          pNumDir) = 0;
 
+            /// Solve a linear system for several right-hand sides.
+            virtual void v_SolveMultiRHS(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
+            /// Solve a basic matrix system for several right-hand sides.
+            virtual void v_SolveLinearSystemMultiRHS(
+                const int                                         pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr                       &locToGloMap,
+                const int                                         pNumDir);
+
             virtual void v_InitObject();
             virtual void v_Initialise(
                 const std::shared_ptr<AssemblyMap>& pLocToGloMap);
@@ -195,6 +232,18 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        inline void GlobalLinSys::SolveMultiRHS(
+                    const Array<OneD, const Array<OneD, NekDouble> > &in,
+                          Array<OneD,       Array<OneD, NekDouble> > &out,
+                    const AssemblyMapSharedPtr &locToGloMap)
+        {
+            v_SolveMultiRHS(in, out, locToGloMap);
+        }
+
+
         /**
          *
          */
@@ -208,6 +257,20 @@ namespace Nektar
             v_SolveLinearSystem(pNumRows, pInput, pOutput, locToGloMap, pNumDir);
         }
 
+        /**
+         *
+         */
+        inline void GlobalLinSys::SolveLinearSystemMultiRHS(
+                const int pNumRows,
+                const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                      Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                const AssemblyMapSharedPtr &locToGloMap,
+                const int pNumDir)
+        {
+            v_SolveLinearSystemMultiRHS(pNumRows, pInput, pOutput,
+                                        locToGloMap, pNumDir);
+        }
+
         inline void GlobalLinSys::InitObject()
         {
             v_InitObject();
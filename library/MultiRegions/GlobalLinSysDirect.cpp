@@ -35,6 +35,8 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <MultiRegions/GlobalLinSysDirect.h>
+#include <MultiRegions/ExpList.h>
+#include <MultiRegions/SubStructuredGraph.h>
 
 namespace Nektar
 {
@@ -77,6 +79,13 @@ namespace Nektar
 
             const int nHomDofs = pNumRows - pNumDir;
 
+            if (m_sparseLinSys)
+            {
+                m_sparseLinSys->Solve(pInput.get()  + pNumDir,
+                                      pOutput.get() + pNumDir);
+                return;
+            }
+
             DNekVec Vin (nHomDofs, pInput  + pNumDir);
 
             Array<OneD, NekDouble> tmp = pOutput + pNumDir;
@@ -84,5 +93,100 @@ namespace Nektar
 
             m_linSys->Solve(Vin, Vout);
         }
+
+        /**
+         * The sparse factorisation is only available for the symmetric
+         * positive definite operators, for which the dense solvers use
+         * symmetric storage.
+         */
+        bool GlobalLinSysDirect::UseSparseCholesky(
+            const AssemblyMapSharedPtr &pLocToGloMap) const
+        {
+            if (!pLocToGloMap->GetLinSysSparseDirect())
+            {
+                return false;
+            }
+
+            switch(m_linSysKey.GetMatrixType())
+            {
+                case StdRegions::eMass:
+                case StdRegions::eLaplacian:
+                case StdRegions::eHelmholtz:
+                case StdRegions::eHybridDGHelmBndLam:
+                    return true;
+                default:
+                    WARNINGL0(false, "LinSysSparseDirect requires a symmetric "
+                              "positive definite matrix; using dense "
+                              "storage.");
+                    return false;
+            }
+        }
+
+        /**
+         * The rows are ordered by nested dissection, using Scotch if
+         * available. The factorisation and the triangular solves are
+         * threaded over independent subtrees of the elimination tree if the
+         * SparseDirectNumThreads parameter is larger than one.
+         */
+        void GlobalLinSysDirect::FactoriseSparseCholesky(
+            const int         pNumRows,
+            const COOMatType &pMatrix)
+        {
+            BoostGraph graph(pNumRows);
+            for (auto &it : pMatrix)
+            {
+                if (it.first.first != it.first.second)
+                {
+                    boost::add_edge(it.first.first, it.first.second, graph);
+                }
+            }
+
+            Array<OneD, int> perm(pNumRows), iperm(pNumRows);
+            NestedDissectionReordering(graph, perm, iperm);
+            graph.clear();
+
+            std::shared_ptr<ExpList> expList = m_expList.lock();
+            LibUtilities::SessionReaderSharedPtr session =
+                expList->GetSession();
+
+            int nthreads;
+            session->LoadParameter("SparseDirectNumThreads", nthreads, 1);
+
+            // Share the thread manager of the session job with any other
+            // user of it.
+            Thread::ThreadManagerSharedPtr threadMan;
+            if (nthreads > 1)
+            {
+#ifdef NEKTAR_USE_THREAD_SAFETY
+                Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+                threadMan = tms.GetInstance(Thread::ThreadMaster::SessionJob);
+
+                if (!threadMan->IsInitialised())
+                {
+                    tms.SetThreadingType("ThreadManagerBoost");
+                    threadMan = tms.CreateInstance(
+                        Thread::ThreadMaster::SessionJob, nthreads);
+                }
+#else
+                WARNINGL0(false, "Threaded sparse factorisation requires "
+                          "NEKTAR_USE_THREAD_SAFETY; ignoring "
+                          "SparseDirectNumThreads.");
+#endif
+            }
+
+            m_sparseLinSys = MemoryManager<SparseCholesky>::AllocateSharedPtr(
+                pNumRows, pMatrix,
+                std::vector<int>(perm.begin(), perm.end()), threadMan);
+
+            if (m_verbose && expList->GetComm()->GetRank() == 0)
+            {
+                std::cout << "Sparse Cholesky factorisation: "
+                          << pNumRows << " rows, "
+                          << m_sparseLinSys->GetNumNonZeroEntries()
+                          << " entries in "
+                          << m_sparseLinSys->GetNumSupernodes()
+                          << " supernodes" << std::endl;
+            }
+        }
     }
 }
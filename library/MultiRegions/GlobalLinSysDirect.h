@@ -36,6 +36,7 @@
 
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <MultiRegions/GlobalLinSys.h>
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
 
 namespace Nektar
 {
@@ -58,6 +59,21 @@ namespace Nektar
         protected:
             /// Basic linear system object.
             DNekLinSysSharedPtr m_linSys;
+            /// Sparse Cholesky factorisation, used instead of #m_linSys if
+            /// requested with the LinSysSparseDirect solver info.
+            SparseCholeskySharedPtr m_sparseLinSys;
+
+            /// Returns true if the assembled matrix is to be factorised
+            /// with a sparse Cholesky factorisation.
+            bool UseSparseCholesky(
+                const AssemblyMapSharedPtr &pLocToGloMap) const;
+
+            /// Factorises the assembled matrix, given by its upper
+            /// triangular part, into #m_sparseLinSys.
+            void FactoriseSparseCholesky(
+                const int         pNumRows,
+                const COOMatType &pMatrix);
+
             /// Solve the linear system for given input and output vectors.
             virtual void v_SolveLinearSystem(
                 const int pNumRows,
@@ -196,6 +196,53 @@ namespace Nektar
             unsigned int cols = totDofs - NumDirBCs;
             NekDouble zero = 0.0;
 
+            DNekScalMatSharedPtr loc_mat;
+            int loc_lda;
+
+            if (UseSparseCholesky(pLocToGloMap))
+            {
+                // Assemble the upper triangular part of the global matrix
+                // in coordinate format.
+                COOMatType spcoomat;
+                for(n = cnt = 0; n < m_expList.lock()->GetNumElmts(); ++n)
+                {
+                    loc_mat = GetBlock(n);
+                    loc_lda = loc_mat->GetRows();
+
+                    for(i = 0; i < loc_lda; ++i)
+                    {
+                        gid1 = pLocToGloMap->GetLocalToGlobalMap(cnt + i)
+                                                                    - NumDirBCs;
+                        sign1 = pLocToGloMap->GetLocalToGlobalSign(cnt + i);
+
+                        if(gid1 < 0)
+                        {
+                            continue;
+                        }
+
+                        for(j = 0; j < loc_lda; ++j)
+                        {
+                            gid2 = pLocToGloMap->GetLocalToGlobalMap(cnt + j)
+                                                                    - NumDirBCs;
+                            sign2 = pLocToGloMap->GetLocalToGlobalSign(cnt + j);
+
+                            if(gid2 >= gid1)
+                            {
+                                spcoomat[std::make_pair(gid1, gid2)] +=
+                                    sign1*sign2*(*loc_mat)(i,j);
+                            }
+                        }
+                    }
+                    cnt += loc_lda;
+                }
+
+                if(rows)
+                {
+                    FactoriseSparseCholesky(rows, spcoomat);
+                }
+                return;
+            }
+
             DNekMatSharedPtr Gmat;
             int bwidth = pLocToGloMap->GetFullSystemBandWidth();
             MatrixStorage matStorage = eFULL;
@@ -242,9 +289,6 @@ namespace Nektar
             }
 
             // fill global matrix
-            DNekScalMatSharedPtr loc_mat;
-
-            int loc_lda;
             for(n = cnt = 0; n < m_expList.lock()->GetNumElmts(); ++n)
             {
                 loc_mat = GetBlock(n);
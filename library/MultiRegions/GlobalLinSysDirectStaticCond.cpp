@@ -74,7 +74,8 @@ namespace Nektar
          * where @f$\boldsymbol{D}@f$ and
          * @f$(\boldsymbol{A-BD^{-1}C})@f$ are invertible, store and assemble
          * a static condensation system, according to a given local to global
-         * mapping. #m_linSys is constructed by AssembleSchurComplement().
+         * mapping. #m_linSys, or #m_sparseLinSys if the LinSysSparseDirect
+         * solver info is set, is constructed by AssembleSchurComplement().
          * @param   mKey        Associated matrix key.
          * @param   pLocMatSys  LocalMatrixSystem
          * @param   locToGloMap Local to global mapping.
@@ -194,6 +195,53 @@ namespace Nektar
             unsigned int rows = nBndDofs - NumDirBCs;
             unsigned int cols = nBndDofs - NumDirBCs;
 
+            DNekScalMatSharedPtr loc_mat;
+            int loc_lda;
+
+            if (UseSparseCholesky(pLocToGloMap))
+            {
+                // Assemble the upper triangular part of the global matrix
+                // in coordinate format.
+                COOMatType spcoomat;
+                for(n = cnt = 0; n < SchurCompl->GetNumberOfBlockRows(); ++n)
+                {
+                    loc_mat = SchurCompl->GetBlock(n,n);
+                    loc_lda = loc_mat->GetRows();
+
+                    for(i = 0; i < loc_lda; ++i)
+                    {
+                        gid1  = pLocToGloMap->GetLocalToGlobalBndMap (cnt + i)
+                                                                    - NumDirBCs;
+                        sign1 = pLocToGloMap->GetLocalToGlobalBndSign(cnt + i);
+
+                        if(gid1 < 0)
+                        {
+                            continue;
+                        }
+
+                        for(j = 0; j < loc_lda; ++j)
+                        {
+                            gid2  = pLocToGloMap->GetLocalToGlobalBndMap(cnt+j)
+                                                                 - NumDirBCs;
+                            sign2 = pLocToGloMap->GetLocalToGlobalBndSign(cnt+j);
+
+                            if(gid2 >= gid1)
+                            {
+                                spcoomat[std::make_pair(gid1, gid2)] +=
+                                    sign1*sign2*(*loc_mat)(i,j);
+                            }
+                        }
+                    }
+                    cnt += loc_lda;
+                }
+
+                if(rows)
+                {
+                    FactoriseSparseCholesky(rows, spcoomat);
+                }
+                return;
+            }
+
             DNekMatSharedPtr Gmat;
             int bwidth = pLocToGloMap->GetBndSystemBandWidth();
 
@@ -232,8 +280,6 @@ namespace Nektar
             }
             
             // fill global matrix
-            DNekScalMatSharedPtr loc_mat;
-            int loc_lda;
             for(n = cnt = 0; n < SchurCompl->GetNumberOfBlockRows(); ++n)
             {
                 loc_mat = SchurCompl->GetBlock(n,n);
@@ -40,6 +40,25 @@ namespace Nektar
 {
     namespace MultiRegions
     {
+        std::string GlobalLinSysIterative::lookupIds[4] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LinSysIterSolver", "ConjugateGradient",
+                MultiRegions::eConjugateGradient),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LinSysIterSolver", "PipelinedConjugateGradient",
+                MultiRegions::ePipelinedConjugateGradient),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LinSysIterSolver", "GMRES",
+                MultiRegions::eGMRES),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LinSysIterSolver", "BiCGStab",
+                MultiRegions::eBiCGStab)
+        };
+
+        std::string GlobalLinSysIterative::def =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "LinSysIterSolver", "ConjugateGradient");
+
         /**
          * @class GlobalLinSysIterative
          *
@@ -56,12 +75,17 @@ namespace Nektar
                   m_rhs_magnitude(NekConstants::kNekUnsetDouble),
                   m_rhs_mag_sm(0.9),
                   m_precon(NullPreconditionerSharedPtr),
+                  m_lowPrecisionSolve(false),
                   m_totalIterations(0),
                   m_useProjection(false),
-                  m_numPrevSols(0)
+                  m_numPrevSols(0),
+                  m_extrapOrder(0),
+                  m_extrapSlot(0)
         {
             m_tolerance = pLocToGloMap->GetIterativeTolerance();
             m_maxiter   = pLocToGloMap->GetMaxIterations();
+            m_linSysIterSolver = pLocToGloMap->GetLinSysIterSolver();
+            m_mixedPrecision   = pLocToGloMap->GetLinSysMixedPrecision();
 
             LibUtilities::CommSharedPtr vComm = m_expList.lock()->GetComm()->GetRowComm();
             m_root    = (vComm->GetRank())? false : true;
@@ -77,6 +101,29 @@ namespace Nektar
             {
                 m_useProjection = false;
             }
+
+            ASSERTL0(!m_useProjection ||
+                     m_linSysIterSolver == eConjugateGradient ||
+                     m_linSysIterSolver == ePipelinedConjugateGradient,
+                     "SuccessiveRHS requires a symmetric positive-definite "
+                     "system and a conjugate gradient LinSysIterSolver.");
+
+            m_extrapOrder = pLocToGloMap->GetInitialGuessExtrapolation();
+            ASSERTL0(m_extrapOrder >= 0,
+                     "InitialGuessExtrapolation must not be negative.");
+            ASSERTL0(!m_useProjection || m_extrapOrder == 0,
+                     "SuccessiveRHS and InitialGuessExtrapolation cannot be "
+                     "used together.");
+
+            m_expList.lock()->GetSession()->LoadParameter(
+                "GMRESRestart", m_gmresRestart, 30);
+            ASSERTL0(m_gmresRestart > 0,
+                     "GMRESRestart must be a positive integer.");
+
+            m_expList.lock()->GetSession()->LoadParameter(
+                "MixedPrecisionInnerTolerance", m_innerTolerance, 1e-4);
+            ASSERTL0(m_innerTolerance > 0.0 && m_innerTolerance < 1.0,
+                     "MixedPrecisionInnerTolerance must lie in (0,1).");
         }
 
         GlobalLinSysIterative::~GlobalLinSysIterative()
@@ -97,14 +144,323 @@ namespace Nektar
             {
                 DoAconjugateProjection(nGlobal, pInput, pOutput, plocToGloMap, nDir);
             }
+            else if (m_extrapOrder > 0)
+            {
+                DoExtrapolatedSolve(nGlobal, pInput, pOutput, plocToGloMap,
+                                    nDir, m_extrapSlot);
+            }
+            else
+            {
+                // applying plain Krylov method
+                DoIterativeSolve(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+            }
+        }
+
+        /**
+         * Solve the global linear system for several right-hand sides. With
+         * the conjugate gradient method, no projection and no mixed-precision
+         * refinement the systems are
+         * iterated together by DoConjugateGradientMultiRHS, so that the
+         * operator is applied to all search directions at once and the
+         * inner products share a single reduction. Otherwise they are solved
+         * one after the other.
+         */
+        void GlobalLinSysIterative::v_SolveLinearSystemMultiRHS(
+                    const int nGlobal,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            if (m_useProjection || m_mixedPrecision ||
+                m_linSysIterSolver != eConjugateGradient ||
+                pInput.size() < 2)
+            {
+                for (int i = 0; i < pInput.size(); ++i)
+                {
+                    if (m_extrapOrder > 0)
+                    {
+                        DoExtrapolatedSolve(nGlobal, pInput[i], pOutput[i],
+                                            plocToGloMap, nDir, i);
+                    }
+                    else
+                    {
+                        v_SolveLinearSystem(nGlobal, pInput[i], pOutput[i],
+                                            plocToGloMap, nDir);
+                    }
+                }
+                return;
+            }
+
+            if (!m_precon)
+            {
+                v_UniqueMap();
+                m_precon = CreatePrecon(plocToGloMap);
+                m_precon->BuildPreconditioner();
+            }
+
+            if (m_extrapOrder == 0)
+            {
+                DoConjugateGradientMultiRHS(nGlobal, pInput, pOutput, nDir);
+                return;
+            }
+
+            // Solve for the corrections to the extrapolated guesses of all
+            // right-hand sides together
+            int nRHS    = pInput.size();
+            int nNonDir = nGlobal - nDir;
+            Array<OneD, Array<OneD, NekDouble> > guess(nRHS), resid(nRHS);
+            Array<OneD, Array<OneD, NekDouble> > corr(nRHS);
+
+            for (int i = 0; i < nRHS; ++i)
+            {
+                guess[i] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                resid[i] = Array<OneD, NekDouble>(nGlobal);
+                corr[i]  = Array<OneD, NekDouble>(nGlobal, 0.0);
+                ExtrapolateInitialGuess(i, nGlobal, pInput[i], guess[i],
+                                        resid[i], nDir);
+            }
+
+            DoConjugateGradientMultiRHS(nGlobal, resid, corr, nDir);
+
+            for (int i = 0; i < nRHS; ++i)
+            {
+                Vmath::Vadd(nNonDir, &guess[i][nDir], 1, &corr[i][nDir], 1,
+                            &pOutput[i][nDir], 1);
+                UpdateExtrapolatedSolutions(i, nGlobal, pOutput[i], nDir);
+            }
+        }
+
+        /**
+         * Solve the global linear system starting from an initial guess
+         * extrapolated from the solutions of the previous solves with the
+         * same right-hand side slot (see ExtrapolateInitialGuess). The
+         * Krylov method is applied to the residual of the guess, so that only
+         * the correction is iterated on. Unlike the A-conjugate projection
+         * of SuccessiveRHS this needs no inner products and only one extra
+         * operator evaluation per solve, and applies to all Krylov methods.
+         *
+         * @param       pInput      Right-hand side of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         * @param       pSlot       Index of the right-hand side, selecting
+         *                          the solution history to extrapolate.
+         */
+        void GlobalLinSysIterative::DoExtrapolatedSolve(
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir,
+                    const int pSlot)
+        {
+            int nNonDir = nGlobal - nDir;
+
+            Array<OneD, NekDouble> guess(nGlobal, 0.0);
+            Array<OneD, NekDouble> resid(nGlobal);
+            Array<OneD, NekDouble> corr (nGlobal, 0.0);
+
+            ExtrapolateInitialGuess(pSlot, nGlobal, pInput, guess, resid,
+                                    nDir);
+
+            DoIterativeSolve(nGlobal, resid, corr, plocToGloMap, nDir);
+
+            Vmath::Vadd(nNonDir, &guess[nDir], 1, &corr[nDir], 1,
+                        &pOutput[nDir], 1);
+
+            UpdateExtrapolatedSolutions(pSlot, nGlobal, pOutput, nDir);
+        }
+
+        /**
+         * Solve the global linear system with the Krylov method selected by
+         * the LinSysIterSolver solver info, creating the preconditioner on
+         * first use. With LinSysMixedPrecision the solve is wrapped in
+         * iterative refinement.
+         */
+        void GlobalLinSysIterative::DoIterativeSolve(
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir)
+        {
+            if (!m_precon)
+            {
+                v_UniqueMap();
+                m_precon = CreatePrecon(plocToGloMap);
+                m_precon->BuildPreconditioner();
+            }
+
+            if (m_mixedPrecision)
+            {
+                DoIterativeRefinement(nGlobal, pInput, pOutput, nDir);
+            }
             else
             {
-                // applying plain Conjugate Gradient
-                DoConjugateGradient(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                DoKrylovSolve(nGlobal, pInput, pOutput, nDir);
+            }
+        }
+
+        /**
+         * Dispatch to the Krylov method selected by the LinSysIterSolver
+         * solver info.
+         */
+        void GlobalLinSysIterative::DoKrylovSolve(
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int nDir)
+        {
+            switch (m_linSysIterSolver)
+            {
+                case eConjugateGradient:
+                    DoConjugateGradient(nGlobal, pInput, pOutput, nDir);
+                    break;
+                case ePipelinedConjugateGradient:
+                    DoPipelinedConjugateGradient(nGlobal, pInput, pOutput, nDir);
+                    break;
+                case eGMRES:
+                    DoGMRES(nGlobal, pInput, pOutput, nDir);
+                    break;
+                case eBiCGStab:
+                    DoBiCGStab(nGlobal, pInput, pOutput, nDir);
+                    break;
+                default:
+                    NEKERROR(ErrorUtil::efatal,
+                             "Unknown iterative solver type");
+                    break;
             }
         }
 
 
+        /**
+         * Solve the global linear system by mixed-precision iterative
+         * refinement. Each step solves for a correction with the selected
+         * Krylov method while #m_lowPrecisionSolve is set, so that the
+         * operator and preconditioner may be applied with matrices stored in
+         * single precision. The inner solve only reduces the current residual
+         * by MixedPrecisionInnerTolerance (or as far as needed), and does not
+         * report its iterations. The correction is then added to the
+         * solution, and the residual is recomputed with double-precision
+         * vectors and accumulation. The outer loop stops at the usual
+         * tolerance for this residual. Where the operator itself is stored in
+         * single precision, this is the residual of the operator with its
+         * entries rounded to single precision.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoIterativeRefinement(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const int                          nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage. The Dirichlet entries of the solution
+            // and correction are kept zero, as in the Krylov methods. The
+            // right-hand side is copied, since it may share the workspace
+            // of the operator.
+            Array<OneD, NekDouble> b_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> x_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> d_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A (nGlobal, 0.0);
+            Array<OneD, NekDouble> Ax_A(nGlobal, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &b_A[nDir], 1);
+            Vmath::Vcopy(nNonDir, &b_A[nDir],    1, &r_A[nDir], 1);
+
+            NekDouble eps = Vmath::Dot2(nNonDir,
+                                        r_A   + nDir,
+                                        r_A   + nDir,
+                                        m_map + nDir);
+            vComm->AllReduce(eps, Nektar::LibUtilities::ReduceSum);
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, b_A, eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            // The inner solves measure their tolerance against the current
+            // residual, so the outer values are stored and restored.
+            const NekDouble tolerance    = m_tolerance;
+            const NekDouble rhsMagnitude = m_rhs_magnitude;
+            const NekDouble tol          = tolerance * tolerance * rhsMagnitude;
+
+            const bool verbose  = m_verbose;
+            int totalIterations = 0;
+            int nRefine         = 0;
+
+            while (eps >= tol)
+            {
+                m_tolerance     = max(m_innerTolerance, sqrt(tol / eps));
+                m_rhs_magnitude = eps;
+
+                m_lowPrecisionSolve = true;
+                m_verbose           = false;
+                DoKrylovSolve(nGlobal, r_A, d_A, nDir);
+                m_lowPrecisionSolve = false;
+                m_verbose           = verbose;
+
+                totalIterations += m_totalIterations;
+                ++nRefine;
+
+                // Update solution x_{k+1} = x_k + d_k
+                Vmath::Vadd(nNonDir, &x_A[nDir], 1, &d_A[nDir], 1,
+                                     &x_A[nDir], 1);
+
+                // Recompute residual r_{k+1} = b - A x_{k+1} with double
+                // precision accumulation
+                v_DoMatrixMultiply(x_A, Ax_A);
+                Vmath::Vsub(nNonDir, &b_A[nDir], 1, &Ax_A[nDir], 1,
+                                     &r_A[nDir], 1);
+
+                NekDouble eps_new = Vmath::Dot2(nNonDir,
+                                                r_A   + nDir,
+                                                r_A   + nDir,
+                                                m_map + nDir);
+                vComm->AllReduce(eps_new, Nektar::LibUtilities::ReduceSum);
+
+                m_tolerance     = tolerance;
+                m_rhs_magnitude = rhsMagnitude;
+
+                if (eps_new >= eps)
+                {
+                    m_totalIterations = totalIterations;
+                    PrintIterations(eps_new);
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Mixed-precision iterative refinement "
+                                      "stagnated; the system is too "
+                                      "ill-conditioned for single-precision "
+                                      "matrices.");
+                }
+                eps = eps_new;
+            }
+
+            m_tolerance       = tolerance;
+            m_rhs_magnitude   = rhsMagnitude;
+            m_totalIterations = totalIterations;
+
+            if (m_verbose)
+            {
+                PrintIterations(eps);
+                if (m_root)
+                {
+                    cout << "Mixed-precision refinement steps = " << nRefine
+                         << endl;
+                }
+            }
+
+            Vmath::Vcopy(nNonDir, &x_A[nDir], 1, &pOutput[nDir], 1);
+        }
+
         /**
          * This method implements A-conjugate projection technique
          * in order to speed up successive linear solves with
@@ -130,7 +486,7 @@ namespace Nektar
             {
                 // no previous solutions found, call CG
 
-                DoConjugateGradient(nGlobal, pInput, pOutput, plocToGloMap, nDir);
+                DoIterativeSolve(nGlobal, pInput, pOutput, plocToGloMap, nDir);
 
                 UpdateKnownSolutions(nGlobal, pOutput, nDir);
             }
@@ -204,7 +560,7 @@ namespace Nektar
 
 
                 // solve the system with projected rhs
-                DoConjugateGradient(nGlobal, pb_s, tmpx_s, plocToGloMap, nDir);
+                DoIterativeSolve(nGlobal, pb_s, tmpx_s, plocToGloMap, nDir);
 
 
                 // remainder solution + projection of previous solutions
@@ -335,6 +691,128 @@ namespace Nektar
             m_numPrevSols++;
         }
 
+        /**
+         * Forms the initial guess by polynomial extrapolation of the \f$ n
+         * \f$ stored solutions \f$ x^{n-1}, \dots, x^0 \f$ of the slot,
+         * \f[ x_{guess} = \sum_{j=1}^{n} (-1)^{j+1} \binom{n}{j} x^{n-j},
+         * \f]
+         * i.e. by evaluating the polynomial through them at the next time
+         * level, and the residual \f$ b - Ax_{guess} \f$ of the
+         * non-Dirichlet dofs. The solvers compute the solution relative to
+         * the initial guess \f$ x_0 \f$ passed to v_Solve, so the stored
+         * vectors are full solutions \f$ x_0 + x \f$ and the guess returned
+         * is \f$ x_{guess} - x_0 \f$, where \f$ x_0 \f$ is held by
+         * ExtrapolationOffset. Without stored solutions the guess is zero and
+         * the residual is a copy of the input.
+         */
+        void GlobalLinSysIterative::ExtrapolateInitialGuess(
+                    const int pSlot,
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pGuess,
+                          Array<OneD,      NekDouble> &pResidual,
+                    const int nDir)
+        {
+            int nNonDir = nGlobal - nDir;
+
+            if (static_cast<size_t>(pSlot) >= m_extrapSol.size())
+            {
+                m_extrapSol.resize(pSlot + 1,
+                    boost::circular_buffer<Array<OneD, NekDouble> >(
+                        m_extrapOrder));
+            }
+
+            const boost::circular_buffer<Array<OneD, NekDouble> > &prevSol =
+                m_extrapSol[pSlot];
+            const int n = prevSol.size();
+
+            Vmath::Vcopy(nGlobal, pInput, 1, pResidual, 1);
+
+            if (n == 0)
+            {
+                return;
+            }
+
+            // Binomial coefficients with alternating sign, starting from the
+            // most recent solution
+            NekDouble coeff = n;
+            for (int j = 1; j <= n; ++j)
+            {
+                Vmath::Svtvp(nNonDir, (j % 2 ? coeff : -coeff),
+                             &prevSol[n - j][0], 1,
+                             &pGuess[nDir], 1, &pGuess[nDir], 1);
+                coeff *= NekDouble(n - j) / NekDouble(j + 1);
+            }
+
+            const Array<OneD, NekDouble> &offset =
+                ExtrapolationOffset(pSlot, nGlobal);
+            Vmath::Vsub(nNonDir, &pGuess[nDir], 1, &offset[nDir], 1,
+                        &pGuess[nDir], 1);
+
+            Array<OneD, NekDouble> Ax(nGlobal, 0.0);
+            v_DoMatrixMultiply(pGuess, Ax);
+            Vmath::Vsub(nNonDir, &pResidual[nDir], 1, &Ax[nDir], 1,
+                        &pResidual[nDir], 1);
+        }
+
+        /**
+         * Stores the non-Dirichlet part of a new solution of the slot, added
+         * to the initial guess it is relative to, reusing the storage of the
+         * oldest solution once #m_extrapOrder solutions are held.
+         */
+        void GlobalLinSysIterative::UpdateExtrapolatedSolutions(
+                    const int pSlot,
+                    const int nGlobal,
+                    const Array<OneD,const NekDouble> &pSolution,
+                    const int nDir)
+        {
+            int nNonDir = nGlobal - nDir;
+
+            boost::circular_buffer<Array<OneD, NekDouble> > &prevSol =
+                m_extrapSol[pSlot];
+
+            const Array<OneD, NekDouble> &offset =
+                ExtrapolationOffset(pSlot, nGlobal);
+
+            Array<OneD, NekDouble> sol = prevSol.full() ? prevSol.front() :
+                Array<OneD, NekDouble>(nNonDir);
+            Vmath::Vadd(nNonDir, &pSolution[nDir], 1, &offset[nDir], 1,
+                        &sol[0], 1);
+            prevSol.push_back(sol);
+        }
+
+        /**
+         * Returns the initial guess of right-hand side @p pSlot which the
+         * next solution is computed relative to. The solvers set it before
+         * SolveLinearSystem when InitialGuessExtrapolation is used; it is
+         * zero otherwise.
+         */
+        Array<OneD, NekDouble> &GlobalLinSysIterative::ExtrapolationOffset(
+                    const int pSlot,
+                    const int nGlobal)
+        {
+            if (static_cast<size_t>(pSlot) >= m_extrapOffset.size())
+            {
+                m_extrapOffset.resize(pSlot + 1);
+            }
+
+            if (m_extrapOffset[pSlot].size() != nGlobal)
+            {
+                m_extrapOffset[pSlot] = Array<OneD, NekDouble>(nGlobal, 0.0);
+            }
+
+            return m_extrapOffset[pSlot];
+        }
+
+        /**
+         * Selects the solution history used by the single solves which
+         * follow.
+         */
+        void GlobalLinSysIterative::v_SelectRHS(const int pRHS)
+        {
+            m_extrapSlot = pRHS;
+        }
+
 
 
         /**  
@@ -354,16 +832,8 @@ namespace Nektar
             const int                          nGlobal,
             const Array<OneD,const NekDouble> &pInput,
                   Array<OneD,      NekDouble> &pOutput,
-            const AssemblyMapSharedPtr        &plocToGloMap,
             const int                          nDir)
         {
-            if (!m_precon)
-            {
-                v_UniqueMap();
-                m_precon = CreatePrecon(plocToGloMap);
-                m_precon->BuildPreconditioner();
-            }
-
             // Get the communicator for performing data exchanges
             LibUtilities::CommSharedPtr vComm
                 = m_expList.lock()->GetComm()->GetRowComm();
@@ -421,13 +891,9 @@ namespace Nektar
             // If input residual is less than tolerance skip solve.
             if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
             {
-                if (m_verbose && m_root)
+                if (m_verbose)
                 {
-                    cout << "CG iterations made = " << m_totalIterations
-                         << " using tolerance of "  << m_tolerance
-                         << " (error = " << sqrt(eps/m_rhs_magnitude)
-                         << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
-                         << endl;
+                    PrintIterations(eps);
                 }
                 return;
             }
@@ -463,14 +929,7 @@ namespace Nektar
 
                 if(k >= m_maxiter)
                 {
-                    if (m_root)
-                    {
-                        cout << "CG iterations made = " << m_totalIterations
-                             << " using tolerance of "  << m_tolerance
-                             << " (error = " << sqrt(eps/m_rhs_magnitude)
-                             << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
-                             << endl;
-                    }
+                    PrintIterations(eps);
                     ROOTONLY_NEKERROR(ErrorUtil::efatal,
                                       "Exceeded maximum number of iterations");
                 }
@@ -520,13 +979,9 @@ namespace Nektar
                 // test if norm is within tolerance
                 if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
                 {
-                    if (m_verbose && m_root)
+                    if (m_verbose)
                     {
-                        cout << "CG iterations made = " << m_totalIterations
-                             << " using tolerance of "  << m_tolerance
-                             << " (error = " << sqrt(eps/m_rhs_magnitude)
-                             << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
-                             << endl;
+                        PrintIterations(eps);
                     }
                     break;
                 }
@@ -540,6 +995,782 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve several global linear systems which share the same operator
+         * with the conjugate gradient method of DoConjugateGradient. Each
+         * right-hand side keeps its own Krylov space and coefficients, but
+         * the search directions are passed to v_DoMatrixMultiplyMultiRHS
+         * together, so that the operator is read from memory once per
+         * iteration for all systems, and the inner products of all systems
+         * are exchanged in a single reduction. A system drops out of the
+         * iteration once it has converged. All systems are tested against
+         * the same right-hand side magnitude, which is the one set for the
+         * last of them. When the magnitude is smoothed between solves (see
+         * Set_Rhs_Magnitude) the systems may therefore take a different
+         * number of iterations than when they are solved one at a time.
+         *
+         * @param       pInput      Input residuals of all DOFs.
+         * @param       pOutput     Solution vectors of all DOFs.
+         */
+        void GlobalLinSysIterative::DoConjugateGradientMultiRHS(
+            const int                                         nGlobal,
+            const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                  Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+            const int                                         nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nRHS    = pInput.size();
+            int nNonDir = nGlobal - nDir;
+            int k, n, nActive;
+
+            // Allocate array storage
+            Array<OneD, Array<OneD, NekDouble> > w_A(nRHS), s_A(nRHS);
+            Array<OneD, Array<OneD, NekDouble> > p_A(nRHS), r_A(nRHS);
+            Array<OneD, Array<OneD, NekDouble> > q_A(nRHS);
+            Array<OneD, NekDouble> alpha(nRHS), beta(nRHS, 0.0);
+            Array<OneD, NekDouble> rho(nRHS), eps(nRHS);
+            Array<OneD, NekDouble> vExchange(3*nRHS, 0.0);
+            Array<OneD, int>       active(nRHS);
+            Array<OneD, NekDouble> tmp;
+            NekDouble rho_new, mu;
+
+            for (n = 0; n < nRHS; ++n)
+            {
+                w_A[n] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                s_A[n] = Array<OneD, NekDouble>(nGlobal, 0.0);
+                p_A[n] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                q_A[n] = Array<OneD, NekDouble>(nNonDir, 0.0);
+                r_A[n] = Array<OneD, NekDouble>(nNonDir, 0.0);
+
+                // Copy initial residual from input before zeroing the
+                // homogeneous output, in case input and output coincide
+                Vmath::Vcopy(nNonDir, &pInput[n][nDir], 1, &r_A[n][0], 1);
+                Vmath::Zero(nNonDir, &pOutput[n][nDir], 1);
+
+                // evaluate initial residual error for exit check
+                vExchange[n] = Vmath::Dot2(nNonDir,
+                                           r_A[n],
+                                           r_A[n],
+                                           m_map + nDir);
+            }
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, pInput[0], eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            const NekDouble tol = m_tolerance * m_tolerance * m_rhs_magnitude;
+
+            m_totalIterations = 0;
+            nActive           = 0;
+            for (n = 0; n < nRHS; ++n)
+            {
+                eps[n]    = vExchange[n];
+                active[n] = eps[n] >= tol;
+                nActive  += active[n];
+
+                // If input residual is less than tolerance skip solve.
+                if (!active[n] && m_verbose)
+                {
+                    PrintIterations(eps[n]);
+                }
+            }
+
+            k = 0;
+            while (nActive > 0)
+            {
+                if(k >= m_maxiter)
+                {
+                    PrintIterations(Vmath::Vmax(nRHS, eps, 1));
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                // Update the unconverged systems and apply the
+                // preconditioner; the first pass only preconditions the
+                // initial residual.
+                Array<OneD, Array<OneD, NekDouble> > w_act(nActive);
+                Array<OneD, Array<OneD, NekDouble> > s_act(nActive);
+                nActive = 0;
+                for (n = 0; n < nRHS; ++n)
+                {
+                    if (!active[n])
+                    {
+                        continue;
+                    }
+
+                    if (k > 0)
+                    {
+                        // Compute new search direction p_k, q_k
+                        Vmath::Svtvp(nNonDir, beta[n], &p_A[n][0], 1,
+                                     &w_A[n][nDir], 1, &p_A[n][0], 1);
+                        Vmath::Svtvp(nNonDir, beta[n], &q_A[n][0], 1,
+                                     &s_A[n][nDir], 1, &q_A[n][0], 1);
+
+                        // Update solution x_{k+1}
+                        Vmath::Svtvp(nNonDir, alpha[n], &p_A[n][0], 1,
+                                     &pOutput[n][nDir], 1,
+                                     &pOutput[n][nDir], 1);
+
+                        // Update residual vector r_{k+1}
+                        Vmath::Svtvp(nNonDir, -alpha[n], &q_A[n][0], 1,
+                                     &r_A[n][0], 1, &r_A[n][0], 1);
+                    }
+
+                    m_precon->DoPreconditioner(r_A[n], tmp = w_A[n] + nDir);
+
+                    w_act[nActive] = w_A[n];
+                    s_act[nActive] = s_A[n];
+                    ++nActive;
+                }
+
+                // Apply the operator to all search directions at once.
+                v_DoMatrixMultiplyMultiRHS(w_act, s_act);
+
+                Vmath::Zero(3*nRHS, vExchange, 1);
+                for (n = 0; n < nRHS; ++n)
+                {
+                    if (!active[n])
+                    {
+                        continue;
+                    }
+
+                    // <r_{k+1}, w_{k+1}>
+                    vExchange[3*n]   = Vmath::Dot2(nNonDir,
+                                                   r_A[n],
+                                                   w_A[n] + nDir,
+                                                   m_map + nDir);
+                    // <s_{k+1}, w_{k+1}>
+                    vExchange[3*n+1] = Vmath::Dot2(nNonDir,
+                                                   s_A[n] + nDir,
+                                                   w_A[n] + nDir,
+                                                   m_map + nDir);
+                    // <r_{k+1}, r_{k+1}>
+                    vExchange[3*n+2] = Vmath::Dot2(nNonDir,
+                                                   r_A[n],
+                                                   r_A[n],
+                                                   m_map + nDir);
+                }
+
+                // Perform inner-product exchanges of all systems
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                m_totalIterations++;
+
+                nActive = 0;
+                for (n = 0; n < nRHS; ++n)
+                {
+                    if (!active[n])
+                    {
+                        continue;
+                    }
+
+                    rho_new = vExchange[3*n];
+                    mu      = vExchange[3*n+1];
+
+                    if (k == 0)
+                    {
+                        // The initial residual has already been checked.
+                        rho[n]   = rho_new;
+                        alpha[n] = rho_new/mu;
+                        ++nActive;
+                        continue;
+                    }
+
+                    eps[n] = vExchange[3*n+2];
+
+                    // test if norm is within tolerance
+                    if (eps[n] < tol)
+                    {
+                        active[n] = 0;
+                        if (m_verbose)
+                        {
+                            PrintIterations(eps[n]);
+                        }
+                        continue;
+                    }
+
+                    // Compute search direction and solution coefficients
+                    beta[n]  = rho_new/rho[n];
+                    alpha[n] = rho_new/(mu - rho_new*beta[n]/alpha[n]);
+                    rho[n]   = rho_new;
+                    ++nActive;
+                }
+
+                k++;
+            }
+        }
+
+        /**
+         * Apply the operator to several vectors. By default this applies
+         * v_DoMatrixMultiply to each of them in turn.
+         */
+        void GlobalLinSysIterative::v_DoMatrixMultiplyMultiRHS(
+            const Array<OneD, Array<OneD, NekDouble> >& pInput,
+                  Array<OneD, Array<OneD, NekDouble> >& pOutput)
+        {
+            for (int n = 0; n < pInput.size(); ++n)
+            {
+                v_DoMatrixMultiply(pInput[n], pOutput[n]);
+            }
+        }
+
+        /**
+         * Solve a global linear system using the pipelined preconditioned
+         * conjugate gradient method (Ghysels and Vanroose, Parallel
+         * Computing 40, 2014). Compared to DoConjugateGradient the
+         * recurrences carry the preconditioned and operator-applied search
+         * directions, so that the three inner products of each iteration
+         * only depend on vectors known at the start of the iteration. Their
+         * global reduction is then started with a non-blocking
+         * Comm::IAllReduce and completes while the preconditioner and
+         * v_DoMatrixMultiply (including its gather-scatter) are applied. The
+         * price is one extra preconditioner and operator application per
+         * solve, four additional vector recurrences per iteration and a
+         * slightly larger accumulation of rounding errors in the residual.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoPipelinedConjugateGradient(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const int                          nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+            LibUtilities::CommRequestSharedPtr request
+                = vComm->CreateRequest(1);
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage. Vectors which are the argument or the
+            // result of v_DoMatrixMultiply span all DOFs, the remaining
+            // recurrences only the non-Dirichlet DOFs.
+            Array<OneD, NekDouble> u_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> w_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> Mw_A   (nGlobal, 0.0);
+            Array<OneD, NekDouble> AMw_A  (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> p_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> s_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> q_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> z_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp, tmp2;
+
+            NekDouble alpha = 0.0, beta = 0.0, gamma, gamma_old = 0.0;
+            NekDouble delta, eps;
+            Array<OneD, NekDouble> vExchange(3, 0.0);
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir, tmp = pOutput + nDir, 1);
+
+            // evaluate initial residual error for exit check
+            vExchange[2] = Vmath::Dot2(nNonDir,
+                                       r_A,
+                                       r_A,
+                                       m_map + nDir);
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            eps = vExchange[2];
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, pInput, eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            m_totalIterations = 0;
+
+            // If input residual is less than tolerance skip solve.
+            if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+            {
+                if (m_verbose)
+                {
+                    PrintIterations(eps);
+                }
+                return;
+            }
+
+            // u_0 = M r_0, w_0 = A u_0
+            m_precon->DoPreconditioner(r_A, tmp = u_A + nDir);
+            v_DoMatrixMultiply(u_A, w_A);
+
+            // Count iterations as DoConjugateGradient does, so that both
+            // report the same number for the same iterates.
+            m_totalIterations = 1;
+
+            for (int k = 0; ; ++k)
+            {
+                if(k >= m_maxiter)
+                {
+                    PrintIterations(eps);
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                // <r_k, u_k>
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                // <w_k, u_k>
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           w_A + nDir,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                // <r_k, r_k>
+                vExchange[2] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           r_A,
+                                           m_map + nDir);
+
+                // Start the inner-product exchanges and overlap them with
+                // m_k = M w_k and n_k = A m_k.
+                vComm->IAllReduce(vExchange, Nektar::LibUtilities::ReduceSum,
+                                  request, 0);
+
+                m_precon->DoPreconditioner(tmp  = w_A  + nDir,
+                                           tmp2 = Mw_A + nDir);
+                v_DoMatrixMultiply(Mw_A, AMw_A);
+
+                vComm->Wait(request, 0);
+
+                gamma = vExchange[0];
+                delta = vExchange[1];
+                eps   = vExchange[2];
+
+                // test if norm is within tolerance
+                if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+                {
+                    if (m_verbose)
+                    {
+                        PrintIterations(eps);
+                    }
+                    break;
+                }
+
+                // Compute search direction and solution coefficients
+                if (k > 0)
+                {
+                    beta  = gamma/gamma_old;
+                    alpha = gamma/(delta - beta*gamma/alpha);
+                }
+                else
+                {
+                    beta  = 0.0;
+                    alpha = gamma/delta;
+                }
+                gamma_old = gamma;
+
+                // z_k = n_k + beta z_{k-1},  q_k = m_k + beta q_{k-1}
+                // s_k = w_k + beta s_{k-1},  p_k = u_k + beta p_{k-1}
+                Vmath::Svtvp(nNonDir, beta, &z_A[0], 1, &AMw_A[nDir], 1, &z_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &q_A[0], 1, &Mw_A[nDir], 1, &q_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &s_A[0], 1, &w_A[nDir], 1, &s_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &p_A[0], 1, &u_A[nDir], 1, &p_A[0], 1);
+
+                // Update solution x_{k+1}
+                Vmath::Svtvp(nNonDir, alpha, &p_A[0], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+
+                // Update residual r_{k+1}, preconditioned residual u_{k+1}
+                // and w_{k+1} = A u_{k+1}
+                Vmath::Svtvp(nNonDir, -alpha, &s_A[0], 1, &r_A[0], 1, &r_A[0], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &q_A[0], 1, &u_A[nDir], 1, &u_A[nDir], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &z_A[0], 1, &w_A[nDir], 1, &w_A[nDir], 1);
+
+                m_totalIterations++;
+            }
+        }
+
+        /**
+         * Solve a global linear system using the restarted generalised
+         * minimal residual method, GMRES(m), with right preconditioning
+         * (Saad, Iterative Methods for Sparse Linear Systems, 2003). Unlike
+         * the conjugate gradient methods this does not require the operator
+         * to be symmetric, so it can be used for the advection-diffusion and
+         * advection-reaction systems. The Krylov basis is orthogonalised by
+         * classical Gram-Schmidt with one reorthogonalisation pass, so that
+         * the inner products against all basis vectors are reduced in a
+         * single exchange. The basis is restarted every #m_gmresRestart
+         * iterations. With right preconditioning the least-squares residual
+         * is the unpreconditioned residual, so the same stopping criterion as
+         * in DoConjugateGradient is used.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoGMRES(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const int                          nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+            int nKrylov = m_gmresRestart;
+
+            // Allocate array storage
+            Array<OneD, NekDouble> x_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> z_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> w_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> b_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            // Krylov basis, Hessenberg matrix (column-major) and Givens
+            // rotations
+            Array<OneD, Array<OneD, NekDouble> > V(nKrylov + 1);
+            for (int i = 0; i <= nKrylov; ++i)
+            {
+                V[i] = Array<OneD, NekDouble>(nNonDir, 0.0);
+            }
+            Array<OneD, NekDouble> H   ((nKrylov + 1) * nKrylov, 0.0);
+            Array<OneD, NekDouble> cs  (nKrylov, 0.0);
+            Array<OneD, NekDouble> sn  (nKrylov, 0.0);
+            Array<OneD, NekDouble> g   (nKrylov + 1, 0.0);
+            Array<OneD, NekDouble> y   (nKrylov, 0.0);
+            Array<OneD, NekDouble> vExchange(nKrylov + 1, 0.0);
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &b_A[0], 1);
+            Vmath::Vcopy(nNonDir, &b_A[0], 1, &r_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir, tmp = pOutput + nDir, 1);
+
+            // evaluate initial residual error for exit check
+            NekDouble eps = Vmath::Dot2(nNonDir,
+                                        r_A,
+                                        r_A,
+                                        m_map + nDir);
+            vComm->AllReduce(eps, Nektar::LibUtilities::ReduceSum);
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, pInput, eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            m_totalIterations = 0;
+
+            const NekDouble tol = m_tolerance * m_tolerance * m_rhs_magnitude;
+
+            // Restart cycles
+            while (eps >= tol)
+            {
+                if(m_totalIterations >= m_maxiter)
+                {
+                    PrintIterations(eps);
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                NekDouble beta = sqrt(eps);
+                Vmath::Smul(nNonDir, 1.0/beta, r_A, 1, V[0], 1);
+                Vmath::Zero(nKrylov + 1, g, 1);
+                g[0] = beta;
+
+                int k = 0;
+                while (k < nKrylov && eps >= tol &&
+                       m_totalIterations < m_maxiter)
+                {
+                    // w = A M^{-1} v_k
+                    m_precon->DoPreconditioner(V[k], tmp = z_A + nDir);
+                    v_DoMatrixMultiply(z_A, w_A);
+
+                    // Orthogonalise w against v_0..v_k twice, reducing all
+                    // inner products of a pass in one exchange.
+                    NekDouble *h = &H[k * (nKrylov + 1)];
+                    Vmath::Zero(k + 1, h, 1);
+                    for (int pass = 0; pass < 2; ++pass)
+                    {
+                        for (int i = 0; i <= k; ++i)
+                        {
+                            vExchange[i] = Vmath::Dot2(nNonDir,
+                                                       w_A + nDir,
+                                                       V[i],
+                                                       m_map + nDir);
+                        }
+                        vComm->AllReduce(vExchange,
+                                         Nektar::LibUtilities::ReduceSum);
+
+                        for (int i = 0; i <= k; ++i)
+                        {
+                            h[i] += vExchange[i];
+                            Vmath::Svtvp(nNonDir, -vExchange[i], &V[i][0], 1,
+                                         &w_A[nDir], 1, &w_A[nDir], 1);
+                        }
+                    }
+
+                    NekDouble hnorm = Vmath::Dot2(nNonDir,
+                                                  w_A + nDir,
+                                                  w_A + nDir,
+                                                  m_map + nDir);
+                    vComm->AllReduce(hnorm, Nektar::LibUtilities::ReduceSum);
+                    hnorm = sqrt(hnorm);
+                    h[k + 1] = hnorm;
+
+                    if (hnorm > 0.0)
+                    {
+                        Vmath::Smul(nNonDir, 1.0/hnorm, &w_A[nDir], 1,
+                                    &V[k + 1][0], 1);
+                    }
+
+                    // Apply previous rotations to the new column and
+                    // compute the rotation eliminating h_{k+1,k}.
+                    for (int i = 0; i < k; ++i)
+                    {
+                        NekDouble t = cs[i] * h[i] + sn[i] * h[i + 1];
+                        h[i + 1]    = cs[i] * h[i + 1] - sn[i] * h[i];
+                        h[i]        = t;
+                    }
+
+                    NekDouble denom = sqrt(h[k] * h[k] + h[k + 1] * h[k + 1]);
+                    ASSERTL0(denom > 0.0, "GMRES breakdown: singular system");
+                    cs[k]    = h[k] / denom;
+                    sn[k]    = h[k + 1] / denom;
+                    h[k]     = denom;
+                    h[k + 1] = 0.0;
+
+                    g[k + 1] = -sn[k] * g[k];
+                    g[k]     =  cs[k] * g[k];
+
+                    eps = g[k + 1] * g[k + 1];
+
+                    ++k;
+                    ++m_totalIterations;
+
+                    // The Krylov space is invariant so the solution is exact.
+                    if (hnorm == 0.0)
+                    {
+                        eps = 0.0;
+                    }
+                }
+
+                // Solve the upper triangular system H y = g
+                for (int i = k - 1; i >= 0; --i)
+                {
+                    NekDouble sum = g[i];
+                    for (int j = i + 1; j < k; ++j)
+                    {
+                        sum -= H[j * (nKrylov + 1) + i] * y[j];
+                    }
+                    y[i] = sum / H[i * (nKrylov + 1) + i];
+                }
+
+                // x += M^{-1} V y
+                Vmath::Zero(nNonDir, r_A, 1);
+                for (int i = 0; i < k; ++i)
+                {
+                    Vmath::Svtvp(nNonDir, y[i], &V[i][0], 1,
+                                 &r_A[0], 1, &r_A[0], 1);
+                }
+                m_precon->DoPreconditioner(r_A, tmp = z_A + nDir);
+                Vmath::Vadd(nNonDir, &z_A[nDir], 1, &x_A[nDir], 1,
+                            &x_A[nDir], 1);
+
+                // Recompute the true residual r = b - A x for the restart.
+                // x_A has zero Dirichlet entries so that these do not
+                // contribute to the product.
+                v_DoMatrixMultiply(x_A, w_A);
+                Vmath::Vsub(nNonDir, &b_A[0], 1, &w_A[nDir], 1, &r_A[0], 1);
+
+                eps = Vmath::Dot2(nNonDir, r_A, r_A, m_map + nDir);
+                vComm->AllReduce(eps, Nektar::LibUtilities::ReduceSum);
+            }
+
+            Vmath::Vcopy(nNonDir, &x_A[nDir], 1, &pOutput[nDir], 1);
+
+            if (m_verbose)
+            {
+                PrintIterations(eps);
+            }
+        }
+
+        /**
+         * Solve a global linear system using the right-preconditioned
+         * biconjugate gradient stabilised method (van der Vorst, SIAM J. Sci.
+         * Stat. Comput. 13, 1992). Like DoGMRES it does not require the
+         * operator to be symmetric, but needs only a fixed amount of storage
+         * at the cost of two operator and preconditioner applications per
+         * iteration. The inner products are grouped so that each iteration
+         * performs three global reductions.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoBiCGStab(
+            const int                          nGlobal,
+            const Array<OneD,const NekDouble> &pInput,
+                  Array<OneD,      NekDouble> &pOutput,
+            const int                          nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage
+            Array<OneD, NekDouble> ph_A   (nGlobal, 0.0);
+            Array<OneD, NekDouble> sh_A   (nGlobal, 0.0);
+            Array<OneD, NekDouble> v_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> t_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> r0_A   (nNonDir, 0.0);
+            Array<OneD, NekDouble> p_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> s_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            NekDouble alpha = 1.0, omega = 1.0, rho = 1.0, rho_new, beta, eps;
+            Array<OneD, NekDouble> vExchange(3, 0.0);
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[0], 1);
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r0_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir, tmp = pOutput + nDir, 1);
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                NekVector<NekDouble> inGlob (nGlobal, pInput, eWrapper);
+                Set_Rhs_Magnitude(inGlob);
+            }
+
+            m_totalIterations = 0;
+
+            while (true)
+            {
+                // <r0, r_k> and <r_k, r_k>
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           r0_A,
+                                           r_A,
+                                           m_map + nDir);
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           r_A,
+                                           m_map + nDir);
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                rho_new = vExchange[0];
+                eps     = vExchange[1];
+
+                // test if norm is within tolerance
+                if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+                {
+                    if (m_verbose)
+                    {
+                        PrintIterations(eps);
+                    }
+                    break;
+                }
+
+                if(m_totalIterations >= m_maxiter)
+                {
+                    PrintIterations(eps);
+                    ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                                      "Exceeded maximum number of iterations");
+                }
+
+                ASSERTL0(rho_new != 0.0 && omega != 0.0,
+                         "BiCGStab breakdown: <r0, r> or omega vanished");
+
+                // p_k = r_k + beta (p_{k-1} - omega v_{k-1})
+                beta = (rho_new / rho) * (alpha / omega);
+                Vmath::Svtvp(nNonDir, -omega, &v_A[nDir], 1, &p_A[0], 1, &p_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &p_A[0], 1, &r_A[0], 1, &p_A[0], 1);
+
+                // v = A M^{-1} p
+                m_precon->DoPreconditioner(p_A, tmp = ph_A + nDir);
+                v_DoMatrixMultiply(ph_A, v_A);
+
+                NekDouble r0v = Vmath::Dot2(nNonDir,
+                                            r0_A,
+                                            v_A + nDir,
+                                            m_map + nDir);
+                vComm->AllReduce(r0v, Nektar::LibUtilities::ReduceSum);
+
+                ASSERTL0(r0v != 0.0, "BiCGStab breakdown: <r0, v> vanished");
+                alpha = rho_new / r0v;
+
+                // s = r - alpha v
+                Vmath::Svtvp(nNonDir, -alpha, &v_A[nDir], 1, &r_A[0], 1, &s_A[0], 1);
+
+                // t = A M^{-1} s
+                m_precon->DoPreconditioner(s_A, tmp = sh_A + nDir);
+                v_DoMatrixMultiply(sh_A, t_A);
+
+                // <t, s> and <t, t>
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           t_A + nDir,
+                                           s_A,
+                                           m_map + nDir);
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           t_A + nDir,
+                                           t_A + nDir,
+                                           m_map + nDir);
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                omega = vExchange[1] > 0.0 ? vExchange[0] / vExchange[1] : 0.0;
+
+                // x_{k+1} = x_k + alpha M^{-1} p + omega M^{-1} s
+                Vmath::Svtvp(nNonDir, alpha, &ph_A[nDir], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+                Vmath::Svtvp(nNonDir, omega, &sh_A[nDir], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+
+                // r_{k+1} = s - omega t
+                Vmath::Svtvp(nNonDir, -omega, &t_A[nDir], 1, &s_A[0], 1, &r_A[0], 1);
+
+                rho = rho_new;
+                m_totalIterations++;
+            }
+        }
+
+        /**
+         * Print the number of iterations and the relative residual of the
+         * last solve on the root process.
+         */
+        void GlobalLinSysIterative::PrintIterations(NekDouble eps)
+        {
+            if (!m_root)
+            {
+                return;
+            }
+
+            const bool isCG = m_linSysIterSolver == eConjugateGradient ||
+                m_linSysIterSolver == ePipelinedConjugateGradient;
+
+            cout << (isCG ? "CG" : IterativeMethodTypeMap[m_linSysIterSolver])
+                 << " iterations made = " << m_totalIterations
+                 << " using tolerance of "  << m_tolerance
+                 << " (error = " << sqrt(eps/m_rhs_magnitude)
+                 << ", rhs_mag = " << sqrt(m_rhs_magnitude) <<  ")"
+                 << endl;
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(
             const NekVector<NekDouble> &pIn)
         {
@@ -59,7 +59,15 @@ namespace Nektar
 
             MULTI_REGIONS_EXPORT virtual ~GlobalLinSysIterative();
 
+            /// Apply the global operator, including the Dirichlet entries.
+            inline void DoMatrixMultiply(
+                    const Array<OneD, NekDouble>& pInput,
+                          Array<OneD, NekDouble>& pOutput);
+
         protected:
+            static std::string                          lookupIds[];
+            static std::string                          def;
+
             /// Global to universal unique map
             Array<OneD, int>                            m_map;
 
@@ -78,6 +86,23 @@ namespace Nektar
             PreconditionerSharedPtr                     m_precon;
 
             MultiRegions::PreconditionerType            m_precontype;
+
+            /// Krylov method used to solve the system
+            IterativeMethodType                         m_linSysIterSolver;
+
+            /// Number of GMRES iterations between restarts
+            int                                         m_gmresRestart;
+
+            /// Whether to solve with single-precision matrices inside
+            /// mixed-precision iterative refinement
+            bool                                        m_mixedPrecision;
+
+            /// Relative tolerance of the inner single-precision solves
+            NekDouble                                   m_innerTolerance;
+
+            /// Set during the inner solves of iterative refinement, when
+            /// the operator may be applied in single precision
+            bool                                        m_lowPrecisionSolve;
             
             int                                         m_totalIterations;
 
@@ -93,6 +118,23 @@ namespace Nektar
             /// Total counter of previous solutions
             int m_numPrevSols;
 
+            /// Number of previous solutions extrapolated to form the initial
+            /// guess, or zero if the initial guess is zero
+            int                                         m_extrapOrder;
+
+            /// Most recent solutions of each right-hand side of the system
+            std::vector<boost::circular_buffer<Array<OneD, NekDouble> > >
+                                                        m_extrapSol;
+
+            /// Initial guess of each right-hand side that the solution of
+            /// SolveLinearSystem is relative to, so that full solutions are
+            /// stored and extrapolated
+            std::vector<Array<OneD, NekDouble> >        m_extrapOffset;
+
+            /// Right-hand side of the single solves which follow, when the
+            /// right-hand sides of a multi-RHS solve are solved in turn
+            int                                         m_extrapSlot;
+
             /// A-conjugate projection technique
             void DoAconjugateProjection(
                     const int pNumRows,
@@ -101,25 +143,107 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
-            /// Actual iterative solve
-            void DoConjugateGradient(
+            /// Iterative solve from an extrapolated initial guess
+            void DoExtrapolatedSolve(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir,
+                    const int pSlot = 0);
+
+            /// Actual iterative solve using the selected Krylov method
+            void DoIterativeSolve(
                     const int pNumRows,
                     const Array<OneD,const NekDouble> &pInput,
                           Array<OneD,      NekDouble> &pOutput,
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Iterative refinement around single-precision Krylov solves
+            void DoIterativeRefinement(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
+            /// Conjugate gradient solve
+            void DoConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
+
+            /// Conjugate gradient solve of several systems at once
+            void DoConjugateGradientMultiRHS(
+                    const int pNumRows,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const int pNumDir);
+
+            /// Pipelined variant of the conjugate gradient solve
+            void DoPipelinedConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
+            /// Restarted GMRES solve for non-symmetric systems
+            void DoGMRES(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
+            /// BiCGStab solve for non-symmetric systems
+            void DoBiCGStab(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
 
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
 
             virtual void v_UniqueMap() = 0;
             
+            /// Storage for the initial guess of a right-hand side, in the
+            /// global numbering of the system
+            Array<OneD, NekDouble> &ExtrapolationOffset(
+                    const int pSlot,
+                    const int pGlobalBndDofs);
+
+            virtual void v_SelectRHS(const int pRHS);
+
         private:
+            /// Solve with the Krylov method selected by LinSysIterSolver
+            void DoKrylovSolve(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
             void UpdateKnownSolutions(
                     const int pGlobalBndDofs,
                     const Array<OneD,const NekDouble> &pSolution,
                     const int pNumDirBndDofs);
 
+            void ExtrapolateInitialGuess(
+                    const int pSlot,
+                    const int pGlobalBndDofs,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pGuess,
+                          Array<OneD,      NekDouble> &pResidual,
+                    const int pNumDirBndDofs);
+
+            void UpdateExtrapolatedSolutions(
+                    const int pSlot,
+                    const int pGlobalBndDofs,
+                    const Array<OneD,const NekDouble> &pSolution,
+                    const int pNumDirBndDofs);
+
+            void PrintIterations(NekDouble eps);
+
             NekDouble CalculateAnorm(
                     const int nGlobal,
                     const Array<OneD,const NekDouble> &in,
@@ -134,10 +258,32 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const int pNumDir);
 
+            /// Solve the matrix system for several right-hand sides
+            virtual void v_SolveLinearSystemMultiRHS(
+                    const int pNumRows,
+                    const Array<OneD, const Array<OneD, NekDouble> > &pInput,
+                          Array<OneD,       Array<OneD, NekDouble> > &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir);
+
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput) = 0;
+
+            virtual void v_DoMatrixMultiplyMultiRHS(
+                    const Array<OneD, Array<OneD, NekDouble> >& pInput,
+                          Array<OneD, Array<OneD, NekDouble> >& pOutput);
         };
+
+        /**
+         *
+         */
+        inline void GlobalLinSysIterative::DoMatrixMultiply(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            v_DoMatrixMultiply(pInput, pOutput);
+        }
     }
 }
 
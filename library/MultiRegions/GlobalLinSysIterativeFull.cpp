@@ -77,6 +77,16 @@ namespace Nektar
             ASSERTL1(m_linSysKey.GetGlobalSysSolnType()==eIterativeFull,
                      "This routine should only be used when using an Iterative "
                      "conjugate gradient matrix solve.");
+
+            // Continuous Helmholtz/Laplacian systems can be applied directly
+            // through the collections without forming elemental matrices.
+            m_matrixFree =
+                std::dynamic_pointer_cast<AssemblyMapCG>(pLocToGloMap) &&
+                m_expList.lock()->CollectionsSupportMatrixOp(m_linSysKey);
+
+            // The full operator is not stored as matrices, so there is
+            // nothing to hold in single precision.
+            m_mixedPrecision = false;
         }
 
 
@@ -156,7 +166,7 @@ namespace Nektar
                 {
                     // Calculate the dirichlet forcing B_b (== X_b) and
                     // substract it from the rhs
-                    expList->GeneralMatrixOp(m_linSysKey, pLocOutput, tmp);
+                    DoLocalMatrixMultiply(pLocOutput, tmp);
 
                     // Iterate over all the elements computing Robin BCs where
                     // necessary
@@ -186,6 +196,13 @@ namespace Nektar
                 {
                     pLocToGloMap->Assemble(tmp1,tmp);
 
+                    if (m_extrapOrder > 0)
+                    {
+                        pLocToGloMap->LocalToGlobal(pLocOutput,
+                            ExtrapolationOffset(m_extrapSlot, nGlobDofs),
+                            false);
+                    }
+
                     // solve for perturbation from initial guess in pOutput
                     SolveLinearSystem(
                         nGlobDofs, tmp, global, pLocToGloMap, nDirDofs);
@@ -203,6 +220,13 @@ namespace Nektar
             else
             {
                 pLocToGloMap->Assemble(pLocInput,tmp);
+
+                if (m_extrapOrder > 0)
+                {
+                    Vmath::Zero(nGlobDofs,
+                        ExtrapolationOffset(m_extrapSlot, nGlobDofs), 1);
+                }
+
                 SolveLinearSystem(nGlobDofs, tmp, global, pLocToGloMap,nDirDofs);
                 pLocToGloMap->GlobalToLocal(global,pLocOutput);
             }
@@ -227,8 +251,7 @@ namespace Nektar
             asmMap->GlobalToLocal(pInput, InputLoc);
 
             // Perform matrix-vector operation A*d_i
-            expList->GeneralMatrixOp(m_linSysKey,
-                                     InputLoc, OutputLoc);
+            DoLocalMatrixMultiply(InputLoc, OutputLoc);
 
 
             // Apply robin boundary conditions to the solution.
@@ -256,6 +279,27 @@ namespace Nektar
             asmMap->Assemble(OutputLoc, pOutput);
         }
 
+        /**
+         * Evaluate the local (elemental) operator, either matrix-free through
+         * the collections or through the elemental GeneralMatrixOp routines.
+         */
+        void GlobalLinSysIterativeFull::DoLocalMatrixMultiply(
+                const Array<OneD, const NekDouble> &pInput,
+                      Array<OneD,       NekDouble> &pOutput)
+        {
+            std::shared_ptr<MultiRegions::ExpList> expList = m_expList.lock();
+
+            if (m_matrixFree)
+            {
+                expList->GeneralMatrixOp_Collections(m_linSysKey,
+                                                     pInput, pOutput);
+            }
+            else
+            {
+                expList->GeneralMatrixOp(m_linSysKey, pInput, pOutput);
+            }
+        }
+
         /**
          *
          */
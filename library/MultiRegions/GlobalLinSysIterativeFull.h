@@ -74,6 +74,9 @@ namespace Nektar
             // Local to global map.
             std::weak_ptr<AssemblyMap> m_locToGloMap;
 
+            /// Evaluate the local operator through the collections.
+            bool m_matrixFree;
+
             /// Solve the linear system for given input and output vectors
             /// using a specified local to global map.
             virtual void v_Solve(
@@ -89,6 +92,10 @@ namespace Nektar
 
             virtual void v_UniqueMap();
 
+            void DoLocalMatrixMultiply(
+                    const Array<OneD, const NekDouble> &pInput,
+                          Array<OneD,       NekDouble> &pOutput);
+
         };
     }
 }
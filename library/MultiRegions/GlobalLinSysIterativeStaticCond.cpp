@@ -39,6 +39,10 @@
 #include <LibUtilities/LinearAlgebra/SparseDiagBlkMatrix.hpp>
 #include <LibUtilities/LinearAlgebra/SparseUtils.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+
 using namespace std;
 
 namespace Nektar
@@ -72,7 +76,7 @@ namespace Nektar
             LibUtilities::SessionReader::RegisterDefaultSolverInfo(
                 "LocalMatrixStorageStrategy",
                 "Sparse");
-        std::string GlobalLinSysIterativeStaticCond::storagelookupIds[3] = {
+        std::string GlobalLinSysIterativeStaticCond::storagelookupIds[4] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "LocalMatrixStorageStrategy",
                 "Contiguous",
@@ -85,6 +89,10 @@ namespace Nektar
                 "LocalMatrixStorageStrategy",
                 "Sparse",
                 MultiRegions::eSparse),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "LocalMatrixStorageStrategy",
+                "Batched",
+                MultiRegions::eBatched),
         };
 
         /**
@@ -112,7 +120,8 @@ namespace Nektar
             const std::shared_ptr<AssemblyMap>   &pLocToGloMap)
             : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
               GlobalLinSysIterative (pKey, pExpList, pLocToGloMap),
-              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap),
+              m_overlapExchange     (false)
         {
             ASSERTL1((pKey.GetGlobalSysSolnType()==eIterativeStaticCond)||
                      (pKey.GetGlobalSysSolnType()==eIterativeMultiLevelStaticCond),
@@ -139,7 +148,8 @@ namespace Nektar
             const PreconditionerSharedPtr         pPrecon)
             : GlobalLinSys          (pKey, pExpList, pLocToGloMap),
               GlobalLinSysIterative (pKey, pExpList, pLocToGloMap),
-              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap)
+              GlobalLinSysStaticCond(pKey, pExpList, pLocToGloMap),
+              m_overlapExchange     (false)
         {
             m_schurCompl  = pSchurCompl;
             m_BinvD       = pBinvD;
@@ -242,6 +252,7 @@ namespace Nektar
                 m_expList.lock()->GetSession()->
                     GetSolverInfoAsEnum<LocalMatrixStorageStrategy>(
                                        "LocalMatrixStorageStrategy");
+            m_storageStrategy = storageStrategy;
 
             switch(storageStrategy)
             {
@@ -380,15 +391,638 @@ namespace Nektar
 
                     break;
                 }
+                case MultiRegions::eBatched:
+                {
+                    PrepareBatchedSchurComplement();
+                    break;
+                }
                 default:
                     ErrorUtil::NekError("Solver info property \
                         LocalMatrixStorageStrategy takes values \
-                        Contiguous, Non-contiguous and Sparse");
+                        Contiguous, Non-contiguous, Sparse and Batched");
+            }
+
+            if (m_mixedPrecision)
+            {
+                PrepareSinglePrecisionSchurComplement();
+            }
+
+            PrepareSharedBlocks();
+
+            // The single-precision blocks are also used for the refinement
+            // residual and the Dirichlet forcing, so the double-precision
+            // blocks are no longer needed once the preconditioner is built.
+            if (!m_floatStorage.empty())
+            {
+                std::vector<double>().swap(m_storage);
+                std::vector<const double*>().swap(m_denseBlocks);
+                m_sparseSchurCompl.reset();
+                m_schurCompl.reset();
             }
         }
 
         /**
-         *
+         * In parallel, the blocks of elements which touch coefficients
+         * shared with other processes are marked so that
+         * v_DoMatrixMultiply can apply them first, start the exchange of
+         * the assembled result and apply the remaining blocks while the
+         * messages are in flight. Batched blocks are reordered so that
+         * their shared elements are listed first. The decision must agree
+         * on all processes, since the split-phase exchange does not match
+         * the messages of the blocking one; it therefore only depends on
+         * the storage strategy, and the sparse block-diagonal storage,
+         * which cannot apply a subset of its blocks, keeps the blocking
+         * exchange.
+         */
+        void GlobalLinSysIterativeStaticCond::PrepareSharedBlocks()
+        {
+            AssemblyMapSharedPtr asmMap = m_locToGloMap.lock();
+
+            m_overlapExchange = !m_sparseSchurCompl &&
+                m_expList.lock()->GetComm()->GetRowComm()->GetSize() > 1;
+
+            if (!m_overlapExchange)
+            {
+                return;
+            }
+
+            int nLocal = asmMap->GetNumLocalBndCoeffs();
+            Array<OneD, int> shared = asmMap->GetSharedBndCoeffs();
+            Array<OneD, int> localShared(nLocal, 0);
+
+            for (int i = 0; i < nLocal; ++i)
+            {
+                localShared[i] = shared[asmMap->GetLocalToGlobalBndMap(i)];
+            }
+
+            // Whether the block of @p rows coefficients starting at local
+            // offset @p off touches a shared coefficient
+            auto touchesShared = [&](unsigned int off, unsigned int rows)
+            {
+                return std::find(localShared.get() + off,
+                                 localShared.get() + off + rows, 1) !=
+                       localShared.get() + off + rows;
+            };
+
+            Array<OneD, int> sharedBlockCoeff(nLocal, 0);
+
+            if (!m_floatStorage.empty())
+            {
+                m_floatShared = Array<OneD, unsigned int>(
+                    m_floatRows.size(), 0U);
+                for (int u = 0; u < m_floatRows.size(); ++u)
+                {
+                    const unsigned int rows = m_floatRows[u];
+                    unsigned int *first = m_floatElmt.get() + m_floatStart[u];
+                    unsigned int *last  = m_floatElmt.get() + m_floatStart[u+1];
+                    unsigned int *mid   = std::stable_partition(first, last,
+                        [&](unsigned int off)
+                        {
+                            return touchesShared(off, rows);
+                        });
+
+                    m_floatShared[u] = mid - first;
+                    for (unsigned int *e = first; e != mid; ++e)
+                    {
+                        std::fill_n(sharedBlockCoeff.get() + *e, rows, 1);
+                    }
+                }
+            }
+            else if (m_storageStrategy == eBatched)
+            {
+                m_batchShared = Array<OneD, unsigned int>(
+                    m_denseBlocks.size(), 0U);
+                for (int u = 0; u < m_denseBlocks.size(); ++u)
+                {
+                    const unsigned int rows = m_rows[u];
+                    unsigned int *first = m_batchElmt.get() + m_batchStart[u];
+                    unsigned int *last  = m_batchElmt.get() + m_batchStart[u+1];
+                    unsigned int *mid   = std::stable_partition(first, last,
+                        [&](unsigned int off)
+                        {
+                            return touchesShared(off, rows);
+                        });
+
+                    m_batchShared[u] = mid - first;
+                    for (unsigned int *e = first; e != mid; ++e)
+                    {
+                        std::fill_n(sharedBlockCoeff.get() + *e, rows, 1);
+                    }
+                }
+            }
+            else
+            {
+                m_sharedBlock = Array<OneD, int>(m_denseBlocks.size(), 0);
+                for (int i = 0, cnt = 0; i < m_denseBlocks.size();
+                     cnt += m_rows[i], ++i)
+                {
+                    if (touchesShared(cnt, m_rows[i]))
+                    {
+                        m_sharedBlock[i] = 1;
+                        std::fill_n(sharedBlockCoeff.get() + cnt, m_rows[i],
+                                    1);
+                    }
+                }
+            }
+
+            int nShared = std::count(sharedBlockCoeff.begin(),
+                                     sharedBlockCoeff.end(), 1);
+            m_sharedLocal   = Array<OneD, unsigned int>(nShared);
+            m_interiorLocal = Array<OneD, unsigned int>(nLocal - nShared);
+            for (int i = 0, j = 0, k = 0; i < nLocal; ++i)
+            {
+                if (sharedBlockCoeff[i])
+                {
+                    m_sharedLocal[j++] = i;
+                }
+                else
+                {
+                    m_interiorLocal[k++] = i;
+                }
+            }
+        }
+
+        /**
+         * Stores the Schur complement blocks in single precision, with their
+         * scaling factor applied, for mixed-precision iterative refinement.
+         * With batched storage only the distinct blocks are copied and they
+         * remain shared between elements; otherwise each element has its own
+         * block. The double-precision blocks are released afterwards by
+         * PrepareLocalSchurComplement.
+         */
+        void GlobalLinSysIterativeStaticCond::
+            PrepareSinglePrecisionSchurComplement()
+        {
+            size_t storageSize = 0;
+
+            if (m_storageStrategy == eBatched)
+            {
+                int nUnique  = m_denseBlocks.size();
+                m_floatRows  = m_rows;
+                m_floatStart = m_batchStart;
+                m_floatElmt  = m_batchElmt;
+
+                for (int u = 0; u < nUnique; ++u)
+                {
+                    storageSize += m_rows[u] * m_rows[u];
+                }
+
+                m_floatStorage.resize(storageSize);
+                float *ptr = m_floatStorage.data();
+
+                for (int u = 0; u < nUnique; ++u)
+                {
+                    const int blockSize = m_rows[u] * m_rows[u];
+                    for (int i = 0; i < blockSize; ++i)
+                    {
+                        ptr[i] = static_cast<float>(m_denseBlocks[u][i]);
+                    }
+                    ptr += blockSize;
+                }
+                return;
+            }
+
+            int nBlk     = m_schurCompl->GetNumberOfBlockRows();
+            m_floatRows  = Array<OneD, unsigned int>(nBlk);
+            m_floatStart = Array<OneD, unsigned int>(nBlk+1);
+            m_floatElmt  = Array<OneD, unsigned int>(nBlk);
+
+            for (int n = 0, cnt = 0; n < nBlk; ++n)
+            {
+                m_floatRows [n] = m_schurCompl->GetBlock(n,n)->GetRows();
+                m_floatStart[n] = n;
+                m_floatElmt [n] = cnt;
+                cnt         += m_floatRows[n];
+                storageSize += m_floatRows[n] * m_floatRows[n];
+            }
+            m_floatStart[nBlk] = nBlk;
+
+            m_floatStorage.resize(storageSize);
+            float *ptr = m_floatStorage.data();
+
+            for (int n = 0; n < nBlk; ++n)
+            {
+                DNekScalMatSharedPtr loc_mat = m_schurCompl->GetBlock(n,n);
+                const int loc_lda = m_floatRows[n];
+                for (int i = 0; i < loc_lda; ++i)
+                {
+                    for (int j = 0; j < loc_lda; ++j)
+                    {
+                        ptr[j*loc_lda+i] = static_cast<float>((*loc_mat)(i,j));
+                    }
+                }
+                ptr += loc_lda * loc_lda;
+            }
+        }
+
+        /**
+         * Populates the batched storage of the Schur complement. Blocks which
+         * agree to within a relative tolerance, as happens for elements of
+         * identical shape and size on regular meshes, are stored once. The
+         * distinct blocks are stored contiguously, sorted by size, with their
+         * scaling factor applied. A block shared by several elements is then
+         * applied to all of them with a single Dgemm call.
+         */
+        void GlobalLinSysIterativeStaticCond::PrepareBatchedSchurComplement()
+        {
+            int nBlk = m_schurCompl->GetNumberOfBlockRows();
+
+            // Candidate blocks are looked up by their size and a coarse
+            // quantisation of their trace and sum of squares, and then
+            // compared entry by entry.
+            auto quantise = [](NekDouble x, std::vector<long long> &key)
+            {
+                int e;
+                NekDouble m = frexp(x, &e);
+                key.push_back(llround(ldexp(m, 24)));
+                key.push_back(e);
+            };
+
+            std::map<std::vector<long long>, std::vector<int> > buckets;
+            std::vector<int>                   blockOf(nBlk);
+            std::vector<unsigned int>          uniqueRows;
+            std::vector<std::vector<NekDouble> > uniqueData;
+            Array<OneD, unsigned int>          offsets(nBlk, 0U);
+            DNekScalMatSharedPtr               loc_mat;
+
+            for (int n = 0, cnt = 0; n < nBlk; ++n)
+            {
+                loc_mat    = m_schurCompl->GetBlock(n,n);
+                int rows   = loc_mat->GetRows();
+                offsets[n] = cnt;
+                cnt       += rows;
+
+                // Column-major copy of the scaled block
+                std::vector<NekDouble> data(rows*rows);
+                NekDouble trace = 0.0, sumsq = 0.0, maxval = 0.0;
+                for (int j = 0; j < rows; ++j)
+                {
+                    for (int i = 0; i < rows; ++i)
+                    {
+                        NekDouble v = (*loc_mat)(i,j);
+                        data[j*rows+i] = v;
+                        sumsq  += v*v;
+                        maxval  = max(maxval, fabs(v));
+                    }
+                    trace += data[j*rows+j];
+                }
+
+                std::vector<long long> key(1, rows);
+                quantise(trace, key);
+                quantise(sumsq, key);
+
+                std::vector<int> &bucket = buckets[key];
+                int match = -1;
+                for (auto &u : bucket)
+                {
+                    const std::vector<NekDouble> &other = uniqueData[u];
+                    int i = 0;
+                    for (; i < rows*rows; ++i)
+                    {
+                        if (fabs(other[i] - data[i]) >
+                                NekConstants::kNekZeroTol * maxval)
+                        {
+                            break;
+                        }
+                    }
+                    if (i == rows*rows)
+                    {
+                        match = u;
+                        break;
+                    }
+                }
+
+                if (match < 0)
+                {
+                    match = uniqueData.size();
+                    bucket.push_back(match);
+                    uniqueRows.push_back(rows);
+                    uniqueData.push_back(std::move(data));
+                }
+
+                blockOf[n] = match;
+                GlobalLinSys::v_DropStaticCondBlock(n);
+            }
+
+            // Order the distinct blocks by size so that blocks of equal size
+            // are contiguous in memory.
+            int nUnique = uniqueData.size();
+            std::vector<int> order(nUnique);
+            for (int u = 0; u < nUnique; ++u)
+            {
+                order[u] = u;
+            }
+            std::stable_sort(order.begin(), order.end(),
+                [&](int a, int b)
+                {
+                    return uniqueData[a].size() < uniqueData[b].size();
+                });
+
+            std::vector<int> position(nUnique);
+            size_t storageSize = 0;
+            for (int u = 0; u < nUnique; ++u)
+            {
+                position[order[u]] = u;
+                storageSize       += uniqueData[order[u]].size();
+            }
+
+            m_storage.resize(storageSize);
+            m_denseBlocks.resize(nUnique);
+            m_rows       = Array<OneD, unsigned int>(nUnique, 0U);
+            m_scale      = Array<OneD, NekDouble>   (nUnique, 1.0);
+            m_batchStart = Array<OneD, unsigned int>(nUnique+1, 0U);
+            m_batchElmt  = Array<OneD, unsigned int>(nBlk, 0U);
+
+            double *ptr = m_storage.data();
+            for (int u = 0; u < nUnique; ++u)
+            {
+                const std::vector<NekDouble> &data = uniqueData[order[u]];
+                m_rows[u]        = uniqueRows[order[u]];
+                m_denseBlocks[u] = ptr;
+                std::copy(data.begin(), data.end(), ptr);
+                ptr += data.size();
+            }
+
+            // Compressed lists of the elements using each distinct block
+            for (int n = 0; n < nBlk; ++n)
+            {
+                m_batchStart[position[blockOf[n]]+1]++;
+            }
+            unsigned int maxSize = 0;
+            for (int u = 0; u < nUnique; ++u)
+            {
+                maxSize = max(maxSize, m_rows[u]*m_batchStart[u+1]);
+                m_batchStart[u+1] += m_batchStart[u];
+            }
+
+            std::vector<unsigned int> fill(m_batchStart.begin(),
+                                           m_batchStart.end() - 1);
+            for (int n = 0; n < nBlk; ++n)
+            {
+                m_batchElmt[fill[position[blockOf[n]]]++] = offsets[n];
+            }
+
+            m_batchWsp = Array<OneD, NekDouble>(2*maxSize);
+
+            if (m_verbose && m_root)
+            {
+                cout << "Batched Schur complement storage: " << nUnique
+                     << " distinct blocks for " << nBlk << " elements"
+                     << endl;
+            }
+        }
+
+        /**
+         * Apply the batched Schur complement to @p nVec local boundary
+         * vectors. The columns of all elements (and vectors) sharing a block
+         * are gathered into the workspace and multiplied with one Dgemm call.
+         */
+        void GlobalLinSysIterativeStaticCond::BatchedMultiply(
+                const int                     nVec,
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput,
+                const BlockSubset             pSubset)
+        {
+            int nLocal = m_locToGloMap.lock()->GetNumLocalBndCoeffs();
+
+            for (int u = 0; u < m_denseBlocks.size(); ++u)
+            {
+                const int rows  = m_rows[u];
+                int       start = m_batchStart[u];
+                int       end   = m_batchStart[u+1];
+
+                if (pSubset == eSharedBlocks)
+                {
+                    end   = start + m_batchShared[u];
+                }
+                else if (pSubset == eInteriorBlocks)
+                {
+                    start = start + m_batchShared[u];
+                }
+
+                const int nElmt = end - start;
+                if (nElmt == 0)
+                {
+                    continue;
+                }
+
+                if (nElmt*nVec == 1)
+                {
+                    const int off = m_batchElmt[start];
+                    Blas::Dgemv('N', rows, rows,
+                                1.0, m_denseBlocks[u], rows,
+                                pInput.get()+off, 1,
+                                0.0, pOutput.get()+off, 1);
+                    continue;
+                }
+
+                const int ncols = nElmt*nVec;
+                if (m_batchWsp.size() < 2*rows*ncols)
+                {
+                    m_batchWsp = Array<OneD, NekDouble>(2*rows*ncols);
+                }
+                NekDouble *x = m_batchWsp.get();
+                NekDouble *y = m_batchWsp.get() + rows*ncols;
+
+                for (int v = 0, c = 0; v < nVec; ++v)
+                {
+                    for (int e = 0; e < nElmt; ++e, ++c)
+                    {
+                        Vmath::Vcopy(rows,
+                                     pInput.get()+v*nLocal+m_batchElmt[start+e],
+                                     1, x+c*rows, 1);
+                    }
+                }
+
+                Blas::Dgemm('N', 'N', rows, ncols, rows,
+                            1.0, m_denseBlocks[u], rows, x, rows,
+                            0.0, y, rows);
+
+                for (int v = 0, c = 0; v < nVec; ++v)
+                {
+                    for (int e = 0; e < nElmt; ++e, ++c)
+                    {
+                        Vmath::Vcopy(rows, y+c*rows, 1,
+                                     pOutput.get()+v*nLocal+m_batchElmt[start+e],
+                                     1);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Apply the single-precision Schur complement blocks to a local
+         * boundary vector. During the inner solves of mixed-precision
+         * refinement (#m_lowPrecisionSolve), the vectors of the elements
+         * sharing a block are converted to single precision side by side and
+         * multiplied with one Sgemv or Sgemm call, and the result is returned
+         * in double precision. Otherwise, as for the refinement residual,
+         * the block entries are promoted to double precision and the products
+         * are accumulated in double precision, so that the residual of the
+         * stored operator is computed to double-precision accuracy.
+         */
+        void GlobalLinSysIterativeStaticCond::SinglePrecisionMultiply(
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput,
+                const BlockSubset             pSubset)
+        {
+            const float *next = m_floatStorage.data();
+
+            for (int u = 0; u < m_floatRows.size(); ++u)
+            {
+                const int rows  = m_floatRows[u];
+                int       start = m_floatStart[u];
+                int       end   = m_floatStart[u+1];
+
+                const float *block = next;
+                next += rows*rows;
+
+                if (pSubset == eSharedBlocks)
+                {
+                    end   = start + m_floatShared[u];
+                }
+                else if (pSubset == eInteriorBlocks)
+                {
+                    start = start + m_floatShared[u];
+                }
+
+                const int nElmt = end - start;
+                if (nElmt == 0)
+                {
+                    continue;
+                }
+
+                if (!m_lowPrecisionSolve)
+                {
+                    for (int e = 0; e < nElmt; ++e)
+                    {
+                        const NekDouble *in  =
+                            pInput.get()  + m_floatElmt[start+e];
+                        NekDouble       *out =
+                            pOutput.get() + m_floatElmt[start+e];
+
+                        std::fill_n(out, rows, 0.0);
+                        for (int j = 0; j < rows; ++j)
+                        {
+                            const float    *col = block + j*rows;
+                            const NekDouble  xj = in[j];
+                            for (int i = 0; i < rows; ++i)
+                            {
+                                out[i] += static_cast<NekDouble>(col[i]) * xj;
+                            }
+                        }
+                    }
+                    continue;
+                }
+
+                const size_t wspSize = 2*rows*nElmt;
+                if (m_floatWsp.size() < wspSize)
+                {
+                    m_floatWsp.resize(wspSize);
+                }
+                float *x = m_floatWsp.data();
+                float *y = m_floatWsp.data() + rows*nElmt;
+
+                for (int e = 0; e < nElmt; ++e)
+                {
+                    const NekDouble *in = pInput.get() + m_floatElmt[start+e];
+                    for (int i = 0; i < rows; ++i)
+                    {
+                        x[e*rows+i] = static_cast<float>(in[i]);
+                    }
+                }
+
+                if (nElmt == 1)
+                {
+                    Blas::Sgemv('N', rows, rows,
+                                1.0f, block, rows, x, 1,
+                                0.0f, y, 1);
+                }
+                else
+                {
+                    Blas::Sgemm('N', 'N', rows, nElmt, rows,
+                                1.0f, block, rows, x, rows,
+                                0.0f, y, rows);
+                }
+
+                for (int e = 0; e < nElmt; ++e)
+                {
+                    NekDouble *out = pOutput.get() + m_floatElmt[start+e];
+                    for (int i = 0; i < rows; ++i)
+                    {
+                        out[i] = y[e*rows+i];
+                    }
+                }
+            }
+        }
+
+        /**
+         * Apply the dense Schur complement blocks of the selected subset of
+         * elements to a local boundary vector, using direct BLAS calls.
+         */
+        void GlobalLinSysIterativeStaticCond::DenseMultiply(
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput,
+                const BlockSubset             pSubset)
+        {
+            int i, cnt;
+            for (i = cnt = 0; i < m_denseBlocks.size(); cnt += m_rows[i], ++i)
+            {
+                if ((pSubset == eSharedBlocks   && !m_sharedBlock[i]) ||
+                    (pSubset == eInteriorBlocks &&  m_sharedBlock[i]))
+                {
+                    continue;
+                }
+
+                const int rows = m_rows[i];
+                Blas::Dgemv('N', rows, rows,
+                            m_scale[i], m_denseBlocks[i], rows,
+                            pInput.get()+cnt, 1,
+                            0.0, pOutput.get()+cnt, 1);
+            }
+        }
+
+        /**
+         * Add the local coefficients listed in @p pLocal to the global
+         * boundary vector, applying the sign changes of the assembly map.
+         */
+        void GlobalLinSysIterativeStaticCond::AssembleSubset(
+                const Array<OneD, const unsigned int> &pLocal,
+                const Array<OneD, const NekDouble>    &pInput,
+                      Array<OneD,       NekDouble>    &pOutput)
+        {
+            AssemblyMapSharedPtr asmMap = m_locToGloMap.lock();
+            const Array<OneD, const int> &map =
+                asmMap->GetLocalToGlobalBndMap();
+
+            if (asmMap->GetSignChange())
+            {
+                Array<OneD, const NekDouble> sign =
+                    asmMap->GetLocalToGlobalBndSign();
+                for (int i = 0; i < pLocal.size(); ++i)
+                {
+                    const unsigned int l = pLocal[i];
+                    pOutput[map[l]] += sign[l] * pInput[l];
+                }
+            }
+            else
+            {
+                for (int i = 0; i < pLocal.size(); ++i)
+                {
+                    const unsigned int l = pLocal[i];
+                    pOutput[map[l]] += pInput[l];
+                }
+            }
+        }
+
+        /**
+         * Apply the Schur complement to a global boundary vector. In
+         * parallel with dense or batched storage, the blocks touching
+         * coefficients shared with other processes are applied and
+         * assembled first. The exchange of the shared coefficients is then
+         * started and the remaining blocks are applied while it is in
+         * progress, since they only contribute to coefficients which are
+         * not exchanged.
          */
         void GlobalLinSysIterativeStaticCond::v_DoMatrixMultiply(
                 const Array<OneD, NekDouble>& pInput,
@@ -396,32 +1030,174 @@ namespace Nektar
         {
             int nLocal = m_locToGloMap.lock()->GetNumLocalBndCoeffs();
             AssemblyMapSharedPtr asmMap = m_locToGloMap.lock();
+            Array<OneD, NekDouble> tmp = m_wsp + nLocal;
 
-            if (m_sparseSchurCompl)
+            const bool singlePrecision = !m_floatStorage.empty();
+
+            asmMap->GlobalToLocalBnd(pInput, m_wsp);
+
+            if (m_overlapExchange)
             {
-                // Do matrix multiply locally using block-diagonal sparse matrix
-                Array<OneD, NekDouble> tmp = m_wsp + nLocal;
+                Vmath::Zero(asmMap->GetNumGlobalBndCoeffs(), pOutput, 1);
+
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    const BlockSubset subset =
+                        pass == 0 ? eSharedBlocks : eInteriorBlocks;
 
-                asmMap->GlobalToLocalBnd(pInput, m_wsp);
+                    if (singlePrecision)
+                    {
+                        SinglePrecisionMultiply(m_wsp, tmp, subset);
+                    }
+                    else if (m_storageStrategy == eBatched)
+                    {
+                        BatchedMultiply(1, m_wsp, tmp, subset);
+                    }
+                    else
+                    {
+                        DenseMultiply(m_wsp, tmp, subset);
+                    }
+
+                    if (pass == 0)
+                    {
+                        AssembleSubset(m_sharedLocal, tmp, pOutput);
+                        asmMap->UniversalAssembleBndBegin(pOutput);
+                    }
+                    else
+                    {
+                        AssembleSubset(m_interiorLocal, tmp, pOutput);
+                        asmMap->UniversalAssembleBndEnd(pOutput);
+                    }
+                }
+                return;
+            }
+
+            if (singlePrecision)
+            {
+                // Do matrix multiply locally with single-precision blocks
+                SinglePrecisionMultiply(m_wsp, tmp);
+            }
+            else if (m_sparseSchurCompl)
+            {
+                // Do matrix multiply locally using block-diagonal sparse matrix
                 m_sparseSchurCompl->Multiply(m_wsp,tmp);
-                asmMap->AssembleBnd(tmp, pOutput);
+            }
+            else if (m_storageStrategy == eBatched)
+            {
+                // Do matrix multiply locally, sharing blocks between elements
+                BatchedMultiply(1, m_wsp, tmp);
+            }
+            else
+            {
+                // Do matrix multiply locally, using direct BLAS calls
+                DenseMultiply(m_wsp, tmp);
+            }
+
+            asmMap->AssembleBnd(tmp, pOutput);
+        }
+
+        /**
+         * Apply the Schur complement to several vectors. With dense local
+         * storage the vectors are scattered side by side, so that each
+         * elemental block is applied to all of them with one Dgemm call and
+         * read from memory only once. The results are assembled with a
+         * single gather-scatter exchange.
+         */
+        void GlobalLinSysIterativeStaticCond::v_DoMatrixMultiplyMultiRHS(
+                const Array<OneD, Array<OneD, NekDouble> >& pInput,
+                      Array<OneD, Array<OneD, NekDouble> >& pOutput)
+        {
+            int nRHS = pInput.size();
+
+            if (m_sparseSchurCompl || !m_floatStorage.empty() || nRHS < 2)
+            {
+                for (int n = 0; n < nRHS; ++n)
+                {
+                    v_DoMatrixMultiply(pInput[n], pOutput[n]);
+                }
+                return;
+            }
+
+            int nLocal = m_locToGloMap.lock()->GetNumLocalBndCoeffs();
+            AssemblyMapSharedPtr asmMap = m_locToGloMap.lock();
+
+            Array<OneD, NekDouble> locIn (nRHS*nLocal);
+            Array<OneD, NekDouble> locOut(nRHS*nLocal);
+            Array<OneD, Array<OneD, NekDouble> > tmpout(nRHS);
+            Array<OneD, NekDouble> tmp;
+
+            for (int n = 0; n < nRHS; ++n)
+            {
+                asmMap->GlobalToLocalBnd(pInput[n], tmp = locIn + n*nLocal);
+                tmpout[n] = locOut + n*nLocal;
+            }
+
+            if (m_storageStrategy == eBatched)
+            {
+                BatchedMultiply(nRHS, locIn, locOut);
             }
             else
             {
                 // Do matrix multiply locally, using direct BLAS calls
-                asmMap->GlobalToLocalBnd(pInput, m_wsp);
                 int i, cnt;
-                Array<OneD, NekDouble> tmpout = m_wsp + nLocal;
-                for (i = cnt = 0; i < m_denseBlocks.size(); cnt += m_rows[i], ++i)
+                for (i = cnt = 0; i < m_denseBlocks.size();
+                     cnt += m_rows[i], ++i)
                 {
                     const int rows = m_rows[i];
-                    Blas::Dgemv('N', rows, rows,
+                    Blas::Dgemm('N', 'N', rows, nRHS, rows,
                                 m_scale[i], m_denseBlocks[i], rows,
-                                m_wsp.get()+cnt, 1,
-                                0.0, tmpout.get()+cnt, 1);
+                                locIn.get()+cnt, nLocal,
+                                0.0, locOut.get()+cnt, nLocal);
                 }
-                asmMap->AssembleBnd(tmpout, pOutput);
             }
+
+            asmMap->AssembleBnd(tmpout, pOutput);
+        }
+
+        /**
+         * Apply the local Schur complement to a local boundary vector, for
+         * the Dirichlet forcing. The single-precision blocks are used when
+         * the double-precision ones have been released.
+         */
+        void GlobalLinSysIterativeStaticCond::v_SchurComplMultiply(
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput)
+        {
+            if (m_floatStorage.empty())
+            {
+                GlobalLinSysStaticCond::v_SchurComplMultiply(pInput, pOutput);
+            }
+            else
+            {
+                SinglePrecisionMultiply(pInput, pOutput);
+            }
+        }
+
+        /**
+         * With InitialGuessExtrapolation, stores the global boundary values
+         * of the initial guess, so that full solutions are extrapolated.
+         */
+        void GlobalLinSysIterativeStaticCond::v_SetInitialGuess(
+                const int                           pRHS,
+                const Array<OneD, const NekDouble> &pLocBnd)
+        {
+            if (m_extrapOrder == 0)
+            {
+                return;
+            }
+
+            AssemblyMapSharedPtr asmMap = m_locToGloMap.lock();
+            Array<OneD, NekDouble> &offset = ExtrapolationOffset(
+                m_extrapSlot + pRHS, asmMap->GetNumGlobalBndCoeffs());
+
+            // The guess is continuous, so no exchange is needed.
+            asmMap->LocalBndToGlobal(pLocBnd, offset, false);
+        }
+
+        void GlobalLinSysIterativeStaticCond::v_SelectRHS(const int pRHS)
+        {
+            GlobalLinSysIterative::v_SelectRHS(pRHS);
+            GlobalLinSysStaticCond::v_SelectRHS(pRHS);
         }
 
         void GlobalLinSysIterativeStaticCond::v_UniqueMap()
@@ -56,14 +56,16 @@ namespace Nektar
             eNoStrategy,
             eContiguous,
             eNonContiguous,
-            eSparse
+            eSparse,
+            eBatched
         };
 
         const char* const LocalMatrixStorageStrategyMap[] =
         {
             "Contiguous",
             "Non-contiguous",
-            "Sparse"
+            "Sparse",
+            "Batched"
         };
 
 
@@ -135,6 +137,14 @@ namespace Nektar
                 Array<OneD, NekDouble>& pOutput);
 
         private:
+            /// Subsets of the local Schur complement blocks to apply.
+            enum BlockSubset
+            {
+                eAllBlocks,
+                eSharedBlocks,
+                eInteriorBlocks
+            };
+
             /// Dense storage for block Schur complement matrix
             std::vector<double>                      m_storage;
             /// Vector of pointers to local matrix data
@@ -145,6 +155,40 @@ namespace Nektar
             Array<OneD, NekDouble>                   m_scale;
             /// Sparse representation of Schur complement matrix at this level
             DNekSmvBsrDiagBlkMatSharedPtr            m_sparseSchurCompl;
+            /// Storage strategy of the local Schur complement matrices
+            LocalMatrixStorageStrategy               m_storageStrategy;
+            /// For batched storage, the elements applying each distinct block
+            /// are m_batchElmt[m_batchStart[i]] to m_batchElmt[m_batchStart[i+1]-1]
+            Array<OneD, unsigned int>                m_batchStart;
+            /// Offset of each element in the local boundary vector
+            Array<OneD, unsigned int>                m_batchElmt;
+            /// Workspace for gathering the vectors of elements sharing a block
+            Array<OneD, NekDouble>                   m_batchWsp;
+            /// Single-precision copy of the local Schur complement blocks,
+            /// applied during the inner solves of mixed-precision refinement
+            std::vector<float>                       m_floatStorage;
+            /// Ranks of the single-precision blocks
+            Array<OneD, unsigned int>                m_floatRows;
+            /// Local offsets of the elements applying each single-precision
+            /// block, stored in the same way as for batched storage
+            Array<OneD, unsigned int>                m_floatStart;
+            Array<OneD, unsigned int>                m_floatElmt;
+            /// Single-precision workspace
+            std::vector<float>                       m_floatWsp;
+            /// Whether the exchange of the assembled result overlaps with
+            /// the blocks which do not touch shared coefficients
+            bool                                     m_overlapExchange;
+            /// 1 for dense blocks touching coefficients shared with other
+            /// processes, 0 otherwise
+            Array<OneD, int>                         m_sharedBlock;
+            /// Number of elements of each batched (single-precision) block
+            /// touching shared coefficients, which are listed first
+            Array<OneD, unsigned int>                m_batchShared;
+            Array<OneD, unsigned int>                m_floatShared;
+            /// Local coefficients of the blocks touching shared coefficients
+            /// and of the remaining blocks
+            Array<OneD, unsigned int>                m_sharedLocal;
+            Array<OneD, unsigned int>                m_interiorLocal;
             /// Utility strings
             static std::string                       storagedef;
             static std::string                       storagelookupIds[];
@@ -159,11 +203,69 @@ namespace Nektar
             /// stored as a sparse block-diagonal matrix.
             void PrepareLocalSchurComplement();
 
+            /// Stores the distinct Schur complement blocks contiguously,
+            /// grouped by size.
+            void PrepareBatchedSchurComplement();
+
+            /// Stores a single-precision copy of the Schur complement
+            /// blocks for mixed-precision solves.
+            void PrepareSinglePrecisionSchurComplement();
+
+            /// Finds the blocks touching coefficients shared with other
+            /// processes, which are applied before the exchange starts.
+            void PrepareSharedBlocks();
+
+            /// Apply the single-precision Schur complement blocks to a local
+            /// vector, in single or double-precision arithmetic.
+            void SinglePrecisionMultiply(
+                    const Array<OneD, NekDouble> &pInput,
+                          Array<OneD, NekDouble> &pOutput,
+                    const BlockSubset             pSubset = eAllBlocks);
+
+            /// Apply the batched Schur complement storage to @p nVec local
+            /// vectors stored one after the other.
+            void BatchedMultiply(
+                    const int                     nVec,
+                    const Array<OneD, NekDouble> &pInput,
+                          Array<OneD, NekDouble> &pOutput,
+                    const BlockSubset             pSubset = eAllBlocks);
+
+            /// Apply the dense Schur complement blocks to a local vector.
+            void DenseMultiply(
+                    const Array<OneD, NekDouble> &pInput,
+                          Array<OneD, NekDouble> &pOutput,
+                    const BlockSubset             pSubset = eAllBlocks);
+
+            /// Add the local coefficients @p pLocal of a subset of blocks
+            /// to the global vector.
+            void AssembleSubset(
+                    const Array<OneD, const unsigned int> &pLocal,
+                    const Array<OneD, const NekDouble>    &pInput,
+                          Array<OneD,       NekDouble>    &pOutput);
+
             /// Perform a Shur-complement matrix multiply operation.
             virtual void v_DoMatrixMultiply(
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
 
+            /// Perform a Schur-complement matrix multiply operation on
+            /// several vectors at once.
+            virtual void v_DoMatrixMultiplyMultiRHS(
+                    const Array<OneD, Array<OneD, NekDouble> >& pInput,
+                          Array<OneD, Array<OneD, NekDouble> >& pOutput);
+
+            /// Apply the local Schur complement blocks to a local boundary
+            /// vector.
+            virtual void v_SchurComplMultiply(
+                    const Array<OneD, NekDouble> &pInput,
+                          Array<OneD, NekDouble> &pOutput);
+
+            virtual void v_SetInitialGuess(
+                    const int                           pRHS,
+                    const Array<OneD, const NekDouble> &pLocBnd);
+
+            virtual void v_SelectRHS(const int pRHS);
+
             virtual void v_UniqueMap();
         };
     }
@@ -170,12 +170,11 @@ namespace Nektar
                     // Transform to new basis if required 
                     v_BasisFwdTransform(F_bnd);
 
-                    DNekScalBlkMat &SchurCompl = *m_schurCompl;
-
                     v_CoeffsFwdTransform(V_bnd,V_bnd);
+                    v_SetInitialGuess(0, V_bnd);
                         
                     // subtract dirichlet boundary forcing
-                    F_Bnd = SchurCompl*V_Bnd;
+                    v_SchurComplMultiply(V_bnd, F_bnd1);
 
                     Vmath::Vsub(nLocBndDofs, F_bnd,1, F_bnd1, 1, F_bnd,1);
 
@@ -237,6 +236,154 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve the system for several right-hand sides. The boundary forcing
+         * of each right-hand side is constructed as in v_Solve, after which
+         * the Schur complement systems of all right-hand sides are passed to
+         * SolveLinearSystemMultiRHS together and the interior solutions are
+         * recovered. Multi-level static condensation solves for each
+         * right-hand side in turn.
+         */
+        void GlobalLinSysStaticCond::v_SolveMultiRHS(
+            const Array<OneD, const Array<OneD, NekDouble> > &pLocInput,
+                  Array<OneD,       Array<OneD, NekDouble> > &pLocOutput,
+            const AssemblyMapSharedPtr                       &pLocToGloMap)
+        {
+            int nRHS = pLocInput.size();
+
+            if (!pLocToGloMap->AtLastLevel() || nRHS < 2)
+            {
+                for (int n = 0; n < nRHS; ++n)
+                {
+                    v_SelectRHS(n);
+                    v_Solve(pLocInput[n], pLocOutput[n], pLocToGloMap);
+                }
+                v_SelectRHS(0);
+                return;
+            }
+
+            int  scLevel           = pLocToGloMap->GetStaticCondLevel();
+
+            int nGlobDofs    = pLocToGloMap->GetNumGlobalCoeffs();
+            int nLocBndDofs  = pLocToGloMap->GetNumLocalBndCoeffs();
+            int nGlobBndDofs = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs  = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nIntDofs     = nGlobDofs - nGlobBndDofs;
+
+            if((nGlobDofs-nDirBndDofs) == 0)
+            {
+                return; //nothing to solve;
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > F_bnd(nRHS), V_bnd(nRHS);
+            Array<OneD, Array<OneD, NekDouble> > F_int(nRHS), F_glo(nRHS);
+            Array<OneD, Array<OneD, NekDouble> > pert(nRHS);
+            Array<OneD, NekDouble> F_bnd1(nLocBndDofs);
+            NekVector<NekDouble>   F_Bnd1(nLocBndDofs, F_bnd1, eWrapper);
+
+            // Construct the boundary forcing of each right-hand side
+            for (int n = 0; n < nRHS; ++n)
+            {
+                V_bnd[n] = Array<OneD, NekDouble>(nLocBndDofs);
+                F_int[n] = Array<OneD, NekDouble>(nIntDofs);
+
+                pLocToGloMap->LocalToLocalBnd(pLocOutput[n], V_bnd[n]);
+
+                if(nIntDofs)
+                {
+                    m_locToGloMap.lock()->LocalToLocalInt(pLocInput[n],
+                                                          F_int[n]);
+                }
+
+                if(nGlobBndDofs-nDirBndDofs)
+                {
+                    F_bnd[n] = Array<OneD, NekDouble>(nLocBndDofs);
+                    pLocToGloMap->LocalToLocalBnd(pLocInput[n], F_bnd[n]);
+
+                    // set up normalisation factor for right hand side
+                    v_PreSolve(scLevel, F_bnd[n]);
+
+                    NekVector<NekDouble> F_Int(nIntDofs, F_int[n], eWrapper);
+
+                    // construct boundary forcing
+                    if(nIntDofs)
+                    {
+                        DNekScalBlkMat &BinvD = *m_BinvD;
+
+                        F_Bnd1 = BinvD*F_Int;
+
+                        Vmath::Vsub(nLocBndDofs, F_bnd[n], 1, F_bnd1, 1,
+                                    F_bnd[n], 1);
+                    }
+
+                    // Transform to new basis if required
+                    v_BasisFwdTransform(F_bnd[n]);
+
+                    v_CoeffsFwdTransform(V_bnd[n], V_bnd[n]);
+                    v_SetInitialGuess(n, V_bnd[n]);
+
+                    // subtract dirichlet boundary forcing
+                    v_SchurComplMultiply(V_bnd[n], F_bnd1);
+
+                    Vmath::Vsub(nLocBndDofs, F_bnd[n], 1, F_bnd1, 1,
+                                F_bnd[n], 1);
+
+                    F_glo[n] = Array<OneD, NekDouble>(nGlobBndDofs);
+                    pert [n] = Array<OneD, NekDouble>(nGlobBndDofs, 0.0);
+
+                    pLocToGloMap->AssembleBnd(F_bnd[n], F_glo[n]);
+                }
+            }
+
+            // Boundary system solution of all right-hand sides
+            if(nGlobBndDofs-nDirBndDofs)
+            {
+                SolveLinearSystemMultiRHS(nGlobBndDofs, F_glo, pert,
+                                          pLocToGloMap, nDirBndDofs);
+            }
+
+            for (int n = 0; n < nRHS; ++n)
+            {
+                if(nGlobBndDofs-nDirBndDofs)
+                {
+                    Array<OneD, NekDouble> outloc = F_bnd[n];
+                    pLocToGloMap->GlobalToLocalBnd(pert[n], outloc);
+
+                    // Add back initial conditions onto difference
+                    Vmath::Vadd(nLocBndDofs, V_bnd[n], 1, outloc, 1,
+                                V_bnd[n], 1);
+
+                    // Transform back to original basis
+                    v_CoeffsBwdTransform(V_bnd[n]);
+
+                    // put final bnd solution back in output array
+                    m_locToGloMap.lock()->LocalBndToLocal(V_bnd[n],
+                                                          pLocOutput[n]);
+                }
+
+                // solve interior system
+                if(nIntDofs)
+                {
+                    Array<OneD, NekDouble> V_int(nIntDofs);
+                    NekVector<NekDouble>   V_Int(nIntDofs, V_int, eWrapper);
+                    NekVector<NekDouble>   F_Int(nIntDofs, F_int[n], eWrapper);
+                    NekVector<NekDouble>   V_Bnd(nLocBndDofs, V_bnd[n],
+                                                 eWrapper);
+
+                    // get array of local solutions
+                    DNekScalBlkMat &invD  = *m_invD;
+                    DNekScalBlkMat &C     = *m_C;
+
+                    F_Int = F_Int - C*V_Bnd;
+
+                    Multiply(V_Int, invD, F_Int);
+
+                    m_locToGloMap.lock()->LocalIntToLocal(V_int,
+                                                          pLocOutput[n]);
+                }
+            }
+        }
+
         /**
          * If at the last level of recursion (or the only level in the case of
          * single-level static condensation), assemble the Schur complement.
@@ -269,6 +416,28 @@ namespace Nektar
             return m_schurCompl->GetNumberOfBlockRows();
         }
 
+        /**
+         * The selection is passed on to the next level, where the boundary
+         * system is solved.
+         */
+        void GlobalLinSysStaticCond::v_SelectRHS(const int pRHS)
+        {
+            if (m_recursiveSchurCompl)
+            {
+                m_recursiveSchurCompl->v_SelectRHS(pRHS);
+            }
+        }
+
+        void GlobalLinSysStaticCond::v_SchurComplMultiply(
+            const Array<OneD, NekDouble> &pInput,
+                  Array<OneD, NekDouble> &pOutput)
+        {
+            int nLocBndDofs = m_locToGloMap.lock()->GetNumLocalBndCoeffs();
+            NekVector<NekDouble> in (nLocBndDofs, pInput,  eWrapper);
+            NekVector<NekDouble> out(nLocBndDofs, pOutput, eWrapper);
+            out = (*m_schurCompl)*in;
+        }
+
         /**
          * For the first level in multi-level static condensation, or the only
          * level in the case of single-level static condensation, allocate the
@@ -90,6 +90,18 @@ namespace Nektar
                 boost::ignore_unused(pInput,pOutput);
             }
 
+            /// Informs the boundary system of the initial guess of
+            /// right-hand side @p pRHS, in the local boundary storage of the
+            /// last level, which its solution is computed relative to.
+            virtual void v_SetInitialGuess(
+                const int                           pRHS,
+                const Array<OneD, const NekDouble> &pLocBnd)
+            {
+                boost::ignore_unused(pRHS, pLocBnd);
+            }
+
+            virtual void v_SelectRHS(const int pRHS);
+
             virtual void v_AssembleSchurComplement(
                 std::shared_ptr<AssemblyMap> pLoctoGloMap)
             {
@@ -98,6 +110,12 @@ namespace Nektar
 
             virtual int v_GetNumBlocks();
 
+            /// Apply the Schur complement blocks of the last level to a
+            /// local boundary vector.
+            virtual void v_SchurComplMultiply(
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput);
+
             virtual GlobalLinSysStaticCondSharedPtr v_Recurse(
                 const GlobalLinSysKey                &mkey,
                 const std::weak_ptr<ExpList>         &pExpList,
@@ -131,6 +149,13 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides, sharing
+            /// the boundary system solve between them.
+            virtual void v_SolveMultiRHS(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
             virtual void v_InitObject();
 
             /// Initialise this object
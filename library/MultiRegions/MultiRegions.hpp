@@ -118,7 +118,9 @@ namespace Nektar
             eLowEnergy,
             eLinearWithLowEnergy,
             eBlock,
-            eLinearWithBlock
+            eLinearWithBlock,
+            ePMultigrid,
+            eChebyshev
         };
 
         const char* const PreconditionerTypeMap[] =
@@ -130,7 +132,27 @@ namespace Nektar
             "LowEnergyBlock",
             "FullLinearSpaceWithLowEnergyBlock",
             "Block",
-            "FullLinearSpaceWithBlock"
+            "FullLinearSpaceWithBlock",
+            "PMultigrid",
+            "Chebyshev"
+        };
+
+        /// Krylov method used by the iterative global linear systems.
+        enum IterativeMethodType
+        {
+            eConjugateGradient,
+            ePipelinedConjugateGradient,
+            eGMRES,
+            eBiCGStab,
+            eSIZE_IterativeMethodType
+        };
+
+        const char* const IterativeMethodTypeMap[] =
+        {
+            "ConjugateGradient",
+            "PipelinedConjugateGradient",
+            "GMRES",
+            "BiCGStab"
         };
 
 
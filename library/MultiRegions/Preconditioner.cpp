@@ -37,13 +37,14 @@
 #include <MultiRegions/Preconditioner.h>
 #include <MultiRegions/GlobalMatrixKey.h>
 #include <LocalRegions/MatrixKey.h>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
 #include <cmath>
 
 namespace Nektar
 {
     namespace MultiRegions
     {
-        std::string Preconditioner::lookupIds[8] = {
+        std::string Preconditioner::lookupIds[10] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "Preconditioner", "Null", eNull),
             LibUtilities::SessionReader::RegisterEnumValue(
@@ -62,6 +63,10 @@ namespace Nektar
                 "Preconditioner", "Block",eBlock),
             LibUtilities::SessionReader::RegisterEnumValue(
                 "Preconditioner", "FullLinearSpaceWithBlock",eLinearWithBlock),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "Preconditioner", "PMultigrid", ePMultigrid),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "Preconditioner", "Chebyshev", eChebyshev),
         };
         std::string Preconditioner::def =
             LibUtilities::SessionReader::RegisterDefaultSolverInfo(
@@ -177,6 +182,115 @@ namespace Nektar
             return loc_mat;
         }
 
+        /**
+         * @brief Store a single-precision copy of the block-diagonal matrix
+         * \p pMat for use by MultiplySinglePrecisionBlkMat. Blocks with
+         * diagonal storage, such as the vertex block, are kept diagonal.
+         */
+        void Preconditioner::SetSinglePrecisionBlkMat(
+            const DNekBlkMatSharedPtr &pMat)
+        {
+            int nBlk = pMat->GetNumberOfBlockRows();
+            size_t storageSize = 0;
+
+            m_floatBlkRows = Array<OneD, unsigned int>(nBlk, 0U);
+            m_floatBlkDiag = Array<OneD, int>         (nBlk, 0);
+
+            for (int i = 0; i < nBlk; ++i)
+            {
+                m_floatBlkRows[i] = pMat->GetNumberOfRowsInBlockRow(i);
+                if (m_floatBlkRows[i] == 0)
+                {
+                    continue;
+                }
+
+                m_floatBlkDiag[i] =
+                    pMat->GetBlock(i,i)->GetStorageType() == eDIAGONAL;
+                storageSize += m_floatBlkDiag[i] ? m_floatBlkRows[i] :
+                    m_floatBlkRows[i] * m_floatBlkRows[i];
+            }
+
+            m_floatBlkMat.resize(storageSize);
+            float *ptr = m_floatBlkMat.data();
+
+            for (int i = 0; i < nBlk; ++i)
+            {
+                const int rows = m_floatBlkRows[i];
+                if (rows == 0)
+                {
+                    continue;
+                }
+
+                DNekMatSharedPtr mat = pMat->GetBlock(i,i);
+                if (m_floatBlkDiag[i])
+                {
+                    for (int j = 0; j < rows; ++j)
+                    {
+                        ptr[j] = static_cast<float>((*mat)(j,j));
+                    }
+                    ptr += rows;
+                }
+                else
+                {
+                    for (int j = 0; j < rows; ++j)
+                    {
+                        for (int k = 0; k < rows; ++k)
+                        {
+                            ptr[k*rows+j] = static_cast<float>((*mat)(j,k));
+                        }
+                    }
+                    ptr += rows * rows;
+                }
+            }
+
+            m_floatBlkWsp.resize(2 * pMat->GetRows());
+        }
+
+        /**
+         * @brief Apply the single-precision block-diagonal matrix stored by
+         * SetSinglePrecisionBlkMat. The input is converted to single
+         * precision and the result is returned in double precision.
+         */
+        void Preconditioner::MultiplySinglePrecisionBlkMat(
+            const Array<OneD, NekDouble>& pInput,
+                  Array<OneD, NekDouble>& pOutput)
+        {
+            const int nRows = m_floatBlkWsp.size() / 2;
+            float *x = m_floatBlkWsp.data();
+            float *y = m_floatBlkWsp.data() + nRows;
+
+            for (int i = 0; i < nRows; ++i)
+            {
+                x[i] = static_cast<float>(pInput[i]);
+            }
+
+            const float *ptr = m_floatBlkMat.data();
+            for (int i = 0, cnt = 0; i < m_floatBlkRows.size(); ++i)
+            {
+                const int rows = m_floatBlkRows[i];
+                if (m_floatBlkDiag[i])
+                {
+                    for (int j = 0; j < rows; ++j)
+                    {
+                        y[cnt+j] = ptr[j] * x[cnt+j];
+                    }
+                    ptr += rows;
+                }
+                else if (rows > 0)
+                {
+                    Blas::Sgemv('N', rows, rows, 1.0f, ptr, rows,
+                                x + cnt, 1, 0.0f, y + cnt, 1);
+                    ptr += rows * rows;
+                }
+                cnt += rows;
+            }
+
+            for (int i = 0; i < nRows; ++i)
+            {
+                pOutput[i] = y[i];
+            }
+        }
+
         /**
          * @brief Performs global assembly of diagonal entries to global Schur
          * complement matrix.
@@ -43,6 +43,7 @@
 #include <MultiRegions/MultiRegionsDeclspec.h>
 
 #include <memory>
+#include <vector>
 
 namespace Nektar
 {
@@ -131,6 +132,22 @@ namespace Nektar
             std::weak_ptr<AssemblyMap>          m_locToGloMap;
             LibUtilities::CommSharedPtr         m_comm;
 
+            /// Single-precision copy of a block-diagonal preconditioner
+            /// matrix, used for mixed-precision solves
+            std::vector<float>                  m_floatBlkMat;
+            /// Ranks of the single-precision blocks
+            Array<OneD, unsigned int>           m_floatBlkRows;
+            /// Whether each single-precision block is stored as a diagonal
+            Array<OneD, int>                    m_floatBlkDiag;
+            /// Single-precision workspace
+            std::vector<float>                  m_floatBlkWsp;
+
+            void SetSinglePrecisionBlkMat(const DNekBlkMatSharedPtr &pMat);
+
+            void MultiplySinglePrecisionBlkMat(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput);
+
             virtual DNekScalMatSharedPtr v_TransformedSchurCompl(
                         int offset, int bndoffset,
                         const std::shared_ptr<DNekScalMat > &loc_mat);
@@ -92,6 +92,14 @@ namespace Nektar
             {
                 BlockPreconditionerCG();
             }
+
+            // For mixed-precision solves only a single-precision copy of the
+            // preconditioner is kept.
+            if (m_locToGloMap.lock()->GetLinSysMixedPrecision())
+            {
+                SetSinglePrecisionBlkMat(m_blkMat);
+                m_blkMat.reset();
+            }
         }
 
         /**
@@ -702,6 +710,13 @@ namespace Nektar
             int nDir    = m_locToGloMap.lock()->GetNumGlobalDirBndCoeffs();
             int nGlobal = m_locToGloMap.lock()->GetNumGlobalBndCoeffs();
             int nNonDir = nGlobal-nDir;
+
+            if (!m_blkMat)
+            {
+                MultiplySinglePrecisionBlkMat(pInput, pOutput);
+                return;
+            }
+
             DNekBlkMat &M = (*m_blkMat);
             NekVector<NekDouble> r(nNonDir,pInput,eWrapper);
             NekVector<NekDouble> z(nNonDir,pOutput,eWrapper);
@@ -0,0 +1,290 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerChebyshev.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Chebyshev polynomial preconditioner definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/VDmathArray.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <MultiRegions/PreconditionerChebyshev.h>
+#include <MultiRegions/GlobalLinSysIterative.h>
+#include <MultiRegions/ExpList.h>
+#include <cmath>
+#include <cstdint>
+
+using namespace std;
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Registers the class with the Factory.
+         */
+        string PreconditionerChebyshev::className
+                = GetPreconFactory().RegisterCreatorFunction(
+                    "Chebyshev",
+                    PreconditionerChebyshev::create,
+                    "Chebyshev polynomial preconditioning");
+
+        /**
+         * @class PreconditionerChebyshev
+         *
+         * This class implements a polynomial preconditioner which applies a
+         * fixed number of Chebyshev iterations, started from zero, to the
+         * diagonally scaled system. The result is a fixed polynomial of the
+         * Jacobi preconditioned operator, so that its application requires
+         * only operator evaluations and no global reductions.
+         *
+         * The polynomial is constructed on an interval bounded by the
+         * extreme eigenvalues of the scaled operator. These are estimated
+         * once by a few steps of the Lanczos process, carried out through
+         * the equivalent Jacobi preconditioned conjugate gradient
+         * recurrence. The upper bound is enlarged by 10%, since the
+         * preconditioner is only guaranteed to be positive definite if the
+         * interval contains the whole spectrum. Because the statically
+         * condensed operators are only finalised after the preconditioner
+         * is built, the estimate is made on the first application.
+         */
+        PreconditionerChebyshev::PreconditionerChebyshev(
+            const std::shared_ptr<GlobalLinSys> &plinsys,
+            const AssemblyMapSharedPtr          &pLocToGloMap)
+            : Preconditioner(plinsys, pLocToGloMap),
+              m_estimated(false),
+              m_lambdaMin(0.0),
+              m_lambdaMax(0.0)
+        {
+        }
+
+        /**
+         *
+         */
+        void PreconditionerChebyshev::v_InitObject()
+        {
+            std::shared_ptr<GlobalLinSysIterative> linsys =
+                std::dynamic_pointer_cast<GlobalLinSysIterative>(
+                    m_linsys.lock());
+            ASSERTL0(linsys, "Chebyshev preconditioner requires an "
+                             "iterative global linear system.");
+            m_iterLinsys = linsys;
+
+            LibUtilities::SessionReaderSharedPtr session =
+                m_linsys.lock()->GetLocMat().lock()->GetSession();
+            session->LoadParameter("ChebyshevDegree",       m_degree,       4);
+            session->LoadParameter("ChebyshevLanczosSteps", m_lanczosSteps, 20);
+            ASSERTL0(m_degree > 0 && m_lanczosSteps > 0,
+                     "Chebyshev degree and Lanczos steps must be positive.");
+
+            m_diagonalPrecon = GetPreconFactory().CreateInstance(
+                "Diagonal", m_linsys.lock(), m_locToGloMap.lock());
+
+            m_operator = std::bind(
+                &PreconditionerChebyshev::DoMatrixMultiply, this,
+                std::placeholders::_1, std::placeholders::_2);
+            m_jacobi   = std::bind(
+                &Preconditioner::DoPreconditioner, m_diagonalPrecon.get(),
+                std::placeholders::_1, std::placeholders::_2);
+        }
+
+        /**
+         *
+         */
+        void PreconditionerChebyshev::v_BuildPreconditioner()
+        {
+            m_diagonalPrecon->BuildPreconditioner();
+
+            int nGlobal, nDir;
+            GetSizes(nGlobal, nDir);
+            m_wk1 = Array<OneD, NekDouble>(nGlobal, 0.0);
+            m_wk2 = Array<OneD, NekDouble>(nGlobal, 0.0);
+            m_smoother.Initialise(nGlobal - nDir);
+
+            m_estimated = false;
+        }
+
+        /**
+         * Number of global degrees of freedom of the system and of these the
+         * number of Dirichlet degrees of freedom.
+         */
+        void PreconditionerChebyshev::GetSizes(int &nGlobal, int &nDir)
+        {
+            auto asmMap = m_locToGloMap.lock();
+
+            nGlobal = asmMap->GetGlobalSysSolnType() == eIterativeFull ?
+                asmMap->GetNumGlobalCoeffs() :
+                asmMap->GetNumGlobalBndCoeffs();
+            nDir    = asmMap->GetNumGlobalDirBndCoeffs();
+        }
+
+        /**
+         * Apply the operator of the linear system to a vector of the
+         * non-Dirichlet degrees of freedom.
+         */
+        void PreconditionerChebyshev::DoMatrixMultiply(
+            const Array<OneD, NekDouble> &pInput,
+                  Array<OneD, NekDouble> &pOutput)
+        {
+            int nGlobal, nDir;
+            GetSizes(nGlobal, nDir);
+            int nNonDir = nGlobal - nDir;
+
+            Vmath::Vcopy(nNonDir, pInput.get(), 1, m_wk1.get() + nDir, 1);
+            m_iterLinsys.lock()->DoMatrixMultiply(m_wk1, m_wk2);
+            Vmath::Vcopy(nNonDir, m_wk2.get() + nDir, 1, pOutput.get(), 1);
+        }
+
+        /**
+         * Inner product of two vectors of the non-Dirichlet degrees of
+         * freedom over all partitions.
+         */
+        NekDouble PreconditionerChebyshev::InnerProduct(
+            const Array<OneD, NekDouble> &pIn1,
+            const Array<OneD, NekDouble> &pIn2)
+        {
+            auto asmMap = m_locToGloMap.lock();
+            LibUtilities::CommSharedPtr comm =
+                m_linsys.lock()->GetLocMat().lock()->GetComm()->GetRowComm();
+
+            int nGlobal, nDir;
+            GetSizes(nGlobal, nDir);
+
+            Array<OneD, const int> map =
+                asmMap->GetGlobalSysSolnType() == eIterativeFull ?
+                asmMap->GetGlobalToUniversalMapUnique() :
+                asmMap->GetGlobalToUniversalBndMapUnique();
+
+            NekDouble result = Vmath::Dot2(nGlobal - nDir,
+                                           pIn1.get(), pIn2.get(),
+                                           map.get() + nDir);
+            comm->AllReduce(result, LibUtilities::ReduceSum);
+            return result;
+        }
+
+        /**
+         * Estimate the extreme eigenvalues of the Jacobi preconditioned
+         * operator from the Lanczos tridiagonal matrix, which is assembled
+         * from the coefficients of the preconditioned conjugate gradient
+         * method. The right hand side is derived from the universal
+         * numbering so that the estimate is independent of the partitioning.
+         */
+        void PreconditionerChebyshev::EstimateEigenvalues()
+        {
+            auto asmMap = m_locToGloMap.lock();
+
+            int nGlobal, nDir;
+            GetSizes(nGlobal, nDir);
+            int nNonDir = nGlobal - nDir;
+
+            Array<OneD, const int> univ =
+                asmMap->GetGlobalSysSolnType() == eIterativeFull ?
+                asmMap->GetGlobalToUniversalMap() :
+                asmMap->GetGlobalToUniversalBndMap();
+
+            Array<OneD, NekDouble> r(nNonDir), z(nNonDir), p(nNonDir),
+                                   q(nNonDir);
+            for (int i = 0; i < nNonDir; ++i)
+            {
+                r[i] = 0.5 + ((static_cast<std::uint64_t>(univ[nDir + i])
+                               * 7919) % 1009) / 1009.0;
+            }
+
+            m_diagonalPrecon->DoPreconditioner(r, z);
+            Vmath::Vcopy(nNonDir, z, 1, p, 1);
+            NekDouble rz = InnerProduct(r, z);
+
+            vector<NekDouble> diag, offDiag;
+            NekDouble alphaOld = 1.0, betaOld = 0.0;
+            for (int k = 0; k < m_lanczosSteps && rz > 0.0; ++k)
+            {
+                DoMatrixMultiply(p, q);
+                NekDouble pq = InnerProduct(p, q);
+                if (pq <= 0.0)
+                {
+                    break;
+                }
+                NekDouble alpha = rz / pq;
+
+                if (k > 0)
+                {
+                    offDiag.push_back(sqrt(betaOld) / alphaOld);
+                }
+                diag.push_back(1.0 / alpha + betaOld / alphaOld);
+
+                Vmath::Svtvp(nNonDir, -alpha, q, 1, r, 1, r, 1);
+                m_diagonalPrecon->DoPreconditioner(r, z);
+                NekDouble rzNew = InnerProduct(r, z);
+                NekDouble beta  = rzNew / rz;
+
+                Vmath::Svtvp(nNonDir, beta, p, 1, z, 1, p, 1);
+
+                rz       = rzNew;
+                alphaOld = alpha;
+                betaOld  = beta;
+            }
+
+            ASSERTL0(diag.size() > 0, "Unable to estimate the spectrum of "
+                                      "the operator; is it positive "
+                                      "definite?");
+
+            // Eigenvalues are returned in ascending order.
+            int n = diag.size(), info;
+            offDiag.push_back(0.0);
+            Lapack::Dsterf(n, &diag[0], &offDiag[0], info);
+            ASSERTL0(info == 0, "Dsterf failed to compute the Lanczos "
+                                "eigenvalues.");
+
+            // Targeting the smallest eigenvalues with a low degree polynomial
+            // degrades the approximation elsewhere, so these are left to the
+            // outer Krylov method.
+            m_lambdaMax = 1.1 * diag[n - 1];
+            m_lambdaMin = max(diag[0], m_lambdaMax / (m_degree * m_degree));
+            m_lambdaMin = min(m_lambdaMin, 0.5 * m_lambdaMax);
+            m_estimated = true;
+        }
+
+        /**
+         * Apply #m_degree Chebyshev iterations to the diagonally scaled
+         * system with right hand side @p pInput and a zero initial guess.
+         */
+        void PreconditionerChebyshev::v_DoPreconditioner(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            if (!m_estimated)
+            {
+                EstimateEigenvalues();
+            }
+
+            m_smoother.Smooth(m_degree, m_lambdaMin, m_lambdaMax,
+                              m_operator, m_jacobi, pInput, pOutput, true);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerChebyshev.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Chebyshev polynomial preconditioner header
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERCHEBYSHEV_H
+#define NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERCHEBYSHEV_H
+
+#include <MultiRegions/ChebyshevSmoother.h>
+#include <MultiRegions/GlobalLinSys.h>
+#include <MultiRegions/Preconditioner.h>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        class GlobalLinSysIterative;
+
+        class PreconditionerChebyshev;
+        typedef std::shared_ptr<PreconditionerChebyshev>
+            PreconditionerChebyshevSharedPtr;
+
+        class PreconditionerChebyshev: public Preconditioner
+        {
+        public:
+            /// Creates an instance of this class
+            static PreconditionerSharedPtr create(
+                const std::shared_ptr<GlobalLinSys> &plinsys,
+                const std::shared_ptr<AssemblyMap>  &pLocToGloMap)
+            {
+                PreconditionerSharedPtr p = MemoryManager<
+                    PreconditionerChebyshev>::AllocateSharedPtr(
+                        plinsys, pLocToGloMap);
+                p->InitObject();
+                return p;
+            }
+
+            /// Name of class
+            static std::string className;
+
+            MULTI_REGIONS_EXPORT PreconditionerChebyshev(
+                const std::shared_ptr<GlobalLinSys> &plinsys,
+                const AssemblyMapSharedPtr          &pLocToGloMap);
+
+            MULTI_REGIONS_EXPORT
+            virtual ~PreconditionerChebyshev() {}
+
+        protected:
+            PreconditionerSharedPtr              m_diagonalPrecon;
+            std::weak_ptr<GlobalLinSysIterative> m_iterLinsys;
+
+            /// Degree of the Chebyshev polynomial
+            int                                  m_degree;
+            /// Number of Lanczos steps used to estimate the spectrum
+            int                                  m_lanczosSteps;
+            /// Whether the spectral interval has been estimated
+            bool                                 m_estimated;
+            NekDouble                            m_lambdaMin;
+            NekDouble                            m_lambdaMax;
+
+            /// Work space for the operator, including Dirichlet entries
+            Array<OneD, NekDouble>               m_wk1;
+            Array<OneD, NekDouble>               m_wk2;
+            /// Chebyshev iteration and its work space
+            ChebyshevSmoother                    m_smoother;
+            /// Operator of the system and its diagonal preconditioner
+            ChebyshevSmoother::OperatorType      m_operator;
+            ChebyshevSmoother::OperatorType      m_jacobi;
+
+        private:
+            void GetSizes(int &nGlobal, int &nDir);
+
+            void DoMatrixMultiply(
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput);
+
+            NekDouble InnerProduct(
+                const Array<OneD, NekDouble> &pIn1,
+                const Array<OneD, NekDouble> &pIn2);
+
+            void EstimateEigenvalues();
+
+            virtual void v_InitObject();
+
+            virtual void v_DoPreconditioner(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput);
+
+            virtual void v_BuildPreconditioner();
+        };
+    }
+}
+
+#endif
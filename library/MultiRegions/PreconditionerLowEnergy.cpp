@@ -916,6 +916,14 @@ namespace Nektar
                     m_BlkMat->SetBlock(i,i,tmp_mat);
                 }
             }
+
+            // For mixed-precision solves only a single-precision copy of the
+            // preconditioner is kept.
+            if (m_locToGloMap.lock()->GetLinSysMixedPrecision())
+            {
+                SetSinglePrecisionBlkMat(m_BlkMat);
+                m_BlkMat.reset();
+            }
         }
 
 
@@ -930,6 +938,13 @@ namespace Nektar
             int nDir    = m_locToGloMap.lock()->GetNumGlobalDirBndCoeffs();
             int nGlobal = m_locToGloMap.lock()->GetNumGlobalBndCoeffs();
             int nNonDir = nGlobal-nDir;
+
+            if (!m_BlkMat)
+            {
+                MultiplySinglePrecisionBlkMat(pInput, pOutput);
+                return;
+            }
+
             DNekBlkMat &M = (*m_BlkMat);
 
             NekVector<NekDouble> r(nNonDir,pInput,eWrapper);
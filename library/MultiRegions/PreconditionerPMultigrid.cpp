@@ -0,0 +1,678 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerPMultigrid.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Polynomial multigrid preconditioner definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/VDmathArray.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <MultiRegions/PreconditionerPMultigrid.h>
+#include <MultiRegions/GlobalLinSysIterative.h>
+#include <MultiRegions/ExpList.h>
+#include <StdRegions/StdSegExp.h>
+#include <StdRegions/StdQuadExp.h>
+#include <StdRegions/StdTriExp.h>
+#include <StdRegions/StdTetExp.h>
+#include <StdRegions/StdPyrExp.h>
+#include <StdRegions/StdPrismExp.h>
+#include <StdRegions/StdHexExp.h>
+#include <cmath>
+#include <cstdint>
+
+using namespace std;
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Registers the class with the Factory.
+         */
+        string PreconditionerPMultigrid::className
+                = GetPreconFactory().RegisterCreatorFunction(
+                    "PMultigrid",
+                    PreconditionerPMultigrid::create,
+                    "Polynomial multigrid preconditioning");
+
+        /**
+         * @class PreconditionerPMultigrid
+         *
+         * This class implements a polynomial multigrid V-cycle as a
+         * preconditioner for the statically condensed boundary system.
+         *
+         * Level 0 is the full Schur complement. Each coarser level halves
+         * the polynomial degree and retains only the boundary modes of that
+         * degree or lower, so that for a hierarchical modal basis the
+         * prolongation is the injection of these modes and the Galerkin
+         * coarse operator is the corresponding principal submatrix of the
+         * Schur complement. The local sub-blocks of this submatrix are
+         * extracted once when the preconditioner is built. The finest level
+         * instead applies the operator of the linear system, so that the
+         * Schur complement is not stored twice; since this operator is only
+         * finalised after the preconditioner is built, the smoothing
+         * interval of the finest level is estimated on the first
+         * application.
+         *
+         * On each level the error is smoothed by a Chebyshev polynomial in
+         * the Jacobi preconditioned operator, whose spectral interval is
+         * estimated by a few power iterations. The same polynomial is used
+         * for pre- and post-smoothing so that the V-cycle is symmetric and
+         * may be used within the conjugate gradient method. The linear
+         * (vertex) level is solved with the FullLinearSpace preconditioner
+         * where this is available and is otherwise smoothed with a higher
+         * degree polynomial.
+         */
+        PreconditionerPMultigrid::PreconditionerPMultigrid(
+            const std::shared_ptr<GlobalLinSys> &plinsys,
+            const AssemblyMapSharedPtr          &pLocToGloMap)
+            : Preconditioner(plinsys, pLocToGloMap),
+              m_estimated(false)
+        {
+        }
+
+        /**
+         *
+         */
+        void PreconditionerPMultigrid::v_InitObject()
+        {
+            GlobalSysSolnType solvertype =
+                m_locToGloMap.lock()->GetGlobalSysSolnType();
+            ASSERTL0(solvertype == eIterativeStaticCond ||
+                     solvertype == ePETScStaticCond,
+                     "Solver type not valid; PMultigrid preconditioner "
+                     "requires a single-level static condensation solver.");
+
+            m_iterLinsys = std::dynamic_pointer_cast<GlobalLinSysIterative>(
+                m_linsys.lock());
+
+            LibUtilities::SessionReaderSharedPtr session =
+                m_linsys.lock()->GetLocMat().lock()->GetSession();
+            session->LoadParameter("PMultigridSmoothingDegree",
+                                   m_smoothDegree, 3);
+            session->LoadParameter("PMultigridCoarseDegree",
+                                   m_coarseDegree, 10);
+            ASSERTL0(m_smoothDegree > 0 && m_coarseDegree > 0,
+                     "PMultigrid smoothing degrees must be positive.");
+
+            int linearSpaceSolve;
+            session->LoadParameter("PMultigridLinearSpaceSolve",
+                                   linearSpaceSolve, 1);
+
+            if (linearSpaceSolve &&
+                GetPreconFactory().ModuleExists("FullLinearSpace"))
+            {
+                m_coarsePrecon = GetPreconFactory().CreateInstance(
+                    "FullLinearSpace", m_linsys.lock(), m_locToGloMap.lock());
+            }
+        }
+
+        /**
+         * Determine the polynomial levels, extract the restricted operators
+         * and estimate the smoothing interval on each level.
+         */
+        void PreconditionerPMultigrid::v_BuildPreconditioner()
+        {
+            std::shared_ptr<MultiRegions::ExpList> expList =
+                ((m_linsys.lock())->GetLocMat()).lock();
+            LibUtilities::CommSharedPtr comm =
+                expList->GetComm()->GetRowComm();
+            auto asmMap = m_locToGloMap.lock();
+
+            int nGlobalBnd = asmMap->GetNumGlobalBndCoeffs();
+            int nDirBnd    = asmMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir    = nGlobalBnd - nDirBnd;
+
+            // Highest polynomial degree over all partitions.
+            int maxDegree = 1;
+            for (int n = 0; n < expList->GetExpSize(); ++n)
+            {
+                LocalRegions::ExpansionSharedPtr exp = expList->GetExp(n);
+                for (int k = 0; k < exp->GetShapeDimension(); ++k)
+                {
+                    maxDegree = max(maxDegree,
+                                    exp->GetBasisNumModes(k) - 1);
+                }
+            }
+            comm->AllReduce(maxDegree, LibUtilities::ReduceMax);
+
+            vector<int> degrees(1, maxDegree);
+            while (degrees.back() > 1)
+            {
+                degrees.push_back(max(degrees.back() / 2, 1));
+            }
+
+            // Assembled diagonal of the Schur complement.
+            Array<OneD, NekDouble> diagonals(nGlobalBnd, 0.0);
+            Array<OneD, NekDouble> tmp = AssembleStaticCondGlobalDiagonals();
+            Vmath::Vcopy(nNonDir, tmp.get(), 1, diagonals.get() + nDirBnd, 1);
+            asmMap->UniversalAssembleBnd(diagonals);
+
+            int nLocBnd = asmMap->GetNumLocalBndCoeffs();
+            int maxSel  = 0;
+            m_locIn  = Array<OneD, NekDouble>(nLocBnd);
+            m_locOut = Array<OneD, NekDouble>(nLocBnd);
+            m_wk1    = Array<OneD, NekDouble>(nGlobalBnd, 0.0);
+            m_wk2    = Array<OneD, NekDouble>(nGlobalBnd, 0.0);
+            m_smoother.Initialise(nNonDir);
+
+            int nLevels = degrees.size();
+            m_levels.resize(nLevels);
+            for (int i = 0; i < nLevels; ++i)
+            {
+                SetupLevel(m_levels[i], degrees[i], diagonals,
+                           i == 0 && !m_iterLinsys.expired());
+                m_levels[i].m_res  = Array<OneD, NekDouble>(nNonDir);
+                m_levels[i].m_corr = Array<OneD, NekDouble>(nNonDir);
+
+                for (int n = 0; n < m_levels[i].m_nLoc.size(); ++n)
+                {
+                    maxSel = max(maxSel, m_levels[i].m_nLoc[n]);
+                }
+            }
+
+            m_blkIn  = Array<OneD, NekDouble>(maxSel);
+            m_blkOut = Array<OneD, NekDouble>(maxSel);
+
+            for (int i = 0; i < nLevels; ++i)
+            {
+                if (!m_levels[i].m_systemOperator)
+                {
+                    EstimateSmoothingInterval(i);
+                }
+            }
+            m_estimated = !m_levels[0].m_systemOperator;
+
+            if (m_coarsePrecon)
+            {
+                m_coarsePrecon->BuildPreconditioner();
+            }
+            m_modeCache.clear();
+        }
+
+        /**
+         * Set up the operator of one level by selecting the boundary modes of
+         * polynomial degree @p degree or lower and copying the corresponding
+         * entries of each local Schur complement. If @p systemOperator is
+         * set, all modes are retained and the operator of the linear system
+         * is used instead of copies of its blocks.
+         */
+        void PreconditionerPMultigrid::SetupLevel(
+            Level                        &level,
+            int                           degree,
+            const Array<OneD, NekDouble> &diagonals,
+            bool                          systemOperator)
+        {
+            std::shared_ptr<MultiRegions::ExpList> expList =
+                ((m_linsys.lock())->GetLocMat()).lock();
+            auto asmMap = m_locToGloMap.lock();
+
+            int nGlobalBnd = asmMap->GetNumGlobalBndCoeffs();
+            int nDirBnd    = asmMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir    = nGlobalBnd - nDirBnd;
+            int nElmt      = m_linsys.lock()->GetNumBlocks();
+            int i, j, n, cnt;
+
+            level.m_degree         = degree;
+            level.m_systemOperator = systemOperator;
+            level.m_operator       = std::bind(
+                &PreconditionerPMultigrid::ApplyLevelOperator, this,
+                std::cref(level),
+                std::placeholders::_1, std::placeholders::_2);
+            level.m_jacobi         = std::bind(
+                &PreconditionerPMultigrid::ApplyLevelJacobi, this,
+                std::cref(level),
+                std::placeholders::_1, std::placeholders::_2);
+
+            // Flag the global dofs which any element retains on this level,
+            // so that shared modes are treated consistently across elements
+            // and partitions.
+            Array<OneD, NekDouble> retained(nGlobalBnd, 0.0);
+            for (cnt = n = 0; n < nElmt; ++n)
+            {
+                LocalRegions::ExpansionSharedPtr exp = expList->GetExp(n);
+                const Array<OneD, int> &modes = GetRetainedModes(exp, degree);
+
+                Array<OneD, unsigned int> bmap;
+                exp->GetBoundaryMap(bmap);
+
+                int nBnd = exp->NumBndryCoeffs();
+                for (i = 0; i < nBnd; ++i)
+                {
+                    if (modes[bmap[i]])
+                    {
+                        retained[asmMap->GetLocalToGlobalBndMap(cnt + i)] = 1.0;
+                    }
+                }
+                cnt += nBnd;
+            }
+            asmMap->UniversalAssembleBnd(retained);
+
+            level.m_mask    = Array<OneD, NekDouble>(nNonDir, 0.0);
+            level.m_invDiag = Array<OneD, NekDouble>(nNonDir, 0.0);
+            for (i = 0; i < nNonDir; ++i)
+            {
+                if (retained[nDirBnd + i] > 0.0)
+                {
+                    level.m_mask[i]    = 1.0;
+                    level.m_invDiag[i] = 1.0 / diagonals[nDirBnd + i];
+                }
+            }
+
+            if (systemOperator)
+            {
+                level.m_nLoc = Array<OneD, int>(nElmt, 0);
+                return;
+            }
+
+            // Extract the retained rows and columns of each local Schur
+            // complement.
+            vector<int>       locIdx;
+            vector<NekDouble> blocks;
+            level.m_nLoc = Array<OneD, int>(nElmt, 0);
+            for (cnt = n = 0; n < nElmt; ++n)
+            {
+                DNekScalMatSharedPtr bnd_mat =
+                    m_linsys.lock()->GetStaticCondBlock(n)->GetBlock(0, 0);
+                int bnd_row = bnd_mat->GetRows();
+
+                vector<int> sel;
+                for (i = 0; i < bnd_row; ++i)
+                {
+                    int gid = asmMap->GetLocalToGlobalBndMap(cnt + i);
+                    if (gid >= nDirBnd && retained[gid] > 0.0)
+                    {
+                        sel.push_back(i);
+                        locIdx.push_back(cnt + i);
+                    }
+                }
+
+                int nSel = sel.size();
+                for (j = 0; j < nSel; ++j)
+                {
+                    for (i = 0; i < nSel; ++i)
+                    {
+                        blocks.push_back((*bnd_mat)(sel[i], sel[j]));
+                    }
+                }
+
+                level.m_nLoc[n] = nSel;
+                cnt += bnd_row;
+            }
+
+            level.m_locIdx = Array<OneD, int>(locIdx.size(), locIdx.data());
+            level.m_blocks = Array<OneD, NekDouble>(blocks.size(),
+                                                    blocks.data());
+        }
+
+        /**
+         * Return an array flagging the coefficients of @p exp which are
+         * spanned by its modes of polynomial degree @p degree or lower. This
+         * is found by projecting each mode of a reduced order expansion of
+         * the same type onto @p exp, which requires a hierarchical basis.
+         */
+        const Array<OneD, int> &PreconditionerPMultigrid::GetRetainedModes(
+            const LocalRegions::ExpansionSharedPtr &exp,
+            int                                     degree)
+        {
+            StdRegions::StdExpansionSharedPtr stdExp = exp->GetStdExp();
+            int nDim = stdExp->GetShapeDimension();
+
+            ModeKey key;
+            key.push_back(stdExp->DetShapeType());
+            key.push_back(stdExp->IsNodalNonTensorialExp());
+            key.push_back(degree);
+
+            int  maxModes = 0;
+            vector<LibUtilities::BasisKey> bkeys;
+            for (int k = 0; k < nDim; ++k)
+            {
+                LibUtilities::BasisKey bkey = stdExp->GetBasis(k)->GetBasisKey();
+                key.push_back(bkey.GetBasisType());
+                key.push_back(bkey.GetNumModes());
+                key.push_back(bkey.GetPointsType());
+                key.push_back(bkey.GetNumPoints());
+                maxModes = max(maxModes, bkey.GetNumModes());
+
+                bkeys.push_back(LibUtilities::BasisKey(
+                    bkey.GetBasisType(), min(degree + 1, bkey.GetNumModes()),
+                    bkey.GetPointsKey()));
+            }
+
+            auto it = m_modeCache.find(key);
+            if (it != m_modeCache.end())
+            {
+                return it->second;
+            }
+
+            int nCoeffs = stdExp->GetNcoeffs();
+            Array<OneD, int> modes(nCoeffs, 0);
+
+            if (maxModes - 1 <= degree)
+            {
+                for (int j = 0; j < nCoeffs; ++j)
+                {
+                    modes[j] = 1;
+                }
+                return m_modeCache[key] = modes;
+            }
+
+            StdRegions::StdExpansionSharedPtr lowExp;
+            switch (stdExp->DetShapeType())
+            {
+                case LibUtilities::eSegment:
+                    lowExp = MemoryManager<StdRegions::StdSegExp>::
+                        AllocateSharedPtr(bkeys[0]);
+                    break;
+                case LibUtilities::eQuadrilateral:
+                    lowExp = MemoryManager<StdRegions::StdQuadExp>::
+                        AllocateSharedPtr(bkeys[0], bkeys[1]);
+                    break;
+                case LibUtilities::eTriangle:
+                    lowExp = MemoryManager<StdRegions::StdTriExp>::
+                        AllocateSharedPtr(bkeys[0], bkeys[1]);
+                    break;
+                case LibUtilities::eTetrahedron:
+                    lowExp = MemoryManager<StdRegions::StdTetExp>::
+                        AllocateSharedPtr(bkeys[0], bkeys[1], bkeys[2]);
+                    break;
+                case LibUtilities::ePyramid:
+                    lowExp = MemoryManager<StdRegions::StdPyrExp>::
+                        AllocateSharedPtr(bkeys[0], bkeys[1], bkeys[2]);
+                    break;
+                case LibUtilities::ePrism:
+                    lowExp = MemoryManager<StdRegions::StdPrismExp>::
+                        AllocateSharedPtr(bkeys[0], bkeys[1], bkeys[2]);
+                    break;
+                case LibUtilities::eHexahedron:
+                    lowExp = MemoryManager<StdRegions::StdHexExp>::
+                        AllocateSharedPtr(bkeys[0], bkeys[1], bkeys[2]);
+                    break;
+                default:
+                    ASSERTL0(false, "Shape not supported.");
+                    break;
+            }
+
+            // Each reduced order mode must coincide with exactly one mode of
+            // the full expansion.
+            int nLowCoeffs = lowExp->GetNcoeffs();
+            Array<OneD, NekDouble> lowCoeffs(nLowCoeffs, 0.0);
+            Array<OneD, NekDouble> phys     (stdExp->GetTotPoints());
+            Array<OneD, NekDouble> coeffs   (nCoeffs);
+            for (int j = 0; j < nLowCoeffs; ++j)
+            {
+                lowCoeffs[j] = 1.0;
+                lowExp->BwdTrans(lowCoeffs, phys);
+                stdExp->FwdTrans(phys, coeffs);
+                lowCoeffs[j] = 0.0;
+
+                int imax = Vmath::Iamax(nCoeffs, coeffs.get(), 1);
+                NekDouble other = 0.0;
+                for (int i = 0; i < nCoeffs; ++i)
+                {
+                    other += i == imax ? 0.0 : fabs(coeffs[i]);
+                }
+                ASSERTL0(fabs(coeffs[imax] - 1.0) < 1e-8 && other < 1e-8,
+                         "PMultigrid preconditioner requires a hierarchical "
+                         "modal expansion basis.");
+
+                modes[imax] = 1;
+            }
+
+            return m_modeCache[key] = modes;
+        }
+
+        /**
+         * Multiply a global boundary vector by the operator of @p level.
+         */
+        void PreconditionerPMultigrid::ApplyLevelOperator(
+            const Level                   &level,
+            const Array<OneD, NekDouble>  &pInput,
+                  Array<OneD, NekDouble>  &pOutput)
+        {
+            auto asmMap = m_locToGloMap.lock();
+
+            int nDirBnd = asmMap->GetNumGlobalDirBndCoeffs();
+            int nLocBnd = asmMap->GetNumLocalBndCoeffs();
+            int nElmt   = level.m_nLoc.size();
+
+            if (level.m_systemOperator)
+            {
+                int nNonDir = asmMap->GetNumGlobalBndCoeffs() - nDirBnd;
+                Vmath::Vcopy(nNonDir, pInput.get(), 1,
+                             m_wk1.get() + nDirBnd, 1);
+                m_iterLinsys.lock()->DoMatrixMultiply(m_wk1, m_wk2);
+                Vmath::Vcopy(nNonDir, m_wk2.get() + nDirBnd, 1,
+                             pOutput.get(), 1);
+                return;
+            }
+
+            asmMap->GlobalToLocalBnd(pInput, m_locIn, nDirBnd);
+            Vmath::Zero(nLocBnd, m_locOut, 1);
+
+            int idxOffset = 0, blkOffset = 0;
+            for (int n = 0; n < nElmt; ++n)
+            {
+                int nSel = level.m_nLoc[n];
+                if (nSel == 0)
+                {
+                    continue;
+                }
+
+                const int *idx = level.m_locIdx.get() + idxOffset;
+                Vmath::Gathr(nSel, m_locIn.get(), idx, m_blkIn.get());
+                Blas::Dgemv('N', nSel, nSel, 1.0,
+                            level.m_blocks.get() + blkOffset, nSel,
+                            m_blkIn.get(), 1, 0.0, m_blkOut.get(), 1);
+                Vmath::Scatr(nSel, m_blkOut.get(), idx, m_locOut.get());
+
+                idxOffset += nSel;
+                blkOffset += nSel * nSel;
+            }
+
+            asmMap->AssembleBnd(m_locOut, pOutput, nDirBnd);
+        }
+
+        /**
+         * Multiply a global boundary vector by the inverse diagonal of
+         * @p level, which vanishes outside the dofs of the level.
+         */
+        void PreconditionerPMultigrid::ApplyLevelJacobi(
+            const Level                   &level,
+            const Array<OneD, NekDouble>  &pInput,
+                  Array<OneD, NekDouble>  &pOutput)
+        {
+            Vmath::Vmul(level.m_invDiag.size(), level.m_invDiag, 1,
+                        pInput, 1, pOutput, 1);
+        }
+
+        /**
+         * Inner product of two global boundary vectors over all partitions.
+         */
+        NekDouble PreconditionerPMultigrid::InnerProduct(
+            const Array<OneD, NekDouble> &pIn1,
+            const Array<OneD, NekDouble> &pIn2)
+        {
+            auto asmMap = m_locToGloMap.lock();
+            LibUtilities::CommSharedPtr comm =
+                m_linsys.lock()->GetLocMat().lock()->GetComm()->GetRowComm();
+
+            int nGlobalBnd = asmMap->GetNumGlobalBndCoeffs();
+            int nDirBnd    = asmMap->GetNumGlobalDirBndCoeffs();
+
+            Array<OneD, const int> map =
+                asmMap->GetGlobalToUniversalBndMapUnique();
+
+            NekDouble result = Vmath::Dot2(nGlobalBnd - nDirBnd,
+                                           pIn1.get(), pIn2.get(),
+                                           map.get() + nDirBnd);
+            comm->AllReduce(result, LibUtilities::ReduceSum);
+            return result;
+        }
+
+        /**
+         * Estimate the largest eigenvalue of the Jacobi preconditioned
+         * operator of @p level by power iteration. The start vector is
+         * derived from the universal numbering so that it is identical for
+         * any partitioning.
+         */
+        NekDouble PreconditionerPMultigrid::EstimateMaxEigenvalue(
+            const Level &level)
+        {
+            auto asmMap = m_locToGloMap.lock();
+
+            int nGlobalBnd = asmMap->GetNumGlobalBndCoeffs();
+            int nDirBnd    = asmMap->GetNumGlobalDirBndCoeffs();
+            int nNonDir    = nGlobalBnd - nDirBnd;
+
+            Array<OneD, const int> univ = asmMap->GetGlobalToUniversalBndMap();
+
+            Array<OneD, NekDouble> x(nNonDir), y(nNonDir);
+            for (int i = 0; i < nNonDir; ++i)
+            {
+                x[i] = level.m_mask[i] *
+                    (0.5 + ((static_cast<std::uint64_t>(univ[nDirBnd + i])
+                             * 7919) % 1009) / 1009.0);
+            }
+
+            NekDouble lambda = 1.0;
+            NekDouble xnorm  = sqrt(InnerProduct(x, x));
+            if (xnorm == 0.0)
+            {
+                return lambda;
+            }
+            Vmath::Smul(nNonDir, 1.0 / xnorm, x, 1, x, 1);
+
+            for (int k = 0; k < 10; ++k)
+            {
+                ApplyLevelOperator(level, x, y);
+                Vmath::Vmul(nNonDir, level.m_invDiag, 1, y, 1, y, 1);
+
+                NekDouble ynorm = sqrt(InnerProduct(y, y));
+                if (ynorm == 0.0)
+                {
+                    break;
+                }
+                lambda = ynorm;
+                Vmath::Smul(nNonDir, 1.0 / ynorm, y, 1, x, 1);
+            }
+
+            return lambda;
+        }
+
+        /**
+         * Set the Chebyshev smoothing interval of level @p lev from an
+         * estimate of its largest eigenvalue. The coarsest level needs no
+         * interval if it is solved by #m_coarsePrecon.
+         */
+        void PreconditionerPMultigrid::EstimateSmoothingInterval(int lev)
+        {
+            int nLevels = m_levels.size();
+            if (lev == nLevels - 1 && m_coarsePrecon)
+            {
+                return;
+            }
+
+            NekDouble lambda = EstimateMaxEigenvalue(m_levels[lev]);
+            m_levels[lev].m_lambdaMax = 1.1 * lambda;
+            m_levels[lev].m_lambdaMin = lev < nLevels - 1 ?
+                0.25 * lambda : 0.01 * lambda;
+        }
+
+        /**
+         * Apply one V-cycle starting from level @p lev.
+         */
+        void PreconditionerPMultigrid::VCycle(
+            int                            lev,
+            const Array<OneD, NekDouble>  &pInput,
+                  Array<OneD, NekDouble>  &pOutput)
+        {
+            Level &level = m_levels[lev];
+            int nNonDir = level.m_mask.size();
+
+            if (lev == (int)m_levels.size() - 1)
+            {
+                if (m_coarsePrecon)
+                {
+                    Vmath::Zero(nNonDir, level.m_corr, 1);
+                    m_coarsePrecon->DoPreconditionerWithNonVertOutput(
+                        pInput, pOutput, level.m_corr);
+                    Vmath::Vmul(nNonDir, pOutput, 1, level.m_mask, 1,
+                                pOutput, 1);
+                }
+                else
+                {
+                    m_smoother.Smooth(m_coarseDegree, level.m_lambdaMin,
+                                      level.m_lambdaMax, level.m_operator,
+                                      level.m_jacobi, pInput, pOutput, true);
+                }
+                return;
+            }
+
+            const Level &coarse = m_levels[lev + 1];
+            Array<OneD, NekDouble> &r = level.m_res;
+            Array<OneD, NekDouble> &e = level.m_corr;
+
+            // Pre-smoothing.
+            m_smoother.Smooth(m_smoothDegree, level.m_lambdaMin,
+                              level.m_lambdaMax, level.m_operator,
+                              level.m_jacobi, pInput, pOutput, true);
+
+            // Restrict the residual to the coarser modes and correct.
+            ApplyLevelOperator(level, pOutput, r);
+            Vmath::Vsub(nNonDir, pInput, 1, r, 1, r, 1);
+            Vmath::Vmul(nNonDir, r, 1, coarse.m_mask, 1, r, 1);
+
+            VCycle(lev + 1, r, e);
+            Vmath::Vadd(nNonDir, pOutput, 1, e, 1, pOutput, 1);
+
+            // Post-smoothing.
+            m_smoother.Smooth(m_smoothDegree, level.m_lambdaMin,
+                              level.m_lambdaMax, level.m_operator,
+                              level.m_jacobi, pInput, pOutput, false);
+        }
+
+        /**
+         *
+         */
+        void PreconditionerPMultigrid::v_DoPreconditioner(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            if (!m_estimated)
+            {
+                EstimateSmoothingInterval(0);
+                m_estimated = true;
+            }
+
+            VCycle(0, pInput, pOutput);
+        }
+    }
+}
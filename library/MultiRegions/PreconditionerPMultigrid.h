@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerPMultigrid.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Polynomial multigrid preconditioner header
+//
+///////////////////////////////////////////////////////////////////////////////
+#ifndef NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERPMULTIGRID_H
+#define NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERPMULTIGRID_H
+
+#include <MultiRegions/ChebyshevSmoother.h>
+#include <MultiRegions/GlobalLinSys.h>
+#include <MultiRegions/Preconditioner.h>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+
+#include <map>
+#include <vector>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        class GlobalLinSysIterative;
+
+        class PreconditionerPMultigrid;
+        typedef std::shared_ptr<PreconditionerPMultigrid>
+            PreconditionerPMultigridSharedPtr;
+
+        class PreconditionerPMultigrid: public Preconditioner
+        {
+        public:
+            /// Creates an instance of this class
+            static PreconditionerSharedPtr create(
+                const std::shared_ptr<GlobalLinSys> &plinsys,
+                const std::shared_ptr<AssemblyMap>  &pLocToGloMap)
+            {
+                PreconditionerSharedPtr p = MemoryManager<
+                    PreconditionerPMultigrid>::AllocateSharedPtr(
+                        plinsys, pLocToGloMap);
+                p->InitObject();
+                return p;
+            }
+
+            /// Name of class
+            static std::string className;
+
+            MULTI_REGIONS_EXPORT PreconditionerPMultigrid(
+                const std::shared_ptr<GlobalLinSys> &plinsys,
+                const AssemblyMapSharedPtr          &pLocToGloMap);
+
+            MULTI_REGIONS_EXPORT
+            virtual ~PreconditionerPMultigrid() {}
+
+        protected:
+            /// Operator restricted to the modes of one polynomial level.
+            struct Level
+            {
+                /// Maximum polynomial degree retained on this level.
+                int                         m_degree;
+                /// Local boundary dofs of each element kept on this level.
+                Array<OneD, int>            m_locIdx;
+                /// Number of dofs kept in each element.
+                Array<OneD, int>            m_nLoc;
+                /// Column-major Schur complement sub-blocks of each element.
+                Array<OneD, NekDouble>      m_blocks;
+                /// Whether the operator of the linear system is applied
+                /// instead of #m_blocks.
+                bool                        m_systemOperator;
+                /// 1 for global (non-Dirichlet) dofs on this level, else 0.
+                Array<OneD, NekDouble>      m_mask;
+                /// Inverse of the assembled diagonal on this level.
+                Array<OneD, NekDouble>      m_invDiag;
+                /// Bounds of the Chebyshev smoothing interval.
+                NekDouble                   m_lambdaMin;
+                NekDouble                   m_lambdaMax;
+                /// Operator of this level and its Jacobi preconditioner.
+                ChebyshevSmoother::OperatorType m_operator;
+                ChebyshevSmoother::OperatorType m_jacobi;
+                /// Residual passed to the next level and the correction
+                /// returned from it.
+                Array<OneD, NekDouble>      m_res;
+                Array<OneD, NekDouble>      m_corr;
+            };
+
+            std::vector<Level>              m_levels;
+            PreconditionerSharedPtr         m_coarsePrecon;
+            std::weak_ptr<GlobalLinSysIterative> m_iterLinsys;
+            int                             m_smoothDegree;
+            int                             m_coarseDegree;
+            /// Whether the smoothing interval of the finest level has been
+            /// estimated
+            bool                            m_estimated;
+
+            /// Chebyshev smoother shared by all levels
+            ChebyshevSmoother               m_smoother;
+
+            /// Work space for the level operators
+            Array<OneD, NekDouble>          m_locIn;
+            Array<OneD, NekDouble>          m_locOut;
+            Array<OneD, NekDouble>          m_blkIn;
+            Array<OneD, NekDouble>          m_blkOut;
+            Array<OneD, NekDouble>          m_wk1;
+            Array<OneD, NekDouble>          m_wk2;
+
+        private:
+            typedef std::vector<int>        ModeKey;
+
+            /// Cache of the modes retained by each expansion and degree.
+            std::map<ModeKey, Array<OneD, int> > m_modeCache;
+
+            void SetupLevel(
+                Level                        &level,
+                int                           degree,
+                const Array<OneD, NekDouble> &diagonals,
+                bool                          systemOperator);
+
+            const Array<OneD, int> &GetRetainedModes(
+                const LocalRegions::ExpansionSharedPtr &exp,
+                int                                     degree);
+
+            void ApplyLevelOperator(
+                const Level                   &level,
+                const Array<OneD, NekDouble>  &pInput,
+                      Array<OneD, NekDouble>  &pOutput);
+
+            NekDouble EstimateMaxEigenvalue(const Level &level);
+
+            void EstimateSmoothingInterval(int lev);
+
+            void ApplyLevelJacobi(
+                const Level                   &level,
+                const Array<OneD, NekDouble>  &pInput,
+                      Array<OneD, NekDouble>  &pOutput);
+
+            NekDouble InnerProduct(
+                const Array<OneD, NekDouble> &pIn1,
+                const Array<OneD, NekDouble> &pIn2);
+
+            void VCycle(
+                int                            lev,
+                const Array<OneD, NekDouble>  &pInput,
+                      Array<OneD, NekDouble>  &pOutput);
+
+            virtual void v_InitObject();
+
+            virtual void v_DoPreconditioner(
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput);
+
+            virtual void v_BuildPreconditioner();
+        };
+    }
+}
+
+#endif
@@ -35,6 +35,7 @@
 
 #include <MultiRegions/SubStructuredGraph.h>
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
 
 #include <iostream>
 #include <iomanip>
@@ -1036,6 +1037,73 @@ namespace Nektar
 #endif
         }
 
+        /**
+         * Computes a fill-reducing nested dissection ordering of the graph
+         * for sparse direct factorisations, using Scotch if available and
+         * SparseCholesky::NestedDissection otherwise.
+         */
+        void NestedDissectionReordering(const BoostGraph& graph,
+                                        Array<OneD, int>& perm,
+                                        Array<OneD, int>& iperm)
+        {
+            int nGraphVerts = boost::num_vertices(graph);
+
+            ASSERTL1(perm. size() >= nGraphVerts &&
+                     iperm.size() >= nGraphVerts,
+                     "Non-matching dimensions");
+
+            // Convert the boost graph to adjacency-list format.
+            std::vector<int> xadj(nGraphVerts + 1, 0);
+            std::vector<int> adjncy;
+            adjncy.reserve(2 * boost::num_edges(graph));
+
+            for (int i = 0; i < nGraphVerts; ++i)
+            {
+                auto adjverts = boost::adjacent_vertices(i, graph);
+                for (auto it = adjverts.first; it != adjverts.second; ++it)
+                {
+                    if (*it != i)
+                    {
+                        adjncy.push_back(*it);
+                    }
+                }
+                xadj[i + 1] = adjncy.size();
+            }
+
+#ifdef NEKTAR_USE_SCOTCH
+            if (adjncy.size())
+            {
+                // Use the default Scotch ordering strategy, which is a
+                // nested dissection with minimum degree ordering of the
+                // leaves.
+                SCOTCH_Graph scGraph;
+                SCOTCH_CALL(SCOTCH_graphBuild,
+                            (&scGraph, 0, nGraphVerts, &xadj[0], &xadj[1],
+                             NULL, NULL, xadj[nGraphVerts], &adjncy[0],
+                             NULL));
+
+                SCOTCH_Strat strat;
+                SCOTCH_CALL(SCOTCH_stratInit, (&strat));
+                SCOTCH_CALL(SCOTCH_graphOrder,
+                            (&scGraph, &strat, &iperm[0], &perm[0],
+                             NULL, NULL, NULL));
+
+                SCOTCH_stratExit(&strat);
+                SCOTCH_graphExit(&scGraph);
+                return;
+            }
+#endif
+
+            std::vector<int> order;
+            SparseCholesky::NestedDissection(nGraphVerts, xadj, adjncy, order);
+
+            for (int i = 0; i < nGraphVerts; i++)
+            {
+                perm[i] = order[i];
+                iperm[order[i]] = i;
+            }
+        }
+
         void NoReordering(const BoostGraph& graph,
                           Array<OneD, int>& perm,
                           Array<OneD, int>& iperm)
@@ -289,6 +289,11 @@ namespace Nektar
         // polynomial order of the expansion and there is still room for
         // optimisation here.
 
+        MULTI_REGIONS_EXPORT void NestedDissectionReordering(
+            const BoostGraph& graph,
+            Array<OneD, int>& perm,
+            Array<OneD, int>& iperm);
+
         MULTI_REGIONS_EXPORT void NoReordering(const BoostGraph& graph,
                           Array<OneD, int>& perm,
                           Array<OneD, int>& iperm);
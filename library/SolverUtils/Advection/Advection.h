@@ -42,6 +42,7 @@
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 #include <MultiRegions/ExpList.h>
 #include <SolverUtils/SolverUtilsDeclspec.h>
+#include <SolverUtils/Core/Workspace.h>
 #include <SolverUtils/RiemannSolvers/RiemannSolver.h>
 
 namespace Nektar
@@ -171,6 +172,29 @@ public:
         m_fluxVector = fluxVector;
     }
 
+    /**
+     * @brief Declare that the exchange of the backwards trace passed to the
+     * next call of Advect() or AdvectCoeffs() has been started with
+     * MultiRegions::ExpList::BeginTraceExchange and is still in progress.
+     *
+     * This may only be used if OverlapsTraceExchange() is true, in which case
+     * the advection object completes the exchange just before the trace flux
+     * is evaluated.
+     */
+    inline void SetTraceExchangePending()
+    {
+        ASSERTL1(v_OverlapsTraceExchange(),
+                 "This advection type cannot complete a trace exchange.");
+        m_traceExchangePending = true;
+    }
+
+    /// Returns true if the advection object can complete an exchange of the
+    /// backwards trace started by the caller.
+    inline bool OverlapsTraceExchange()
+    {
+        return v_OverlapsTraceExchange();
+    }
+
     /**
      * @brief Set the base flow used for linearised advection objects.
      *
@@ -191,6 +215,10 @@ protected:
     RiemannSolverSharedPtr m_riemann;
     /// Storage for space dimension. Used for homogeneous extension.
     int                    m_spaceDim;
+    /// Exchange of the backwards trace started by the caller is pending.
+    bool                   m_traceExchangePending = false;
+    /// Scratch storage reused by successive evaluations of the operator.
+    Workspace              m_workspace;
 
     /// Initialises the advection object.
     SOLVER_UTILS_EXPORT virtual void v_InitObject(
@@ -242,6 +270,11 @@ protected:
         const Array<OneD, Array<OneD, NekDouble> >
             &pBwd = NullNekDoubleArrayofArray);
 
+    SOLVER_UTILS_EXPORT virtual bool v_OverlapsTraceExchange()
+    {
+        return false;
+    }
+
     /// Overrides the base flow used during linearised advection
     SOLVER_UTILS_EXPORT virtual void v_SetBaseFlow(
         const Array<OneD, Array<OneD, NekDouble> >        &inarray,
@@ -61,6 +61,16 @@ namespace Nektar
             Array<OneD, MultiRegions::ExpListSharedPtr> pFields)
         {
             Advection::v_InitObject(pSession, pFields);
+
+            // Reserve scratch storage for the flux vector, trace values,
+            // numerical flux and coefficient space result of each field
+            size_t nFields         = pFields.size();
+            size_t nPointsTot      = pFields[0]->GetTotPoints();
+            size_t nCoeffs         = pFields[0]->GetNcoeffs();
+            size_t nTracePointsTot = pFields[0]->GetTrace()->GetTotPoints();
+
+            m_workspace.Reserve(nFields * (m_spaceDim * nPointsTot +
+                                           3 * nTracePointsTot + nCoeffs));
         }
 
         /**
@@ -87,11 +97,9 @@ namespace Nektar
             boost::ignore_unused(advVel, time);
             size_t nCoeffs         = fields[0]->GetNcoeffs();
 
-            Array<OneD, Array<OneD, NekDouble> > tmp{size_t(nConvectiveFields)};
-            for (int i = 0; i < nConvectiveFields; ++i)
-            {
-                tmp[i] = Array<OneD, NekDouble> {nCoeffs, 0.0};
-            }
+            Workspace::Scope scope(m_workspace);
+            Array<OneD, Array<OneD, NekDouble> > tmp =
+                m_workspace.GetArrays(nConvectiveFields, nCoeffs, 0.0);
 
             AdvectionWeakDG::v_AdvectCoeffs(
                 nConvectiveFields, fields, advVel, inarray, tmp, time,
@@ -117,17 +125,37 @@ namespace Nektar
             size_t nCoeffs         = fields[0]->GetNcoeffs();
             size_t nTracePointsTot = fields[0]->GetTrace()->GetTotPoints();
 
+            Workspace::Scope scope(m_workspace);
+
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > >
                 fluxvector(nConvectiveFields);
-            // Allocate storage for flux vector F(u).
+            // Take storage for flux vector F(u) from the workspace.
             for (int i = 0; i < nConvectiveFields; ++i)
             {
-                fluxvector[i] =
-                    Array<OneD, Array<OneD, NekDouble> > {size_t(m_spaceDim)};
-                for (int j = 0; j < m_spaceDim; ++j)
+                fluxvector[i] = m_workspace.GetArrays(m_spaceDim, nPointsTot);
+            }
+
+            // Start the exchange of the trace across partitions, which is
+            // completed only once the volume terms have been evaluated
+            Array<OneD, Array<OneD, NekDouble> > Fwd = pFwd;
+            Array<OneD, Array<OneD, NekDouble> > Bwd = pBwd;
+            bool pendingExchange   = m_traceExchangePending;
+            m_traceExchangePending = false;
+
+            if (pFwd == NullNekDoubleArrayofArray ||
+                pBwd == NullNekDoubleArrayofArray)
+            {
+                Fwd = m_workspace.GetArrays(
+                    nConvectiveFields, nTracePointsTot, 0.0);
+                Bwd = m_workspace.GetArrays(
+                    nConvectiveFields, nTracePointsTot, 0.0);
+                for (int i = 0; i < nConvectiveFields; ++i)
                 {
-                    fluxvector[i][j] = Array<OneD, NekDouble> {nPointsTot};
+                    fields[i]->GetFwdBwdTracePhysSerial(
+                        inarray[i], Fwd[i], Bwd[i]);
                 }
+                fields[0]->BeginTraceExchange(Fwd);
+                pendingExchange = true;
             }
 
             v_AdvectVolumeFlux(nConvectiveFields, fields, advVel,inarray,
@@ -140,21 +168,27 @@ namespace Nektar
                 fields[i]->IProductWRTDerivBase(fluxvector[i], outarray[i]);
             }
 
-            Array<OneD, Array<OneD, NekDouble> >
-                numflux{size_t(nConvectiveFields)};
+            if (pendingExchange)
+            {
+                fields[0]->FinishTraceExchange(Bwd);
+            }
+
+            Array<OneD, Array<OneD, NekDouble> > numflux =
+                m_workspace.GetArrays(nConvectiveFields, nTracePointsTot, 0.0);
+
+            v_AdvectTraceFlux(nConvectiveFields, fields, advVel, inarray,
+                                numflux,time, Fwd, Bwd);
 
             for (int i = 0; i < nConvectiveFields; ++i)
             {
-                numflux[i] = Array<OneD, NekDouble> {nTracePointsTot, 0.0};
+                Vmath::Neg(nCoeffs, outarray[i], 1);
             }
 
-            v_AdvectTraceFlux(nConvectiveFields, fields, advVel, inarray,
-                                numflux,time, pFwd, pBwd);
+            // Scatter the numerical flux of all variables in one pass
+            fields[0]->AddTraceIntegral(numflux, outarray);
 
             for (int i = 0; i < nConvectiveFields; ++i)
             {
-                Vmath::Neg                      (nCoeffs, outarray[i], 1);
-                fields[i]->AddTraceIntegral     (numflux[i], outarray[i]);
                 fields[i]->MultiplyByElmtInvMass(outarray[i], outarray[i]);
             }
         }
@@ -176,16 +210,19 @@ namespace Nektar
                 "Riemann solver must be provided for AdvectionWeakDG.");
 
             // Store forwards/backwards space along trace space
+            Workspace::Scope scope(m_workspace);
             Array<OneD, Array<OneD, NekDouble>> Fwd(nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble>> Bwd(nConvectiveFields);
 
             if (pFwd == NullNekDoubleArrayofArray ||
                 pBwd == NullNekDoubleArrayofArray)
             {
+                Fwd = m_workspace.GetArrays(
+                    nConvectiveFields, nTracePointsTot, 0.0);
+                Bwd = m_workspace.GetArrays(
+                    nConvectiveFields, nTracePointsTot, 0.0);
                 for (int i = 0; i < nConvectiveFields; ++i)
                 {
-                    Fwd[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                    Bwd[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
                     fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
                 }
             }
@@ -109,6 +109,11 @@ namespace Nektar
                     &pFwd =NullNekDoubleArrayofArray,
                 const Array<OneD, Array<OneD, NekDouble>>
                     &pBwd =NullNekDoubleArrayofArray);
+
+            virtual bool v_OverlapsTraceExchange()
+            {
+                return true;
+            }
         };
     }
 }
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Misc.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Persistent scratch storage for right-hand-side operators.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <SolverUtils/Core/Workspace.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /// Arrays are padded to this many entries so that consecutive arrays
+    /// start on separate cache lines.
+    static const size_t kWorkspacePadding = 8;
+
+    Workspace::Workspace() : m_offset(0), m_peak(0), m_depth(0)
+    {
+    }
+
+    void Workspace::Reserve(size_t size)
+    {
+        ASSERTL0(m_depth == 0,
+                 "Workspace cannot be resized while arrays are in use.");
+
+        if (size > m_storage.size())
+        {
+            m_storage = Array<OneD, NekDouble>(size);
+        }
+    }
+
+    Array<OneD, NekDouble> Workspace::Get(size_t n)
+    {
+        ASSERTL1(m_depth > 0,
+                 "Arrays must be requested within a Workspace::Scope.");
+
+        size_t padded = (n + kWorkspacePadding - 1) /
+            kWorkspacePadding * kWorkspacePadding;
+        size_t offset = m_offset;
+
+        m_offset += padded;
+        m_peak    = std::max(m_peak, m_offset);
+
+        if (m_offset > m_storage.size())
+        {
+            return Array<OneD, NekDouble>(n);
+        }
+
+        Array<OneD, NekDouble> tmp = m_storage + offset;
+        return Array<OneD, NekDouble>(n, tmp);
+    }
+
+    Array<OneD, NekDouble> Workspace::Get(size_t n, NekDouble initValue)
+    {
+        Array<OneD, NekDouble> tmp = Get(n);
+        Vmath::Fill(n, initValue, tmp.get(), 1);
+        return tmp;
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > Workspace::GetArrays(
+        size_t nArrays, size_t n)
+    {
+        Array<OneD, Array<OneD, NekDouble> > tmp(nArrays);
+        for (size_t i = 0; i < nArrays; ++i)
+        {
+            tmp[i] = Get(n);
+        }
+        return tmp;
+    }
+
+    Array<OneD, Array<OneD, NekDouble> > Workspace::GetArrays(
+        size_t nArrays, size_t n, NekDouble initValue)
+    {
+        Array<OneD, Array<OneD, NekDouble> > tmp(nArrays);
+        for (size_t i = 0; i < nArrays; ++i)
+        {
+            tmp[i] = Get(n, initValue);
+        }
+        return tmp;
+    }
+
+    void Workspace::Release(size_t offset)
+    {
+        m_offset = offset;
+
+        if (--m_depth == 0 && m_peak > m_storage.size())
+        {
+            m_storage = Array<OneD, NekDouble>(m_peak);
+            m_peak    = 0;
+        }
+    }
+
+}
+}
@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Core.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Persistent scratch storage for right-hand-side operators.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERUTILS_CORE_WORKSPACE_H
+#define NEKTAR_SOLVERUTILS_CORE_WORKSPACE_H
+
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <SolverUtils/SolverUtilsDeclspec.h>
+
+namespace Nektar {
+namespace SolverUtils {
+
+    /**
+     * @brief Scratch storage reused across calls of right-hand-side
+     * operators.
+     *
+     * Arrays handed out by Get() and GetArrays() are views into a single block owned by the
+     * workspace, so that operators evaluated at every stage of a time step
+     * do not allocate and initialise fresh memory on each call. Arrays are
+     * released in stack order when the enclosing Workspace::Scope is
+     * destroyed and must not be used afterwards.
+     *
+     * Requests which do not fit into the block are served by a separate
+     * allocation. The block is enlarged to the peak usage once the outermost
+     * scope is left, so that after the first call no further allocations
+     * take place.
+     */
+    class Workspace
+    {
+    public:
+        /// Releases all arrays obtained from the workspace during its
+        /// lifetime.
+        class Scope
+        {
+        public:
+            Scope(Workspace &wsp) : m_wsp(wsp), m_offset(wsp.m_offset)
+            {
+                ++m_wsp.m_depth;
+            }
+
+            ~Scope()
+            {
+                m_wsp.Release(m_offset);
+            }
+
+        private:
+            Workspace &m_wsp;
+            size_t     m_offset;
+
+            Scope(const Scope &);
+            Scope &operator=(const Scope &);
+        };
+
+        SOLVER_UTILS_EXPORT Workspace();
+
+        /// Ensures that at least @a size entries are available.
+        SOLVER_UTILS_EXPORT void Reserve(size_t size);
+
+        /// Returns an uninitialised array of size @a n.
+        SOLVER_UTILS_EXPORT Array<OneD, NekDouble> Get(size_t n);
+
+        /// Returns an array of size @a n filled with @a initValue.
+        SOLVER_UTILS_EXPORT Array<OneD, NekDouble> Get(
+            size_t n, NekDouble initValue);
+
+        /// Returns @a nArrays uninitialised arrays of size @a n.
+        SOLVER_UTILS_EXPORT Array<OneD, Array<OneD, NekDouble> > GetArrays(
+            size_t nArrays, size_t n);
+
+        /// Returns @a nArrays arrays of size @a n filled with @a initValue.
+        SOLVER_UTILS_EXPORT Array<OneD, Array<OneD, NekDouble> > GetArrays(
+            size_t nArrays, size_t n, NekDouble initValue);
+
+        /// Returns the number of entries held by the workspace.
+        size_t GetCapacity() const
+        {
+            return m_storage.size();
+        }
+
+    private:
+        /// Contiguous storage from which arrays are handed out.
+        Array<OneD, NekDouble> m_storage;
+        /// Number of entries currently handed out, including those served
+        /// by separate allocations.
+        size_t                 m_offset;
+        /// Largest value of #m_offset since the storage was last resized.
+        size_t                 m_peak;
+        /// Number of active scopes.
+        int                    m_depth;
+
+        void Release(size_t offset);
+    };
+
+}
+}
+
+#endif
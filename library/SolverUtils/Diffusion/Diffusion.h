@@ -45,6 +45,7 @@
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <MultiRegions/ExpList.h>
 #include <SolverUtils/SolverUtilsDeclspec.h>
+#include <SolverUtils/Core/Workspace.h>
 #include <SolverUtils/RiemannSolvers/RiemannSolver.h>
 
 namespace Nektar
@@ -378,6 +379,10 @@ namespace Nektar
 
             NekDouble                       m_time=0.0;
 
+            /// Scratch storage reused by successive evaluations of the
+            /// operator.
+            Workspace                       m_workspace;
+
             SOLVER_UTILS_EXPORT virtual void v_InitObject(
                 LibUtilities::SessionReaderSharedPtr              pSession,
                 Array<OneD, MultiRegions::ExpListSharedPtr>       pFields)
@@ -71,6 +71,14 @@ void DiffusionLDG::v_InitObject(
         m_traceNormals[i] = Array<OneD, NekDouble>{nTracePts};
     }
     pFields[0]->GetTrace()->GetNormals(m_traceNormals);
+
+    // Reserve scratch storage for the solution and its gradient and flux
+    // in physical, coefficient and trace space
+    std::size_t nFields  = pFields.size();
+    std::size_t nPts     = pFields[0]->GetTotPoints();
+    std::size_t nCoeffs  = pFields[0]->GetNcoeffs();
+    m_workspace.Reserve(nFields * (2 * nDim * nPts + (nDim + 1) * nCoeffs +
+                                   (3 * nDim + 5) * nTracePts));
 }
 
 void DiffusionLDG::v_Diffuse(
@@ -83,11 +91,9 @@ void DiffusionLDG::v_Diffuse(
 {
     std::size_t nCoeffs   = fields[0]->GetNcoeffs();
 
-    Array<OneD, Array<OneD, NekDouble> >  tmp{nConvectiveFields};
-    for (std::size_t i=0; i < nConvectiveFields; ++i)
-    {
-        tmp[i] = Array<OneD, NekDouble> {nCoeffs, 0.0};
-    }
+    Workspace::Scope scope(m_workspace);
+    Array<OneD, Array<OneD, NekDouble> >  tmp =
+        m_workspace.GetArrays(nConvectiveFields, nCoeffs, 0.0);
 
     DiffusionLDG::v_DiffuseCoeffs(nConvectiveFields, fields, inarray, tmp,
                                     pFwd, pBwd);
@@ -111,23 +117,16 @@ void DiffusionLDG::v_DiffuseCoeffs(
     std::size_t nCoeffs   = fields[0]->GetNcoeffs();
     std::size_t nTracePts = fields[0]->GetTrace()->GetTotPoints();
 
-    Array<OneD, NekDouble>  tmp{nCoeffs};
+    Workspace::Scope scope(m_workspace);
 
     TensorOfArray3D<NekDouble> qfield{nDim};
     for (std::size_t j = 0; j < nDim; ++j)
     {
-        qfield[j] = Array<OneD, Array<OneD, NekDouble> > {nConvectiveFields};
-        for (std::size_t i = 0; i < nConvectiveFields; ++i)
-        {
-            qfield[j][i] = Array<OneD, NekDouble>{nPts, 0.0};
-        }
+        qfield[j] = m_workspace.GetArrays(nConvectiveFields, nPts, 0.0);
     }
 
-    Array<OneD, Array<OneD, NekDouble > > traceflux{nConvectiveFields};
-    for (std::size_t i = 0; i < nConvectiveFields; ++i)
-    {
-        traceflux[i] = Array<OneD, NekDouble>{nTracePts, 0.0};
-    }
+    Array<OneD, Array<OneD, NekDouble > > traceflux =
+        m_workspace.GetArrays(nConvectiveFields, nTracePts, 0.0);
 
     DiffuseCalculateDerivative(fields, inarray, qfield, pFwd, pBwd);
 
@@ -135,14 +134,15 @@ void DiffusionLDG::v_DiffuseCoeffs(
     Array<OneD, Array<OneD, Array<OneD, NekDouble>>> viscTensor{nDim};
     for (std::size_t j = 0; j < nDim; ++j)
     {
-        viscTensor[j] = Array<OneD, Array<OneD, NekDouble>>{nConvectiveFields};
-        for (std::size_t i = 0; i < nConvectiveFields; ++i)
-        {
-            viscTensor[j][i] = Array<OneD, NekDouble>{nPts, 0.0};
-        }
+        viscTensor[j] = m_workspace.GetArrays(nConvectiveFields, nPts, 0.0);
     }
     DiffuseVolumeFlux(fields, inarray, qfield, viscTensor);
-    DiffuseTraceFlux(fields, inarray, qfield, viscTensor, traceflux, pFwd, pBwd);
+
+    // Start the exchange of the traces needed by the numerical flux and
+    // evaluate the volume term while it is in progress
+    Array<OneD, Array<OneD, NekDouble> > traceFwd;
+    Array<OneD, Array<OneD, NekDouble> > traceBwd;
+    BeginVectorTraceExchange(fields, inarray, viscTensor, traceFwd, traceBwd);
 
     Array<OneD, Array<OneD, NekDouble> > qdbase{nDim};
 
@@ -152,12 +152,19 @@ void DiffusionLDG::v_DiffuseCoeffs(
         {
             qdbase[j] = viscTensor[j][i];
         }
-        fields[i]->IProductWRTDerivBase(qdbase, tmp);
+        fields[i]->IProductWRTDerivBase(qdbase, outarray[i]);
+        Vmath::Neg(nCoeffs, outarray[i], 1);
+    }
+
+    fields[0]->FinishTraceExchange(traceBwd);
+    NumFluxforVector(fields, inarray, viscTensor, traceFwd, traceBwd,
+                     traceflux);
 
-        Vmath::Neg                      (nCoeffs, tmp, 1);
-        fields[i]->AddTraceIntegral     (traceflux[i], tmp);
+    for (std::size_t i = 0; i < nConvectiveFields; ++i)
+    {
+        fields[i]->AddTraceIntegral     (traceflux[i], outarray[i]);
         fields[i]->SetPhysState         (false);
-        fields[i]->MultiplyByElmtInvMass(tmp, outarray[i]);
+        fields[i]->MultiplyByElmtInvMass(outarray[i], outarray[i]);
     }
 }
 
@@ -173,25 +180,56 @@ void DiffusionLDG::v_DiffuseCalculateDerivative(
     std::size_t nCoeffs   = fields[0]->GetNcoeffs();
     std::size_t nTracePts = fields[0]->GetTrace()->GetTotPoints();
 
-    Array<OneD, NekDouble>  tmp{nCoeffs};
+    Workspace::Scope scope(m_workspace);
+
     TensorOfArray3D<NekDouble> flux {nDim};
     for (std::size_t j = 0; j < nDim; ++j)
     {
-        flux[j]   = Array<OneD, Array<OneD, NekDouble> > {nConvectiveFields};
+        flux[j]   = m_workspace.GetArrays(nConvectiveFields, nTracePts, 0.0);
+    }
+
+    // Start the exchange of the trace of the solution, unless the caller
+    // has already provided it, and evaluate the volume term meanwhile
+    Array<OneD, Array<OneD, NekDouble> > Fwd = pFwd;
+    Array<OneD, Array<OneD, NekDouble> > Bwd = pBwd;
+    bool pendingExchange = false;
+
+    if (pFwd == NullNekDoubleArrayofArray ||
+        pBwd == NullNekDoubleArrayofArray)
+    {
+        Fwd = m_workspace.GetArrays(nConvectiveFields, nTracePts, 0.0);
+        Bwd = m_workspace.GetArrays(nConvectiveFields, nTracePts, 0.0);
+        for (std::size_t i = 0; i < nConvectiveFields; ++i)
+        {
+            fields[i]->GetFwdBwdTracePhysSerial(inarray[i], Fwd[i], Bwd[i]);
+        }
+        fields[0]->BeginTraceExchange(Fwd);
+        pendingExchange = true;
+    }
+
+    TensorOfArray3D<NekDouble> qcoeffs{nDim};
+    for (std::size_t j = 0; j < nDim; ++j)
+    {
+        qcoeffs[j] = m_workspace.GetArrays(nConvectiveFields, nCoeffs);
         for (std::size_t i = 0; i < nConvectiveFields; ++i)
         {
-            flux[j][i]   = Array<OneD, NekDouble>{nTracePts, 0.0};
+            fields[i]->IProductWRTDerivBase(j, inarray[i], qcoeffs[j][i]);
+            Vmath::Neg(nCoeffs, qcoeffs[j][i], 1);
         }
     }
 
-    NumFluxforScalar(fields, inarray, flux, pFwd, pBwd);
+    if (pendingExchange)
+    {
+        fields[0]->FinishTraceExchange(Bwd);
+    }
+
+    NumFluxforScalar(fields, inarray, flux, Fwd, Bwd);
 
     for (std::size_t j = 0; j < nDim; ++j)
     {
         for (std::size_t i = 0; i < nConvectiveFields; ++i)
         {
-            fields[i]->IProductWRTDerivBase(j, inarray[i], tmp);
-            Vmath::Neg                      (nCoeffs, tmp, 1);
+            Array<OneD, NekDouble> &tmp = qcoeffs[j][i];
             fields[i]->AddTraceIntegral     (flux[j][i], tmp);
             fields[i]->SetPhysState         (false);
             fields[i]->MultiplyByElmtInvMass(tmp, tmp);
@@ -235,9 +273,10 @@ void DiffusionLDG::NumFluxforScalar(
     std::size_t nvariables = fields.size();
     std::size_t nDim       = fields[0]->GetCoordim(0);
 
-    Array<OneD, NekDouble> Fwd{nTracePts};
-    Array<OneD, NekDouble> Bwd{nTracePts};
-    Array<OneD, NekDouble> fluxtemp{nTracePts, 0.0};
+    Workspace::Scope scope(m_workspace);
+    Array<OneD, NekDouble> Fwd      = m_workspace.Get(nTracePts);
+    Array<OneD, NekDouble> Bwd      = m_workspace.Get(nTracePts);
+    Array<OneD, NekDouble> fluxtemp = m_workspace.Get(nTracePts, 0.0);
 
     // Get the sign of (v \cdot n), v = an arbitrary vector
     // Evaluate upwind flux:
@@ -359,27 +398,113 @@ void DiffusionLDG::NumFluxforVector(
     std::size_t nvariables = fields.size();
     std::size_t nDim       = qfield.size();
 
-    Array<OneD, NekDouble> Fwd{nTracePts};
-    Array<OneD, NekDouble> Bwd{nTracePts};
-    Array<OneD, NekDouble> qFwd{nTracePts};
-    Array<OneD, NekDouble> qBwd{nTracePts};
-    Array<OneD, NekDouble> qfluxtemp{nTracePts, 0.0};
-    Array<OneD, NekDouble> uterm{nTracePts};
+    // There is no local work to overlap with the exchange here, so the
+    // traces are exchanged with the blocking calls
+    Workspace::Scope scope(m_workspace);
+    Array<OneD, Array<OneD, NekDouble> > traceFwd =
+        m_workspace.GetArrays((nDim + 1) * nvariables, nTracePts, 0.0);
+    Array<OneD, Array<OneD, NekDouble> > traceBwd =
+        m_workspace.GetArrays((nDim + 1) * nvariables, nTracePts, 0.0);
+
+    for (std::size_t i = 0; i < nvariables; ++i)
+    {
+        fields[i]->GetFwdBwdTracePhys(ufield[i], traceFwd[i], traceBwd[i]);
+        for (std::size_t j = 0; j < nDim; ++j)
+        {
+            std::size_t k = (j + 1) * nvariables + i;
+            fields[i]->GetFwdBwdTracePhys(qfield[j][i], traceFwd[k],
+                                          traceBwd[k]);
+        }
+    }
+
+    NumFluxforVector(fields, ufield, qfield, traceFwd, traceBwd, qflux);
+}
+
+/**
+ * @brief Fill the forwards and backwards traces of @a ufield and @a qfield
+ * used by NumFluxforVector and start their exchange across partitions.
+ *
+ * The traces of the variables of @a ufield come first, followed by those of
+ * each direction of @a qfield. The exchange must be completed with
+ * ExpList::FinishTraceExchange before the backwards traces are used. The
+ * traces are taken from the workspace and are valid until the caller's
+ * Workspace::Scope ends.
+ */
+void DiffusionLDG::BeginVectorTraceExchange(
+    const Array<OneD, MultiRegions::ExpListSharedPtr> &fields,
+    const Array<OneD, Array<OneD, NekDouble>> &ufield,
+    Array<OneD, Array<OneD, Array<OneD, NekDouble>>> &qfield,
+    Array<OneD, Array<OneD, NekDouble>> &traceFwd,
+    Array<OneD, Array<OneD, NekDouble>> &traceBwd)
+{
+    std::size_t nTracePts  = fields[0]->GetTrace()->GetTotPoints();
+    std::size_t nvariables = fields.size();
+    std::size_t nDim       = qfield.size();
+
+    traceFwd = m_workspace.GetArrays((nDim + 1) * nvariables, nTracePts, 0.0);
+    traceBwd = m_workspace.GetArrays((nDim + 1) * nvariables, nTracePts, 0.0);
+
+    for (std::size_t i = 0; i < nvariables; ++i)
+    {
+        fields[i]->GetFwdBwdTracePhysSerial(ufield[i], traceFwd[i],
+                                            traceBwd[i]);
+        for (std::size_t j = 0; j < nDim; ++j)
+        {
+            std::size_t k = (j + 1) * nvariables + i;
+            fields[i]->GetFwdBwdTracePhysSerial(qfield[j][i], traceFwd[k],
+                                                traceBwd[k]);
+        }
+    }
+
+    fields[0]->BeginTraceExchange(traceFwd);
+}
+
+/**
+ * @brief Build the numerical flux for the 2nd order derivatives from the
+ * traces filled by BeginVectorTraceExchange.
+ */
+void DiffusionLDG::NumFluxforVector(
+    const Array<OneD, MultiRegions::ExpListSharedPtr> &fields,
+    const Array<OneD, Array<OneD, NekDouble>> &ufield,
+    Array<OneD, Array<OneD, Array<OneD, NekDouble>>> &qfield,
+    const Array<OneD, Array<OneD, NekDouble>> &traceFwd,
+    const Array<OneD, Array<OneD, NekDouble>> &traceBwd,
+    Array<OneD, Array<OneD, NekDouble>> &qflux)
+{
+    boost::ignore_unused(ufield);
+
+    std::size_t nTracePts  = fields[0]->GetTrace()->GetTotPoints();
+    std::size_t nvariables = fields.size();
+    std::size_t nDim       = qfield.size();
+
+    Workspace::Scope scope(m_workspace);
+    Array<OneD, NekDouble> qfluxtemp = m_workspace.Get(nTracePts, 0.0);
+    Array<OneD, NekDouble> uterm     = m_workspace.Get(nTracePts);
 
     // Evaulate upwind flux:
     // qflux = \hat{q} \cdot u = q \cdot n - C_(11)*(u^+ - u^-)
     for (std::size_t i = 0; i < nvariables; ++i)
     {
         // Generate Stability term = - C11 ( u- - u+ )
-        fields[i]->GetFwdBwdTracePhys(ufield[i], Fwd, Bwd);
-        Vmath::Vsub(nTracePts, Fwd, 1, Bwd, 1, uterm, 1);
+        Vmath::Vsub(nTracePts, traceFwd[i], 1, traceBwd[i], 1, uterm, 1);
         Vmath::Smul(nTracePts, -m_C11, uterm, 1, uterm, 1);
 
-        qflux[i] = Array<OneD, NekDouble>{nTracePts, 0.0};
+        // Reuse the storage of qflux if the caller has provided it
+        if (qflux[i].size() == nTracePts)
+        {
+            Vmath::Zero(nTracePts, qflux[i], 1);
+        }
+        else
+        {
+            qflux[i] = Array<OneD, NekDouble>{nTracePts, 0.0};
+        }
         for (std::size_t j = 0; j < nDim; ++j)
         {
-            //  Compute Fwd and Bwd value of ufield of jth direction
-            fields[i]->GetFwdBwdTracePhys(qfield[j][i], qFwd, qBwd);
+            //  Fwd and Bwd value of ufield of jth direction
+            const Array<OneD, NekDouble> &qFwd =
+                traceFwd[(j + 1) * nvariables + i];
+            const Array<OneD, NekDouble> &qBwd =
+                traceBwd[(j + 1) * nvariables + i];
 
             // Downwind
             Vmath::Vcopy(nTracePts, qBwd, 1, qfluxtemp, 1);
@@ -130,6 +130,21 @@ namespace Nektar
                 TensorOfArray3D<NekDouble>                              &qfield,
                 Array<OneD, Array<OneD, NekDouble> >                    &qflux);
 
+            void NumFluxforVector(
+                const Array<OneD, MultiRegions::ExpListSharedPtr>       &fields,
+                const Array<OneD, Array<OneD, NekDouble> >              &ufield,
+                TensorOfArray3D<NekDouble>                              &qfield,
+                const Array<OneD, Array<OneD, NekDouble> >              &traceFwd,
+                const Array<OneD, Array<OneD, NekDouble> >              &traceBwd,
+                Array<OneD, Array<OneD, NekDouble> >                    &qflux);
+
+            void BeginVectorTraceExchange(
+                const Array<OneD, MultiRegions::ExpListSharedPtr>       &fields,
+                const Array<OneD, Array<OneD, NekDouble> >              &ufield,
+                TensorOfArray3D<NekDouble>                              &qfield,
+                Array<OneD, Array<OneD, NekDouble> >                    &traceFwd,
+                Array<OneD, Array<OneD, NekDouble> >                    &traceBwd);
+
             void ApplyVectorBCs(
                 const Array<OneD, MultiRegions::ExpListSharedPtr> &fields,
                 const std::size_t                                  var,
@@ -153,6 +153,11 @@ namespace Nektar
                 }
             }
 
+            // Reserve scratch storage for the temporaries of v_Diffuse and
+            // of the interface fluxes
+            int nCoeffs = pFields[0]->GetNcoeffs();
+            m_workspace.Reserve(nConvectiveFields * nCoeffs +
+                                2 * nSolutionPts + 8 * nTracePts);
         }
 
         /**
@@ -874,11 +879,9 @@ namespace Nektar
             int nSolutionPts = fields[0]->GetTotPoints();
             int nCoeffs      = fields[0]->GetNcoeffs();
 
-            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff(nConvectiveFields);
-            for (i = 0; i < nConvectiveFields; ++i)
-            {
-                outarrayCoeff[i]  = Array<OneD, NekDouble>(nCoeffs);
-            }
+            Workspace::Scope scope(m_workspace);
+            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff =
+                m_workspace.GetArrays(nConvectiveFields, nCoeffs);
 
             // Compute interface numerical fluxes for inarray in physical space
             v_NumFluxforScalar(fields, inarray, m_IF1);
@@ -964,14 +967,17 @@ namespace Nektar
                 // 2D problems
                 case 2:
                 {
+                    // Temporary vectors, overwritten for each field and
+                    // direction
+                    Array<OneD, NekDouble> u1_hat =
+                        m_workspace.Get(nSolutionPts);
+                    Array<OneD, NekDouble> u2_hat =
+                        m_workspace.Get(nSolutionPts);
+
                     for(i = 0; i < nConvectiveFields; ++i)
                     {
                         for (j = 0; j < nDim; ++j)
                         {
-                            // Temporary vectors
-                            Array<OneD, NekDouble> u1_hat(nSolutionPts, 0.0);
-                            Array<OneD, NekDouble> u2_hat(nSolutionPts, 0.0);
-
                             if (j == 0)
                             {
                                 Vmath::Vmul(nSolutionPts, &inarray[i][0], 1,
@@ -1082,11 +1088,11 @@ namespace Nektar
 
                     // Computing the standard second-order discontinuous
                     // derivatives
+                    Array<OneD, NekDouble> f_hat = u1_hat;
+                    Array<OneD, NekDouble> g_hat = u2_hat;
+
                     for (i = 0; i < nConvectiveFields; ++i)
                     {
-                        Array<OneD, NekDouble> f_hat(nSolutionPts, 0.0);
-                        Array<OneD, NekDouble> g_hat(nSolutionPts, 0.0);
-
                         for (j = 0; j < nSolutionPts; j++)
                         {
                             f_hat[j] = (m_D1[i][0][j] * m_gmat[0][j] +
@@ -1173,10 +1179,11 @@ namespace Nektar
             int nvariables = fields.size();
             int nDim       = fields[0]->GetCoordim(0);
 
-            Array<OneD, NekDouble > Fwd     (nTracePts);
-            Array<OneD, NekDouble > Bwd     (nTracePts);
-            Array<OneD, NekDouble > Vn      (nTracePts, 0.0);
-            Array<OneD, NekDouble > fluxtemp(nTracePts, 0.0);
+            Workspace::Scope scope(m_workspace);
+            Array<OneD, NekDouble > Fwd      = m_workspace.Get(nTracePts);
+            Array<OneD, NekDouble > Bwd      = m_workspace.Get(nTracePts);
+            Array<OneD, NekDouble > Vn       = m_workspace.Get(nTracePts, 0.0);
+            Array<OneD, NekDouble > fluxtemp = m_workspace.Get(nTracePts, 0.0);
 
             // Get the normal velocity Vn
             for (i = 0; i < nDim; ++i)
@@ -1318,14 +1325,12 @@ namespace Nektar
             int nDim       = fields[0]->GetCoordim(0);
 
             NekDouble C11 = 0.0;
-            Array<OneD, NekDouble > Fwd(nTracePts);
-            Array<OneD, NekDouble > Bwd(nTracePts);
-            Array<OneD, NekDouble > Vn (nTracePts, 0.0);
+            Workspace::Scope scope(m_workspace);
+            Array<OneD, NekDouble > Vn = m_workspace.Get(nTracePts, 0.0);
 
-            Array<OneD, NekDouble > qFwd     (nTracePts);
-            Array<OneD, NekDouble > qBwd     (nTracePts);
-            Array<OneD, NekDouble > qfluxtemp(nTracePts, 0.0);
-            Array<OneD, NekDouble > uterm(nTracePts);
+            Array<OneD, NekDouble > qFwd      = m_workspace.Get(nTracePts);
+            Array<OneD, NekDouble > qBwd      = m_workspace.Get(nTracePts);
+            Array<OneD, NekDouble > qfluxtemp = m_workspace.Get(nTracePts, 0.0);
 
             // Get the normal velocity Vn
             for(i = 0; i < nDim; ++i)
@@ -1338,7 +1343,15 @@ namespace Nektar
             // qflux = \hat{q} \cdot u = q \cdot n - C_(11)*(u^+ - u^-)
             for (i = 0; i < nvariables; ++i)
             {
-                qflux[i] = Array<OneD, NekDouble> (nTracePts, 0.0);
+                // Reuse the storage of qflux if the caller has provided it
+                if (qflux[i].size() == size_t(nTracePts))
+                {
+                    Vmath::Zero(nTracePts, qflux[i], 1);
+                }
+                else
+                {
+                    qflux[i] = Array<OneD, NekDouble> (nTracePts, 0.0);
+                }
                 for (j = 0; j < nDim; ++j)
                 {
                     //  Compute Fwd and Bwd value of ufield of jth direction
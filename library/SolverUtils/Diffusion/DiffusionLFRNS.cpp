@@ -929,11 +929,9 @@ namespace Nektar
             int nSolutionPts = fields[0]->GetTotPoints();
             int nCoeffs      = fields[0]->GetNcoeffs();
 
-            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff(nConvectiveFields);
-            for (i = 0; i < nConvectiveFields; ++i)
-            {
-                outarrayCoeff[i]  = Array<OneD, NekDouble>(nCoeffs);
-            }
+            Workspace::Scope scope(m_workspace);
+            Array<OneD, Array<OneD, NekDouble> > outarrayCoeff =
+                m_workspace.GetArrays(nConvectiveFields, nCoeffs);
 
             // Compute interface numerical fluxes for inarray in physical space
             v_NumericalFluxO1(fields, inarray, m_IF1);
@@ -1250,8 +1248,8 @@ namespace Nektar
             int nScalars  = inarray.size();
             int nDim      = fields[0]->GetCoordim(0);
 
-            Array<OneD, NekDouble > Vn      (nTracePts, 0.0);
-            Array<OneD, NekDouble > fluxtemp(nTracePts, 0.0);
+            Workspace::Scope scope(m_workspace);
+            Array<OneD, NekDouble > Vn = m_workspace.Get(nTracePts, 0.0);
 
             // Get the normal velocity Vn
             for (i = 0; i < nDim; ++i)
@@ -1262,15 +1260,15 @@ namespace Nektar
             }
 
             // Store forwards/backwards space along trace space
-            Array<OneD, Array<OneD, NekDouble> > Fwd    (nScalars);
-            Array<OneD, Array<OneD, NekDouble> > Bwd    (nScalars);
-            Array<OneD, Array<OneD, NekDouble> > numflux(nScalars);
+            Array<OneD, Array<OneD, NekDouble> > Fwd     =
+                m_workspace.GetArrays(nScalars, nTracePts);
+            Array<OneD, Array<OneD, NekDouble> > Bwd     =
+                m_workspace.GetArrays(nScalars, nTracePts);
+            Array<OneD, Array<OneD, NekDouble> > numflux =
+                m_workspace.GetArrays(nScalars, nTracePts);
 
             for (i = 0; i < nScalars; ++i)
             {
-                Fwd[i]     = Array<OneD, NekDouble>(nTracePts);
-                Bwd[i]     = Array<OneD, NekDouble>(nTracePts);
-                numflux[i] = Array<OneD, NekDouble>(nTracePts);
                 fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
                 fields[0]->GetTrace()->Upwind(Vn, Fwd[i], Bwd[i], numflux[i]);
             }
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TimingAssemblyCommDG.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Benchmark of the DG trace exchange methods between partitions.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/AssemblyMap/AssemblyCommDG.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+#include <MultiRegions/DisContField1D.h>
+#include <MultiRegions/DisContField2D.h>
+#include <MultiRegions/DisContField3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+#include "TimingUtils.h"
+
+using namespace std;
+using namespace Nektar;
+
+MultiRegions::ExpListSharedPtr SetupDisContField(
+    LibUtilities::SessionReaderSharedPtr session,
+    SpatialDomains::MeshGraphSharedPtr   graph)
+{
+    const string var = session->GetVariable(0);
+
+    switch (graph->GetMeshDimension())
+    {
+        case 1:
+            return MemoryManager<MultiRegions::DisContField1D>::
+                AllocateSharedPtr(session, graph, var);
+        case 2:
+            return MemoryManager<MultiRegions::DisContField2D>::
+                AllocateSharedPtr(session, graph, var);
+        case 3:
+            return MemoryManager<MultiRegions::DisContField3D>::
+                AllocateSharedPtr(session, graph, var);
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    return MultiRegions::ExpListSharedPtr();
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReader::RegisterCmdLineArgument(
+        "json", "j", "Write results as JSON to the given file.");
+    LibUtilities::SessionReaderSharedPtr session
+        = LibUtilities::SessionReader::CreateInstance(argc, argv);
+    LibUtilities::CommSharedPtr comm = session->GetComm();
+
+    int Ntest, Nrepeat;
+    session->LoadParameter("Ntest",   Ntest,   100);
+    session->LoadParameter("Nrepeat", Nrepeat, 5);
+
+    string json = session->DefinesCmdLineArgument("json") ?
+        session->GetCmdLineArgument<string>("json") : "";
+
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+
+    Timings::Suite suite("AssemblyCommDG", Ntest, Nrepeat, comm);
+
+    // Setting up the trace map times every exchange method and keeps the
+    // fastest one.
+    MultiRegions::ExpListSharedPtr field = SetupDisContField(session, graph);
+    MultiRegions::AssemblyCommDGSharedPtr assemblyComm =
+        field->GetTraceMap()->GetAssemblyCommDG();
+
+    const int ntrace = field->GetTrace()->GetNpoints();
+    Timings::Params params = {{"ntrace", to_string(ntrace)}};
+
+    if (comm->IsSerial())
+    {
+        suite.Skip("ExchangeMethod", params, "no exchange in serial");
+    }
+
+    // These are measured over 50 exchanges by AssemblyCommDG; the minimum
+    // and maximum are taken over ranks rather than repeats.
+    for (auto &timing : assemblyComm->GetExchangeTimings())
+    {
+        Timings::Result res;
+        res.name    = "ExchangeMethod";
+        res.params  = params;
+        res.params.push_back(make_pair("method", timing.first));
+        res.ntest   = 50;
+        res.nrepeat = 1;
+        tie(res.avg, res.min, res.max) = timing.second;
+        suite.Add(res);
+    }
+
+    Array<OneD, NekDouble> phys(field->GetNpoints(), 1.0);
+    Array<OneD, NekDouble> fwd(ntrace, 0.0), bwd(ntrace, 0.0);
+
+    suite.Run("PerformExchange", params, [&]() {
+        assemblyComm->PerformExchange(fwd, bwd);
+    });
+
+    suite.Run("GetFwdBwdTracePhys", params, [&]() {
+        field->GetFwdBwdTracePhys(phys, fwd, bwd);
+    });
+
+    suite.Write(json);
+    session->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TimingCollections.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Benchmark of the collection operators for each shape in a
+// mesh, polynomial order and implementation.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ExpList1D.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <Collections/Collection.h>
+#include <SpatialDomains/MeshGraph.h>
+
+#include "TimingUtils.h"
+
+using namespace std;
+using namespace Nektar;
+
+MultiRegions::ExpListSharedPtr SetupExpList(
+    LibUtilities::SessionReaderSharedPtr session,
+    SpatialDomains::MeshGraphSharedPtr   graph)
+{
+    switch (graph->GetMeshDimension())
+    {
+        case 1:
+            return MemoryManager<MultiRegions::ExpList1D>::AllocateSharedPtr(
+                session, graph);
+        case 2:
+            return MemoryManager<MultiRegions::ExpList2D>::AllocateSharedPtr(
+                session, graph);
+        case 3:
+            return MemoryManager<MultiRegions::ExpList3D>::AllocateSharedPtr(
+                session, graph);
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    return MultiRegions::ExpListSharedPtr();
+}
+
+/**
+ * Time a single operator of collection @p coll, which contains @p nElmt
+ * copies of an expansion with @p nq points, @p nm modes and coordinate
+ * dimension @p coordim.
+ */
+void TimeOperator(
+    Timings::Suite                   &suite,
+    const Timings::Params            &params,
+    Collections::Collection          &coll,
+    Collections::OperatorType         op,
+    int                               nElmt,
+    int                               nq,
+    int                               nm,
+    int                               coordim)
+{
+    // Scaled quadrature has at most twice as many points in each direction.
+    int nqScaled = nq;
+    for (int i = 0; i < coordim; ++i)
+    {
+        nqScaled *= 2;
+    }
+
+    Array<OneD, NekDouble> phys (nElmt*nqScaled, 1.0);
+    Array<OneD, NekDouble> coeffs(nElmt*nm, 1.0);
+    Array<OneD, Array<OneD, NekDouble> > out(3);
+    for (int i = 0; i < 3; ++i)
+    {
+        out[i] = Array<OneD, NekDouble>(nElmt*nqScaled, 0.0);
+    }
+
+    StdRegions::ConstFactorMap factors;
+    factors[StdRegions::eFactorLambda] = 1.0;
+    factors[StdRegions::eFactorConst]  = 1.5;
+
+    string name = Collections::OperatorTypeMap[op];
+
+    switch (op)
+    {
+        case Collections::eBwdTrans:
+            suite.Run(name, params, [&]() {
+                coll.ApplyOperator(op, coeffs, out[0]);
+            });
+            break;
+        case Collections::eIProductWRTBase:
+        case Collections::eFwdTrans:
+        case Collections::ePhysDerivIProductWRTDerivBase:
+            suite.Run(name, params, [&]() {
+                coll.ApplyOperator(op, phys, coeffs);
+            });
+            break;
+        case Collections::eIProductWRTDerivBase:
+            suite.Run(name, params, [&]() {
+                switch (coordim)
+                {
+                    case 1:
+                        coll.ApplyOperator(op, phys, coeffs);
+                        break;
+                    case 2:
+                        coll.ApplyOperator(op, phys, out[0], coeffs);
+                        break;
+                    default:
+                        coll.ApplyOperator(op, phys, out[0], out[1], coeffs);
+                        break;
+                }
+            });
+            break;
+        case Collections::ePhysDeriv:
+            suite.Run(name, params, [&]() {
+                coll.ApplyOperator(op, phys, out[0], out[1], out[2]);
+            });
+            break;
+        case Collections::eHelmholtz:
+        case Collections::eLaplacian:
+            coll.UpdateFactors(op, factors);
+            suite.Run(name, params, [&]() {
+                coll.ApplyOperator(op, coeffs, out[0]);
+            });
+            break;
+        case Collections::ePhysInterp1DScaled:
+        case Collections::ePhysGalerkinProjection1DScaled:
+            coll.UpdateFactors(op, factors);
+            suite.Run(name, params, [&]() {
+                coll.ApplyOperator(op, phys, out[0]);
+            });
+            break;
+        default:
+            suite.Skip(name, params, "no benchmark for this operator");
+            break;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReader::RegisterCmdLineArgument(
+        "json", "j", "Write results as JSON to the given file.");
+    LibUtilities::SessionReaderSharedPtr session
+        = LibUtilities::SessionReader::CreateInstance(argc, argv);
+
+    int Ntest, Nrepeat, minOrder, maxOrder;
+    session->LoadParameter("Ntest",    Ntest,    100);
+    session->LoadParameter("Nrepeat",  Nrepeat,  5);
+    session->LoadParameter("minOrder", minOrder, 1);
+    session->LoadParameter("maxOrder", maxOrder, 8);
+
+    string json = session->DefinesCmdLineArgument("json") ?
+        session->GetCmdLineArgument<string>("json") : "";
+
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+
+    Timings::Suite suite("Collections", Ntest, Nrepeat);
+
+    for (int P = minOrder; P <= maxOrder; ++P)
+    {
+        graph->SetExpansionsToPolyOrder(P + 1);
+        MultiRegions::ExpListSharedPtr expList = SetupExpList(session, graph);
+
+        // Group the elements by shape, keeping nodal expansions apart.
+        map<pair<LibUtilities::ShapeType, bool>,
+            vector<StdRegions::StdExpansionSharedPtr> > groups;
+        for (int i = 0; i < expList->GetExpSize(); ++i)
+        {
+            StdRegions::StdExpansionSharedPtr exp = expList->GetExp(i);
+            groups[make_pair(exp->DetShapeType(),
+                             exp->IsNodalNonTensorialExp())].push_back(exp);
+        }
+
+        for (auto &group : groups)
+        {
+            vector<StdRegions::StdExpansionSharedPtr> &exps = group.second;
+            StdRegions::StdExpansionSharedPtr exp = exps[0];
+
+            string shape = LibUtilities::ShapeTypeMap[group.first.first];
+            if (group.first.second)
+            {
+                shape += "Nodal";
+            }
+
+            for (int imp = Collections::eNoCollection;
+                 imp < Collections::SIZE_ImplementationType; ++imp)
+            {
+                for (int i = 0; i < Collections::SIZE_OperatorType; ++i)
+                {
+                    Collections::OperatorType op =
+                        (Collections::OperatorType)i;
+                    Collections::ImplementationType impType =
+                        (Collections::ImplementationType)imp;
+
+                    Timings::Params params = {
+                        {"shape", shape},
+                        {"order", to_string(P)},
+                        {"impl", Collections::ImplementationTypeMap[imp]},
+                        {"nelmt", to_string(exps.size())}
+                    };
+
+                    Collections::OperatorKey key(
+                        group.first.first, op, impType, group.first.second);
+                    if (!Collections::GetOperatorFactory().ModuleExists(key))
+                    {
+                        suite.Skip(Collections::OperatorTypeMap[op], params,
+                                   "not implemented");
+                        continue;
+                    }
+
+                    Collections::OperatorImpMap impTypes;
+                    impTypes[op] = impType;
+                    Collections::Collection coll(exps, impTypes);
+
+                    TimeOperator(suite, params, coll, op, exps.size(),
+                                 exp->GetTotPoints(), exp->GetNcoeffs(),
+                                 exp->GetCoordim());
+                }
+            }
+        }
+    }
+
+    suite.Write(json);
+    session->Finalise();
+
+    return 0;
+}
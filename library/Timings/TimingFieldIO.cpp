@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TimingFieldIO.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Benchmark of writing and reading field files in each of the
+// available formats.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/FieldIO.h>
+#include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ExpList1D.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+#include "TimingUtils.h"
+
+using namespace std;
+using namespace Nektar;
+
+MultiRegions::ExpListSharedPtr SetupExpList(
+    LibUtilities::SessionReaderSharedPtr session,
+    SpatialDomains::MeshGraphSharedPtr   graph)
+{
+    switch (graph->GetMeshDimension())
+    {
+        case 1:
+            return MemoryManager<MultiRegions::ExpList1D>::AllocateSharedPtr(
+                session, graph);
+        case 2:
+            return MemoryManager<MultiRegions::ExpList2D>::AllocateSharedPtr(
+                session, graph);
+        case 3:
+            return MemoryManager<MultiRegions::ExpList3D>::AllocateSharedPtr(
+                session, graph);
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    return MultiRegions::ExpListSharedPtr();
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReader::RegisterCmdLineArgument(
+        "json", "j", "Write results as JSON to the given file.");
+    LibUtilities::SessionReaderSharedPtr session
+        = LibUtilities::SessionReader::CreateInstance(argc, argv);
+    LibUtilities::CommSharedPtr comm = session->GetComm();
+
+    int Ntest, Nrepeat;
+    session->LoadParameter("Ntest",   Ntest,   3);
+    session->LoadParameter("Nrepeat", Nrepeat, 3);
+
+    string json = session->DefinesCmdLineArgument("json") ?
+        session->GetCmdLineArgument<string>("json") : "";
+
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+    MultiRegions::ExpListSharedPtr field = SetupExpList(session, graph);
+
+    vector<string> vars = session->GetVariables();
+    if (vars.empty())
+    {
+        vars.push_back("u");
+    }
+
+    // Fill the field definitions with one copy of the coefficients for each
+    // variable.
+    Array<OneD, NekDouble> coeffs(field->GetNcoeffs());
+    for (int i = 0; i < coeffs.size(); ++i)
+    {
+        coeffs[i] = 1.0 / (1.0 + i);
+    }
+
+    vector<LibUtilities::FieldDefinitionsSharedPtr> fieldDef =
+        field->GetFieldDefinitions();
+    vector<vector<NekDouble> > fieldData(fieldDef.size());
+    for (int i = 0; i < fieldDef.size(); ++i)
+    {
+        for (auto &var : vars)
+        {
+            fieldDef[i]->m_fields.push_back(var);
+            field->AppendFieldData(fieldDef[i], fieldData[i], coeffs);
+        }
+    }
+
+    Timings::Suite suite("FieldIO", Ntest, Nrepeat, comm);
+
+    for (const string format : {"Xml", "Hdf5"})
+    {
+        Timings::Params params = {
+            {"format", format},
+            {"nvar",   to_string(vars.size())},
+            {"ncoeffs", to_string(field->GetNcoeffs())}
+        };
+
+        if (!LibUtilities::GetFieldIOFactory().ModuleExists(format))
+        {
+            suite.Skip("Write", params, "format not available in this build");
+            suite.Skip("Read",  params, "format not available in this build");
+            continue;
+        }
+
+        LibUtilities::FieldIOSharedPtr fio =
+            LibUtilities::GetFieldIOFactory().CreateInstance(
+                format, comm, session->GetSharedFilesystem());
+
+        const string filename =
+            session->GetSessionName() + "_timing_" + format + ".fld";
+
+        suite.Run("Write", params, [&]() {
+            fio->Write(filename, fieldDef, fieldData);
+        });
+
+        suite.Run("Read", params, [&]() {
+            vector<LibUtilities::FieldDefinitionsSharedPtr> inDef;
+            vector<vector<NekDouble> > inData;
+            fio->Import(filename, inDef, inData);
+        });
+
+        comm->Block();
+        if (comm->GetRank() == 0)
+        {
+            fs::remove_all(filename);
+        }
+    }
+
+    suite.Write(json);
+    session->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TimingGlobalLinSys.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Benchmark of the Helmholtz solve for each global linear system
+// type and preconditioner.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ContField1D.h>
+#include <MultiRegions/ContField2D.h>
+#include <MultiRegions/ContField3D.h>
+#include <SpatialDomains/MeshGraph.h>
+
+#include "TimingUtils.h"
+
+using namespace std;
+using namespace Nektar;
+
+MultiRegions::ExpListSharedPtr SetupContField(
+    LibUtilities::SessionReaderSharedPtr session,
+    SpatialDomains::MeshGraphSharedPtr   graph)
+{
+    const string var = session->GetVariable(0);
+
+    switch (graph->GetMeshDimension())
+    {
+        case 1:
+            return MemoryManager<MultiRegions::ContField1D>::
+                AllocateSharedPtr(session, graph, var);
+        case 2:
+            return MemoryManager<MultiRegions::ContField2D>::
+                AllocateSharedPtr(session, graph, var);
+        case 3:
+            return MemoryManager<MultiRegions::ContField3D>::
+                AllocateSharedPtr(session, graph, var);
+        default:
+            NEKERROR(ErrorUtil::efatal, "Unsupported mesh dimension");
+    }
+
+    return MultiRegions::ExpListSharedPtr();
+}
+
+int main(int argc, char *argv[])
+{
+    LibUtilities::SessionReader::RegisterCmdLineArgument(
+        "json", "j", "Write results as JSON to the given file.");
+    LibUtilities::SessionReaderSharedPtr session
+        = LibUtilities::SessionReader::CreateInstance(argc, argv);
+    LibUtilities::CommSharedPtr comm = session->GetComm();
+
+    int Ntest, Nrepeat;
+    NekDouble lambda;
+    session->LoadParameter("Ntest",   Ntest,   10);
+    session->LoadParameter("Nrepeat", Nrepeat, 3);
+    session->LoadParameter("Lambda",  lambda,  1.0);
+
+    string json = session->DefinesCmdLineArgument("json") ?
+        session->GetCmdLineArgument<string>("json") : "";
+
+    SpatialDomains::MeshGraphSharedPtr graph =
+        SpatialDomains::MeshGraph::Read(session);
+
+    Timings::Suite suite("GlobalLinSys", Ntest, Nrepeat, comm);
+
+    StdRegions::ConstFactorMap factors;
+    factors[StdRegions::eFactorLambda] = lambda;
+
+    const int nPrecon = sizeof(MultiRegions::PreconditionerTypeMap) /
+                        sizeof(MultiRegions::PreconditionerTypeMap[0]);
+
+    for (int s = MultiRegions::eDirectFullMatrix;
+         s < MultiRegions::eSIZE_GlobalSysSolnType; ++s)
+    {
+        const string solnType = MultiRegions::GlobalSysSolnTypeMap[s];
+        const bool iterative =
+            s == MultiRegions::eIterativeFull ||
+            s == MultiRegions::eIterativeStaticCond ||
+            s == MultiRegions::eIterativeMultiLevelStaticCond;
+
+        // Preconditioners only apply to the iterative solvers.
+        for (int p = 0; p < (iterative ? nPrecon : 1); ++p)
+        {
+            const string precon =
+                iterative ? MultiRegions::PreconditionerTypeMap[p] : "None";
+
+            Timings::Params params = {
+                {"GlobalSysSoln",  solnType},
+                {"Preconditioner", precon}
+            };
+
+            session->SetSolverInfo("GlobalSysSoln", solnType);
+            if (iterative)
+            {
+                session->SetSolverInfo("Preconditioner", precon);
+            }
+
+            MultiRegions::ExpListSharedPtr field;
+            try
+            {
+                field = SetupContField(session, graph);
+            }
+            catch (const ErrorUtil::NekError &e)
+            {
+                suite.Skip("HelmSolve", params, e.what());
+                continue;
+            }
+
+            const int nq = field->GetNpoints();
+            Array<OneD, NekDouble> forcing(nq, 1.0);
+            if (session->DefinesFunction("Forcing"))
+            {
+                Array<OneD, NekDouble> x0(nq), x1(nq), x2(nq);
+                field->GetCoords(x0, x1, x2);
+                session->GetFunction("Forcing", 0)->Evaluate(
+                    x0, x1, x2, forcing);
+            }
+
+            // The first solve also assembles the system and sets up the
+            // preconditioner, so it is timed separately.
+            Timings::Result setup;
+            setup.name    = "HelmSolveSetup";
+            setup.params  = params;
+            setup.ntest   = 1;
+            setup.nrepeat = 1;
+            try
+            {
+                LibUtilities::Timer timer;
+                timer.Start();
+                field->HelmSolve(forcing, field->UpdateCoeffs(), factors);
+                timer.Stop();
+
+                NekDouble elapsed = timer.TimePerTest(1);
+                comm->AllReduce(elapsed, LibUtilities::ReduceMax);
+                setup.min = setup.avg = setup.max = elapsed;
+                suite.Add(setup);
+            }
+            catch (const ErrorUtil::NekError &e)
+            {
+                suite.Skip(setup.name, params, e.what());
+                suite.Skip("HelmSolve", params, e.what());
+                continue;
+            }
+
+            suite.Run("HelmSolve", params, [&]() {
+                Vmath::Zero(field->GetNcoeffs(), field->UpdateCoeffs(), 1);
+                field->HelmSolve(forcing, field->UpdateCoeffs(), factors);
+            });
+        }
+    }
+
+    suite.Write(json);
+    session->Finalise();
+
+    return 0;
+}
@@ -0,0 +1,364 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TimingUtils.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Helpers shared by the benchmark timing codes to time a case
+// and write the results of a suite as JSON.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIBRARY_TIMINGS_TIMINGUTILS_H
+#define NEKTAR_LIBRARY_TIMINGS_TIMINGUTILS_H
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/Communication/Comm.h>
+
+#ifndef NEKTAR_VERSION
+#define NEKTAR_VERSION "Unknown"
+#endif
+
+namespace Nektar
+{
+namespace Timings
+{
+
+/// List of (name, value) pairs describing a benchmark case.
+typedef std::vector<std::pair<std::string, std::string> > Params;
+
+/// Timing of a single benchmark case, in seconds per call.
+struct Result
+{
+    std::string name;
+    Params      params;
+    int         ntest   = 0;
+    int         nrepeat = 0;
+    NekDouble   min     = 0.0;
+    NekDouble   avg     = 0.0;
+    NekDouble   max     = 0.0;
+    /// Set when the case could not be run, together with the reason.
+    bool        skipped = false;
+    std::string message;
+};
+
+/**
+ * @brief Collects the results of a benchmark suite and writes them as JSON.
+ *
+ * Each case is called once to warm up and is then timed @a nrepeat times
+ * over @a ntest calls. The minimum, average and maximum time per call over
+ * the repeats are recorded. When a communicator is supplied, the time of each
+ * repeat is the maximum across ranks and only rank zero writes the output.
+ *
+ * A case which throws a NekError, e.g. because a solver or preconditioner is
+ * not available in this build, is recorded as skipped rather than aborting
+ * the suite. With a communicator, a case failing on any rank is skipped on
+ * all of them.
+ */
+class Suite
+{
+public:
+    Suite(const std::string                 &name,
+          int                                ntest,
+          int                                nrepeat,
+          const LibUtilities::CommSharedPtr &comm =
+                                            LibUtilities::CommSharedPtr())
+        : m_name(name), m_ntest(std::max(ntest, 1)),
+          m_nrepeat(std::max(nrepeat, 1)), m_comm(comm)
+    {
+    }
+
+    /// Time @p func under the name @p name with parameters @p params.
+    template<typename F>
+    void Run(const std::string &name, const Params &params, F &&func)
+    {
+        Result res;
+        res.name    = name;
+        res.params  = params;
+        res.ntest   = m_ntest;
+        res.nrepeat = m_nrepeat;
+
+        // Every rank takes part in the same reductions whether or not its
+        // own calls failed, so that a failure on one rank is reported by all
+        // of them instead of leaving the others waiting.
+        std::vector<NekDouble> times(m_nrepeat);
+        LibUtilities::Timer timer;
+
+        bool ok = TryCall(func, res.message);
+
+        for (int r = 0; r < m_nrepeat; ++r)
+        {
+            if (!AllSucceeded(ok))
+            {
+                ok = false;
+                break;
+            }
+
+            timer.Start();
+            for (int i = 0; i < m_ntest && ok; ++i)
+            {
+                ok = TryCall(func, res.message);
+            }
+            timer.Stop();
+
+            times[r] = timer.TimePerTest(m_ntest);
+            if (m_comm)
+            {
+                m_comm->AllReduce(times[r], LibUtilities::ReduceMax);
+            }
+        }
+
+        if (!AllSucceeded(ok))
+        {
+            res.skipped = true;
+            if (res.message.empty())
+            {
+                res.message = "failed on another process";
+            }
+        }
+        else
+        {
+            res.min = *std::min_element(times.begin(), times.end());
+            res.max = *std::max_element(times.begin(), times.end());
+            for (auto &t : times)
+            {
+                res.avg += t;
+            }
+            res.avg /= m_nrepeat;
+        }
+
+        m_results.push_back(res);
+        PrintSummary(res);
+    }
+
+    /// Record a pre-computed timing, e.g. one measured inside the library.
+    void Add(const Result &res)
+    {
+        m_results.push_back(res);
+        PrintSummary(res);
+    }
+
+    /// Record a case which cannot be run in this configuration.
+    void Skip(const std::string &name, const Params &params,
+              const std::string &reason)
+    {
+        Result res;
+        res.name    = name;
+        res.params  = params;
+        res.skipped = true;
+        res.message = reason;
+        Add(res);
+    }
+
+    /// Write the results to @p filename, or to standard output if empty.
+    void Write(const std::string &filename) const
+    {
+        if (m_comm && m_comm->GetRank() != 0)
+        {
+            return;
+        }
+
+        if (filename.empty() || filename == "-")
+        {
+            Write(std::cout);
+            return;
+        }
+
+        std::ofstream out(filename.c_str());
+        ASSERTL0(out.good(), "Unable to open " + filename + " for writing.");
+        Write(out);
+    }
+
+    void Write(std::ostream &out) const
+    {
+        boost::system::error_code ec;
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ",
+                      std::gmtime(&now));
+
+        out << std::setprecision(9);
+        out << "{" << std::endl
+            << "  \"suite\": " << Quote(m_name) << "," << std::endl
+            << "  \"version\": " << Quote(NEKTAR_VERSION) << "," << std::endl
+            << "  \"date\": " << Quote(date) << "," << std::endl
+            << "  \"hostname\": "
+            << Quote(boost::asio::ip::host_name(ec)) << "," << std::endl
+            << "  \"nprocs\": " << (m_comm ? m_comm->GetSize() : 1) << ","
+            << std::endl
+            << "  \"results\": [";
+
+        for (size_t i = 0; i < m_results.size(); ++i)
+        {
+            const Result &res = m_results[i];
+
+            out << (i == 0 ? "" : ",") << std::endl
+                << "    {" << std::endl
+                << "      \"name\": " << Quote(res.name) << "," << std::endl
+                << "      \"params\": {";
+            for (size_t j = 0; j < res.params.size(); ++j)
+            {
+                out << (j == 0 ? "" : ", ") << Quote(res.params[j].first)
+                    << ": " << Quote(res.params[j].second);
+            }
+            out << "}," << std::endl;
+
+            if (res.skipped)
+            {
+                out << "      \"skipped\": true," << std::endl
+                    << "      \"message\": " << Quote(res.message)
+                    << std::endl;
+            }
+            else
+            {
+                out << "      \"ntest\": " << res.ntest << "," << std::endl
+                    << "      \"nrepeat\": " << res.nrepeat << "," << std::endl
+                    << "      \"min\": " << res.min << "," << std::endl
+                    << "      \"avg\": " << res.avg << "," << std::endl
+                    << "      \"max\": " << res.max << std::endl;
+            }
+            out << "    }";
+        }
+
+        out << std::endl << "  ]" << std::endl << "}" << std::endl;
+    }
+
+private:
+    std::string                 m_name;
+    int                         m_ntest;
+    int                         m_nrepeat;
+    LibUtilities::CommSharedPtr m_comm;
+    std::vector<Result>         m_results;
+
+    /// Call @p func, storing the message of a NekError in @p message.
+    template<typename F>
+    static bool TryCall(F &func, std::string &message)
+    {
+        try
+        {
+            func();
+        }
+        catch (const ErrorUtil::NekError &e)
+        {
+            message = e.what();
+            return false;
+        }
+        return true;
+    }
+
+    /// Return whether @p ok is set on every rank.
+    bool AllSucceeded(bool ok) const
+    {
+        int failed = ok ? 0 : 1;
+        if (m_comm)
+        {
+            m_comm->AllReduce(failed, LibUtilities::ReduceMax);
+        }
+        return failed == 0;
+    }
+
+    /// Print a one-line summary of @p res on rank zero.
+    void PrintSummary(const Result &res) const
+    {
+        if (m_comm && m_comm->GetRank() != 0)
+        {
+            return;
+        }
+
+        std::cerr << res.name;
+        for (auto &p : res.params)
+        {
+            std::cerr << " " << p.first << "=" << p.second;
+        }
+
+        if (res.skipped)
+        {
+            std::cerr << ": skipped (" << res.message << ")" << std::endl;
+        }
+        else
+        {
+            std::cerr << ": " << res.avg << " s" << std::endl;
+        }
+    }
+
+    /// Return @p str as a quoted and escaped JSON string.
+    static std::string Quote(const std::string &str)
+    {
+        std::ostringstream ss;
+        ss << '"';
+        for (auto c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    ss << "\\\"";
+                    break;
+                case '\\':
+                    ss << "\\\\";
+                    break;
+                case '\n':
+                    ss << "\\n";
+                    break;
+                case '\t':
+                    ss << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        ss << "\\u" << std::hex << std::setw(4)
+                           << std::setfill('0') << static_cast<int>(c)
+                           << std::dec << std::setfill(' ');
+                    }
+                    else
+                    {
+                        ss << c;
+                    }
+                    break;
+            }
+        }
+        ss << '"';
+        return ss.str();
+    }
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TimingVmath.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Benchmark of the Vmath kernels and dense BLAS operations for a
+// range of vector lengths.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <numeric>
+#include <random>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/program_options.hpp>
+
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+
+#include "TimingUtils.h"
+
+using namespace std;
+using namespace Nektar;
+
+namespace po = boost::program_options;
+
+int main(int argc, char *argv[])
+{
+    po::options_description desc("Available options");
+    desc.add_options()
+        ("help,h", "Produce this help message.")
+        ("ntest,n", po::value<int>()->default_value(1000),
+         "Number of calls per repeat.")
+        ("nrepeat,r", po::value<int>()->default_value(5),
+         "Number of timed repeats.")
+        ("sizes,s", po::value<string>()->default_value("64,1024,16384,262144"),
+         "Comma-separated list of vector lengths.")
+        ("json,j", po::value<string>()->default_value(""),
+         "Write results as JSON to the given file.");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+    }
+    catch (const std::exception &e)
+    {
+        cerr << e.what() << endl;
+        cerr << desc;
+        return 1;
+    }
+
+    if (vm.count("help"))
+    {
+        cout << "Usage: TimingVmath [options]" << endl;
+        cout << desc;
+        return 0;
+    }
+
+    vector<string> sizeStr;
+    boost::split(sizeStr, vm["sizes"].as<string>(), boost::is_any_of(","));
+
+    Timings::Suite suite("Vmath", vm["ntest"].as<int>(),
+                         vm["nrepeat"].as<int>());
+
+    // Results of reductions are accumulated here so that the calls are not
+    // optimised away.
+    volatile NekDouble sink = 0.0;
+
+    for (auto &s : sizeStr)
+    {
+        const int n = stoi(s);
+        Timings::Params params = {{"n", to_string(n)}};
+
+        Array<OneD, NekDouble> x(n), y(n), z(n, 0.0);
+        for (int i = 0; i < n; ++i)
+        {
+            x[i] = 1.0 + 1.0e-3 * i;
+            y[i] = 2.0 - 1.0e-3 * i;
+        }
+
+        // Fixed permutation to give the gather and scatter an irregular
+        // access pattern which is reproducible between runs.
+        Array<OneD, int> perm(n);
+        iota(perm.begin(), perm.end(), 0);
+        shuffle(perm.begin(), perm.end(), mt19937(42));
+
+        suite.Run("Vcopy", params, [&]() {
+            Vmath::Vcopy(n, x.get(), 1, z.get(), 1);
+        });
+        suite.Run("Vadd", params, [&]() {
+            Vmath::Vadd(n, x.get(), 1, y.get(), 1, z.get(), 1);
+        });
+        suite.Run("Vmul", params, [&]() {
+            Vmath::Vmul(n, x.get(), 1, y.get(), 1, z.get(), 1);
+        });
+        suite.Run("Vdiv", params, [&]() {
+            Vmath::Vdiv(n, x.get(), 1, y.get(), 1, z.get(), 1);
+        });
+        suite.Run("Smul", params, [&]() {
+            Vmath::Smul(n, 2.0, x.get(), 1, z.get(), 1);
+        });
+        suite.Run("Vvtvp", params, [&]() {
+            Vmath::Vvtvp(n, x.get(), 1, y.get(), 1, z.get(), 1, z.get(), 1);
+        });
+        suite.Run("Svtvp", params, [&]() {
+            Vmath::Svtvp(n, 2.0, x.get(), 1, y.get(), 1, z.get(), 1);
+        });
+        suite.Run("Vsqrt", params, [&]() {
+            Vmath::Vsqrt(n, x.get(), 1, z.get(), 1);
+        });
+        suite.Run("Vsum", params, [&]() {
+            sink = sink + Vmath::Vsum(n, x.get(), 1);
+        });
+        suite.Run("Dot", params, [&]() {
+            sink = sink + Vmath::Dot(n, x.get(), 1, y.get(), 1);
+        });
+        suite.Run("Gathr", params, [&]() {
+            Vmath::Gathr(n, x.get(), perm.get(), z.get());
+        });
+        suite.Run("Scatr", params, [&]() {
+            Vmath::Scatr(n, x.get(), perm.get(), z.get());
+        });
+        suite.Run("Assmb", params, [&]() {
+            Vmath::Assmb(n, x.get(), perm.get(), z.get());
+        });
+    }
+
+    // Square matrix products of the sizes met in elemental operators.
+    for (int m : {8, 16, 32, 64, 128})
+    {
+        Timings::Params params = {{"m", to_string(m)}};
+
+        Array<OneD, NekDouble> a(m*m, 1.0), b(m*m, 0.5), c(m*m, 0.0);
+
+        suite.Run("Dgemv", params, [&]() {
+            Blas::Dgemv('N', m, m, 1.0, a.get(), m, b.get(), 1, 0.0,
+                        c.get(), 1);
+        });
+        suite.Run("Dgemm", params, [&]() {
+            Blas::Dgemm('N', 'N', m, m, m, 1.0, a.get(), m, b.get(), m, 0.0,
+                        c.get(), m);
+        });
+    }
+
+    suite.Write(vm["json"].as<string>());
+
+    return 0;
+}
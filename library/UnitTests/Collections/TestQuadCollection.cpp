@@ -33,6 +33,8 @@
 #include <SpatialDomains/MeshGraph.h>
 #include <Collections/Collection.h>
 #include <Collections/CollectionOptimisation.h>
+#include <LibUtilities/Foundations/Interp.h>
+#include <LibUtilities/Foundations/PhysGalerkinProject.h>
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/test_case_template.hpp>
 #include <boost/test/floating_point_comparison.hpp>
@@ -530,6 +532,127 @@ namespace Nektar
             }
         }
 
+        BOOST_AUTO_TEST_CASE(TestQuadBwdTrans_SumFacSIMD_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacSIMD);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            Array<OneD, NekDouble> coeffs(nelmts*Exp->GetNcoeffs(), 1.0), tmp;
+            Array<OneD, NekDouble> phys1(nelmts*Exp->GetTotPoints());
+            Array<OneD, NekDouble> phys2(nelmts*Exp->GetTotPoints());
+
+            for(int i = 0; i < coeffs.size(); ++i)
+            {
+                coeffs[i] = sin(0.1*i) + 1.0;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->BwdTrans(coeffs + i*Exp->GetNcoeffs(), tmp = phys1+i*Exp->GetTotPoints());
+            }
+            c.ApplyOperator(Collections::eBwdTrans, coeffs, phys2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < phys1.size(); ++i)
+            {
+                BOOST_CHECK_CLOSE(phys1[i],phys2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadBwdTrans_SumFac_SpecialisedP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+
+            // Cover every specialised kernel, P = 1..10
+            for (int nmodes = 2; nmodes <= 11; ++nmodes)
+            {
+                const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(nmodes+1, quadPointsTypeDir1);
+                const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,nmodes,quadPointsKeyDir1);
+
+                Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                    MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                    basisKeyDir1, quadGeom);
+
+                Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                    MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                    basisKeyDir1);
+
+                int nelmts = 3;
+
+                std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+                for(int i = 0; i < nelmts; ++i)
+                {
+                    CollExp.push_back(Exp);
+                }
+
+                LibUtilities::SessionReaderSharedPtr dummySession;
+                Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+                Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+                Collections::Collection     c(CollExp, impTypes);
+
+                Array<OneD, NekDouble> coeffs(nelmts*Exp->GetNcoeffs()), tmp;
+                Array<OneD, NekDouble> phys1(nelmts*Exp->GetTotPoints());
+                Array<OneD, NekDouble> phys2(nelmts*Exp->GetTotPoints());
+
+                for(int i = 0; i < coeffs.size(); ++i)
+                {
+                    coeffs[i] = sin(0.1*i) + 1.0;
+                }
+
+                for(int i = 0; i < nelmts; ++i)
+                {
+                    Exp->BwdTrans(coeffs + i*Exp->GetNcoeffs(), tmp = phys1+i*Exp->GetTotPoints());
+                }
+                c.ApplyOperator(Collections::eBwdTrans, coeffs, phys2);
+
+                double epsilon = 1.0e-8;
+                for(int i = 0; i < phys1.size(); ++i)
+                {
+                    BOOST_CHECK_CLOSE(phys1[i],phys2[i], epsilon);
+                }
+            }
+        }
+
 
         BOOST_AUTO_TEST_CASE(TestQuadIProductWRTBase_StdMat_UniformP)
         {
@@ -893,6 +1016,143 @@ namespace Nektar
             }
         }
 
+        BOOST_AUTO_TEST_CASE(TestQuadIProductWRTBase_SumFacSIMD_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(2u, 2u,  1.0, 1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(2u, 3u, -1.0, 1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacSIMD);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            Array<OneD, NekDouble> xc(nq), yc(nq);
+
+            Exp->GetCoords(xc, yc);
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                for (int j = 0; j < nq; ++j)
+                {
+                    phys[i*nq+j] = sin(xc[j] + i)*cos(yc[j]);
+                }
+
+                Exp->IProductWRTBase(phys + i*nq, tmp = coeffs1 + i*nm);
+            }
+
+            c.ApplyOperator(Collections::eIProductWRTBase, phys, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadIProductWRTBase_SumFac_SpecialisedP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+
+            // Cover every specialised kernel, P = 1..10
+            for (int nmodes = 2; nmodes <= 11; ++nmodes)
+            {
+                const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(nmodes+1, quadPointsTypeDir1);
+                const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,nmodes,quadPointsKeyDir1);
+
+                Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                    MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                    basisKeyDir1, quadGeom);
+
+                Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                    MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                    basisKeyDir1);
+
+                int nelmts = 3;
+
+                std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+                for(int i = 0; i < nelmts; ++i)
+                {
+                    CollExp.push_back(Exp);
+                }
+
+                LibUtilities::SessionReaderSharedPtr dummySession;
+                Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+                Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+                Collections::Collection     c(CollExp, impTypes);
+
+                const int nq = Exp->GetTotPoints();
+                const int nm = Exp->GetNcoeffs();
+                Array<OneD, NekDouble> xc(nq), yc(nq), tmp;
+                Array<OneD, NekDouble> phys(nelmts*nq);
+                Array<OneD, NekDouble> coeffs1(nelmts*nm);
+                Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+                Exp->GetCoords(xc, yc);
+
+                for(int i = 0; i < nelmts; ++i)
+                {
+                    for (int j = 0; j < nq; ++j)
+                    {
+                        phys[i*nq+j] = sin(xc[j] + i)*cos(yc[j]);
+                    }
+
+                    Exp->IProductWRTBase(phys + i*nq, tmp = coeffs1 + i*nm);
+                }
+                c.ApplyOperator(Collections::eIProductWRTBase, phys, coeffs2);
+
+                // High modes of the projection are at round-off level, so
+                // compare absolutely rather than relatively.
+                double epsilon = 1.0e-12;
+                for(int i = 0; i < coeffs1.size(); ++i)
+                {
+                    BOOST_CHECK_SMALL(coeffs1[i] - coeffs2[i], epsilon);
+                }
+            }
+        }
+
         BOOST_AUTO_TEST_CASE(TestQuadPhysDeriv_IterPerExp_UniformP)
         {
             SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
@@ -1267,6 +1527,75 @@ namespace Nektar
             }
         }
 
+        BOOST_AUTO_TEST_CASE(TestQuadPhysDeriv_SumFacSIMD_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.5, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFacSIMD);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            Array<OneD, NekDouble> xc(nq), yc(nq);
+            Array<OneD, NekDouble> phys(nelmts*nq),tmp,tmp1;
+            Array<OneD, NekDouble> diff1(2*nelmts*nq);
+            Array<OneD, NekDouble> diff2(2*nelmts*nq);
+
+            Exp->GetCoords(xc, yc);
+
+            for (int i = 0; i < nq; ++i)
+            {
+                phys[i] = sin(xc[i])*cos(yc[i]);
+            }
+            Exp->PhysDeriv(phys, diff1, tmp1 = diff1 + nelmts*nq);
+            for(int i = 1; i < nelmts; ++i)
+            {
+                Vmath::Vcopy(nq,phys,1,tmp = phys+i*nq,1);
+                Exp->PhysDeriv(phys, tmp = diff1+i*nq,
+                               tmp1 = diff1+(nelmts+i)*nq);
+
+            }
+
+            c.ApplyOperator(Collections::ePhysDeriv, phys, diff2, tmp = diff2 + nelmts*nq);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < diff1.size(); ++i)
+            {
+                diff1[i] = (fabs(diff1[i]) < 1e-14)? 0.0: diff1[i];
+                diff2[i] = (fabs(diff2[i]) < 1e-14)? 0.0: diff2[i];
+                BOOST_CHECK_CLOSE(diff1[i],diff2[i], epsilon);
+            }
+        }
+
         BOOST_AUTO_TEST_CASE(TestQuadIProductWRTDerivBase_IterPerExp_UniformP)
         {
             SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
@@ -1729,5 +2058,1004 @@ namespace Nektar
                 BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
             }
         }
+
+        BOOST_AUTO_TEST_CASE(TestQuadHelmholtz_SumFac_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,6,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,4,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 2.5;
+            c.UpdateFactors(Collections::eHelmholtz, factors);
+
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> coeffsIn(nelmts*nm), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nm; ++i)
+            {
+                coeffsIn[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            StdRegions::StdMatrixKey mkey(StdRegions::eHelmholtz,
+                                          Exp->DetShapeType(), *Exp, factors);
+            for(int i = 0; i < nelmts; ++i)
+            {
+                // Standard routines
+                Exp->GeneralMatrixOp(coeffsIn + i*nm,
+                                     tmp = coeffs1 + i*nm, mkey);
+            }
+
+            c.ApplyOperator(Collections::eHelmholtz, coeffsIn, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadHelmholtz_IterPerExp_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,6,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,4,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eIterPerExp);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 2.5;
+            c.UpdateFactors(Collections::eHelmholtz, factors);
+
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> coeffsIn(nelmts*nm), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nm; ++i)
+            {
+                coeffsIn[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            StdRegions::StdMatrixKey mkey(StdRegions::eHelmholtz,
+                                          Exp->DetShapeType(), *Exp, factors);
+            for(int i = 0; i < nelmts; ++i)
+            {
+                // Standard routines
+                Exp->GeneralMatrixOp(coeffsIn + i*nm,
+                                     tmp = coeffs1 + i*nm, mkey);
+            }
+
+            c.ApplyOperator(Collections::eHelmholtz, coeffsIn, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadLaplacian_StdMat_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,6,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,4,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eStdMat);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            StdRegions::ConstFactorMap factors;
+            c.UpdateFactors(Collections::eLaplacian, factors);
+
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> coeffsIn(nelmts*nm), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nm; ++i)
+            {
+                coeffsIn[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            StdRegions::StdMatrixKey mkey(StdRegions::eLaplacian,
+                                          Exp->DetShapeType(), *Exp, factors);
+            for(int i = 0; i < nelmts; ++i)
+            {
+                // Standard routines
+                Exp->GeneralMatrixOp(coeffsIn + i*nm,
+                                     tmp = coeffs1 + i*nm, mkey);
+            }
+
+            c.ApplyOperator(Collections::eLaplacian, coeffsIn, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadFwdTrans_StdMat_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eStdMat);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->FwdTrans(phys + i*nq, tmp = coeffs1 + i*nm);
+            }
+
+            c.ApplyOperator(Collections::eFwdTrans, phys, coeffs2);
+
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(coeffs1[i] - coeffs2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadFwdTrans_SumFac_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                Exp->FwdTrans(phys + i*nq, tmp = coeffs1 + i*nm);
+            }
+
+            c.ApplyOperator(Collections::eFwdTrans, phys, coeffs2);
+
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(coeffs1[i] - coeffs2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadFwdTrans_SumFac_MixedDeformed_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v4(new SpatialDomains::PointGeom(2u, 4u, -1.0, -1.5, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom0 = CreateQuad(v0, v1, v2, v3);
+            SpatialDomains::QuadGeomSharedPtr quadGeom1 = CreateQuad(v4, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp0 =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom0);
+            Nektar::LocalRegions::QuadExpSharedPtr Exp1 =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom1);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            // Alternate undeformed and deformed elements
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                if (i % 2)
+                {
+                    CollExp.push_back(Exp1);
+                }
+                else
+                {
+                    CollExp.push_back(Exp0);
+                }
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp0->GetTotPoints();
+            const int nm = Exp0->GetNcoeffs();
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp[i]->FwdTrans(phys + i*nq, tmp = coeffs1 + i*nm);
+            }
+
+            c.ApplyOperator(Collections::eFwdTrans, phys, coeffs2);
+
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(coeffs1[i] - coeffs2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysInterp1DScaled_SumFac_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const NekDouble scale = 2.0;
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorConst] = scale;
+            c.UpdateFactors(Collections::ePhysInterp1DScaled, factors);
+
+            const LibUtilities::PointsKey scaledKeyDir1(
+                int(5*scale), quadPointsTypeDir1);
+            const LibUtilities::PointsKey scaledKeyDir2(
+                int(7*scale), quadPointsTypeDir1);
+
+            const int nq  = Exp->GetTotPoints();
+            const int nqs = scaledKeyDir1.GetNumPoints() *
+                            scaledKeyDir2.GetNumPoints();
+            Array<OneD, NekDouble> phys(nelmts*nq);
+            Array<OneD, NekDouble> phys1(nelmts*nqs);
+            Array<OneD, NekDouble> phys2(nelmts*nqs);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                LibUtilities::Interp2D(quadPointsKeyDir1, quadPointsKeyDir2,
+                                       &phys[i*nq], scaledKeyDir1,
+                                       scaledKeyDir2, &phys1[i*nqs]);
+            }
+
+            c.ApplyOperator(Collections::ePhysInterp1DScaled, phys, phys2);
+
+            for(int i = 0; i < phys1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(phys1[i] - phys2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysInterp1DScaled_StdMat_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eStdMat);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const NekDouble scale = 2.0;
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorConst] = scale;
+            c.UpdateFactors(Collections::ePhysInterp1DScaled, factors);
+
+            const LibUtilities::PointsKey scaledKeyDir1(
+                int(5*scale), quadPointsTypeDir1);
+            const LibUtilities::PointsKey scaledKeyDir2(
+                int(7*scale), quadPointsTypeDir1);
+
+            const int nq  = Exp->GetTotPoints();
+            const int nqs = scaledKeyDir1.GetNumPoints() *
+                            scaledKeyDir2.GetNumPoints();
+            Array<OneD, NekDouble> phys(nelmts*nq);
+            Array<OneD, NekDouble> phys1(nelmts*nqs);
+            Array<OneD, NekDouble> phys2(nelmts*nqs);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                LibUtilities::Interp2D(quadPointsKeyDir1, quadPointsKeyDir2,
+                                       &phys[i*nq], scaledKeyDir1,
+                                       scaledKeyDir2, &phys1[i*nqs]);
+            }
+
+            c.ApplyOperator(Collections::ePhysInterp1DScaled, phys, phys2);
+
+            for(int i = 0; i < phys1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(phys1[i] - phys2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysGalerkinProjection1DScaled_IterPerExp_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eIterPerExp);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            StdRegions::ConstFactorMap factors;
+            c.UpdateFactors(Collections::ePhysGalerkinProjection1DScaled,
+                            factors);
+
+            // Default scaling of 3/2
+            const LibUtilities::PointsKey scaledKeyDir1(7, quadPointsTypeDir1);
+            const LibUtilities::PointsKey scaledKeyDir2(10, quadPointsTypeDir1);
+
+            const int nq  = Exp->GetTotPoints();
+            const int nqs = scaledKeyDir1.GetNumPoints() *
+                            scaledKeyDir2.GetNumPoints();
+            Array<OneD, NekDouble> phys(nelmts*nqs);
+            Array<OneD, NekDouble> phys1(nelmts*nq);
+            Array<OneD, NekDouble> phys2(nelmts*nq);
+
+            for (int i = 0; i < nelmts*nqs; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                LibUtilities::PhysGalerkinProject2D(
+                    scaledKeyDir1, scaledKeyDir2, &phys[i*nqs],
+                    quadPointsKeyDir1, quadPointsKeyDir2, &phys1[i*nq]);
+            }
+
+            c.ApplyOperator(Collections::ePhysGalerkinProjection1DScaled,
+                            phys, phys2);
+
+            for(int i = 0; i < phys1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(phys1[i] - phys2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysGalerkinProjection1DScaled_StdMat_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eStdMat);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            StdRegions::ConstFactorMap factors;
+            c.UpdateFactors(Collections::ePhysGalerkinProjection1DScaled,
+                            factors);
+
+            // Default scaling of 3/2
+            const LibUtilities::PointsKey scaledKeyDir1(7, quadPointsTypeDir1);
+            const LibUtilities::PointsKey scaledKeyDir2(10, quadPointsTypeDir1);
+
+            const int nq  = Exp->GetTotPoints();
+            const int nqs = scaledKeyDir1.GetNumPoints() *
+                            scaledKeyDir2.GetNumPoints();
+            Array<OneD, NekDouble> phys(nelmts*nqs);
+            Array<OneD, NekDouble> phys1(nelmts*nq);
+            Array<OneD, NekDouble> phys2(nelmts*nq);
+
+            for (int i = 0; i < nelmts*nqs; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                LibUtilities::PhysGalerkinProject2D(
+                    scaledKeyDir1, scaledKeyDir2, &phys[i*nqs],
+                    quadPointsKeyDir1, quadPointsKeyDir2, &phys1[i*nq]);
+            }
+
+            c.ApplyOperator(Collections::ePhysGalerkinProjection1DScaled,
+                            phys, phys2);
+
+            for(int i = 0; i < phys1.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(phys1[i] - phys2[i], 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysDerivIProductWRTDerivBase_IterPerExp_VariableP_MultiElmt)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 10;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eIterPerExp);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> diff0(nq), diff1(nq), tmp1(nm);
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                // grad u
+                Exp->PhysDeriv(phys + i*nq, diff0, diff1);
+
+                // (grad phi, D grad u)
+                Exp->IProductWRTDerivBase(0, diff0, tmp = coeffs1 + i*nm);
+                Exp->IProductWRTDerivBase(1, diff1, tmp1);
+                Vmath::Vadd(nm, tmp1, 1, coeffs1 + i*nm, 1,
+                            tmp = coeffs1 + i*nm, 1);
+            }
+
+            c.ApplyOperator(Collections::ePhysDerivIProductWRTDerivBase,
+                            phys, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysDerivIProductWRTDerivBase_SumFac_VariableP_MultiElmt_VarCoeff)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.5, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom = CreateQuad(v0, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            int nelmts = 500;
+
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp;
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp.push_back(Exp);
+            }
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            Collections::CollectionOptimisation colOpt(dummySession, Collections::eSumFac);
+            Collections::OperatorImpMap impTypes = colOpt.GetOperatorImpMap(stdExp);
+            Collections::Collection     c(CollExp, impTypes);
+
+            const int nq = Exp->GetTotPoints();
+            const int nm = Exp->GetNcoeffs();
+
+            StdRegions::VarCoeffMap varcoeffs;
+            varcoeffs[StdRegions::eVarCoeffD00] = Array<OneD, NekDouble>(nelmts*nq);
+            varcoeffs[StdRegions::eVarCoeffD01] = Array<OneD, NekDouble>(nelmts*nq);
+            varcoeffs[StdRegions::eVarCoeffD11] = Array<OneD, NekDouble>(nelmts*nq);
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                varcoeffs[StdRegions::eVarCoeffD00][i] = 1.0 + 0.5*sin(0.1*i);
+                varcoeffs[StdRegions::eVarCoeffD01][i] = 0.2*cos(0.2*i);
+                varcoeffs[StdRegions::eVarCoeffD11][i] = 2.0 + cos(0.3*i);
+            }
+            c.UpdateVarCoeffs(Collections::ePhysDerivIProductWRTDerivBase,
+                              varcoeffs);
+
+            Array<OneD, NekDouble> phys(nelmts*nq), tmp;
+            Array<OneD, NekDouble> diff0(nq), diff1(nq), tmp1(nm);
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            for(int i = 0; i < nelmts; ++i)
+            {
+                // grad u
+                Exp->PhysDeriv(phys + i*nq, diff0, diff1);
+
+                // D grad u
+                NekDouble *d00 = &varcoeffs[StdRegions::eVarCoeffD00][i*nq];
+                NekDouble *d01 = &varcoeffs[StdRegions::eVarCoeffD01][i*nq];
+                NekDouble *d11 = &varcoeffs[StdRegions::eVarCoeffD11][i*nq];
+                for (int j = 0; j < nq; ++j)
+                {
+                    NekDouble f0 = d00[j]*diff0[j] + d01[j]*diff1[j];
+                    NekDouble f1 = d01[j]*diff0[j] + d11[j]*diff1[j];
+                    diff0[j] = f0;
+                    diff1[j] = f1;
+                }
+
+                // (grad phi, D grad u)
+                Exp->IProductWRTDerivBase(0, diff0, tmp = coeffs1 + i*nm);
+                Exp->IProductWRTDerivBase(1, diff1, tmp1);
+                Vmath::Vadd(nm, tmp1, 1, coeffs1 + i*nm, 1,
+                            tmp = coeffs1 + i*nm, 1);
+            }
+
+            c.ApplyOperator(Collections::ePhysDerivIProductWRTDerivBase,
+                            phys, coeffs2);
+
+            double epsilon = 1.0e-8;
+            for(int i = 0; i < coeffs1.size(); ++i)
+            {
+                coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestQuadPhysDerivIProductWRTDerivBase_MixedDeformed_MultiElmt_VarCoeff)
+        {
+            SpatialDomains::PointGeomSharedPtr v0(new SpatialDomains::PointGeom(2u, 0u, -1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v1(new SpatialDomains::PointGeom(2u, 1u,  1.0, -1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v2(new SpatialDomains::PointGeom(3u, 2u,  1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v3(new SpatialDomains::PointGeom(3u, 3u, -1.0,  1.0, 0.0));
+            SpatialDomains::PointGeomSharedPtr v4(new SpatialDomains::PointGeom(2u, 4u, -1.0, -1.5, 0.0));
+
+            SpatialDomains::QuadGeomSharedPtr quadGeom0 = CreateQuad(v0, v1, v2, v3);
+            SpatialDomains::QuadGeomSharedPtr quadGeom1 = CreateQuad(v4, v1, v2, v3);
+
+            Nektar::LibUtilities::PointsType quadPointsTypeDir1 = Nektar::LibUtilities::eGaussLobattoLegendre;
+            Nektar::LibUtilities::BasisType basisTypeDir1 = Nektar::LibUtilities::eModified_A;
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir1(5, quadPointsTypeDir1);
+            const Nektar::LibUtilities::PointsKey quadPointsKeyDir2(7, quadPointsTypeDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir1(basisTypeDir1,4,quadPointsKeyDir1);
+            const Nektar::LibUtilities::BasisKey basisKeyDir2(basisTypeDir1,6,quadPointsKeyDir2);
+
+            Nektar::LocalRegions::QuadExpSharedPtr Exp0 =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom0);
+            Nektar::LocalRegions::QuadExpSharedPtr Exp1 =
+                MemoryManager<Nektar::LocalRegions::QuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2, quadGeom1);
+
+            Nektar::StdRegions::StdQuadExpSharedPtr stdExp =
+                MemoryManager<Nektar::StdRegions::StdQuadExp>::AllocateSharedPtr(basisKeyDir1,
+                basisKeyDir2);
+
+            // Enough elements for the fused operator to use several blocks
+            int nelmts = 300;
+
+            // An undeformed collection and one alternating undeformed and
+            // deformed elements
+            std::vector<StdRegions::StdExpansionSharedPtr> CollExp[2];
+            for(int i = 0; i < nelmts; ++i)
+            {
+                CollExp[0].push_back(Exp0);
+                if (i % 2)
+                {
+                    CollExp[1].push_back(Exp1);
+                }
+                else
+                {
+                    CollExp[1].push_back(Exp0);
+                }
+            }
+
+            const int nq = Exp0->GetTotPoints();
+            const int nm = Exp0->GetNcoeffs();
+
+            StdRegions::VarCoeffMap varcoeffs;
+            varcoeffs[StdRegions::eVarCoeffD00] = Array<OneD, NekDouble>(nelmts*nq);
+            varcoeffs[StdRegions::eVarCoeffD01] = Array<OneD, NekDouble>(nelmts*nq);
+            varcoeffs[StdRegions::eVarCoeffD11] = Array<OneD, NekDouble>(nelmts*nq);
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                varcoeffs[StdRegions::eVarCoeffD00][i] = 1.0 + 0.5*sin(0.1*i);
+                varcoeffs[StdRegions::eVarCoeffD01][i] = 0.2*cos(0.2*i);
+                varcoeffs[StdRegions::eVarCoeffD11][i] = 2.0 + cos(0.3*i);
+            }
+
+            Array<OneD, NekDouble> phys(nelmts*nq);
+            Array<OneD, NekDouble> diff0(nelmts*nq), diff1(nelmts*nq);
+            Array<OneD, NekDouble> coeffs1(nelmts*nm);
+            Array<OneD, NekDouble> coeffs2(nelmts*nm);
+
+            for (int i = 0; i < nelmts*nq; ++i)
+            {
+                phys[i] = sin(0.3*i) + 0.1*i;
+            }
+
+            Collections::ImplementationType impTypes[] = {
+                Collections::eStdMat, Collections::eSumFac };
+
+            LibUtilities::SessionReaderSharedPtr dummySession;
+            for (auto &impType : impTypes)
+            {
+                for (auto &exps : CollExp)
+                {
+                    for (int v = 0; v < 2; ++v)
+                    {
+                        Collections::CollectionOptimisation colOpt(dummySession, impType);
+                        Collections::OperatorImpMap imps = colOpt.GetOperatorImpMap(stdExp);
+                        Collections::Collection     c(exps, imps);
+
+                        // PhysDeriv followed by IProductWRTDerivBase
+                        c.ApplyOperator(Collections::ePhysDeriv,
+                                        phys, diff0, diff1);
+                        if (v)
+                        {
+                            NekDouble *d00 = &varcoeffs[StdRegions::eVarCoeffD00][0];
+                            NekDouble *d01 = &varcoeffs[StdRegions::eVarCoeffD01][0];
+                            NekDouble *d11 = &varcoeffs[StdRegions::eVarCoeffD11][0];
+                            for (int j = 0; j < nelmts*nq; ++j)
+                            {
+                                NekDouble f0 = d00[j]*diff0[j] + d01[j]*diff1[j];
+                                NekDouble f1 = d01[j]*diff0[j] + d11[j]*diff1[j];
+                                diff0[j] = f0;
+                                diff1[j] = f1;
+                            }
+                            c.UpdateVarCoeffs(
+                                Collections::ePhysDerivIProductWRTDerivBase,
+                                varcoeffs);
+                        }
+                        c.ApplyOperator(Collections::eIProductWRTDerivBase,
+                                        diff0, diff1, coeffs1);
+
+                        c.ApplyOperator(
+                            Collections::ePhysDerivIProductWRTDerivBase,
+                            phys, coeffs2);
+
+                        double epsilon = 1.0e-8;
+                        for(int i = 0; i < coeffs1.size(); ++i)
+                        {
+                            coeffs1[i] = (fabs(coeffs1[i]) < 1e-14)? 0.0: coeffs1[i];
+                            coeffs2[i] = (fabs(coeffs2[i]) < 1e-14)? 0.0: coeffs2[i];
+                            BOOST_CHECK_CLOSE(coeffs1[i],coeffs2[i], epsilon);
+                        }
+                    }
+                }
+            }
+        }
     }
 }
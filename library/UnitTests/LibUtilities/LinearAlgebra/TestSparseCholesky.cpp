@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestSparseCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the supernodal sparse Cholesky factorisation.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <LibUtilities/LinearAlgebra/SparseCholesky.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Nektar
+{
+    namespace SparseCholeskyUnitTests
+    {
+        // Upper triangular part of the five-point Laplacian on an n x n
+        // grid, shifted to be positive definite.
+        COOMatType GridLaplacian(unsigned int n)
+        {
+            COOMatType mat;
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                for (unsigned int j = 0; j < n; ++j)
+                {
+                    unsigned int k = i * n + j;
+                    mat[CoordType(k, k)] = 4.1;
+                    if (j + 1 < n)
+                    {
+                        mat[CoordType(k, k + 1)] = -1.0;
+                    }
+                    if (i + 1 < n)
+                    {
+                        mat[CoordType(k, k + n)] = -1.0;
+                    }
+                }
+            }
+            return mat;
+        }
+
+        std::vector<NekDouble> Multiply(unsigned int                  nRows,
+                                        const COOMatType             &mat,
+                                        const std::vector<NekDouble> &x)
+        {
+            std::vector<NekDouble> y(nRows, 0.0);
+            for (auto &it : mat)
+            {
+                y[it.first.first] += it.second * x[it.first.second];
+                if (it.first.first != it.first.second)
+                {
+                    y[it.first.second] += it.second * x[it.first.first];
+                }
+            }
+            return y;
+        }
+
+        void CheckSolve(unsigned int           nRows,
+                        const COOMatType      &mat,
+                        const SparseCholesky  &chol)
+        {
+            std::vector<NekDouble> exact(nRows);
+            for (unsigned int i = 0; i < nRows; ++i)
+            {
+                exact[i] = std::sin(0.1 * i) + 1.0;
+            }
+
+            std::vector<NekDouble> rhs = Multiply(nRows, mat, exact);
+            std::vector<NekDouble> sol(nRows);
+            chol.Solve(&rhs[0], &sol[0]);
+
+            for (unsigned int i = 0; i < nRows; ++i)
+            {
+                BOOST_CHECK_CLOSE(sol[i], exact[i], 1e-8);
+            }
+
+            // The input and output may alias.
+            chol.Solve(&rhs[0], &rhs[0]);
+            for (unsigned int i = 0; i < nRows; ++i)
+            {
+                BOOST_CHECK_CLOSE(rhs[i], exact[i], 1e-8);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestTridiagonal)
+        {
+            unsigned int n = 50;
+            COOMatType mat;
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                mat[CoordType(i, i)] = 2.5;
+                if (i + 1 < n)
+                {
+                    mat[CoordType(i, i + 1)] = -1.0;
+                }
+            }
+
+            SparseCholesky chol(n, mat);
+            BOOST_CHECK_EQUAL(chol.GetRows(), n);
+            CheckSolve(n, mat, chol);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestGridLaplacian)
+        {
+            unsigned int n = 40;
+            COOMatType mat = GridLaplacian(n);
+
+            SparseCholesky chol(n * n, mat);
+            CheckSolve(n * n, mat, chol);
+
+            // Nested dissection should need far less storage than the
+            // band of the natural ordering.
+            BOOST_CHECK_LT(chol.GetNumNonZeroEntries(), n * n * n / 2);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestGivenOrdering)
+        {
+            unsigned int n = 12;
+            COOMatType mat = GridLaplacian(n);
+
+            std::vector<int> perm(n * n);
+            for (unsigned int i = 0; i < n * n; ++i)
+            {
+                perm[i] = n * n - 1 - i;
+            }
+
+            SparseCholesky chol(n * n, mat, perm);
+            CheckSolve(n * n, mat, chol);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNestedDissectionPermutation)
+        {
+            // Two disconnected grids of 30 x 30 vertices.
+            int n = 30, nVerts = 2 * n * n;
+            std::vector<int> xadj(1, 0), adjncy;
+            for (int k = 0; k < nVerts; ++k)
+            {
+                int g = k / (n * n), i = (k % (n * n)) / n, j = k % n;
+                int off = g * n * n;
+                if (i > 0)     adjncy.push_back(off + (i - 1) * n + j);
+                if (j > 0)     adjncy.push_back(off + i * n + j - 1);
+                if (j + 1 < n) adjncy.push_back(off + i * n + j + 1);
+                if (i + 1 < n) adjncy.push_back(off + (i + 1) * n + j);
+                xadj.push_back(adjncy.size());
+            }
+
+            std::vector<int> perm;
+            SparseCholesky::NestedDissection(nVerts, xadj, adjncy, perm);
+
+            BOOST_CHECK_EQUAL(perm.size(), nVerts);
+            std::sort(perm.begin(), perm.end());
+            for (int i = 0; i < nVerts; ++i)
+            {
+                BOOST_CHECK_EQUAL(perm[i], i);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestThreaded)
+        {
+            Thread::ThreadMaster &tms = Thread::GetThreadMaster();
+            Thread::ThreadManagerSharedPtr threadMan =
+                tms.GetInstance(Thread::ThreadMaster::SessionJob);
+            if (!threadMan->IsInitialised())
+            {
+                tms.SetThreadingType("ThreadManagerBoost");
+                threadMan = tms.CreateInstance(
+                    Thread::ThreadMaster::SessionJob, 2);
+            }
+
+            unsigned int n = 40;
+            COOMatType mat = GridLaplacian(n);
+
+            SparseCholesky chol(n * n, mat, std::vector<int>(), threadMan);
+            CheckSolve(n * n, mat, chol);
+        }
+    }
+}
@@ -0,0 +1,31 @@
+<?xml version="1.0" encoding="utf-8" ?>
+<test>
+    <description>2D unsteady CG implicit diffusion, P = 7, iterative sc with extrapolated initial guess</description>
+    <executable>ADRSolver</executable>
+    <parameters>-v ImDiffusion_Quad_Periodic_m7_Extrap.xml</parameters>
+    <files>
+        <file description="Session File">ImDiffusion_Quad_Periodic_m7_Extrap.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-9">2.28016e-05</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-9">2.27313e-05</value>
+        </metric>
+        <metric type="Precon" id="3">
+            <value tolerance="1">7</value>
+            <value tolerance="1">8</value>
+            <value tolerance="1">8</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+            <value tolerance="1">2</value>
+        </metric>
+    </metrics>
+</test>
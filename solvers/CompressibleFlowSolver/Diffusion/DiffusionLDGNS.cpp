@@ -295,9 +295,14 @@ void DiffusionLDGNS::v_DiffuseCoeffs(
             Vmath::Vadd(nCoeffs, tmp1, 1, tmp2[i], 1, tmp2[i], 1);
         }
 
-        // Evaulate  <\phi, \hat{F}\cdot n> - outarray[i]
-        Vmath::Neg                      (nCoeffs, tmp2[i], 1);
-        fields[i]->AddTraceIntegral     (viscousFlux[i], tmp2[i]);
+        Vmath::Neg(nCoeffs, tmp2[i], 1);
+    }
+
+    // Evaulate  <\phi, \hat{F}\cdot n> - outarray[i] for all variables
+    fields[0]->AddTraceIntegral(viscousFlux, tmp2);
+
+    for (std::size_t i = 0; i < nConvectiveFields; ++i)
+    {
         fields[i]->SetPhysState         (false);
         fields[i]->MultiplyByElmtInvMass(tmp2[i], outarray[i]);
     }
@@ -316,10 +321,14 @@ void DiffusionLDGNS::v_DiffuseCalculateDerivative(
     std::size_t nTracePts = fields[0]->GetTrace()->GetTotPoints();
     std::size_t nConvectiveFields = fields.size();
 
-    Array<OneD, NekDouble>               tmp1{nCoeffs};
-    Array<OneD, Array<OneD, NekDouble> > tmp2{nConvectiveFields};
+    Array<OneD, Array<OneD, NekDouble> > tmp1{nScalars};
     TensorOfArray3D<NekDouble> numericalFluxO1{m_spaceDim};
 
+    for (std::size_t i = 0; i < nScalars; ++i)
+    {
+        tmp1[i] = Array<OneD, NekDouble>{nCoeffs};
+    }
+
     for (std::size_t j = 0; j < m_spaceDim; ++j)
     {
         numericalFluxO1[j] = Array<OneD, Array<OneD, NekDouble> >{nScalars};
@@ -336,12 +345,17 @@ void DiffusionLDGNS::v_DiffuseCalculateDerivative(
     {
         for (std::size_t i = 0; i < nScalars; ++i)
         {
-            fields[i]->IProductWRTDerivBase (j, inarray[i], tmp1);
-            Vmath::Neg                      (nCoeffs, tmp1, 1);
-            fields[i]->AddTraceIntegral     (numericalFluxO1[j][i], tmp1);
+            fields[i]->IProductWRTDerivBase (j, inarray[i], tmp1[i]);
+            Vmath::Neg                      (nCoeffs, tmp1[i], 1);
+        }
+
+        fields[0]->AddTraceIntegral(numericalFluxO1[j], tmp1);
+
+        for (std::size_t i = 0; i < nScalars; ++i)
+        {
             fields[i]->SetPhysState         (false);
-            fields[i]->MultiplyByElmtInvMass(tmp1, tmp1);
-            fields[i]->BwdTrans             (tmp1, qfields[j][i]);
+            fields[i]->MultiplyByElmtInvMass(tmp1[i], tmp1[i]);
+            fields[i]->BwdTrans             (tmp1[i], qfields[j][i]);
         }
     }
     // For 3D Homogeneous 1D only take derivatives in 3rd direction
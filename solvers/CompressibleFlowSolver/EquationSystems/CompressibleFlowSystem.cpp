@@ -125,8 +125,26 @@ namespace Nektar
             m_ode.DefineProjection(&CompressibleFlowSystem::DoOdeProjection, this);
         }
         else
-        {   
-            ASSERTL0(false, "Implicit CFS not set up.");
+        {
+            ASSERTL0(m_projectionType == MultiRegions::eDiscontinuous &&
+                     m_HomogeneousType == eNotHomogeneous,
+                     "Implicit CFS is only supported for the discontinuous "
+                     "Galerkin method without homogeneous directions.");
+
+            m_ode.DefineOdeRhs       (&CompressibleFlowSystem::DoOdeRhs, this);
+            m_ode.DefineProjection   (&CompressibleFlowSystem::DoOdeProjection, this);
+            m_ode.DefineImplicitSolve(&CompressibleFlowSystem::DoImplicitSolve, this);
+
+            m_implicitSolver = MemoryManager<NewtonKrylovSolver>::
+                AllocateSharedPtr(m_session, m_fields);
+            m_implicitSolver->SetOdeRhs(
+                &CompressibleFlowSystem::DoOdeRhs, this);
+            m_implicitSolver->SetProjection(
+                &CompressibleFlowSystem::DoOdeProjection, this);
+
+            // Artificial diffusion couples elements through two layers of
+            // traces.
+            m_implicitSolver->SetStencilWidth(m_artificialDiffusion ? 2 : 1);
         }
 
         SetBoundaryConditionsBwdWeight();
@@ -235,9 +253,11 @@ namespace Nektar
 
         m_BndEvaluateTime   = time;
 
-        // Store forwards/backwards space along trace space
-        Array<OneD, Array<OneD, NekDouble> > Fwd    (nvariables);
-        Array<OneD, Array<OneD, NekDouble> > Bwd    (nvariables);
+        // Store forwards/backwards space along trace space, taken from
+        // storage which persists between calls
+        SolverUtils::Workspace::Scope scope(m_rhsWorkspace);
+        Array<OneD, Array<OneD, NekDouble> > Fwd;
+        Array<OneD, Array<OneD, NekDouble> > Bwd;
 
         if (m_HomogeneousType == eHomogeneous1D)
         {
@@ -246,11 +266,26 @@ namespace Nektar
         }
         else
         {
+            // Gather the traces of all variables in one pass, then fill the
+            // boundaries of each variable and exchange them together
+            Fwd = m_rhsWorkspace.GetArrays(nvariables, nTracePts, 0.0);
+            Bwd = m_rhsWorkspace.GetArrays(nvariables, nTracePts, 0.0);
+            m_fields[0]->GetFwdBwdTracePhysInterior(inarray, Fwd, Bwd);
             for (int i = 0; i < nvariables; ++i)
             {
-                Fwd[i]     = Array<OneD, NekDouble>(nTracePts, 0.0);
-                Bwd[i]     = Array<OneD, NekDouble>(nTracePts, 0.0);
-                m_fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+                m_fields[i]->FillBwdWithBound(Fwd[i], Bwd[i]);
+            }
+            m_fields[0]->BeginTraceExchange(Fwd);
+
+            if (m_advObject->OverlapsTraceExchange())
+            {
+                // Let the advection object complete the exchange once the
+                // volume flux has been evaluated
+                m_advObject->SetTraceExchangePending();
+            }
+            else
+            {
+                m_fields[0]->FinishTraceExchange(Bwd);
             }
         }
         
@@ -280,7 +315,7 @@ namespace Nektar
             NekDouble fac;
             Array<OneD, NekDouble> tmp;
 
-            Array<OneD, NekDouble> tstep (nElements, 0.0);
+            Array<OneD, NekDouble> tstep = m_rhsWorkspace.Get(nElements, 0.0);
             GetElmtTimeStep(inarray, tstep);
 
             // Loop over elements
@@ -341,6 +376,19 @@ namespace Nektar
         }
     }
 
+    /**
+     * @brief Solve the implicit stage equation \f$ y - \lambda f(y) = x \f$
+     * with the Jacobian-free Newton-Krylov solver.
+     */
+    void CompressibleFlowSystem::DoImplicitSolve(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+              Array<OneD,       Array<OneD, NekDouble> > &outarray,
+        const NekDouble                                   time,
+        const NekDouble                                   lambda)
+    {
+        m_implicitSolver->Solve(inarray, outarray, time, lambda);
+    }
+
     /**
      * @brief Compute the advection terms for the right-hand side
      */
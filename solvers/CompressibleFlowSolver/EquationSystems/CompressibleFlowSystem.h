@@ -38,6 +38,7 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <CompressibleFlowSolver/ArtificialDiffusion/ArtificialDiffusion.h>
+#include <CompressibleFlowSolver/Misc/NewtonKrylovSolver.h>
 #include <CompressibleFlowSolver/Misc/VariableConverter.h>
 #include <CompressibleFlowSolver/BoundaryConditions/CFSBndCond.h>
 #include <SolverUtils/UnsteadySystem.h>
@@ -46,6 +47,7 @@
 #include <SolverUtils/AdvectionSystem.h>
 #include <SolverUtils/Diffusion/Diffusion.h>
 #include <SolverUtils/Forcing/Forcing.h>
+#include <SolverUtils/Core/Workspace.h>
 #include <SolverUtils/Filters/FilterInterfaces.hpp>
 #include <LocalRegions/Expansion3D.h>
 #include <LocalRegions/Expansion2D.h>
@@ -112,6 +114,9 @@ namespace Nektar
         // Auxiliary object to convert variables
         VariableConverterSharedPtr          m_varConv;
 
+        // Newton-Krylov solver for implicit time integration
+        NewtonKrylovSolverSharedPtr         m_implicitSolver;
+
         // User defined boundary conditions
         std::vector<CFSBndCondSharedPtr>    m_bndConds;
 
@@ -120,6 +125,9 @@ namespace Nektar
 
         NekDouble                           m_BndEvaluateTime;
 
+        // Scratch storage reused by each evaluation of the right-hand side
+        SolverUtils::Workspace              m_rhsWorkspace;
+
         CompressibleFlowSystem(
             const LibUtilities::SessionReaderSharedPtr& pSession,
             const SpatialDomains::MeshGraphSharedPtr& pGraph);
@@ -139,6 +147,12 @@ namespace Nektar
                   Array<OneD,       Array<OneD, NekDouble> > &outarray,
             const NekDouble                                   time);
 
+        void DoImplicitSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const NekDouble                                   time,
+            const NekDouble                                   lambda);
+
         void DoAdvection(
             const Array<OneD, const Array<OneD, NekDouble> > &inarray,
                   Array<OneD,       Array<OneD, NekDouble> > &outarray,
@@ -155,6 +155,12 @@ namespace Nektar
 
         // Concluding initialisation of diffusion operator
         m_diffusion->InitObject         (m_session, m_fields);
+
+        // Viscous fluxes couple elements through two layers of traces
+        if (m_implicitSolver)
+        {
+            m_implicitSolver->SetStencilWidth(2);
+        }
     }
 
     void NavierStokesCFE::v_DoDiffusion(
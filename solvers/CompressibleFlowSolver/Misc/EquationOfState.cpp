@@ -94,20 +94,113 @@ NekDouble EquationOfState::GetRhoFromPT(const NekDouble &p, const NekDouble &T)
     return v_GetRhoFromPT(p, T);
 }
 
-// General implementation for v_GetSoundSpeed: c^2 = xi + kappa * h
-//    where xi = dpdrho - e/rho * dp/de    and  kappa = dp/de / rho
+void EquationOfState::GetTemperature(const Array<OneD, const NekDouble> &rho,
+                                     const Array<OneD, const NekDouble> &e,
+                                     Array<OneD, NekDouble> &T)
+{
+    v_GetTemperature(rho, e, T);
+}
+
+void EquationOfState::GetPressure(const Array<OneD, const NekDouble> &rho,
+                                  const Array<OneD, const NekDouble> &e,
+                                  Array<OneD, NekDouble> &p)
+{
+    v_GetPressure(rho, e, p);
+}
+
+void EquationOfState::GetSoundSpeed(const Array<OneD, const NekDouble> &rho,
+                                    const Array<OneD, const NekDouble> &e,
+                                    Array<OneD, NekDouble> &c)
+{
+    v_GetSoundSpeed(rho, e, c);
+}
+
+void EquationOfState::GetEntropy(const Array<OneD, const NekDouble> &rho,
+                                 const Array<OneD, const NekDouble> &e,
+                                 Array<OneD, NekDouble> &s)
+{
+    v_GetEntropy(rho, e, s);
+}
+
+void EquationOfState::GetEFromRhoP(const Array<OneD, const NekDouble> &rho,
+                                   const Array<OneD, const NekDouble> &p,
+                                   Array<OneD, NekDouble> &e)
+{
+    v_GetEFromRhoP(rho, p, e);
+}
+
+void EquationOfState::GetRhoFromPT(const Array<OneD, const NekDouble> &p,
+                                   const Array<OneD, const NekDouble> &T,
+                                   Array<OneD, NekDouble> &rho)
+{
+    v_GetRhoFromPT(p, T, rho);
+}
+
+// General implementation for v_GetSoundSpeed, see SoundSpeedSquared
 NekDouble EquationOfState::v_GetSoundSpeed(const NekDouble &rho,
                                            const NekDouble &e)
 {
-    NekDouble p      = GetPressure(rho, e);
-    NekDouble dpde   = GetDPDe_rho(rho, e);
-    NekDouble dpdrho = GetDPDrho_e(rho, e);
+    return sqrt(SoundSpeedSquared(rho, e, GetPressure(rho, e),
+                                  GetDPDrho_e(rho, e), GetDPDe_rho(rho, e)));
+}
+
+void EquationOfState::v_GetTemperature(const Array<OneD, const NekDouble> &rho,
+                                       const Array<OneD, const NekDouble> &e,
+                                       Array<OneD, NekDouble> &T)
+{
+    for (size_t i = 0; i < rho.size(); ++i)
+    {
+        T[i] = v_GetTemperature(rho[i], e[i]);
+    }
+}
+
+void EquationOfState::v_GetPressure(const Array<OneD, const NekDouble> &rho,
+                                    const Array<OneD, const NekDouble> &e,
+                                    Array<OneD, NekDouble> &p)
+{
+    for (size_t i = 0; i < rho.size(); ++i)
+    {
+        p[i] = v_GetPressure(rho[i], e[i]);
+    }
+}
+
+void EquationOfState::v_GetSoundSpeed(const Array<OneD, const NekDouble> &rho,
+                                      const Array<OneD, const NekDouble> &e,
+                                      Array<OneD, NekDouble> &c)
+{
+    for (size_t i = 0; i < rho.size(); ++i)
+    {
+        c[i] = v_GetSoundSpeed(rho[i], e[i]);
+    }
+}
 
-    NekDouble enthalpy = e + p / rho;
+void EquationOfState::v_GetEntropy(const Array<OneD, const NekDouble> &rho,
+                                   const Array<OneD, const NekDouble> &e,
+                                   Array<OneD, NekDouble> &s)
+{
+    for (size_t i = 0; i < rho.size(); ++i)
+    {
+        s[i] = v_GetEntropy(rho[i], e[i]);
+    }
+}
 
-    NekDouble chi   = dpdrho - e / rho * dpde;
-    NekDouble kappa = dpde / rho;
+void EquationOfState::v_GetEFromRhoP(const Array<OneD, const NekDouble> &rho,
+                                     const Array<OneD, const NekDouble> &p,
+                                     Array<OneD, NekDouble> &e)
+{
+    for (size_t i = 0; i < rho.size(); ++i)
+    {
+        e[i] = v_GetEFromRhoP(rho[i], p[i]);
+    }
+}
 
-    return sqrt(chi + kappa * enthalpy);
+void EquationOfState::v_GetRhoFromPT(const Array<OneD, const NekDouble> &p,
+                                     const Array<OneD, const NekDouble> &T,
+                                     Array<OneD, NekDouble> &rho)
+{
+    for (size_t i = 0; i < p.size(); ++i)
+    {
+        rho[i] = v_GetRhoFromPT(p[i], T[i]);
+    }
 }
 }
@@ -37,6 +37,7 @@
 
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
 
 namespace Nektar
 {
@@ -90,6 +91,36 @@ public:
     /// Obtain the density from P and T
     NekDouble GetRhoFromPT(const NekDouble &p, const NekDouble &T);
 
+    /// Calculate the temperature at each point of rho and e
+    void GetTemperature(const Array<OneD, const NekDouble> &rho,
+                        const Array<OneD, const NekDouble> &e,
+                        Array<OneD, NekDouble> &T);
+
+    /// Calculate the pressure at each point of rho and e
+    void GetPressure(const Array<OneD, const NekDouble> &rho,
+                     const Array<OneD, const NekDouble> &e,
+                     Array<OneD, NekDouble> &p);
+
+    /// Calculate the sound speed at each point of rho and e
+    void GetSoundSpeed(const Array<OneD, const NekDouble> &rho,
+                       const Array<OneD, const NekDouble> &e,
+                       Array<OneD, NekDouble> &c);
+
+    /// Calculate the entropy at each point of rho and e
+    void GetEntropy(const Array<OneD, const NekDouble> &rho,
+                    const Array<OneD, const NekDouble> &e,
+                    Array<OneD, NekDouble> &s);
+
+    /// Obtain the internal energy at each point of rho and P
+    void GetEFromRhoP(const Array<OneD, const NekDouble> &rho,
+                      const Array<OneD, const NekDouble> &p,
+                      Array<OneD, NekDouble> &e);
+
+    /// Obtain the density at each point of P and T
+    void GetRhoFromPT(const Array<OneD, const NekDouble> &p,
+                      const Array<OneD, const NekDouble> &T,
+                      Array<OneD, NekDouble> &rho);
+
 protected:
     NekDouble m_gamma;
     NekDouble m_gasConstant;
@@ -97,6 +128,23 @@ protected:
     /// Constructor
     EquationOfState(const LibUtilities::SessionReaderSharedPtr &pSession);
 
+    /// Squared sound speed c^2 = chi + kappa * h from the pressure @p p and
+    /// its partial derivatives, with chi = dp/drho - e/rho * dp/de and
+    /// kappa = dp/de / rho.
+    static NekDouble SoundSpeedSquared(const NekDouble &rho,
+                                       const NekDouble &e,
+                                       const NekDouble &p,
+                                       const NekDouble &dpdrho,
+                                       const NekDouble &dpde)
+    {
+        NekDouble enthalpy = e + p / rho;
+
+        NekDouble chi   = dpdrho - e / rho * dpde;
+        NekDouble kappa = dpde / rho;
+
+        return chi + kappa * enthalpy;
+    }
+
     virtual NekDouble v_GetTemperature(const NekDouble &rho,
                                        const NekDouble &e) = 0;
 
@@ -119,6 +167,137 @@ protected:
 
     virtual NekDouble v_GetRhoFromPT(const NekDouble &rho,
                                      const NekDouble &p) = 0;
+
+    // The array versions below evaluate the point-wise versions at each
+    // point. Equations of state derived from EquationOfStateImpl override
+    // them with loops that avoid the virtual call per point.
+    virtual void v_GetTemperature(const Array<OneD, const NekDouble> &rho,
+                                  const Array<OneD, const NekDouble> &e,
+                                  Array<OneD, NekDouble> &T);
+
+    virtual void v_GetPressure(const Array<OneD, const NekDouble> &rho,
+                               const Array<OneD, const NekDouble> &e,
+                               Array<OneD, NekDouble> &p);
+
+    virtual void v_GetSoundSpeed(const Array<OneD, const NekDouble> &rho,
+                                 const Array<OneD, const NekDouble> &e,
+                                 Array<OneD, NekDouble> &c);
+
+    virtual void v_GetEntropy(const Array<OneD, const NekDouble> &rho,
+                              const Array<OneD, const NekDouble> &e,
+                              Array<OneD, NekDouble> &s);
+
+    virtual void v_GetEFromRhoP(const Array<OneD, const NekDouble> &rho,
+                                const Array<OneD, const NekDouble> &p,
+                                Array<OneD, NekDouble> &e);
+
+    virtual void v_GetRhoFromPT(const Array<OneD, const NekDouble> &p,
+                                const Array<OneD, const NekDouble> &T,
+                                Array<OneD, NekDouble> &rho);
+};
+
+/**
+ * @class EquationOfStateImpl
+ * @brief Implements the array evaluations of EquationOfState for the
+ *        equation of state @p TEoS, which derives from this class.
+ *
+ * The loops call the point-wise evaluations of @p TEoS without virtual
+ * dispatch, so that they can be inlined into the loops. The sound speed is
+ * obtained from TEoS::GetSoundSpeedSquared, which by default applies
+ * EquationOfState::SoundSpeedSquared, and the square roots are taken over
+ * the whole array at once.
+ */
+template <class TEoS> class EquationOfStateImpl : public EquationOfState
+{
+protected:
+    EquationOfStateImpl(const LibUtilities::SessionReaderSharedPtr &pSession)
+        : EquationOfState(pSession)
+    {
+    }
+
+    /// Squared sound speed of @p TEoS.
+    NekDouble GetSoundSpeedSquared(const NekDouble &rho, const NekDouble &e)
+    {
+        TEoS *eos = static_cast<TEoS *>(this);
+        return SoundSpeedSquared(rho, e, eos->TEoS::v_GetPressure(rho, e),
+                                 eos->TEoS::v_GetDPDrho_e(rho, e),
+                                 eos->TEoS::v_GetDPDe_rho(rho, e));
+    }
+
+    virtual NekDouble v_GetSoundSpeed(const NekDouble &rho,
+                                      const NekDouble &e)
+    {
+        return sqrt(static_cast<TEoS *>(this)->TEoS::GetSoundSpeedSquared(
+            rho, e));
+    }
+
+    virtual void v_GetTemperature(const Array<OneD, const NekDouble> &rho,
+                                  const Array<OneD, const NekDouble> &e,
+                                  Array<OneD, NekDouble> &T)
+    {
+        TEoS *eos = static_cast<TEoS *>(this);
+        for (size_t i = 0; i < rho.size(); ++i)
+        {
+            T[i] = eos->TEoS::v_GetTemperature(rho[i], e[i]);
+        }
+    }
+
+    virtual void v_GetPressure(const Array<OneD, const NekDouble> &rho,
+                               const Array<OneD, const NekDouble> &e,
+                               Array<OneD, NekDouble> &p)
+    {
+        TEoS *eos = static_cast<TEoS *>(this);
+        for (size_t i = 0; i < rho.size(); ++i)
+        {
+            p[i] = eos->TEoS::v_GetPressure(rho[i], e[i]);
+        }
+    }
+
+    virtual void v_GetSoundSpeed(const Array<OneD, const NekDouble> &rho,
+                                 const Array<OneD, const NekDouble> &e,
+                                 Array<OneD, NekDouble> &c)
+    {
+        TEoS *eos   = static_cast<TEoS *>(this);
+        size_t nPts = rho.size();
+        for (size_t i = 0; i < nPts; ++i)
+        {
+            c[i] = eos->TEoS::GetSoundSpeedSquared(rho[i], e[i]);
+        }
+        Vmath::Vsqrt(nPts, c, 1, c, 1);
+    }
+
+    virtual void v_GetEntropy(const Array<OneD, const NekDouble> &rho,
+                              const Array<OneD, const NekDouble> &e,
+                              Array<OneD, NekDouble> &s)
+    {
+        TEoS *eos = static_cast<TEoS *>(this);
+        for (size_t i = 0; i < rho.size(); ++i)
+        {
+            s[i] = eos->TEoS::v_GetEntropy(rho[i], e[i]);
+        }
+    }
+
+    virtual void v_GetEFromRhoP(const Array<OneD, const NekDouble> &rho,
+                                const Array<OneD, const NekDouble> &p,
+                                Array<OneD, NekDouble> &e)
+    {
+        TEoS *eos = static_cast<TEoS *>(this);
+        for (size_t i = 0; i < rho.size(); ++i)
+        {
+            e[i] = eos->TEoS::v_GetEFromRhoP(rho[i], p[i]);
+        }
+    }
+
+    virtual void v_GetRhoFromPT(const Array<OneD, const NekDouble> &p,
+                                const Array<OneD, const NekDouble> &T,
+                                Array<OneD, NekDouble> &rho)
+    {
+        TEoS *eos = static_cast<TEoS *>(this);
+        for (size_t i = 0; i < p.size(); ++i)
+        {
+            rho[i] = eos->TEoS::v_GetRhoFromPT(p[i], T[i]);
+        }
+    }
 };
 }
 
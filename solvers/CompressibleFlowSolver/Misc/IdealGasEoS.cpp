@@ -47,7 +47,7 @@ std::string IdealGasEoS::className = GetEquationOfStateFactory().
                             "Ideal gas equation of state.");
 
 IdealGasEoS::IdealGasEoS(const LibUtilities::SessionReaderSharedPtr& pSession)
-    : EquationOfState(pSession)
+    : EquationOfStateImpl<IdealGasEoS>(pSession)
 {
 
 }
@@ -65,17 +65,17 @@ NekDouble IdealGasEoS::v_GetPressure(
     return rho*e*(m_gamma-1);
 }
 
-NekDouble IdealGasEoS::v_GetSoundSpeed(
+NekDouble IdealGasEoS::GetSoundSpeedSquared(
     const NekDouble &rho, const NekDouble &e)
 {
-    NekDouble T = GetTemperature(rho,e);
-    return sqrt(m_gamma * m_gasConstant * T);
+    NekDouble T = v_GetTemperature(rho,e);
+    return m_gamma * m_gasConstant * T;
 }
 
 NekDouble IdealGasEoS::v_GetEntropy(
     const NekDouble &rho, const NekDouble &e)
 {
-    NekDouble T = GetTemperature(rho,e);
+    NekDouble T = v_GetTemperature(rho,e);
     return m_gasConstant/(m_gamma-1) * log(T) - m_gasConstant * log(rho);
 }
 
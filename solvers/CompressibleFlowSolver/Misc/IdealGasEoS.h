@@ -45,11 +45,12 @@ namespace Nektar
 * @brief Ideal gas equation of state:
  *       p = rho * R * T
 */
-class IdealGasEoS : public EquationOfState
+class IdealGasEoS final : public EquationOfStateImpl<IdealGasEoS>
 {
     public:
 
         friend class MemoryManager<IdealGasEoS>;
+        friend class EquationOfStateImpl<IdealGasEoS>;
 
         /// Creates an instance of this class
         static EquationOfStateSharedPtr create(
@@ -71,7 +72,8 @@ class IdealGasEoS : public EquationOfState
         virtual NekDouble v_GetPressure(
             const NekDouble &rho, const NekDouble &e);
 
-        virtual NekDouble v_GetSoundSpeed(
+        /// Squared sound speed c^2 = gamma * R * T
+        NekDouble GetSoundSpeedSquared(
             const NekDouble &rho, const NekDouble &e);
 
         virtual NekDouble v_GetEntropy(
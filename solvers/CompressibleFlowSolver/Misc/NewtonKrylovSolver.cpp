@@ -0,0 +1,767 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File NewtonKrylovSolver.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Jacobian-free Newton-Krylov solver for the implicit
+//              stages of the compressible flow system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <limits>
+#include <set>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <CompressibleFlowSolver/Misc/NewtonKrylovSolver.h>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
+
+using namespace std;
+
+namespace Nektar
+{
+NewtonKrylovSolver::NewtonKrylovSolver(
+    const LibUtilities::SessionReaderSharedPtr        &pSession,
+    const Array<OneD, MultiRegions::ExpListSharedPtr> &pFields)
+    : m_session(pSession), m_fields(pFields), m_stencilWidth(1),
+      m_solvesSinceBuild(0), m_blockLambda(0.0)
+{
+    m_comm    = m_fields[0]->GetComm()->GetRowComm();
+    m_nVar    = m_fields.size();
+    m_nCoeffs = m_fields[0]->GetNcoeffs();
+    m_nPhys   = m_fields[0]->GetTotPoints();
+
+    m_nGlobalCoeffs = m_nCoeffs;
+    m_comm->AllReduce(m_nGlobalCoeffs, LibUtilities::ReduceSum);
+
+    // Parameters of the Newton and Krylov iterations
+    m_session->LoadParameter("JFNKNewtonTolerance",     m_newtonTol, 1e-6);
+    m_session->LoadParameter("JFNKNewtonMaxIterations", m_newtonMaxIter, 10);
+    m_session->LoadParameter("JFNKKrylovTolerance",     m_krylovTol, 1e-2);
+    m_session->LoadParameter("JFNKKrylovMaxIterations", m_krylovMaxIter, 200);
+    m_session->LoadParameter("GMRESRestart",            m_gmresRestart, 30);
+    m_session->LoadParameter("JFNKJacobianFreeze",      m_jacobianFreeze, 10);
+    m_verbose = m_session->DefinesCmdLineArgument("verbose");
+
+    // Preconditioner
+    if (m_session->DefinesSolverInfo("JFNKPreconditioner"))
+    {
+        std::string precon = m_session->GetSolverInfo("JFNKPreconditioner");
+        ASSERTL0(boost::iequals(precon, "BlockJacobi") ||
+                 boost::iequals(precon, "None"),
+                 "Unknown JFNKPreconditioner '" + precon + "'");
+    }
+    m_session->MatchSolverInfo(
+        "JFNKPreconditioner", "BlockJacobi", m_useBlockJacobi, true);
+
+    m_scale   = Array<OneD, NekDouble>(m_nVar, 1.0);
+    m_uPhys   = Array<OneD, Array<OneD, NekDouble> >(m_nVar);
+    m_fPhys   = Array<OneD, Array<OneD, NekDouble> >(m_nVar);
+    m_tmpPhys = Array<OneD, Array<OneD, NekDouble> >(m_nVar);
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        m_uPhys[i]   = Array<OneD, NekDouble>(m_nPhys, 0.0);
+        m_fPhys[i]   = Array<OneD, NekDouble>(m_nPhys, 0.0);
+        m_tmpPhys[i] = Array<OneD, NekDouble>(m_nPhys, 0.0);
+    }
+}
+
+NewtonKrylovSolver::~NewtonKrylovSolver()
+{
+}
+
+/**
+ * @brief Solve \f$ y - \lambda f(y, t) = x \f$ for the stage value \f$ y \f$.
+ *
+ * The nonlinear system is solved for the coefficients \f$ c \f$ of each
+ * variable, starting from the projection of @p inarray. Residuals are
+ * measured after scaling each variable by the norm of its right-hand side,
+ * with the momentum components sharing a common scale. The output is
+ * assembled as \f$ y = x + \lambda f(c) \f$ so that the stage derivative
+ * recovered by the time integration scheme is exactly the right-hand side
+ * at the converged state.
+ *
+ * @param inarray   Known part of the stage, \f$ x \f$, in physical space.
+ * @param outarray  Stage solution \f$ y \f$ in physical space.
+ * @param time      Time at which the right-hand side is evaluated.
+ * @param lambda    Coefficient \f$ \lambda = a_{ii} \Delta t \f$.
+ */
+void NewtonKrylovSolver::Solve(
+    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+    const NekDouble                                   time,
+    const NekDouble                                   lambda)
+{
+    ASSERTL1(m_odeRhs && m_projection,
+             "Right-hand side and projection operators have not been set");
+
+    m_time   = time;
+    m_lambda = lambda;
+
+    const int nTot = m_nVar * m_nCoeffs;
+    Array<OneD, NekDouble> b  (nTot);
+    Array<OneD, NekDouble> c  (nTot);
+    Array<OneD, NekDouble> fc (nTot);
+    Array<OneD, NekDouble> res(nTot);
+    Array<OneD, NekDouble> dc (nTot);
+    Array<OneD, NekDouble> tmp;
+
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        m_fields[i]->FwdTrans_IterPerExp(inarray[i], tmp = b + i * m_nCoeffs);
+    }
+
+    // Scale each variable by the norm of its coefficients. The momentum
+    // components share the largest of their norms, bounded below so that
+    // vanishing velocity components are not amplified.
+    Array<OneD, NekDouble> ref(m_nVar);
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        ref[i] = Vmath::Dot(m_nCoeffs, &b[i * m_nCoeffs], 1,
+                                       &b[i * m_nCoeffs], 1);
+    }
+    m_comm->AllReduce(ref, LibUtilities::ReduceSum);
+    Vmath::Vsqrt(m_nVar, ref, 1, ref, 1);
+
+    NekDouble momRef = 1e-2 * sqrt(ref[0] * ref[m_nVar - 1]);
+    for (int i = 1; i < m_nVar - 1; ++i)
+    {
+        momRef = std::max(momRef, ref[i]);
+    }
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        NekDouble r = (i == 0 || i == m_nVar - 1) ? ref[i] : momRef;
+        m_scale[i]  = r > 0.0 ? 1.0 / r : 1.0;
+    }
+
+    bool rebuild = m_useBlockJacobi &&
+        (m_jacBlocks.size() == 0 ||
+         m_solvesSinceBuild >= m_jacobianFreeze);
+
+    Vmath::Vcopy(nTot, b, 1, c, 1);
+
+    int       nNewton = 0;
+    int       nKrylov = 0;
+    NekDouble resNorm = 0.0;
+    while (true)
+    {
+        // R(c) = c - b - lambda f(c)
+        EvaluateRhs(c, fc, m_fPhys);
+        Vmath::Vsub (nTot, c, 1, b, 1, res, 1);
+        Vmath::Svtvp(nTot, -lambda, fc, 1, res, 1, res, 1);
+        resNorm = ScaledNorm(res);
+
+        if (resNorm <= m_newtonTol)
+        {
+            break;
+        }
+
+        if (nNewton >= m_newtonMaxIter)
+        {
+            ROOTONLY_NEKERROR(ErrorUtil::efatal,
+                              "Exceeded maximum number of Newton iterations");
+        }
+
+        if (rebuild)
+        {
+            BuildBlockJacobian(c, fc);
+            m_solvesSinceBuild = 0;
+            rebuild            = false;
+        }
+        if (m_useBlockJacobi && lambda != m_blockLambda)
+        {
+            FactoriseBlocks();
+        }
+
+        // Solve D J dc = -D R, where D is the variable scaling.
+        for (int i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Smul(m_nCoeffs, -m_scale[i], &res[i * m_nCoeffs], 1,
+                        &res[i * m_nCoeffs], 1);
+        }
+        nKrylov += DoGMRES(c, fc, res, dc, m_krylovTol * resNorm);
+
+        Vmath::Vadd(nTot, c, 1, dc, 1, c, 1);
+        ++nNewton;
+    }
+    ++m_solvesSinceBuild;
+
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        Vmath::Svtvp(m_nPhys, lambda, m_fPhys[i], 1, inarray[i], 1,
+                     outarray[i], 1);
+    }
+
+    if (m_verbose && m_comm->GetRank() == 0)
+    {
+        cout << "JFNK: Newton iterations " << nNewton
+             << ", GMRES iterations " << nKrylov
+             << ", residual " << resNorm << endl;
+    }
+}
+
+/**
+ * @brief Evaluate the projection of the right-hand side, \f$ f(c) \f$, for
+ * the coefficients @p coeffs.
+ */
+void NewtonKrylovSolver::EvaluateRhs(
+    const Array<OneD, const NekDouble>         &coeffs,
+          Array<OneD,       NekDouble>         &rhs,
+          Array<OneD, Array<OneD, NekDouble> > &rhsPhys)
+{
+    Array<OneD, NekDouble> tmp;
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        m_fields[i]->BwdTrans(coeffs + i * m_nCoeffs, m_uPhys[i]);
+    }
+
+    m_projection(m_uPhys, m_uPhys, m_time);
+    m_odeRhs    (m_uPhys, rhsPhys, m_time);
+
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        m_fields[i]->FwdTrans_IterPerExp(rhsPhys[i],
+                                         tmp = rhs + i * m_nCoeffs);
+    }
+}
+
+/**
+ * @brief Approximate the Jacobian-vector product
+ * \f$ J z = z - \lambda \partial f / \partial c \, z \f$ by a one-sided
+ * finite difference about @p coeffs, where @p rhs holds \f$ f(c) \f$.
+ *
+ * The step follows the usual choice
+ * \f$ \epsilon = \sqrt{\epsilon_m (1 + \|c\|)} / \|z\| \f$, with norms taken
+ * in the scaled variables.
+ */
+void NewtonKrylovSolver::ApplyJacobian(
+    const Array<OneD, const NekDouble> &coeffs,
+    const Array<OneD, const NekDouble> &rhs,
+    const Array<OneD, const NekDouble> &pInput,
+          Array<OneD,       NekDouble> &pOutput)
+{
+    const int nTot = m_nVar * m_nCoeffs;
+
+    NekDouble zNorm = ScaledNorm(pInput);
+    if (zNorm == 0.0)
+    {
+        Vmath::Zero(nTot, pOutput, 1);
+        return;
+    }
+
+    NekDouble cNorm = ScaledNorm(coeffs);
+    NekDouble eps   = sqrt(std::numeric_limits<NekDouble>::epsilon() *
+                           (1.0 + cNorm)) / zNorm;
+
+    Array<OneD, NekDouble> cp(nTot);
+    Array<OneD, NekDouble> fp(nTot);
+    Vmath::Svtvp(nTot, eps, pInput, 1, coeffs, 1, cp, 1);
+    EvaluateRhs(cp, fp, m_tmpPhys);
+
+    Vmath::Vsub (nTot, fp, 1, rhs, 1, fp, 1);
+    Vmath::Svtvp(nTot, -m_lambda / eps, fp, 1, pInput, 1, pOutput, 1);
+}
+
+/**
+ * @brief Apply the right preconditioner \f$ P^{-1} = A^{-1} D^{-1} \f$,
+ * mapping a scaled Krylov vector to an unscaled coefficient update. Here
+ * \f$ A \f$ is the block-diagonal part of the Jacobian, or the identity
+ * when no preconditioner is used.
+ */
+void NewtonKrylovSolver::ApplyPreconditioner(
+    const Array<OneD, const NekDouble> &pInput,
+          Array<OneD,       NekDouble> &pOutput)
+{
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        Vmath::Smul(m_nCoeffs, 1.0 / m_scale[i], &pInput[i * m_nCoeffs], 1,
+                    &pOutput[i * m_nCoeffs], 1);
+    }
+
+    if (!m_useBlockJacobi)
+    {
+        return;
+    }
+
+    int nElmt = m_fields[0]->GetExpSize();
+    Array<OneD, NekDouble> blk(m_nVar * m_maxElmtCoeffs);
+    for (int e = 0; e < nElmt; ++e)
+    {
+        int nc     = m_fields[0]->GetNcoeffs(e);
+        int offset = m_fields[0]->GetCoeff_Offset(e);
+        int n      = m_nVar * nc;
+        int info   = 0;
+
+        for (int i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Vcopy(nc, &pOutput[i * m_nCoeffs + offset], 1,
+                         &blk[i * nc], 1);
+        }
+
+        Lapack::Dgetrs('N', n, 1, &m_luBlocks[m_blockOffset[e]], n,
+                       &m_pivots[m_nVar * offset], &blk[0], n, info);
+        ASSERTL0(info == 0, "Failed to apply block-Jacobi preconditioner");
+
+        for (int i = 0; i < m_nVar; ++i)
+        {
+            Vmath::Vcopy(nc, &blk[i * nc], 1,
+                         &pOutput[i * m_nCoeffs + offset], 1);
+        }
+    }
+}
+
+/**
+ * @brief Solve the scaled Newton system \f$ D J P^{-1} y = r \f$ with
+ * right-preconditioned restarted GMRES(m), returning the unscaled update
+ * \f$ P^{-1} y \f$ in @p pOutput.
+ *
+ * The iteration follows GlobalLinSysIterative::DoGMRES: the Krylov basis is
+ * orthogonalised by classical Gram-Schmidt with one reorthogonalisation
+ * pass and the true residual is recomputed at each restart. Since only an
+ * inexact Newton update is required, reaching the iteration limit is not an
+ * error.
+ *
+ * @return Number of GMRES iterations performed.
+ */
+int NewtonKrylovSolver::DoGMRES(
+    const Array<OneD, const NekDouble> &coeffs,
+    const Array<OneD, const NekDouble> &rhs,
+    const Array<OneD, const NekDouble> &pInput,
+          Array<OneD,       NekDouble> &pOutput,
+    const NekDouble                     tol)
+{
+    const int nTot    = m_nVar * m_nCoeffs;
+    const int nKrylov = m_gmresRestart;
+
+    Array<OneD, NekDouble> z_A(nTot, 0.0);
+    Array<OneD, NekDouble> w_A(nTot, 0.0);
+    Array<OneD, NekDouble> r_A(nTot, 0.0);
+
+    // Krylov basis, Hessenberg matrix (column-major) and Givens rotations
+    Array<OneD, Array<OneD, NekDouble> > V(nKrylov + 1);
+    for (int i = 0; i <= nKrylov; ++i)
+    {
+        V[i] = Array<OneD, NekDouble>(nTot, 0.0);
+    }
+    Array<OneD, NekDouble> H   ((nKrylov + 1) * nKrylov, 0.0);
+    Array<OneD, NekDouble> cs  (nKrylov, 0.0);
+    Array<OneD, NekDouble> sn  (nKrylov, 0.0);
+    Array<OneD, NekDouble> g   (nKrylov + 1, 0.0);
+    Array<OneD, NekDouble> y   (nKrylov, 0.0);
+    Array<OneD, NekDouble> vExchange(nKrylov + 1, 0.0);
+
+    Vmath::Vcopy(nTot, pInput, 1, r_A, 1);
+    Vmath::Zero (nTot, pOutput, 1);
+
+    NekDouble eps   = Dot(r_A, r_A);
+    NekDouble tolSq = tol * tol;
+    int       nIter = 0;
+
+    // Restart cycles
+    while (eps > tolSq && nIter < m_krylovMaxIter)
+    {
+        NekDouble beta = sqrt(eps);
+        Vmath::Smul(nTot, 1.0/beta, r_A, 1, V[0], 1);
+        Vmath::Zero(nKrylov + 1, g, 1);
+        g[0] = beta;
+
+        int k = 0;
+        while (k < nKrylov && eps > tolSq && nIter < m_krylovMaxIter)
+        {
+            // w = D J P^{-1} v_k
+            ApplyPreconditioner(V[k], z_A);
+            ApplyJacobian(coeffs, rhs, z_A, w_A);
+            for (int i = 0; i < m_nVar; ++i)
+            {
+                Vmath::Smul(m_nCoeffs, m_scale[i], &w_A[i * m_nCoeffs], 1,
+                            &w_A[i * m_nCoeffs], 1);
+            }
+
+            // Orthogonalise w against v_0..v_k twice, reducing all inner
+            // products of a pass in one exchange.
+            NekDouble *h = &H[k * (nKrylov + 1)];
+            Vmath::Zero(k + 1, h, 1);
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (int i = 0; i <= k; ++i)
+                {
+                    vExchange[i] = Vmath::Dot(nTot, &w_A[0], 1, &V[i][0], 1);
+                }
+                m_comm->AllReduce(vExchange, LibUtilities::ReduceSum);
+
+                for (int i = 0; i <= k; ++i)
+                {
+                    h[i] += vExchange[i];
+                    Vmath::Svtvp(nTot, -vExchange[i], &V[i][0], 1,
+                                 &w_A[0], 1, &w_A[0], 1);
+                }
+            }
+
+            NekDouble hnorm = sqrt(Dot(w_A, w_A));
+            h[k + 1] = hnorm;
+
+            if (hnorm > 0.0)
+            {
+                Vmath::Smul(nTot, 1.0/hnorm, w_A, 1, V[k + 1], 1);
+            }
+
+            // Apply previous rotations to the new column and compute the
+            // rotation eliminating h_{k+1,k}.
+            for (int i = 0; i < k; ++i)
+            {
+                NekDouble t = cs[i] * h[i] + sn[i] * h[i + 1];
+                h[i + 1]    = cs[i] * h[i + 1] - sn[i] * h[i];
+                h[i]        = t;
+            }
+
+            NekDouble denom = sqrt(h[k] * h[k] + h[k + 1] * h[k + 1]);
+            ASSERTL0(denom > 0.0, "GMRES breakdown: singular system");
+            cs[k]    = h[k] / denom;
+            sn[k]    = h[k + 1] / denom;
+            h[k]     = denom;
+            h[k + 1] = 0.0;
+
+            g[k + 1] = -sn[k] * g[k];
+            g[k]     =  cs[k] * g[k];
+
+            eps = g[k + 1] * g[k + 1];
+
+            ++k;
+            ++nIter;
+
+            // The Krylov space is invariant so the solution is exact.
+            if (hnorm == 0.0)
+            {
+                eps = 0.0;
+            }
+        }
+
+        // Solve the upper triangular system H y = g
+        for (int i = k - 1; i >= 0; --i)
+        {
+            NekDouble sum = g[i];
+            for (int j = i + 1; j < k; ++j)
+            {
+                sum -= H[j * (nKrylov + 1) + i] * y[j];
+            }
+            y[i] = sum / H[i * (nKrylov + 1) + i];
+        }
+
+        // x += P^{-1} V y
+        Vmath::Zero(nTot, r_A, 1);
+        for (int i = 0; i < k; ++i)
+        {
+            Vmath::Svtvp(nTot, y[i], V[i], 1, r_A, 1, r_A, 1);
+        }
+        ApplyPreconditioner(r_A, z_A);
+        Vmath::Vadd(nTot, z_A, 1, pOutput, 1, pOutput, 1);
+
+        // Only recompute the true residual r = b - D J x if another restart
+        // cycle follows.
+        if (eps > tolSq && nIter < m_krylovMaxIter)
+        {
+            ApplyJacobian(coeffs, rhs, pOutput, w_A);
+            for (int i = 0; i < m_nVar; ++i)
+            {
+                Vmath::Smul(m_nCoeffs, m_scale[i], &w_A[i * m_nCoeffs], 1,
+                            &w_A[i * m_nCoeffs], 1);
+            }
+            Vmath::Vsub(nTot, pInput, 1, w_A, 1, r_A, 1);
+            eps = Dot(r_A, r_A);
+        }
+    }
+
+    if (m_verbose && eps > tolSq && m_comm->GetRank() == 0)
+    {
+        cout << "JFNK: GMRES reached " << nIter << " iterations with residual "
+             << sqrt(eps) << " (tolerance " << tol << ")" << endl;
+    }
+
+    return nIter;
+}
+
+/**
+ * @brief Greedily colour the elements so that elements of the same colour
+ * do not influence each other's right-hand side.
+ *
+ * Elements are neighbours if they share a trace. Within #m_stencilWidth
+ * layers of neighbours colours must differ, so that perturbing all elements
+ * of one colour at once recovers each element's diagonal Jacobian block.
+ * Neighbours on other partitions are not considered, which only affects the
+ * accuracy of the preconditioner next to partition boundaries.
+ */
+void NewtonKrylovSolver::ColourElements()
+{
+    Array<OneD, Array<OneD, LocalRegions::ExpansionSharedPtr> >
+        &elmtToTrace = m_fields[0]->GetTraceMap()->GetElmtToTrace();
+    int nElmt = m_fields[0]->GetExpSize();
+
+    // Elements adjacent to each trace
+    int nTrace = 0;
+    for (int e = 0; e < nElmt; ++e)
+    {
+        for (int f = 0; f < m_fields[0]->GetExp(e)->GetNtrace(); ++f)
+        {
+            nTrace = std::max(nTrace, elmtToTrace[e][f]->GetElmtId() + 1);
+        }
+    }
+
+    std::vector<std::vector<int> > traceElmts(nTrace);
+    for (int e = 0; e < nElmt; ++e)
+    {
+        for (int f = 0; f < m_fields[0]->GetExp(e)->GetNtrace(); ++f)
+        {
+            traceElmts[elmtToTrace[e][f]->GetElmtId()].push_back(e);
+        }
+    }
+
+    std::vector<std::set<int> > nbrs(nElmt);
+    for (int e = 0; e < nElmt; ++e)
+    {
+        for (int f = 0; f < m_fields[0]->GetExp(e)->GetNtrace(); ++f)
+        {
+            for (auto &n : traceElmts[elmtToTrace[e][f]->GetElmtId()])
+            {
+                if (n != e)
+                {
+                    nbrs[e].insert(n);
+                }
+            }
+        }
+    }
+
+    for (int w = 1; w < m_stencilWidth; ++w)
+    {
+        std::vector<std::set<int> > wider(nbrs);
+        for (int e = 0; e < nElmt; ++e)
+        {
+            for (auto &n : nbrs[e])
+            {
+                for (auto &n2 : nbrs[n])
+                {
+                    if (n2 != e)
+                    {
+                        wider[e].insert(n2);
+                    }
+                }
+            }
+        }
+        nbrs.swap(wider);
+    }
+
+    Array<OneD, int> colour(nElmt, -1);
+    m_colours.clear();
+    for (int e = 0; e < nElmt; ++e)
+    {
+        std::vector<bool> used(m_colours.size(), false);
+        for (auto &n : nbrs[e])
+        {
+            if (colour[n] >= 0)
+            {
+                used[colour[n]] = true;
+            }
+        }
+
+        int c = 0;
+        while (c < used.size() && used[c])
+        {
+            ++c;
+        }
+        if (c == m_colours.size())
+        {
+            m_colours.push_back(std::vector<int>());
+        }
+        colour[e] = c;
+        m_colours[c].push_back(e);
+    }
+
+    // Storage for the element blocks
+    m_blockOffset   = Array<OneD, int>(nElmt);
+    m_maxElmtCoeffs = 0;
+    int blockSize   = 0;
+    for (int e = 0; e < nElmt; ++e)
+    {
+        int nc           = m_fields[0]->GetNcoeffs(e);
+        m_blockOffset[e] = blockSize;
+        blockSize       += (m_nVar * nc) * (m_nVar * nc);
+        m_maxElmtCoeffs  = std::max(m_maxElmtCoeffs, nc);
+    }
+    m_jacBlocks = Array<OneD, NekDouble>(blockSize, 0.0);
+    m_luBlocks  = Array<OneD, NekDouble>(blockSize, 0.0);
+    m_pivots    = Array<OneD, int>(m_nVar * m_nCoeffs, 0);
+}
+
+/**
+ * @brief Compute the element-diagonal blocks of \f$ \partial f / \partial c
+ * \f$ at @p coeffs by finite differences, where @p rhs holds \f$ f(c) \f$.
+ *
+ * All elements of one colour are perturbed together, so the number of
+ * right-hand side evaluations is the number of colours times the number of
+ * coefficients per element and variable. The count is made uniform across
+ * processes since each evaluation involves communication.
+ */
+void NewtonKrylovSolver::BuildBlockJacobian(
+    const Array<OneD, const NekDouble> &coeffs,
+    const Array<OneD, const NekDouble> &rhs)
+{
+    if (m_jacBlocks.size() == 0)
+    {
+        ColourElements();
+    }
+
+    const int nTot = m_nVar * m_nCoeffs;
+    int nColours   = m_colours.size();
+    int maxCoeffs  = m_maxElmtCoeffs;
+    m_comm->AllReduce(nColours,  LibUtilities::ReduceMax);
+    m_comm->AllReduce(maxCoeffs, LibUtilities::ReduceMax);
+
+    const NekDouble sqrtEps = sqrt(std::numeric_limits<NekDouble>::epsilon());
+
+    Array<OneD, NekDouble> cp(nTot);
+    Array<OneD, NekDouble> fp(nTot);
+    Array<OneD, NekDouble> step(m_fields[0]->GetExpSize(), 0.0);
+    Vmath::Vcopy(nTot, coeffs, 1, cp, 1);
+
+    for (int k = 0; k < nColours; ++k)
+    {
+        static const std::vector<int> empty;
+        const std::vector<int> &elmts =
+            k < m_colours.size() ? m_colours[k] : empty;
+
+        for (int v = 0; v < m_nVar; ++v)
+        {
+            // Perturbation relative to the root mean square coefficient
+            NekDouble rms = 1.0 / (m_scale[v] * sqrt(m_nGlobalCoeffs));
+
+            for (int j = 0; j < maxCoeffs; ++j)
+            {
+                for (auto &e : elmts)
+                {
+                    if (j < m_fields[0]->GetNcoeffs(e))
+                    {
+                        int id  = v * m_nCoeffs +
+                                  m_fields[0]->GetCoeff_Offset(e) + j;
+                        step[e] = sqrtEps * (fabs(coeffs[id]) + rms);
+                        cp[id] += step[e];
+                    }
+                }
+
+                EvaluateRhs(cp, fp, m_tmpPhys);
+
+                for (auto &e : elmts)
+                {
+                    int nc = m_fields[0]->GetNcoeffs(e);
+                    if (j >= nc)
+                    {
+                        continue;
+                    }
+
+                    int offset  = m_fields[0]->GetCoeff_Offset(e);
+                    int n       = m_nVar * nc;
+                    NekDouble *col = &m_jacBlocks[m_blockOffset[e] +
+                                                  (v * nc + j) * n];
+                    for (int w = 0; w < m_nVar; ++w)
+                    {
+                        for (int i = 0; i < nc; ++i)
+                        {
+                            int id = w * m_nCoeffs + offset + i;
+                            col[w * nc + i] = (fp[id] - rhs[id]) / step[e];
+                        }
+                    }
+
+                    int id = v * m_nCoeffs + offset + j;
+                    cp[id] = coeffs[id];
+                }
+            }
+        }
+    }
+
+    // Force refactorisation with the new blocks
+    m_blockLambda = 0.0;
+
+    if (m_verbose && m_comm->GetRank() == 0)
+    {
+        cout << "JFNK: rebuilt block Jacobian with " << nColours
+             << " colours (" << nColours * maxCoeffs * m_nVar
+             << " right-hand side evaluations)" << endl;
+    }
+}
+
+/**
+ * @brief Form and LU-factorise \f$ I - \lambda G_e \f$ for each element
+ * block \f$ G_e \f$ with the current \f$ \lambda \f$.
+ */
+void NewtonKrylovSolver::FactoriseBlocks()
+{
+    int nElmt = m_fields[0]->GetExpSize();
+    for (int e = 0; e < nElmt; ++e)
+    {
+        int nc   = m_fields[0]->GetNcoeffs(e);
+        int n    = m_nVar * nc;
+        int info = 0;
+
+        NekDouble *blk = &m_luBlocks[m_blockOffset[e]];
+        Vmath::Smul(n * n, -m_lambda, &m_jacBlocks[m_blockOffset[e]], 1,
+                    blk, 1);
+        Vmath::Sadd(n, 1.0, blk, n + 1, blk, n + 1);
+
+        Lapack::Dgetrf(n, n, blk, n,
+                       &m_pivots[m_nVar * m_fields[0]->GetCoeff_Offset(e)],
+                       info);
+        ASSERTL0(info == 0, "Singular block in block-Jacobi preconditioner");
+    }
+
+    m_blockLambda = m_lambda;
+}
+
+NekDouble NewtonKrylovSolver::Dot(
+    const Array<OneD, const NekDouble> &a,
+    const Array<OneD, const NekDouble> &b)
+{
+    NekDouble dot = Vmath::Dot(m_nVar * m_nCoeffs, &a[0], 1, &b[0], 1);
+    m_comm->AllReduce(dot, LibUtilities::ReduceSum);
+    return dot;
+}
+
+/**
+ * @brief Global 2-norm of @p a after scaling each variable by #m_scale.
+ */
+NekDouble NewtonKrylovSolver::ScaledNorm(const Array<OneD, const NekDouble> &a)
+{
+    NekDouble norm = 0.0;
+    for (int i = 0; i < m_nVar; ++i)
+    {
+        norm += m_scale[i] * m_scale[i] *
+            Vmath::Dot(m_nCoeffs, &a[i * m_nCoeffs], 1, &a[i * m_nCoeffs], 1);
+    }
+    m_comm->AllReduce(norm, LibUtilities::ReduceSum);
+    return sqrt(norm);
+}
+}
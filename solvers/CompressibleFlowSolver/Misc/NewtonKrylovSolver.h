@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File NewtonKrylovSolver.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Jacobian-free Newton-Krylov solver for the implicit
+//              stages of the compressible flow system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERS_COMPRESSIBLEFLOWSOLVER_MISC_NEWTONKRYLOVSOLVER_H
+#define NEKTAR_SOLVERS_COMPRESSIBLEFLOWSOLVER_MISC_NEWTONKRYLOVSOLVER_H
+
+#include <functional>
+#include <vector>
+
+#include <LibUtilities/BasicUtils/SessionReader.h>
+#include <MultiRegions/ExpList.h>
+
+namespace Nektar
+{
+// Forward declarations
+class NewtonKrylovSolver;
+typedef std::shared_ptr<NewtonKrylovSolver> NewtonKrylovSolverSharedPtr;
+
+/**
+ * @brief Jacobian-free Newton-Krylov solver for the stage equations of
+ * implicit (DIRK) time integration.
+ *
+ * Each implicit stage requires the solution of \f$ y - \lambda f(y) = b \f$,
+ * where \f$ f \f$ is the discontinuous Galerkin right-hand side. The system
+ * is solved for the modal coefficients by an inexact Newton method, with the
+ * Newton updates computed by restarted GMRES. Jacobian-vector products are
+ * approximated by finite differences of \f$ f \f$, so the global Jacobian
+ * is never formed. GMRES is right-preconditioned by the element-diagonal
+ * blocks of the Jacobian, which are computed by coloured finite differences
+ * and frozen for a number of solves.
+ */
+class NewtonKrylovSolver
+{
+public:
+    typedef std::function<void(
+        const Array<OneD, const Array<OneD, NekDouble> > &,
+              Array<OneD,       Array<OneD, NekDouble> > &,
+        const NekDouble)> OperatorType;
+
+    NewtonKrylovSolver(
+        const LibUtilities::SessionReaderSharedPtr        &pSession,
+        const Array<OneD, MultiRegions::ExpListSharedPtr> &pFields);
+
+    ~NewtonKrylovSolver();
+
+    template<typename FuncPointerT, typename ObjectPointerT>
+    void SetOdeRhs(FuncPointerT func, ObjectPointerT obj)
+    {
+        m_odeRhs = std::bind(func, obj, std::placeholders::_1,
+                             std::placeholders::_2, std::placeholders::_3);
+    }
+
+    template<typename FuncPointerT, typename ObjectPointerT>
+    void SetProjection(FuncPointerT func, ObjectPointerT obj)
+    {
+        m_projection = std::bind(func, obj, std::placeholders::_1,
+                                 std::placeholders::_2, std::placeholders::_3);
+    }
+
+    /// Set the number of trace-neighbour layers an element's right-hand
+    /// side depends on (1 for inviscid fluxes, 2 with LDG diffusion).
+    void SetStencilWidth(const int width)
+    {
+        m_stencilWidth = width;
+    }
+
+    void Solve(
+        const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+              Array<OneD,       Array<OneD, NekDouble> > &outarray,
+        const NekDouble                                   time,
+        const NekDouble                                   lambda);
+
+protected:
+    LibUtilities::SessionReaderSharedPtr        m_session;
+    LibUtilities::CommSharedPtr                 m_comm;
+    Array<OneD, MultiRegions::ExpListSharedPtr> m_fields;
+    OperatorType                                m_odeRhs;
+    OperatorType                                m_projection;
+
+    int                                         m_nVar;
+    int                                         m_nCoeffs;
+    int                                         m_nPhys;
+    NekDouble                                   m_nGlobalCoeffs;
+
+    // Newton and Krylov iteration parameters
+    NekDouble                                   m_newtonTol;
+    int                                         m_newtonMaxIter;
+    NekDouble                                   m_krylovTol;
+    int                                         m_krylovMaxIter;
+    int                                         m_gmresRestart;
+    bool                                        m_verbose;
+
+    // Block-Jacobi preconditioner
+    bool                                        m_useBlockJacobi;
+    int                                         m_jacobianFreeze;
+    int                                         m_stencilWidth;
+    int                                         m_solvesSinceBuild;
+    NekDouble                                   m_blockLambda;
+    std::vector<std::vector<int> >              m_colours;
+    int                                         m_maxElmtCoeffs;
+    Array<OneD, int>                            m_blockOffset;
+    Array<OneD, NekDouble>                      m_jacBlocks;
+    Array<OneD, NekDouble>                      m_luBlocks;
+    Array<OneD, int>                            m_pivots;
+
+    // State of the current implicit solve
+    NekDouble                                   m_time;
+    NekDouble                                   m_lambda;
+    Array<OneD, NekDouble>                      m_scale;
+    Array<OneD, Array<OneD, NekDouble> >        m_uPhys;
+    Array<OneD, Array<OneD, NekDouble> >        m_fPhys;
+    Array<OneD, Array<OneD, NekDouble> >        m_tmpPhys;
+
+    void EvaluateRhs(
+        const Array<OneD, const NekDouble>         &coeffs,
+              Array<OneD,       NekDouble>         &rhs,
+              Array<OneD, Array<OneD, NekDouble> > &rhsPhys);
+
+    void ApplyJacobian(
+        const Array<OneD, const NekDouble> &coeffs,
+        const Array<OneD, const NekDouble> &rhs,
+        const Array<OneD, const NekDouble> &pInput,
+              Array<OneD,       NekDouble> &pOutput);
+
+    void ApplyPreconditioner(
+        const Array<OneD, const NekDouble> &pInput,
+              Array<OneD,       NekDouble> &pOutput);
+
+    int DoGMRES(
+        const Array<OneD, const NekDouble> &coeffs,
+        const Array<OneD, const NekDouble> &rhs,
+        const Array<OneD, const NekDouble> &pInput,
+              Array<OneD,       NekDouble> &pOutput,
+        const NekDouble                     tol);
+
+    void ColourElements();
+
+    void BuildBlockJacobian(
+        const Array<OneD, const NekDouble> &coeffs,
+        const Array<OneD, const NekDouble> &rhs);
+
+    void FactoriseBlocks();
+
+    NekDouble Dot(
+        const Array<OneD, const NekDouble> &a,
+        const Array<OneD, const NekDouble> &b);
+
+    NekDouble ScaledNorm(const Array<OneD, const NekDouble> &a);
+};
+}
+
+#endif
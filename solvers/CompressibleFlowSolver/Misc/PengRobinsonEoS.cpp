@@ -46,7 +46,7 @@ std::string PengRobinsonEoS::className =
 
 PengRobinsonEoS::PengRobinsonEoS(
     const LibUtilities::SessionReaderSharedPtr &pSession)
-    : EquationOfState(pSession)
+    : EquationOfStateImpl<PengRobinsonEoS>(pSession)
 {
     pSession->LoadParameter("Tcrit", m_Tc);
     pSession->LoadParameter("Pcrit", m_Pc);
@@ -82,7 +82,7 @@ NekDouble PengRobinsonEoS::v_GetTemperature(const NekDouble &rho,
 NekDouble PengRobinsonEoS::v_GetPressure(const NekDouble &rho,
                                          const NekDouble &e)
 {
-    NekDouble T = GetTemperature(rho, e);
+    NekDouble T = v_GetTemperature(rho, e);
 
     NekDouble p =
         m_gasConstant * T / (1.0 / rho - m_b) -
@@ -94,7 +94,7 @@ NekDouble PengRobinsonEoS::v_GetPressure(const NekDouble &rho,
 NekDouble PengRobinsonEoS::v_GetEntropy(const NekDouble &rho,
                                         const NekDouble &e)
 {
-    NekDouble T       = GetTemperature(rho, e);
+    NekDouble T       = v_GetTemperature(rho, e);
     NekDouble logTerm = LogTerm(rho);
     // Entropy for an ideal gas
     NekDouble sIg =
@@ -113,8 +113,8 @@ NekDouble PengRobinsonEoS::v_GetEntropy(const NekDouble &rho,
 NekDouble PengRobinsonEoS::v_GetDPDrho_e(const NekDouble &rho,
                                          const NekDouble &e)
 {
-    NekDouble T    = GetTemperature(rho, e);
-    NekDouble dPde = GetDPDe_rho(rho, e);
+    NekDouble T    = v_GetTemperature(rho, e);
+    NekDouble dPde = v_GetDPDe_rho(rho, e);
 
     // First calculate the denominator 1/rho^2 + 2*b/rho - b^2
     //    and alpha = [1+f_w*(1-sqrt(Tr))]^2
@@ -138,7 +138,7 @@ NekDouble PengRobinsonEoS::v_GetDPDrho_e(const NekDouble &rho,
 NekDouble PengRobinsonEoS::v_GetDPDe_rho(const NekDouble &rho,
                                          const NekDouble &e)
 {
-    NekDouble T       = GetTemperature(rho, e);
+    NekDouble T       = v_GetTemperature(rho, e);
     NekDouble logTerm = LogTerm(rho);
 
     // First calculate the denominator 1/rho^2 + 2*b/rho - b^2
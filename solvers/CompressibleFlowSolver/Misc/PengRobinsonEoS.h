@@ -48,10 +48,11 @@ namespace Nektar
  *            Alpha(T/Tc) = [1 + fw * (1 - sqrt(T/ Tc))]^2
  *            fw = 0.37464 + 1.54226*omega - 0.2699*omega*omega
 */
-class PengRobinsonEoS : public EquationOfState
+class PengRobinsonEoS final : public EquationOfStateImpl<PengRobinsonEoS>
 {
 public:
     friend class MemoryManager<PengRobinsonEoS>;
+    friend class EquationOfStateImpl<PengRobinsonEoS>;
 
     /// Creates an instance of this class
     static EquationOfStateSharedPtr create(
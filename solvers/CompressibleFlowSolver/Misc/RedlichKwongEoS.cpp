@@ -46,7 +46,7 @@ std::string RedlichKwongEoS::className =
 
 RedlichKwongEoS::RedlichKwongEoS(
     const LibUtilities::SessionReaderSharedPtr &pSession)
-    : EquationOfState(pSession)
+    : EquationOfStateImpl<RedlichKwongEoS>(pSession)
 {
     pSession->LoadParameter("Tcrit", m_Tc);
     pSession->LoadParameter("Pcrit", m_Pc);
@@ -101,7 +101,7 @@ NekDouble RedlichKwongEoS::v_GetTemperature(const NekDouble &rho,
 NekDouble RedlichKwongEoS::v_GetPressure(const NekDouble &rho,
                                          const NekDouble &e)
 {
-    NekDouble T = GetTemperature(rho, e);
+    NekDouble T = v_GetTemperature(rho, e);
 
     NekDouble p = m_gasConstant * T / (1.0 / rho - m_b) -
                   m_a * Alpha(T) / (1.0 / (rho * rho) + m_b / rho);
@@ -112,7 +112,7 @@ NekDouble RedlichKwongEoS::v_GetPressure(const NekDouble &rho,
 NekDouble RedlichKwongEoS::v_GetEntropy(const NekDouble &rho,
                                         const NekDouble &e)
 {
-    NekDouble T       = GetTemperature(rho, e);
+    NekDouble T       = v_GetTemperature(rho, e);
     NekDouble logTerm = LogTerm(rho);
     // Entropy for an ideal gas
     NekDouble sIg =
@@ -127,9 +127,9 @@ NekDouble RedlichKwongEoS::v_GetEntropy(const NekDouble &rho,
 NekDouble RedlichKwongEoS::v_GetDPDrho_e(const NekDouble &rho,
                                          const NekDouble &e)
 {
-    NekDouble T     = GetTemperature(rho, e);
+    NekDouble T     = v_GetTemperature(rho, e);
     NekDouble alpha = Alpha(T);
-    NekDouble dPde  = GetDPDe_rho(rho, e);
+    NekDouble dPde  = v_GetDPDe_rho(rho, e);
 
     // Calculate dPdrho_T
     NekDouble dPdrho_T =
@@ -147,7 +147,7 @@ NekDouble RedlichKwongEoS::v_GetDPDrho_e(const NekDouble &rho,
 NekDouble RedlichKwongEoS::v_GetDPDe_rho(const NekDouble &rho,
                                          const NekDouble &e)
 {
-    NekDouble T       = GetTemperature(rho, e);
+    NekDouble T       = v_GetTemperature(rho, e);
     NekDouble alpha   = Alpha(T);
     NekDouble logTerm = LogTerm(rho);
 
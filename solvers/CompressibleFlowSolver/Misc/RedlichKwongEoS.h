@@ -46,10 +46,11 @@ namespace Nektar
  *       with a = 0.42748 * (R*Tc)^2 / Pc
  *            b = 0.08664 * (R*Tc) / Pc
 */
-class RedlichKwongEoS : public EquationOfState
+class RedlichKwongEoS final : public EquationOfStateImpl<RedlichKwongEoS>
 {
 public:
     friend class MemoryManager<RedlichKwongEoS>;
+    friend class EquationOfStateImpl<RedlichKwongEoS>;
 
     /// Creates an instance of this class
     static EquationOfStateSharedPtr create(
@@ -48,7 +48,7 @@ std::string VanDerWaalsEoS::className =
 
 VanDerWaalsEoS::VanDerWaalsEoS(
     const LibUtilities::SessionReaderSharedPtr &pSession)
-    : EquationOfState(pSession)
+    : EquationOfStateImpl<VanDerWaalsEoS>(pSession)
 {
     NekDouble Tcrit, Pcrit;
     pSession->LoadParameter("Tcrit", Tcrit);
@@ -73,7 +73,7 @@ NekDouble VanDerWaalsEoS::v_GetPressure(const NekDouble &rho,
 
 NekDouble VanDerWaalsEoS::v_GetEntropy(const NekDouble &rho, const NekDouble &e)
 {
-    NekDouble T = GetTemperature(rho, e);
+    NekDouble T = v_GetTemperature(rho, e);
     NekDouble sIg =
         m_gasConstant / (m_gamma - 1) * log(T) - m_gasConstant * log(rho);
 
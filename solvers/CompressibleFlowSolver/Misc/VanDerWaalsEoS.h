@@ -46,10 +46,11 @@ namespace Nektar
  *       with a = 27/64 * (R*Tc)^2 / Pc
  *            b = 1/8   * (R*Tc) / Pc
 */
-class VanDerWaalsEoS : public EquationOfState
+class VanDerWaalsEoS final : public EquationOfStateImpl<VanDerWaalsEoS>
 {
 public:
     friend class MemoryManager<VanDerWaalsEoS>;
+    friend class EquationOfStateImpl<VanDerWaalsEoS>;
 
     /// Creates an instance of this class
     static EquationOfStateSharedPtr create(
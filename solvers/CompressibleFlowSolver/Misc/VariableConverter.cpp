@@ -340,10 +340,7 @@ void VariableConverter::GetPressure(
     Array<OneD, NekDouble> energy(nPts);
     GetInternalEnergy(physfield, energy);
 
-    for (int i = 0; i < nPts; ++i)
-    {
-        pressure[i] = m_eos->GetPressure(physfield[0][i], energy[i]);
-    }
+    m_eos->GetPressure(physfield[0], energy, pressure);
 }
 
 /**
@@ -361,10 +358,7 @@ void VariableConverter::GetTemperature(
     Array<OneD, NekDouble> energy(nPts);
     GetInternalEnergy(physfield, energy);
 
-    for (int i = 0; i < nPts; ++i)
-    {
-        temperature[i] = m_eos->GetTemperature(physfield[0][i], energy[i]);
-    }
+    m_eos->GetTemperature(physfield[0], energy, temperature);
 }
 
 /**
@@ -382,10 +376,7 @@ void VariableConverter::GetSoundSpeed(
     Array<OneD, NekDouble> energy(nPts);
     GetInternalEnergy(physfield, energy);
 
-    for (int i = 0; i < nPts; ++i)
-    {
-        soundspeed[i] = m_eos->GetSoundSpeed(physfield[0][i], energy[i]);
-    }
+    m_eos->GetSoundSpeed(physfield[0], energy, soundspeed);
 }
 
 /**
@@ -403,10 +394,7 @@ void VariableConverter::GetEntropy(
     Array<OneD, NekDouble> energy(nPts);
     GetInternalEnergy(physfield, energy);
 
-    for (int i = 0; i < nPts; ++i)
-    {
-        entropy[i] = m_eos->GetEntropy(physfield[0][i], energy[i]);
-    }
+    m_eos->GetEntropy(physfield[0], energy, entropy);
 }
 
 /**
@@ -420,12 +408,7 @@ void VariableConverter::GetEFromRhoP(const Array<OneD, NekDouble> &rho,
                                      const Array<OneD, NekDouble> &pressure,
                                      Array<OneD, NekDouble> &energy)
 {
-    int nPts = rho.size();
-
-    for (int i = 0; i < nPts; ++i)
-    {
-        energy[i] = m_eos->GetEFromRhoP(rho[i], pressure[i]);
-    }
+    m_eos->GetEFromRhoP(rho, pressure, energy);
 }
 
 /**
@@ -439,11 +422,6 @@ void VariableConverter::GetRhoFromPT(const Array<OneD, NekDouble> &pressure,
                                      const Array<OneD, NekDouble> &temperature,
                                      Array<OneD, NekDouble> &rho)
 {
-    int nPts = pressure.size();
-
-    for (int i = 0; i < nPts; ++i)
-    {
-        rho[i] = m_eos->GetRhoFromPT(pressure[i], temperature[i]);
-    }
+    m_eos->GetRhoFromPT(pressure, temperature, rho);
 }
 }
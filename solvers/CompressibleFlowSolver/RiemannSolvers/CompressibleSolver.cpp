@@ -38,9 +38,12 @@
 
 namespace Nektar
 {
+    const int CompressibleSolver::m_blockSize;
+
     CompressibleSolver::CompressibleSolver(
         const LibUtilities::SessionReaderSharedPtr& pSession)
-        : RiemannSolver(pSession), m_pointSolve(true)
+        : RiemannSolver(pSession), m_pointSolve(true), m_blockSolve(false),
+          m_blockZero(m_blockSize, 0.0), m_blockDiscard(m_blockSize)
     {
         m_requiresRotation = true;
 
@@ -60,7 +63,11 @@ namespace Nektar
         const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
               Array<OneD,       Array<OneD, NekDouble> > &flux)
     {
-        if (m_pointSolve)
+        if (m_blockSolve && Fwd.size() == size_t(nDim + 2))
+        {
+            BlockSolve(nDim, Fwd, Bwd, flux);
+        }
+        else if (m_pointSolve)
         {
             int expDim      = nDim;
             int nvariables  = Fwd.size();
@@ -130,6 +137,49 @@ namespace Nektar
         }
     }
 
+    /**
+     * @brief Solves the Riemann problem at all trace points by passing
+     * consecutive blocks of #m_blockSize points to v_BlockSolve.
+     */
+    void CompressibleSolver::BlockSolve(
+        const int                                         expDim,
+        const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+        const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+              Array<OneD,       Array<OneD, NekDouble> > &flux)
+    {
+        // Index of density, momentum and energy in the field variables,
+        // or -1 for momentum components not present in this dimension
+        int vars[5] = {0, 1, expDim > 1 ? 2 : -1, expDim > 2 ? 3 : -1,
+                       expDim + 1};
+
+        const NekDouble *pFwd[5], *pBwd[5];
+              NekDouble *pFlux[5];
+
+        int nPts = Fwd[0].size();
+        for (int i = 0; i < nPts; i += m_blockSize)
+        {
+            int n = nPts - i < m_blockSize ? nPts - i : m_blockSize;
+
+            for (int k = 0; k < 5; ++k)
+            {
+                if (vars[k] < 0)
+                {
+                    pFwd [k] = m_blockZero.data();
+                    pBwd [k] = m_blockZero.data();
+                    pFlux[k] = m_blockDiscard.data();
+                }
+                else
+                {
+                    pFwd [k] = Fwd [vars[k]].data() + i;
+                    pBwd [k] = Bwd [vars[k]].data() + i;
+                    pFlux[k] = flux[vars[k]].data() + i;
+                }
+            }
+
+            v_BlockSolve(n, pFwd, pBwd, pFlux);
+        }
+    }
+
     NekDouble CompressibleSolver::GetRoeSoundSpeed(
         NekDouble rhoL, NekDouble pL, NekDouble eL, NekDouble HL, NekDouble srL,
         NekDouble rhoR, NekDouble pR, NekDouble eR, NekDouble HR, NekDouble srR,
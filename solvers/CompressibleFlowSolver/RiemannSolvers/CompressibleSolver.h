@@ -48,8 +48,18 @@ namespace Nektar
     {
     protected:
         bool m_pointSolve;
+        /// Solve blocks of trace points with v_BlockSolve rather than
+        /// calling v_PointSolve for each point.
+        bool m_blockSolve;
         EquationOfStateSharedPtr m_eos;
         bool m_idealGas;
+
+        /// Number of trace points passed to each call of v_BlockSolve.
+        static const int m_blockSize = 16;
+        /// Zero state and discarded flux substituted for the momentum
+        /// components which are absent in one and two dimensions.
+        Array<OneD, NekDouble> m_blockZero;
+        Array<OneD, NekDouble> m_blockDiscard;
         
         CompressibleSolver(
                 const LibUtilities::SessionReaderSharedPtr& pSession);
@@ -70,6 +80,26 @@ namespace Nektar
                      "This function should be defined by subclasses.");
         }
         
+        /**
+         * @brief Solves the Riemann problem at @a n <= #m_blockSize trace
+         * points.
+         *
+         * The states and fluxes are given in structure-of-arrays form as
+         * pointers to the density, the three momentum components and the
+         * energy, each referring to @a n consecutive values. Momentum
+         * components absent in one and two dimensions are zero.
+         */
+        virtual void v_BlockSolve(
+            const int                n,
+            const NekDouble * const *Fwd,
+            const NekDouble * const *Bwd,
+                  NekDouble * const *flux)
+        {
+            boost::ignore_unused(n, Fwd, Bwd, flux);
+            NEKERROR(ErrorUtil::efatal,
+                     "This function should be defined by subclasses.");
+        }
+
         virtual void v_PointSolve(
             NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL,
             NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER,
@@ -98,6 +128,13 @@ namespace Nektar
             NekDouble rhoL, NekDouble pL, NekDouble eL, NekDouble HL, NekDouble srL,
             NekDouble rhoR, NekDouble pR, NekDouble eR, NekDouble HR, NekDouble srR,
             NekDouble HRoe, NekDouble URoe2, NekDouble srLR);
+
+    private:
+        void BlockSolve(
+            const int                                         expDim,
+            const Array<OneD, const Array<OneD, NekDouble> > &Fwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &flux);
     };
 }
 
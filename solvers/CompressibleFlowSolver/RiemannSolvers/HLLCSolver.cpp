@@ -43,7 +43,8 @@ namespace Nektar
     HLLCSolver::HLLCSolver(const LibUtilities::SessionReaderSharedPtr& pSession)
         : CompressibleSolver(pSession)
     {
-        
+        // The batched solver evaluates the ideal gas law directly
+        m_blockSolve = m_idealGas;
     }
     
     /**
@@ -170,6 +171,144 @@ namespace Nektar
         }
     }
 
+    /**
+     * @brief HLLC Riemann solver for a block of trace points of an ideal
+     * gas.
+     *
+     * Follows v_PointSolve, but is split into loops over the block which
+     * are free of branches and function calls, so that they can be
+     * vectorised. Square roots are taken in between with Vmath::Vsqrt, and
+     * the flux is selected among all candidate fluxes.
+     */
+    void HLLCSolver::v_BlockSolve(
+        const int                n,
+        const NekDouble * const *Fwd,
+        const NekDouble * const *Bwd,
+              NekDouble * const *flux)
+    {
+        static NekDouble gamma = m_params["gamma"]();
+
+        // Local copy of the states, which the compiler can prove not to
+        // alias the other arrays of the block
+        NekDouble L[5][m_blockSize], R[5][m_blockSize];
+        for (int k = 0; k < 5; ++k)
+        {
+            Vmath::Vcopy(n, Fwd[k], 1, L[k], 1);
+            Vmath::Vcopy(n, Bwd[k], 1, R[k], 1);
+        }
+
+        NekDouble *rhoL = L[0], *rhouL = L[1], *rhovL = L[2];
+        NekDouble *rhowL = L[3], *EL = L[4];
+        NekDouble *rhoR = R[0], *rhouR = R[1], *rhovR = R[2];
+        NekDouble *rhowR = R[3], *ER = R[4];
+
+        NekDouble uL[m_blockSize], vL[m_blockSize], wL[m_blockSize];
+        NekDouble uR[m_blockSize], vR[m_blockSize], wR[m_blockSize];
+        NekDouble pL[m_blockSize], pR[m_blockSize];
+        NekDouble cL[m_blockSize], cR[m_blockSize];
+        NekDouble srL[m_blockSize], srR[m_blockSize];
+        NekDouble uRoe[m_blockSize], cRoe[m_blockSize];
+        NekDouble SL[m_blockSize], SR[m_blockSize], SM[m_blockSize];
+        NekDouble fL[5][m_blockSize], fR[5][m_blockSize];
+        NekDouble fML[5][m_blockSize], fMR[5][m_blockSize];
+
+        // Velocities, pressure and squared speed of sound
+        for (int i = 0; i < n; ++i)
+        {
+            uL[i] = rhouL[i] / rhoL[i];
+            vL[i] = rhovL[i] / rhoL[i];
+            wL[i] = rhowL[i] / rhoL[i];
+            uR[i] = rhouR[i] / rhoR[i];
+            vR[i] = rhovR[i] / rhoR[i];
+            wR[i] = rhowR[i] / rhoR[i];
+
+            pL[i] = (gamma - 1.0) * (EL[i] - 0.5 *
+                (rhouL[i] * uL[i] + rhovL[i] * vL[i] + rhowL[i] * wL[i]));
+            pR[i] = (gamma - 1.0) * (ER[i] - 0.5 *
+                (rhouR[i] * uR[i] + rhovR[i] * vR[i] + rhowR[i] * wR[i]));
+            cL[i] = gamma * pL[i] / rhoL[i];
+            cR[i] = gamma * pR[i] / rhoR[i];
+        }
+
+        Vmath::Vsqrt(n, cL,   1, cL,  1);
+        Vmath::Vsqrt(n, cR,   1, cR,  1);
+        Vmath::Vsqrt(n, rhoL, 1, srL, 1);
+        Vmath::Vsqrt(n, rhoR, 1, srR, 1);
+
+        // Roe average state and squared Roe average speed of sound
+        for (int i = 0; i < n; ++i)
+        {
+            NekDouble HL    = (EL[i] + pL[i]) / rhoL[i];
+            NekDouble HR    = (ER[i] + pR[i]) / rhoR[i];
+            NekDouble srLR  = srL[i] + srR[i];
+            NekDouble vRoe  = (srL[i] * vL[i] + srR[i] * vR[i]) / srLR;
+            NekDouble wRoe  = (srL[i] * wL[i] + srR[i] * wR[i]) / srLR;
+            NekDouble HRoe  = (srL[i] * HL + srR[i] * HR) / srLR;
+            uRoe[i]         = (srL[i] * uL[i] + srR[i] * uR[i]) / srLR;
+            NekDouble URoe2 = uRoe[i]*uRoe[i] + vRoe*vRoe + wRoe*wRoe;
+            cRoe[i]         = (gamma - 1.0) * (HRoe - 0.5 * URoe2);
+        }
+
+        Vmath::Vsqrt(n, cRoe, 1, cRoe, 1);
+
+        // Fluxes of the left, right and star states
+        for (int i = 0; i < n; ++i)
+        {
+            // Maximum wave speeds and contact wave speed
+            SL[i] = std::min(uL[i] - cL[i], uRoe[i] - cRoe[i]);
+            SR[i] = std::max(uR[i] + cR[i], uRoe[i] + cRoe[i]);
+            SM[i] = (pR[i] - pL[i] + rhouL[i] * (SL[i] - uL[i]) -
+                     rhouR[i] * (SR[i] - uR[i])) /
+                (rhoL[i] * (SL[i] - uL[i]) - rhoR[i] * (SR[i] - uR[i]));
+
+            fL[0][i] = rhouL[i];
+            fL[1][i] = rhouL[i] * uL[i] + pL[i];
+            fL[2][i] = rhouL[i] * vL[i];
+            fL[3][i] = rhouL[i] * wL[i];
+            fL[4][i] = uL[i] * (EL[i] + pL[i]);
+
+            fR[0][i] = rhouR[i];
+            fR[1][i] = rhouR[i] * uR[i] + pR[i];
+            fR[2][i] = rhouR[i] * vR[i];
+            fR[3][i] = rhouR[i] * wR[i];
+            fR[4][i] = uR[i] * (ER[i] + pR[i]);
+
+            NekDouble rhoML = rhoL[i] * (SL[i] - uL[i]) / (SL[i] - SM[i]);
+            NekDouble EML   = rhoML * (EL[i] / rhoL[i] + (SM[i] - uL[i]) *
+                (SM[i] + pL[i] / (rhoL[i] * (SL[i] - uL[i]))));
+            fML[0][i] = fL[0][i] + SL[i] * (rhoML - rhoL[i]);
+            fML[1][i] = fL[1][i] + SL[i] * (rhoML * SM[i] - rhouL[i]);
+            fML[2][i] = fL[2][i] + SL[i] * (rhoML * vL[i] - rhovL[i]);
+            fML[3][i] = fL[3][i] + SL[i] * (rhoML * wL[i] - rhowL[i]);
+            fML[4][i] = fL[4][i] + SL[i] * (EML - EL[i]);
+
+            NekDouble rhoMR = rhoR[i] * (SR[i] - uR[i]) / (SR[i] - SM[i]);
+            NekDouble EMR   = rhoMR * (ER[i] / rhoR[i] + (SM[i] - uR[i]) *
+                (SM[i] + pR[i] / (rhoR[i] * (SR[i] - uR[i]))));
+            fMR[0][i] = fR[0][i] + SR[i] * (rhoMR - rhoR[i]);
+            fMR[1][i] = fR[1][i] + SR[i] * (rhoMR * SM[i] - rhouR[i]);
+            fMR[2][i] = fR[2][i] + SR[i] * (rhoMR * vR[i] - rhovR[i]);
+            fMR[3][i] = fR[3][i] + SR[i] * (rhoMR * wR[i] - rhowR[i]);
+            fMR[4][i] = fR[4][i] + SR[i] * (EMR - ER[i]);
+        }
+
+        // Select the flux of the region containing the interface
+        for (int k = 0; k < 5; ++k)
+        {
+            const NekDouble *fLk = fL[k], *fRk = fR[k];
+            const NekDouble *fMLk = fML[k], *fMRk = fMR[k];
+            NekDouble *f = flux[k];
+            for (int i = 0; i < n; ++i)
+            {
+                // Load all candidates so that the selection is branch-free
+                NekDouble a = fLk[i], b = fRk[i], c = fMLk[i], d = fMRk[i];
+                NekDouble fM = SM[i] >= 0.0 ? c : d;
+                fM   = SR[i] <= 0.0 ? b : fM;
+                f[i] = SL[i] >= 0.0 ? a : fM;
+            }
+        }
+    }
+
     void HLLCSolver::v_PointSolveVisc(
         NekDouble  rhoL, NekDouble  rhouL, NekDouble  rhovL, NekDouble  rhowL, NekDouble  EL, NekDouble  EpsL,
         NekDouble  rhoR, NekDouble  rhouR, NekDouble  rhovR, NekDouble  rhowR, NekDouble  ER, NekDouble  EpsR,
@@ -46,7 +46,8 @@ namespace Nektar
         const LibUtilities::SessionReaderSharedPtr& pSession)
         : CompressibleSolver(pSession)
     {
-        
+        // The batched solver evaluates the ideal gas law directly
+        m_blockSolve = m_idealGas;
     }
     
     /**
@@ -120,4 +121,103 @@ namespace Nektar
         rhowf = 0.5*(rhouL*wL + rhouR*wR - URoe*(rhowR - rhowL));
         Ef    = 0.5*(uL*(EL + pL) + uR*(ER + pR) - URoe*(ER - EL));
     }
+
+    /**
+     * @brief Lax-Friedrichs Riemann solver for a block of trace points of
+     * an ideal gas.
+     *
+     * Follows v_PointSolve, with the square roots taken in between the
+     * loops with Vmath::Vsqrt so that the loops over the block can be
+     * vectorised.
+     */
+    void LaxFriedrichsSolver::v_BlockSolve(
+        const int                n,
+        const NekDouble * const *Fwd,
+        const NekDouble * const *Bwd,
+              NekDouble * const *flux)
+    {
+        static NekDouble gamma = m_params["gamma"]();
+
+        // Local copy of the states, which the compiler can prove not to
+        // alias the other arrays of the block
+        NekDouble L[5][m_blockSize], R[5][m_blockSize];
+        for (int k = 0; k < 5; ++k)
+        {
+            Vmath::Vcopy(n, Fwd[k], 1, L[k], 1);
+            Vmath::Vcopy(n, Bwd[k], 1, R[k], 1);
+        }
+
+        NekDouble *rhoL = L[0], *rhouL = L[1], *rhovL = L[2];
+        NekDouble *rhowL = L[3], *EL = L[4];
+        NekDouble *rhoR = R[0], *rhouR = R[1], *rhovR = R[2];
+        NekDouble *rhowR = R[3], *ER = R[4];
+
+        // Fluxes are likewise assembled locally and copied out at the end
+        NekDouble F[5][m_blockSize];
+        NekDouble *rhof = F[0], *rhouf = F[1], *rhovf = F[2];
+        NekDouble *rhowf = F[3], *Ef = F[4];
+
+        NekDouble uL[m_blockSize], vL[m_blockSize], wL[m_blockSize];
+        NekDouble uR[m_blockSize], vR[m_blockSize], wR[m_blockSize];
+        NekDouble pL[m_blockSize], pR[m_blockSize];
+        NekDouble srL[m_blockSize], srR[m_blockSize];
+        NekDouble uRoe[m_blockSize], cRoe[m_blockSize];
+
+        Vmath::Vsqrt(n, rhoL, 1, srL, 1);
+        Vmath::Vsqrt(n, rhoR, 1, srR, 1);
+
+        for (int i = 0; i < n; ++i)
+        {
+            // Left and right velocities
+            uL[i] = rhouL[i] / rhoL[i];
+            vL[i] = rhovL[i] / rhoL[i];
+            wL[i] = rhowL[i] / rhoL[i];
+            uR[i] = rhouR[i] / rhoR[i];
+            vR[i] = rhovR[i] / rhoR[i];
+            wR[i] = rhowR[i] / rhoR[i];
+
+            // Pressure
+            pL[i] = (gamma - 1.0) * (EL[i] - 0.5 *
+                (rhouL[i] * uL[i] + rhovL[i] * vL[i] + rhowL[i] * wL[i]));
+            pR[i] = (gamma - 1.0) * (ER[i] - 0.5 *
+                (rhouR[i] * uR[i] + rhovR[i] * vR[i] + rhowR[i] * wR[i]));
+
+            // Left and right total enthalpy
+            NekDouble HL = (EL[i] + pL[i]) / rhoL[i];
+            NekDouble HR = (ER[i] + pR[i]) / rhoR[i];
+
+            // Roe average state and squared sound speed
+            NekDouble srLR  = srL[i] + srR[i];
+            uRoe[i]         = (srL[i] * uL[i] + srR[i] * uR[i]) / srLR;
+            NekDouble vRoe  = (srL[i] * vL[i] + srR[i] * vR[i]) / srLR;
+            NekDouble wRoe  = (srL[i] * wL[i] + srR[i] * wR[i]) / srLR;
+            NekDouble URoe2 = uRoe[i]*uRoe[i] + vRoe*vRoe + wRoe*wRoe;
+            NekDouble HRoe  = (srL[i] * HL + srR[i] * HR) / srLR;
+            cRoe[i]         = (gamma - 1.0) * (HRoe - 0.5 * URoe2);
+        }
+
+        Vmath::Vsqrt(n, cRoe, 1, cRoe, 1);
+
+        for (int i = 0; i < n; ++i)
+        {
+            // Maximum eigenvalue
+            NekDouble URoe = fabs(uRoe[i]) + cRoe[i];
+
+            // Lax-Friedrichs flux formula
+            rhof [i] = 0.5*(rhouL[i] + rhouR[i] - URoe*(rhoR[i] - rhoL[i]));
+            rhouf[i] = 0.5*(pL[i] + rhouL[i]*uL[i] + pR[i] + rhouR[i]*uR[i] -
+                            URoe*(rhouR[i] - rhouL[i]));
+            rhovf[i] = 0.5*(rhouL[i]*vL[i] + rhouR[i]*vR[i] -
+                            URoe*(rhovR[i] - rhovL[i]));
+            rhowf[i] = 0.5*(rhouL[i]*wL[i] + rhouR[i]*wR[i] -
+                            URoe*(rhowR[i] - rhowL[i]));
+            Ef   [i] = 0.5*(uL[i]*(EL[i] + pL[i]) + uR[i]*(ER[i] + pR[i]) -
+                            URoe*(ER[i] - EL[i]));
+        }
+
+        for (int k = 0; k < 5; ++k)
+        {
+            Vmath::Vcopy(n, F[k], 1, flux[k], 1);
+        }
+    }
 }
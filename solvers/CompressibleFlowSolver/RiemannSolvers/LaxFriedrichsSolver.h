@@ -59,6 +59,12 @@ namespace Nektar
             double  rhoL, double  rhouL, double  rhovL, double  rhowL, double  EL,
             double  rhoR, double  rhouR, double  rhovR, double  rhowR, double  ER,
             double &rhof, double &rhouf, double &rhovf, double &rhowf, double &Ef);
+
+        virtual void v_BlockSolve(
+            const int                n,
+            const NekDouble * const *Fwd,
+            const NekDouble * const *Bwd,
+                  NekDouble * const *flux);
     };
 }
 
@@ -45,7 +45,7 @@ namespace Nektar
     RoeSolver::RoeSolver(const LibUtilities::SessionReaderSharedPtr& pSession)
         : CompressibleSolver(pSession)
     {
-
+        m_blockSolve = true;
     }
 
     /**
@@ -172,4 +172,136 @@ namespace Nektar
             Ef    -= uRoeAbs*k[i][4];
         }
     }
+
+    /**
+     * @brief Roe Riemann solver for a block of trace points.
+     *
+     * Evaluates the same expressions as v_PointSolve, with the summation
+     * over the waves written out and the square roots taken in between the
+     * loops with Vmath::Vsqrt, so that the loops over the block can be
+     * vectorised.
+     */
+    void RoeSolver::v_BlockSolve(
+        const int                n,
+        const NekDouble * const *Fwd,
+        const NekDouble * const *Bwd,
+              NekDouble * const *flux)
+    {
+        static NekDouble gamma = m_params["gamma"]();
+
+        // Local copy of the states, which the compiler can prove not to
+        // alias the other arrays of the block
+        NekDouble L[5][m_blockSize], R[5][m_blockSize];
+        for (int k = 0; k < 5; ++k)
+        {
+            Vmath::Vcopy(n, Fwd[k], 1, L[k], 1);
+            Vmath::Vcopy(n, Bwd[k], 1, R[k], 1);
+        }
+
+        NekDouble *rhoL = L[0], *rhouL = L[1], *rhovL = L[2];
+        NekDouble *rhowL = L[3], *EL = L[4];
+        NekDouble *rhoR = R[0], *rhouR = R[1], *rhovR = R[2];
+        NekDouble *rhowR = R[3], *ER = R[4];
+
+        // Fluxes are likewise assembled locally and copied out at the end
+        NekDouble F[5][m_blockSize];
+        NekDouble *rhof = F[0], *rhouf = F[1], *rhovf = F[2];
+        NekDouble *rhowf = F[3], *Ef = F[4];
+
+        NekDouble uL[m_blockSize], vL[m_blockSize], wL[m_blockSize];
+        NekDouble uR[m_blockSize], vR[m_blockSize], wR[m_blockSize];
+        NekDouble pL[m_blockSize], pR[m_blockSize];
+        NekDouble srL[m_blockSize], srR[m_blockSize];
+        NekDouble uRoe[m_blockSize], vRoe[m_blockSize], wRoe[m_blockSize];
+        NekDouble hRoe[m_blockSize], cRoe[m_blockSize];
+
+        Vmath::Vsqrt(n, rhoL, 1, srL, 1);
+        Vmath::Vsqrt(n, rhoR, 1, srR, 1);
+
+        for (int i = 0; i < n; ++i)
+        {
+            // Left and right velocities
+            uL[i] = rhouL[i] / rhoL[i];
+            vL[i] = rhovL[i] / rhoL[i];
+            wL[i] = rhowL[i] / rhoL[i];
+            uR[i] = rhouR[i] / rhoR[i];
+            vR[i] = rhovR[i] / rhoR[i];
+            wR[i] = rhowR[i] / rhoR[i];
+
+            // Left and right pressures
+            pL[i] = (gamma - 1.0) * (EL[i] - 0.5 *
+                (rhouL[i] * uL[i] + rhovL[i] * vL[i] + rhowL[i] * wL[i]));
+            pR[i] = (gamma - 1.0) * (ER[i] - 0.5 *
+                (rhouR[i] * uR[i] + rhovR[i] * vR[i] + rhowR[i] * wR[i]));
+
+            // Left and right enthalpy
+            NekDouble hL = (EL[i] + pL[i]) / rhoL[i];
+            NekDouble hR = (ER[i] + pR[i]) / rhoR[i];
+
+            // Velocity, enthalpy and squared sound speed Roe averages
+            // (eq. 11.60).
+            NekDouble srLR = srL[i] + srR[i];
+            uRoe[i] = (srL[i] * uL[i] + srR[i] * uR[i]) / srLR;
+            vRoe[i] = (srL[i] * vL[i] + srR[i] * vR[i]) / srLR;
+            wRoe[i] = (srL[i] * wL[i] + srR[i] * wR[i]) / srLR;
+            hRoe[i] = (srL[i] * hL + srR[i] * hR) / srLR;
+            NekDouble URoe = uRoe[i] * uRoe[i] + vRoe[i] * vRoe[i] +
+                wRoe[i] * wRoe[i];
+            cRoe[i] = (gamma - 1.0) * (hRoe[i] - 0.5 * URoe);
+        }
+
+        Vmath::Vsqrt(n, cRoe, 1, cRoe, 1);
+
+        for (int i = 0; i < n; ++i)
+        {
+            NekDouble u = uRoe[i], v = vRoe[i], w = wRoe[i];
+            NekDouble h = hRoe[i], c = cRoe[i];
+            NekDouble URoe = u * u + v * v + w * w;
+
+            // Jumps (defined preceding equation 11.67).
+            NekDouble jump0 = rhoR[i]  - rhoL[i];
+            NekDouble jump1 = rhouR[i] - rhouL[i];
+            NekDouble jump2 = rhovR[i] - rhovL[i];
+            NekDouble jump3 = rhowR[i] - rhowL[i];
+            NekDouble jump4 = ER[i]    - EL[i];
+
+            // Define \Delta u_5 (equation 11.70).
+            NekDouble jumpbar = jump4 - (jump2 - v*jump0)*v -
+                (jump3 - w*jump0)*w;
+
+            // Wave amplitudes (equations 11.68, 11.69).
+            NekDouble alpha1 = (gamma-1.0)*(jump0*(h - u*u) +
+                                            u*jump1 - jumpbar)/(c*c);
+            NekDouble alpha0 = (jump0*(u + c) - jump1 - c*alpha1) / (2.0*c);
+            NekDouble alpha4 = jump0 - (alpha0 + alpha1);
+            NekDouble alpha2 = jump2 - v * jump0;
+            NekDouble alpha3 = jump3 - w * jump0;
+
+            // Wave strengths 0.5 * alpha_i * |lambda_i| (equation 11.58).
+            NekDouble uRoeAbs = fabs(u);
+            NekDouble s0 = 0.5*alpha0*fabs(u - c);
+            NekDouble s1 = 0.5*alpha1*uRoeAbs;
+            NekDouble s2 = 0.5*alpha2*uRoeAbs;
+            NekDouble s3 = 0.5*alpha3*uRoeAbs;
+            NekDouble s4 = 0.5*alpha4*fabs(u + c);
+
+            // Average of left and right fluxes minus the summation over
+            // the eigenvectors of equation 11.59 (equation 11.29).
+            rhof [i] = 0.5*(rhoL[i]*uL[i] + rhoR[i]*uR[i]) - (s0 + s1 + s4);
+            rhouf[i] = 0.5*(pL[i] + rhoL[i]*uL[i]*uL[i] +
+                            pR[i] + rhoR[i]*uR[i]*uR[i]) -
+                (s0*(u - c) + s1*u + s4*(u + c));
+            rhovf[i] = 0.5*(rhoL[i]*uL[i]*vL[i] + rhoR[i]*uR[i]*vR[i]) -
+                ((s0 + s1 + s4)*v + s2);
+            rhowf[i] = 0.5*(rhoL[i]*uL[i]*wL[i] + rhoR[i]*uR[i]*wR[i]) -
+                ((s0 + s1 + s4)*w + s3);
+            Ef   [i] = 0.5*(uL[i]*(EL[i] + pL[i]) + uR[i]*(ER[i] + pR[i])) -
+                (s0*(h - u*c) + s1*0.5*URoe + s2*v + s3*w + s4*(h + u*c));
+        }
+
+        for (int k = 0; k < 5; ++k)
+        {
+            Vmath::Vcopy(n, F[k], 1, flux[k], 1);
+        }
+    }
 }
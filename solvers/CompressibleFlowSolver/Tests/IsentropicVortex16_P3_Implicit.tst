@@ -0,0 +1,24 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Euler Isentropic Vortex P=3, implicit DIRK2 with JFNK</description>
+    <executable>CompressibleFlowSolver</executable>
+    <parameters>IsentropicVortex16_P3_Implicit.xml</parameters>
+    <files>
+        <file description="Session File">IsentropicVortex16_P3_Implicit.xml</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="rho" tolerance="1e-12">0.0119847</value>
+            <value variable="rhou" tolerance="1e-12">0.0236152</value>
+            <value variable="rhov" tolerance="1e-12">0.0252057</value>
+            <value variable="E" tolerance="1e-12">0.0640099</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="rho" tolerance="1e-12">0.0316711</value>
+            <value variable="rhou" tolerance="1e-12">0.0493121</value>
+            <value variable="rhov" tolerance="1e-12">0.0476247</value>
+            <value variable="E" tolerance="1e-12">0.135379</value>
+        </metric>
+    </metrics>
+</test>
+
@@ -109,6 +109,8 @@ namespace Nektar
 
         m_session->MatchSolverInfo("SmoothAdvection", "True",
                                     m_SmoothAdvection, false);
+        m_session->MatchSolverInfo("MultiRHSViscousSolve", "True",
+                                    m_multiRHSViscousSolve, false);
 
         // set explicit time-intregration class operators
         m_ode.DefineOdeRhs(
@@ -822,6 +824,39 @@ namespace Nektar
 
         AppendSVVFactors(factors,varFactorsMap);
 
+        // With equal diffusion coefficients all velocity components share
+        // the same Helmholtz operator, so they may be solved together.
+        bool sameDiffCoeff = m_multiRHSViscousSolve &&
+            m_nConvectiveFields > 1;
+        for(int i = 1; i < m_nConvectiveFields; ++i)
+        {
+            sameDiffCoeff = sameDiffCoeff &&
+                m_diffCoeff[i] == m_diffCoeff[0];
+        }
+
+        if(sameDiffCoeff)
+        {
+            Array<OneD, MultiRegions::ExpListSharedPtr>
+                fields(m_nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > coeffs(m_nConvectiveFields);
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                fields[i] = m_fields[i];
+                coeffs[i] = m_fields[i]->UpdateCoeffs();
+            }
+
+            factors[StdRegions::eFactorLambda] = 1.0/aii_Dt/m_diffCoeff[0];
+            m_fields[0]->HelmSolveMultiRHS(fields, Forcing, coeffs,
+                                           factors, varCoeffMap,
+                                           varFactorsMap);
+
+            for(int i = 0; i < m_nConvectiveFields; ++i)
+            {
+                m_fields[i]->BwdTrans(m_fields[i]->GetCoeffs(),outarray[i]);
+            }
+            return;
+        }
+
         // Solve Helmholtz system and put in Physical space
         for(int i = 0; i < m_nConvectiveFields; ++i)
         {
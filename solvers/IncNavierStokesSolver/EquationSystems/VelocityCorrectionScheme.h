@@ -128,6 +128,8 @@ namespace Nektar
         bool m_IsSVVPowerKernel;
         /// Diffusion coefficients (will be kinvis for velocities)
         Array<OneD, NekDouble> m_diffCoeff;
+        /// Solve the viscous systems of all velocity components together
+        bool m_multiRHSViscousSolve;
 
         /// Variable Coefficient map for the Laplacian which can be activated as part of SVV or otherwise
         StdRegions::VarCoeffMap m_varCoeffLap;